@@ -13,8 +13,50 @@ cbuffer LightBuffer : register(b0)
     float3 _pad0;
     LightPacked lights[64];
     row_major matrix lightViewProjs[64];
+    // NX^Pʂ̃Cg蓖(LightClusterBuilder)
+    uint clusterTilesX;
+    uint clusterTilesY;
+    uint clusterSlicesZ;
+    uint clusterEnabled; // 0: SCg
+    float2 clusterScreenSize;
+    float clusterSliceScale;
+    float clusterSliceBias;
+    float4 clusterViewDepth; // r[Ԃz = dot(float4(worldPos, 1), clusterViewDepth)
+    float clusterNearSliceDepth;
+    float3 _pad1;
 };
 
+// NX^Ƃ̊蓖: x = clusterLightIndices̐擪, y = 
+StructuredBuffer<uint2> clusterRanges : register(t1);
+StructuredBuffer<uint> clusterLightIndices : register(t2);
+
+// sNZNX^̃Cg͈̔(LightClusterBuilder::FindClusterƓIѕ)
+uint2 GetClusterLightRange(float2 _pixelPos, float3 _worldPos)
+{
+    if (clusterEnabled == 0)
+    {
+        return uint2(0, lightCount);
+    }
+
+    uint2 tile = (uint2) clamp(floor(_pixelPos / clusterScreenSize * float2(clusterTilesX, clusterTilesY)),
+        float2(0, 0), float2(clusterTilesX - 1, clusterTilesY - 1));
+
+    float viewZ = dot(float4(_worldPos, 1.0f), clusterViewDepth);
+    uint slice = 0;
+    if (viewZ >= clusterNearSliceDepth)
+    {
+        slice = min((uint) (1.0f + floor(log(viewZ) * clusterSliceScale + clusterSliceBias)), clusterSlicesZ - 1);
+    }
+
+    return clusterRanges[(slice * clusterTilesY + tile.y) * clusterTilesX + tile.x];
+}
+
+// ͈͂nԖڂ̃Cg
+int GetClusterLightIndex(uint2 _range, uint _n)
+{
+    return (clusterEnabled == 0) ? (int) _n : (int) clusterLightIndices[_range.x + _n];
+}
+
 
 float Lambert(float3 _n, float3 _l)
 {
@@ -51,8 +51,12 @@ float4 PSMain(PSIN _pin) : SV_Target
     
     float3 color = float3(0.0f, 0.0f, 0.0f);
     float totalLight = 0.0f;
-    for (int i = 0; i < lightCount; ++i)
+    // ̃sNZ̃NX^ɓ͂Cg
+    uint2 clusterRange = GetClusterLightRange(_pin.pos.xy, _pin.worldPos);
+    for (uint n = 0; n < clusterRange.y; ++n)
     {
+        int i = GetClusterLightIndex(clusterRange, n);
+        
         // CeBOvZ
         float li = ComputeLight(lights[i], N, _pin.worldPos);
         
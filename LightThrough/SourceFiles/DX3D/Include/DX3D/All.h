@@ -8,4 +8,5 @@
  */
 
  /*---------- CN[h ----------*/
-#include <DX3D/Game/Game.h>
\ No newline at end of file
+#include <DX3D/Game/Game.h>
+#include <DX3D/Game/HeadlessGame.h>
\ No newline at end of file
@@ -9,7 +9,6 @@
 #include <vector>
 #include <string>
 #include <DirectXMath.h>
-#include <d3d11.h>
 #include <DX3D/Core/Core.h>
 #include <DX3D/Core/Logger.h>
 #include <DX3D/Math/Rect.h>
@@ -70,6 +69,7 @@ namespace dx3d {
 		const void* vertexList{};
 		uint32_t vertexListSize{};
 		uint32_t vertexSize{};
+		bool dynamic{};	// true: CPU疈t[(vertexList͖Ă悢)
 	};
 
 	struct ConstantBufferDesc {
@@ -93,9 +93,29 @@ namespace dx3d {
 		uint32_t elementCount{};
 	};
 
+	/**
+	 * @brief e̎s@
+	 */
+	enum class ShadowTestBackend : uint8_t {
+		Gpu,	// CS_ShadowTestDispatchēǂݖ߂
+		Cpu,	// CPUŐ[x`Ĕ肷(GPUȂł)
+	};
+
 	struct GameDesc {
 		Rect windowSize{ 1280, 720 };
 		Logger::LogLevel logLevel = Logger::LogLevel::Error;
+		ShadowTestBackend shadowTestBackend = ShadowTestBackend::Gpu;
+	};
+
+	/**
+	 * @brief wbhXs(EBhE /  / GPUȂ)̐ݒ
+	 */
+	struct HeadlessGameDesc {
+		Logger::LogLevel logLevel = Logger::LogLevel::Error;
+		std::string scene = "TestScene";	// ǂݍރV[
+		uint32_t frames = 600;				// 񂷃t[
+		float fixedTimeStep = 1.0f / 60.0f;	// 1t[dt(ŒXVƍXV̗Ɏg)
+		std::string reportPath = "DebugLog/HeadlessReport.txt";	// SystemƂ̎Ԃ̏o
 	};
 }
 
@@ -106,6 +126,8 @@ namespace scene {
 namespace dx3d {
 	class MeshRegistry;
 	class TextureRegistry;
+	class JobSystem;
+	class IGraphicsBackend;
 }
 
 namespace ecs {
@@ -115,9 +137,12 @@ namespace ecs {
 		dx3d::BaseDesc base;
 		Coordinator& ecs; // Coordinatorւ̎Q
 		scene::SceneManager& sceneManager; // SceneManagerւ̎Q
-		dx3d::GraphicsEngine& graphicsEngine;
+		dx3d::IGraphicsBackend& graphicsBackend; // `obNGh(wbhXłNull)
 		dx3d::MeshRegistry& meshRegistry; // bVWXgւ̎Q
-		dx3d::TextureRegistry& textureRegistry; // eNX`WXgւ̎Q
+		dx3d::JobSystem& jobSystem; // WuVXeւ̎Q
+		dx3d::GraphicsEngine* graphicsEngine = nullptr; // `nSystemg(wbhXłnullptr)
+		dx3d::TextureRegistry* textureRegistry = nullptr; // eNX`WXg(wbhXłnullptr)
 		bool oneShot = false; // xsVXe
+		dx3d::ShadowTestBackend shadowTestBackend = dx3d::ShadowTestBackend::Gpu; // e̎s@
 	};
 }
\ No newline at end of file
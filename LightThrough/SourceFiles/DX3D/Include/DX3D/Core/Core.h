@@ -30,6 +30,7 @@ namespace dx3d {
 	class InputLayout;
 	class Texture;
 	class PipelineCache;
+	class JobSystem;
 
 	using SwapChainPtr = std::shared_ptr<SwapChain>;
 	using DeviceContextPtr = std::shared_ptr<DeviceContext>;
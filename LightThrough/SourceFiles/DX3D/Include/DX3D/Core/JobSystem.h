@@ -0,0 +1,125 @@
+#pragma once
+/**
+ * @file JobSystem.h
+ * @brief [NXeB[ÕWuVXe
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <cstdint>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace dx3d {
+	/**
+	 * @brief WuJE^(tFX)
+	 *
+	 * RunɓnƖ̃Wu𐔂BWait0ɂȂ܂ő҂B
+	 * WuO𓊂ꍇ͍ŏ̈aAWaitœB
+	 */
+	class JobCounter {
+	public:
+		uint32_t Get() const { return value_.load(std::memory_order_acquire); }
+		bool IsDone() const { return Get() == 0; }
+
+	private:
+		friend class JobSystem;
+		std::atomic<uint32_t> value_{ 0 };
+		std::mutex error_mutex_{};
+		std::exception_ptr error_{};	// Wuŏ̗O
+	};
+
+	/**
+	 * @brief WuVXe
+	 *
+	 * Œ萔̃[J[ꂼꎩ̃L[AɂȂ瑼̃L[̐擪瓐ށB
+	 * [J[ȊÕXbh(CXbh)ς񂾃Wu͋L̃L[ɓB
+	 * WaitĂ񂾃XbhI܂ŃWu`B
+	 */
+	class JobSystem final {
+	public:
+		using JobFunc = std::function<void()>;
+
+		explicit JobSystem(uint32_t _workerCount = 0);	// 0: RA - 1
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/**
+		 * @brief Wuς
+		 * @param _job s鏈
+		 * @param _counter 𐔂JE^(svȂnullptr)
+		 */
+		void Run(JobFunc _job, JobCounter* _counter = nullptr);
+
+		/**
+		 * @brief JE^0ɂȂ܂ő҂i҂ĂԂWusj
+		 *	WuO𓊂ĂASIĂ瓊
+		 * @param _counter ҂JE^
+		 */
+		void Wait(JobCounter& _counter);
+
+		/**
+		 * @brief ͈͂𕪊ĕɏ
+		 *	ĂяoXbhڂ̋ԂASI܂Ŗ߂Ȃ(OoĂ)
+		 * @param _begin JnIndex
+		 * @param _end IIndex(܂܂Ȃ)
+		 * @param _grainSize 1Wu̗vf(0Ȃ玩)
+		 * @param _func (uint32_t begin, uint32_t end)
+		 */
+		template<typename Func>
+		void ParallelFor(uint32_t _begin, uint32_t _end, uint32_t _grainSize, Func&& _func);
+
+		uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+		uint32_t GetThreadCount() const { return GetWorkerCount() + 1; }	// CXbh
+
+		/**
+		 * @brief ̃XbhIndex
+		 * @return 0: [J[ȊO, 1 ~ : [J[
+		 */
+		static uint32_t GetCurrentThreadIndex();
+
+	private:
+		/**
+		 * @brief Wu
+		 */
+		struct Job {
+			JobFunc func{};
+			JobCounter* counter = nullptr;
+		};
+
+		/**
+		 * @brief XbhƂ̃L[
+		 *	͌납Aޑ͑O
+		 */
+		struct WorkQueue {
+			std::mutex mutex{};
+			std::deque<Job> jobs{};
+		};
+
+		bool TryPop(uint32_t _queue, Job& _out);		// ̃L[
+		bool TrySteal(uint32_t _thief, Job& _out);		// ̃L[瓐
+		bool TryRunOne(uint32_t _queue);				// s
+		void Execute(Job& _job);
+		void WorkerLoop(uint32_t _index);
+
+	private:
+		std::vector<std::unique_ptr<WorkQueue>> queues_{};	// [0]: [J[ȊO, [1 ~]: [J[
+		std::vector<std::thread> workers_{};
+		std::atomic<uint32_t> pending_{ 0 };	// L[ɐς܂ĂWu
+		std::atomic<bool> stop_{ false };
+		std::mutex sleep_mutex_{};
+		std::condition_variable sleep_cv_{};
+	};
+}
+
+#include <DX3D/Core/JobSystem.inl>
@@ -0,0 +1,58 @@
+#pragma once
+/**
+ * @file JobSystem.inl
+ * @brief WuVXẽev[g֐̒`
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <algorithm>
+#include <DX3D/Core/JobSystem.h>
+
+namespace dx3d {
+	/**
+	 * @brief ͈͂𕪊ĕɏ
+	 * @param _begin JnIndex
+	 * @param _end IIndex(܂܂Ȃ)
+	 * @param _grainSize 1Wu̗vf(0Ȃ玩)
+	 * @param _func (uint32_t begin, uint32_t end)
+	 */
+	template<typename Func>
+	void JobSystem::ParallelFor(uint32_t _begin, uint32_t _end, uint32_t _grainSize, Func&& _func)
+	{
+		if (_end <= _begin) { return; }
+		const uint32_t count = _end - _begin;
+
+		// Ȃ1Xbh4炢BԂ͍Ȃ
+		constexpr uint32_t MIN_GRAIN = 64;
+		uint32_t grain = _grainSize;
+		if (grain == 0) {
+			const uint32_t parts = GetThreadCount() * 4;
+			grain = (std::max)((count + parts - 1) / parts, MIN_GRAIN);
+		}
+
+		// ӖȂȂ炻̂܂
+		if (workers_.empty() || count <= grain) {
+			_func(_begin, _end);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t b = _begin + grain; b < _end; b += grain) {
+			const uint32_t e = (std::min)(b + grain, _end);
+			Run([&_func, b, e]() { _func(b, e); }, &counter);
+		}
+		// ڂ̋Ԃ͎ŏ
+		// (œĂAς񂾃Wucounter_funcQƂI܂ł͔Ȃ)
+		try {
+			_func(_begin, (std::min)(_begin + grain, _end));
+		}
+		catch (...) {
+			try { Wait(counter); }
+			catch (...) {}	// ɏo̗OD悷
+			throw;
+		}
+		Wait(counter);
+	}
+}
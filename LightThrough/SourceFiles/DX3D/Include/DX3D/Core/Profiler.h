@@ -0,0 +1,122 @@
+#pragma once
+/**
+ * @file Profiler.h
+ * @brief XR[vPʂ̋Ԍv(t[vt@C)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dx3d {
+	/**
+	 * @brief vԈ
+	 */
+	struct ProfileEvent {
+		const char* name = nullptr;	// Ԗ(񃊃eȂǁAƐĂ镶)
+		uint64_t startNs = 0;		// vJn̎
+		uint64_t endNs = 0;
+		uint16_t thread = 0;		// Profiler::GetThreadName Index
+		uint16_t depth = 0;			// q̐[(0ԊO)
+	};
+
+	/**
+	 * @brief 1t[̌v
+	 */
+	struct ProfileFrame {
+		uint64_t frameIndex = 0;
+		uint64_t startNs = 0;
+		uint64_t endNs = 0;
+		std::vector<ProfileEvent> events{};
+	};
+
+	/**
+	 * @brief t[vt@C
+	 *
+	 * Ԃ̓XbhƂ̃Oobt@ɏ(͎̂̃XbhȂ̂ŃbN͖)B
+	 * NextFrameŃCXbhSXbh̃OAt[̗ɐςށB
+	 * ǂɏ㏑ꂽԂ͎̂ĂāAB
+	 * Lv`͉Ԃ߂ĂAwt[܂Chromẽg[X`(JSON)ŏoB
+	 */
+	class Profiler final {
+	public:
+		static constexpr uint32_t RING_SIZE = 1u << 14;	// XbhƂ̃Ȏ傫(2ׂ̂)
+		static constexpr uint32_t HISTORY_FRAMES = 120;	// cĂt[
+
+		Profiler() = delete;
+
+		static void SetEnabled(bool _enabled);	// vOn/Off(Off̊Ԃ͋ԂȂ)
+		static bool IsEnabled();
+
+		/**
+		 * @brief Ԃ
+		 *	iProfileScope(DX3D_PROFILE_SCOPE)Ă
+		 */
+		static void Record(const char* _name, uint64_t _startNs, uint64_t _endNs, uint32_t _depth);
+		static uint64_t NowNs();	// vJn̎
+
+		/**
+		 * @brief t[̋؂(CXbhĂ)
+		 *	SXbh̋ԂėɐςށBLv`I珑o
+		 */
+		static void NextFrame();
+
+		/**
+		 * @brief Lv`̊Jn
+		 * @param _frames Lv`t[
+		 * @param _path o(Chromẽg[X`)
+		 */
+		static void StartCapture(uint32_t _frames, const std::string& _path);
+		static bool IsCapturing();
+		static uint32_t GetCaptureRemaining();
+
+		/**
+		 * @brief ԂChromẽg[X`(chrome://tracing, Perfetto)ŏo
+		 * @param _frames ot[
+		 * @param _path o
+		 * @return : true
+		 */
+		static bool ExportChromeTrace(const std::vector<ProfileFrame>& _frames, const std::string& _path);
+
+		/**
+		 * @brief ̃t[擾(CXbh)
+		 * @param _back 0: , 1: O ...
+		 * @return nullptr
+		 */
+		static const ProfileFrame* GetFrame(uint32_t _back = 0);
+		static uint32_t GetFrameCount();	// ɂt[
+
+		static void SetCurrentThreadName(const std::string& _name);	// ̃Xbh̕\(: Worker N / Thread N)
+		static uint32_t GetThreadCount();
+		static std::string GetThreadName(uint32_t _thread);
+		static uint64_t GetDroppedCount();	// OӂĎ̂ĂԂ̐(݌v)
+	};
+
+	/**
+	 * @brief XR[v̊Ԃv
+	 */
+	class ProfileScope final {
+	public:
+		explicit ProfileScope(const char* _name);
+		~ProfileScope();
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* name_ = nullptr;	// nullptr: vȂ
+		uint64_t start_ns_ = 0;
+		uint32_t depth_ = 0;
+	};
+}
+
+#define DX3D_PROFILE_CONCAT_INNER(a, b) a##b
+#define DX3D_PROFILE_CONCAT(a, b) DX3D_PROFILE_CONCAT_INNER(a, b)
+/**
+ * @brief XR[v̏I܂łv
+ * : DX3D_PROFILE_SCOPE("FlushPending");
+ */
+#define DX3D_PROFILE_SCOPE(name) ::dx3d::ProfileScope DX3D_PROFILE_CONCAT(profile_scope_, __LINE__)(name)
@@ -55,6 +55,7 @@ namespace dx3d {
 		std::unique_ptr<Display> display_{};
 		bool is_running_ = true;
 
+		std::unique_ptr<JobSystem> job_system_{};	// WuVXe(CoordinatorɔjȂ悤ɑOɒu)
 		std::unique_ptr<ecs::Coordinator> ecs_coordinator_{};	// ECS̃R[fBl[^[
 		std::unique_ptr<scene::SceneManager> scene_manager_{};
 		std::chrono::high_resolution_clock::time_point last_time_{};	// ԊǗp
@@ -0,0 +1,41 @@
+#pragma once
+/**
+ * @file GameSystems.h
+ * @brief Q[Component / System̓o^(EBhEGameƃwbhXsŋL)
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <functional>
+#include <DX3D/Core/Common.h>
+
+namespace ecs {
+	class Coordinator;
+}
+
+namespace dx3d {
+	/**
+	 * @brief `nSystemނƂ
+	 *	GPUɐGSystem(IRenderSystem)͂炾o^BwbhXsł͑Ŝ܂
+	 */
+	struct GameSystemHooks {
+		std::function<void(ecs::SystemDesc&)> resolve{};	// ֌W̍Ō(eNX`̉Ȃ)
+		std::function<void(ecs::SystemDesc&)> shadowPass{};	// e𗎂Ƃ`I񂾌AȇO(Cg[x)
+		std::function<void(ecs::SystemDesc&)> render{};		// J̌(`)
+	};
+
+	/**
+	 * @brief R|[lg̓o^
+	 * @param _ecs ECS̃R[fBl[^[
+	 */
+	void RegisterGameComponents(ecs::Coordinator& _ecs);
+
+	/**
+	 * @brief VXe̓o^Ə
+	 *	o^XV(錾ANZXȂ̓m͕)BŌɑSSystem
+	 * @param _systemDesc System̐
+	 * @param _hooks `nSystem̓o^
+	 */
+	void RegisterGameSystems(ecs::SystemDesc& _systemDesc, const GameSystemHooks& _hooks);
+}
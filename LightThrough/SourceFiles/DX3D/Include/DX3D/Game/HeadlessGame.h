@@ -0,0 +1,48 @@
+#pragma once
+/**
+ * @file HeadlessGame.h
+ * @brief EBhE /  / GPUȂŃQ[System
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <memory>
+#include <DX3D/Core/Base.h>
+#include <Game/ECS/Coordinator.h>
+#include <Game/Scene/SceneManager.h>
+
+
+namespace dx3d {
+	class NullGraphicsBackend;
+	class MeshRegistry;
+
+	/**
+	 * @brief wbhXs
+	 *
+	 * Null̕`obNGhCPUMeshŃV[ǂݍ݁AŒdtframest[񂷁B
+	 * `nSystem(IRenderSystem)͓o^Ȃ̂ŁAD3D11ȂŃrhł(Linux̃rht@[œp)B
+	 * SystemƂ̎Ԃƕ`obNGh̋L^reportPathɏoB
+	 */
+	class HeadlessGame : public Base {
+	public:
+		explicit HeadlessGame(const HeadlessGameDesc& _desc);
+		virtual ~HeadlessGame() override;
+
+		/**
+		 * @brief framest[񂵂ă|[go
+		 * @return 񂵂t[
+		 */
+		uint32_t Run();
+
+	private:
+		std::unique_ptr<Logger> logger_ptr_{};
+		HeadlessGameDesc desc_{};
+
+		std::unique_ptr<NullGraphicsBackend> backend_{};
+		std::unique_ptr<MeshRegistry> mesh_registry_{};
+		std::unique_ptr<JobSystem> job_system_{};	// WuVXe(CoordinatorɔjȂ悤ɑOɒu)
+		std::unique_ptr<ecs::Coordinator> ecs_coordinator_{};	// ECS̃R[fBl[^[
+		std::unique_ptr<scene::SceneManager> scene_manager_{};
+	};
+}
@@ -0,0 +1,59 @@
+#pragma once
+/**
+ * @file BoxContact.h
+ * @brief m̐ڐG_̐(ʂ̃NbsO)
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <Game/Collisions/ContactManifold.h>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief ڐG_̐Ɏg
+		 */
+		struct ContactBox {
+			float center[3]{};
+			float axis[3][3]{ { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };	// Kς
+			float half[3]{};
+		};
+
+		/**
+		 * @brief m̐ڐG_𐶐
+		 *
+		 * SATőI΂ꂽ(_feature)ڐG̎d߂B
+		 * - ʂ̎: ̖ʂʁÄԌʂ˖ʂɂāA˖ʂʂ̎lӂŃNbsO(Sutherland-Hodgman)B
+		 *   ʂɎc_ڐG_B_maxPoints葽΁A[_ƍLőIђ
+		 * - ӓm̎: ̕ӂ̍ŋߐړ_Ԃ
+		 * ڐG_͓̔̒(ˑ̓_Ɗʂ̊)ɒuB
+		 *
+		 * @param _a / _b 
+		 * @param _normal ABւ̖@(Kς)
+		 * @param _penetration SAT̊ђʗ(ӓm̎Ɏg)
+		 * @param _feature SAT̎̔ԍ(IntersectOBBContactResult::feature)
+		 * @param _out ڐG_(featureId _feature Ɩ / _̔ԍ)
+		 * @param _maxPoints ڐG_̏(MAX_MANIFOLD_POINTS܂)
+		 * @return ڐG_̐(l덷ŉcȂ0)
+		 */
+		uint32_t GenerateBoxContacts(
+			const ContactBox& _a, const ContactBox& _b,
+			const float* _normal, float _penetration, uint32_t _feature,
+			ContactPointInput* _out, uint32_t _maxPoints = MAX_MANIFOLD_POINTS);
+
+		/**
+		 * @brief ڐG_܂Ō炷
+		 *	Ԑ[_  ԉ_  _̐痼Ɉԗꂽ_ȀɑI(ʐς傫c)
+		 * @param _points ڐG_(擪ɑI񂾓_l߂)
+		 * @param _count ڐG_̐
+		 * @param _normal @(_̍E̔Ɏg)
+		 * @param _maxPoints 
+		 * @return 炵̐
+		 */
+		uint32_t ReduceContactPoints(ContactPointInput* _points, uint32_t _count, const float* _normal, uint32_t _maxPoints);
+	}
+}
@@ -0,0 +1,152 @@
+#pragma once
+/**
+ * @file BroadPhase.h
+ * @brief u[htF[ỸC^[tF[X
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	namespace collision {
+		using ProxyId = int32_t;
+		constexpr ProxyId NULL_PROXY = -1;
+
+		/**
+		 * @brief sE{bNX
+		 */
+		struct AABB {
+			float min[3]{};
+			float max[3]{};
+
+			//! @brief dȂĂ邩
+			bool Overlaps(const AABB& _other) const
+			{
+				for (int i = 0; i < 3; ++i) {
+					if (max[i] < _other.min[i] || _other.max[i] < min[i]) { return false; }
+				}
+				return true;
+			}
+
+			//! @brief SɓɊ܂ނ
+			bool Contains(const AABB& _other) const
+			{
+				for (int i = 0; i < 3; ++i) {
+					if (_other.min[i] < min[i] || max[i] < _other.max[i]) { return false; }
+				}
+				return true;
+			}
+
+			//! @brief \ʐ(}̃RXgvZp)
+			float SurfaceArea() const
+			{
+				const float dx = max[0] - min[0];
+				const float dy = max[1] - min[1];
+				const float dz = max[2] - min[2];
+				return 2.0f * (dx * dy + dy * dz + dz * dx);
+			}
+
+			//! @brief ͂AABB
+			static AABB Union(const AABB& _a, const AABB& _b)
+			{
+				AABB out;
+				for (int i = 0; i < 3; ++i) {
+					out.min[i] = (std::min)(_a.min[i], _b.min[i]);
+					out.max[i] = (std::max)(_a.max[i], _b.max[i]);
+				}
+				return out;
+			}
+		};
+
+		/**
+		 * @brief dȂĂyA
+		 *	userA / userB ̓vLV쐬ɓnlB(proxyA < proxyB)
+		 */
+		struct BroadPhasePair {
+			ProxyId proxyA = NULL_PROXY;
+			ProxyId proxyB = NULL_PROXY;
+			uint64_t userA = 0;
+			uint64_t userB = 0;
+
+			// vLVIDg񂳂Ăʂ̃yAƂĈ悤ɁAuserr
+			bool operator<(const BroadPhasePair& _other) const
+			{
+				if (proxyA != _other.proxyA) { return proxyA < _other.proxyA; }
+				if (proxyB != _other.proxyB) { return proxyB < _other.proxyB; }
+				if (userA != _other.userA) { return userA < _other.userA; }
+				return userB < _other.userB;
+			}
+			bool operator==(const BroadPhasePair& _other) const
+			{
+				return proxyA == _other.proxyA && proxyB == _other.proxyB && userA == _other.userA && userB == _other.userB;
+			}
+		};
+
+		/**
+		 * @brief \[gς݂̃yAꗗ̍
+		 * @param _prev Öꗗ(\[gς)
+		 * @param _next ̈ꗗ(\[gς)
+		 * @param _added yA̒ǉ
+		 * @param _removed yA̒ǉ
+		 */
+		inline void DiffPairs(const std::vector<BroadPhasePair>& _prev, const std::vector<BroadPhasePair>& _next,
+			std::vector<BroadPhasePair>& _added, std::vector<BroadPhasePair>& _removed)
+		{
+			std::set_difference(_next.begin(), _next.end(), _prev.begin(), _prev.end(), std::back_inserter(_added));
+			std::set_difference(_prev.begin(), _prev.end(), _next.begin(), _next.end(), std::back_inserter(_removed));
+		}
+
+		/**
+		 * @brief u[htF[ỸC^[tF[X
+		 *
+		 * vLV(AABB)o^ / ړ / 폜AUpdatePairsŏdȂĂyAXVB
+		 * yÄꗗ͍ōXVAO񂩂瑝 / ̂ʂɕԂB
+		 */
+		class IBroadPhase {
+		public:
+			virtual ~IBroadPhase() = default;
+
+			/**
+			 * @brief vLV̍쐬
+			 * @param _aabb `AABB
+			 * @param _userData l(EntityȂ)
+			 * @return vLVID
+			 */
+			virtual ProxyId CreateProxy(const AABB& _aabb, uint64_t _userData) = 0;
+			/**
+			 * @brief vLV̍폜
+			 *	ւĂyA͎UpdatePairsŁuyAvƂĕԂ
+			 * @param _proxy vLVID
+			 */
+			virtual void DestroyProxy(ProxyId _proxy) = 0;
+			/**
+			 * @brief vLV̈ړ
+			 * @param _proxy vLVID
+			 * @param _aabb ړ̌`AABB
+			 * @return true: \ς(yA̍ČvZΏۂɂȂ)
+			 */
+			virtual bool MoveProxy(ProxyId _proxy, const AABB& _aabb) = 0;
+
+			/**
+			 * @brief dȂĂyA̍XV
+			 * @param _added O񂩂瑝yA
+			 * @param _removed O񂩂猸yA
+			 */
+			virtual void UpdatePairs(std::vector<BroadPhasePair>& _added, std::vector<BroadPhasePair>& _removed) = 0;
+			//! @brief dȂĂyÄꗗ(vLVID̏)
+			virtual const std::vector<BroadPhasePair>& GetPairs() const = 0;
+
+			virtual uint64_t GetUserData(ProxyId _proxy) const = 0;
+			virtual const AABB& GetFatAABB(ProxyId _proxy) const = 0;	// ɎgĂ(]T)AABB
+			virtual std::size_t GetProxyCount() const = 0;
+		};
+	}
+}
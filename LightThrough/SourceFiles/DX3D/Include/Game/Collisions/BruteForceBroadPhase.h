@@ -0,0 +1,49 @@
+#pragma once
+/**
+ * @file BruteForceBroadPhase.h
+ * @brief SyA𒲂ׂu[htF[Y(rp)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+#include <Game/Collisions/BroadPhase.h>
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief SyA𒲂ׂu[htF[Y
+		 *
+		 * ȑȎƓ O(n^2) ̂B
+		 * DynamicAABBTreě / x̔rƁA؂蕪̂߂̍ւpB
+		 */
+		class BruteForceBroadPhase final : public IBroadPhase {
+		public:
+			ProxyId CreateProxy(const AABB& _aabb, uint64_t _userData) override;
+			void DestroyProxy(ProxyId _proxy) override;
+			bool MoveProxy(ProxyId _proxy, const AABB& _aabb) override;
+
+			void UpdatePairs(std::vector<BroadPhasePair>& _added, std::vector<BroadPhasePair>& _removed) override;
+			const std::vector<BroadPhasePair>& GetPairs() const override { return pairs_; }
+
+			uint64_t GetUserData(ProxyId _proxy) const override { return proxies_[_proxy].userData; }
+			const AABB& GetFatAABB(ProxyId _proxy) const override { return proxies_[_proxy].aabb; }
+			std::size_t GetProxyCount() const override { return proxy_count_; }
+
+		private:
+			struct Proxy {
+				AABB aabb{};
+				uint64_t userData = 0;
+				bool alive = false;
+			};
+
+			std::vector<Proxy> proxies_{};
+			std::vector<ProxyId> free_list_{};
+			std::size_t proxy_count_ = 0;
+			std::vector<BroadPhasePair> pairs_{};	// dȂĂyA(\[gς)
+			std::vector<BroadPhasePair> next_{};	// Ɨp
+		};
+	}
+}
@@ -5,6 +5,7 @@
  */
 
  // ---------- CN[h ---------- //
+#include <cfloat>
 #include <cmath>
 #include <algorithm>
 #include <optional>
@@ -12,6 +13,8 @@
 #include <DirectXMath.h>
 #include <DX3D/Math/MathUtils.h>
 #include <Game/Serialization/ComponentReflection.h>
+#include <Game/Collisions/BoxContact.h>
+#include <Game/Collisions/NarrowPhaseBatch.h>
 
 namespace dx3d {
 	namespace collision {
@@ -60,8 +63,34 @@ namespace dx3d {
 			XMFLOAT3 normal{};       // ABւ̖@iA->Bj
 			float penetration{};     // Փː[x
 			XMFLOAT3 contactPoint{}; // ߎڐG_iSATRj
+			uint32_t feature{};      // ڐG̓̔ԍiXebv܂œڐGj
 		};
 
+		// ---------- p̌`ւ̕ϊ ---------- //
+		//! @brief ContactBox(float[3]ł̔)ɕϊ
+		inline ContactBox ToContactBox(const WorldOBB& _obb)
+		{
+			ContactBox box{};
+			box.center[0] = _obb.center.x; box.center[1] = _obb.center.y; box.center[2] = _obb.center.z;
+			for (int i = 0; i < 3; ++i) {
+				box.axis[i][0] = _obb.axis[i].x; box.axis[i][1] = _obb.axis[i].y; box.axis[i][2] = _obb.axis[i].z;
+			}
+			box.half[0] = _obb.half.x; box.half[1] = _obb.half.y; box.half[2] = _obb.half.z;
+			return box;
+		}
+
+		//! @brief NarrowPhaseBatcȟʂContactResultɖ߂(ĂȂnullopt)
+		inline std::optional<ContactResult> ToContactResult(const NarrowPhaseResult& _result)
+		{
+			if (!_result.hit) { return std::nullopt; }
+			return ContactResult{
+				{ _result.normal[0], _result.normal[1], _result.normal[2] },
+				_result.penetration,
+				{ _result.contactPoint[0], _result.contactPoint[1], _result.contactPoint[2] },
+				_result.feature
+			};
+		}
+
 		/**
 		 * @brief xNg̓evZ
 		 */
@@ -149,9 +178,10 @@ namespace dx3d {
 			XMFLOAT3 T = math::Sub(_obbB.center, _obbA.center);
 
 			XMFLOAT3 axes[15]{};
+			uint32_t axisIds[15]{};	// 0`2: A̖, 3`5: B̖, 6`14: ӓm
 			int axisCount = 0;
-			for (int i = 0; i < 3; ++i) axes[axisCount++] = _obbA.axis[i];
-			for (int i = 0; i < 3; ++i) axes[axisCount++] = _obbB.axis[i];
+			for (int i = 0; i < 3; ++i) { axisIds[axisCount] = i; axes[axisCount++] = _obbA.axis[i]; }
+			for (int i = 0; i < 3; ++i) { axisIds[axisCount] = 3 + i; axes[axisCount++] = _obbB.axis[i]; }
 
 			for (int i = 0; i < 3; ++i) {
 				for (int j = 0; j < 3; ++j) {
@@ -159,6 +189,7 @@ namespace dx3d {
 					float len2 = math::Dot(cr, cr);
 					if (len2 > EPS) {
 						float inv = 1.0f / std::sqrt(len2);
+						axisIds[axisCount] = 6 + i * 3 + j;
 						axes[axisCount++] = math::Scale(cr, inv);
 					}
 				}
@@ -166,6 +197,7 @@ namespace dx3d {
 
 			float minPenetration = FLT_MAX;
 			XMFLOAT3 bestAxis{};
+			uint32_t bestFeature = 0;
 
 			for (int i = 0; i < axisCount; ++i) {
 				const auto& axis = axes[i];
@@ -183,10 +215,12 @@ namespace dx3d {
 				if (overlap < minPenetration) {
 					minPenetration = overlap;
 					bestAxis = axis;
+					bestFeature = axisIds[i] * 2;
 					if (math::Dot(axis, T) < 0.0f) {
 						bestAxis.x *= -1.0f;
 						bestAxis.y *= -1.0f;
 						bestAxis.z *= -1.0f;
+						bestFeature += 1;	// ʂ
 					}
 				}
 			}
@@ -226,7 +260,22 @@ namespace dx3d {
 				(closestOnA.z + closestOnB.z) * 0.5f
 			};
 
-			return ContactResult{ bestAxis, minPenetration, contactPoint };
+			return ContactResult{ bestAxis, minPenetration, contactPoint, bestFeature };
+		}
+
+		/**
+		 * @brief OBBm̐ڐG_𐶐(ő_maxPoints)
+		 *	IntersectOBBőI΂ꂽ / ˖ʂ߂ăNbsO(GenerateBoxContacts)
+		 * @param _contact IntersectOBB(_obbA, _obbB)̌
+		 * @return ڐG_̐
+		 */
+		inline uint32_t GenerateOBBContactPoints(
+			const WorldOBB& _obbA, const WorldOBB& _obbB,
+			const ContactResult& _contact,
+			ContactPointInput* _out, uint32_t _maxPoints = MAX_MANIFOLD_POINTS)
+		{
+			const float n[3] = { _contact.normal.x, _contact.normal.y, _contact.normal.z };
+			return GenerateBoxContacts(ToContactBox(_obbA), ToContactBox(_obbB), n, _contact.penetration, _contact.feature, _out, _maxPoints);
 		}
 
 
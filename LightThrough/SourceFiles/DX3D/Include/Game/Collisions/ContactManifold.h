@@ -0,0 +1,118 @@
+#pragma once
+/**
+ * @file ContactManifold.h
+ * @brief Xebv܂ŕێڐG}jtH[h
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	namespace collision {
+		constexpr uint32_t MAX_MANIFOLD_POINTS = 4;
+
+		/**
+		 * @brief i[tF[YnڐG_
+		 *	featureId́uǂ̖ /  / _m̐ڐGv\ԍBԍ̓_͎̃Xebvł_ƂĈ
+		 */
+		struct ContactPointInput {
+			float position[3]{};	// [h̐ڐG_
+			float penetration = 0.0f;
+			uint32_t featureId = 0;
+		};
+
+		/**
+		 * @brief }jtH[h̐ڐG_
+		 */
+		struct ManifoldPoint {
+			float position[3]{};
+			float penetration = 0.0f;
+			uint32_t featureId = 0;
+
+			// ݐσCpX(̃XebṽEH[X^[gɎg)
+			float normalImpulse = 0.0f;
+			float tangentImpulse[2]{};
+
+			// \o[̍Ɨp(PreStepŌvZ)
+			float normalMass = 0.0f;
+			float tangentMass = 0.0f;
+			float velocityBias = 0.0f;
+		};
+
+		/**
+		 * @brief ڐG}jtH[h
+		 *	̂̊̕Ԃ̐ڐG_(őMAX_MANIFOLD_POINTS)ƁA@ / CȂǂ̑gݍ킹̒l
+		 */
+		struct ContactManifold {
+			uint64_t key = 0;			// yÃL[(ContactManifoldCache::MakeKey)
+			uint64_t userA = 0;			// @̍
+			uint64_t userB = 0;			// @̐摤
+			uint32_t bodyA = 0;			// \o[̂̔̕ԍ(XebvĂяoݒ肷)
+			uint32_t bodyB = 0;
+			float normal[3]{};			// ABւ̖@(Kς)
+			float tangent[2][3]{};		// C̕(PreStepŌvZ)
+			float friction = 0.0f;
+			float restitution = 0.0f;
+			uint32_t pointCount = 0;
+			ManifoldPoint points[MAX_MANIFOLD_POINTS]{};
+			uint32_t lastStep = 0;		// ŌɍXVꂽXebv
+		};
+
+		/**
+		 * @brief ڐG}jtH[h̃LbV
+		 *
+		 * yAƂ̃}jtH[hXebv܂ŕێB
+		 * Xebv BeginStep  (ڐGƂ)Update  EndStep ̏ɌĂԁB
+		 * Updateł̓yÃL[Ń}jtH[hTAfeatureId_̗ݐσCpXpB
+		 * EndStepōXebvGȂyA(ꂽ / XLbvꂽ)̂ĂB
+		 */
+		class ContactManifoldCache final {
+		public:
+			/**
+			 * @brief yÃL[(ԂɂȂ)
+			 * @param _a / _b ̂̔ԍ(32bit܂)
+			 */
+			static uint64_t MakeKey(uint64_t _a, uint64_t _b)
+			{
+				const uint64_t lo = (_a < _b) ? _a : _b;
+				const uint64_t hi = (_a < _b) ? _b : _a;
+				return (hi << 32) | (lo & 0xffffffffull);
+			}
+
+			void BeginStep();
+			/**
+			 * @brief Xebv̐ڐGŃ}jtH[hXV
+			 *	@傫ς͈pȂ(ڐG̎dςĂ)
+			 * @param _userA @̍
+			 * @param _userB @̐摤
+			 * @param _normal ABւ̖@(Kς)
+			 * @param _points ڐG_
+			 * @param _count ڐG_̐(MAX_MANIFOLD_POINTS܂)
+			 * @return XV}jtH[h
+			 */
+			ContactManifold& Update(uint64_t _userA, uint64_t _userB, const float* _normal, const ContactPointInput* _points, uint32_t _count);
+			void EndStep();
+			void Clear();
+
+			std::vector<ContactManifold>& GetManifolds() { return manifolds_; }
+			const std::vector<ContactManifold>& GetManifolds() const { return manifolds_; }
+			const ContactManifold* Find(uint64_t _key) const;
+			uint32_t GetPointCount() const { return point_count_; }			// Xebv̐ڐG_̐
+			uint32_t GetMatchedPointCount() const { return matched_count_; }	// ̂ÕXebvp
+
+		private:
+			std::vector<ContactManifold> manifolds_{};
+			std::unordered_map<uint64_t, uint32_t> index_{};	// L[ -> manifolds_̔ԍ
+			uint32_t step_ = 0;
+			uint32_t point_count_ = 0;
+			uint32_t matched_count_ = 0;
+		};
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+/**
+ * @file ContactSolver.h
+ * @brief CpX@̐ڐG\o[
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+#include <Game/Collisions/ContactManifold.h>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+//       e\Ȃ̂ŕî݂(]͈Ȃ)
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief \o[
+		 *	invMass0̕(ÓI / Ll}eBbN)͑xςȂ
+		 */
+		struct SolverBody {
+			float velocity[3]{};
+			float invMass = 0.0f;
+			float positionCorrection[3]{};	// ђʂ߂߂̈ړ(SolvěʁBĂяoʒuɑ)
+		};
+
+		/**
+		 * @brief \o[̐ݒ
+		 */
+		struct ContactSolverSettings {
+			uint32_t iterations = 8;			// x̔
+			uint32_t positionIterations = 4;	// ђʂ߂
+			bool warmStart = true;				// ÕXebv̗ݐσCpXn߂
+			float baumgarte = 0.2f;				// ђʂ߂(1Xebv)
+			float slop = 0.01f;					// eђ
+			float maxCorrection = 0.2f;			// 1XebvŖ߂ђʂ̏([߂荞񂾎ɒe΂Ȃ)
+			float restitutionThreshold = 1.0f;	// xՓ˂͔Ȃ(Î~̔Uh)
+			bool positionsIntegrated = true;	// ʒuɉȎxŐił(ϕ  Փ˂̏)Bx̕ωړʂɊ܂߂
+		};
+
+		/**
+		 * @brief ߂Solve̓v
+		 */
+		struct ContactSolverStats {
+			uint32_t manifoldCount = 0;
+			uint32_t pointCount = 0;
+			uint32_t iterations = 0;
+			float lastImpulseDelta = 0.0f;	// Ō̔ł̃CpX̕ω̍ől()
+		};
+
+		/**
+		 * @brief ڐG\o[
+		 *
+		 * }jtH[h̐ڐG_ƂɁA@(Ԃ)Ɛڐ(N[C)̃CpX
+		 * ݐϒlŃNvȂ甽ĉBݐσCpX̓}jtH[hɎcÃXebv̏lɂȂB
+		 * ђʂ͑xƂ͕ʂ̋[xŖ߂(split impulse)Bxɉ߂̕cȂ̂ŁAςݏグĂ˂ȂB
+		 */
+		class ContactSolver final {
+		public:
+			/**
+			 * @brief 
+			 * @param _bodies (xXV)
+			 * @param _manifolds }jtH[h(bodyA / bodyB_bodies̔ԍ)
+			 * @param _dt Xebv̎(0ȉȂ牽Ȃ)
+			 * @param _settings ݒ
+			 */
+			void Solve(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds, float _dt, const ContactSolverSettings& _settings);
+
+			const ContactSolverStats& GetLastStats() const { return stats_; }
+
+		private:
+			void PreStep(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds, const ContactSolverSettings& _settings);
+			float SolveOnce(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds);
+			void SolvePosition(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds, const ContactSolverSettings& _settings);
+
+		private:
+			ContactSolverStats stats_{};
+			std::vector<float> start_velocities_{};	// Ȏx(Ɨp)
+		};
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+/**
+ * @file DynamicAABBTree.h
+ * @brief IAABBc[̃u[htF[Y
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+#include <Game/Collisions/BroadPhase.h>
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief IAABBc[
+		 *
+		 * tɂ͌`菭傫(fat)AABBAɎ܂ĂԂ͓Ăc[GȂB
+		 * ͂ݏot𔲂āAړɐL΂AABBœ꒼B
+		 * }͕\ʐς̃RXgőIсAAVL̉]ō}B
+		 * yA͓꒼(=)vLV₢킹āAÖꗗƍB
+		 */
+		class DynamicAABBTree final : public IBroadPhase {
+		public:
+			static constexpr float DEFAULT_MARGIN = 0.1f;				// fat AABB̗]
+			static constexpr float DEFAULT_DISPLACEMENT_SCALE = 2.0f;	// ړɐL΂{
+
+			explicit DynamicAABBTree(float _margin = DEFAULT_MARGIN, float _displacementScale = DEFAULT_DISPLACEMENT_SCALE);
+
+			ProxyId CreateProxy(const AABB& _aabb, uint64_t _userData) override;
+			void DestroyProxy(ProxyId _proxy) override;
+			bool MoveProxy(ProxyId _proxy, const AABB& _aabb) override;
+
+			void UpdatePairs(std::vector<BroadPhasePair>& _added, std::vector<BroadPhasePair>& _removed) override;
+			const std::vector<BroadPhasePair>& GetPairs() const override { return pairs_; }
+
+			uint64_t GetUserData(ProxyId _proxy) const override { return nodes_[_proxy].userData; }
+			const AABB& GetFatAABB(ProxyId _proxy) const override { return nodes_[_proxy].aabb; }
+			std::size_t GetProxyCount() const override { return proxy_count_; }
+
+			/**
+			 * @brief AABBƏdȂt
+			 * @param _aabb ׂAABB
+			 * @param _func (ProxyId) -> bool  falseԂƂőł؂
+			 */
+			template<typename Func>
+			void Query(const AABB& _aabb, Func&& _func) const;
+
+			int32_t GetHeight() const { return root_ == NULL_PROXY ? 0 : nodes_[root_].height; }
+			bool Validate() const;	// eq֌W /  / AABB̐̊mF(fobOp)
+
+		private:
+			/**
+			 * @brief m[h
+			 *	tID̂܂܃vLVID
+			 */
+			struct Node {
+				AABB aabb{};			// t: fat AABB, : q͂AABB
+				AABB tight{};			// t: Ōɓnꂽ`AABB
+				uint64_t userData = 0;
+				int32_t parent = NULL_PROXY;
+				int32_t next = NULL_PROXY;		// 󂫃Xg
+				int32_t child1 = NULL_PROXY;
+				int32_t child2 = NULL_PROXY;
+				int32_t height = -1;			// t: 0, : -1
+				bool moved = false;				// UpdatePairsŖ₢킹邩
+
+				bool IsLeaf() const { return child1 == NULL_PROXY; }
+			};
+
+			int32_t AllocateNode();
+			void FreeNode(int32_t _node);
+			void InsertLeaf(int32_t _leaf);
+			void RemoveLeaf(int32_t _leaf);
+			int32_t Balance(int32_t _node);	// ]č𑵂(V؂̍Ԃ)
+			void Refit(int32_t _node);			// eɌAABBƍ𒼂
+			AABB MakeFatAABB(const AABB& _aabb, const float* _displacement) const;
+			void MarkMoved(int32_t _leaf);
+
+		private:
+			std::vector<Node> nodes_{};
+			int32_t root_ = NULL_PROXY;
+			int32_t free_list_ = NULL_PROXY;
+			std::size_t proxy_count_ = 0;
+
+			float margin_ = DEFAULT_MARGIN;
+			float displacement_scale_ = DEFAULT_DISPLACEMENT_SCALE;
+
+			std::vector<ProxyId> move_buffer_{};			// UpdatePairsŖ₢킹vLV
+			std::vector<BroadPhasePair> pairs_{};			// dȂĂyA(\[gς)
+			std::vector<BroadPhasePair> destroyed_pairs_{};	// 폜vLVĂyA
+			std::vector<BroadPhasePair> candidates_{};		// Ɨp
+			std::vector<BroadPhasePair> stale_{};			// Ɨp
+			std::vector<BroadPhasePair> kept_{};			// Ɨp
+			mutable std::vector<int32_t> stack_{};			// Queryp
+		};
+	}
+}
+
+#include <Game/Collisions/DynamicAABBTree.inl>
@@ -0,0 +1,44 @@
+#pragma once
+/**
+ * @file DynamicAABBTree.inl
+ * @brief IAABBc[̃ev[g֐̒`
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Collisions/DynamicAABBTree.h>
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief AABBƏdȂt
+		 *	ċAɍƗp̃X^bNŒH
+		 * @param _aabb ׂAABB
+		 * @param _func (ProxyId) -> bool  falseԂƂőł؂
+		 */
+		template<typename Func>
+		void DynamicAABBTree::Query(const AABB& _aabb, Func&& _func) const
+		{
+			if (root_ == NULL_PROXY) { return; }
+
+			stack_.clear();
+			stack_.push_back(root_);
+			while (!stack_.empty()) {
+				const int32_t index = stack_.back();
+				stack_.pop_back();
+
+				const Node& node = nodes_[index];
+				if (!node.aabb.Overlaps(_aabb)) { continue; }
+
+				if (node.IsLeaf()) {
+					if (!_func(index)) { return; }
+				}
+				else {
+					stack_.push_back(node.child1);
+					stack_.push_back(node.child2);
+				}
+			}
+		}
+	}
+}
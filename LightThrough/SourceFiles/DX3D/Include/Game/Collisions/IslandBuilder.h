@@ -0,0 +1,57 @@
+#pragma once
+/**
+ * @file IslandBuilder.h
+ * @brief ڐGłȂ̂̂܂Ƃ܂()̍\z
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief ̍\z(Union-Find)
+		 *
+		 * ̂0琔ԍňAڐGĂyAUnionłȂB
+		 * BuildœƂɕ̂ג̂ŁAPʂŖ点 / N̂ɎgB
+		 * :
+		 *	builder.Reset(bodyCount);
+		 *	for (...) { builder.Union(a, b); }
+		 *	builder.Build();
+		 *	for (uint32_t i = 0; i < builder.GetIslandCount(); ++i) { for (uint32_t body : builder.GetIsland(i)) { ... } }
+		 */
+		class IslandBuilder final {
+		public:
+			//! @brief ̂_bodyCountAꂼ̓ɂ(mۂ͎g)
+			void Reset(uint32_t _bodyCount);
+			//! @brief ̂̕𓯂ɂ
+			void Union(uint32_t _a, uint32_t _b);
+			//! @brief ̂Ă铇̑\
+			uint32_t Find(uint32_t _body);
+			//! @brief Ƃɕׂ̂(UnionɈĂ)
+			void Build();
+
+			uint32_t GetBodyCount() const { return static_cast<uint32_t>(parent_.size()); }
+			uint32_t GetIslandCount() const { return static_cast<uint32_t>(island_start_.empty() ? 0 : island_start_.size() - 1); }
+			//! @brief ɑ镨̂̔ԍ(ԍ̏)
+			std::span<const uint32_t> GetIsland(uint32_t _island) const;
+			//! @brief ̂Ă铇̔ԍ(Build)
+			uint32_t GetIslandOf(uint32_t _body) const { return island_of_[_body]; }
+
+		private:
+			std::vector<uint32_t> parent_{};
+			std::vector<uint32_t> rank_{};
+
+			// Builď
+			std::vector<uint32_t> island_of_{};		//   ̔ԍ
+			std::vector<uint32_t> island_start_{};	// ̐擪(island_bodies_̈ʒu)BŌɏI[
+			std::vector<uint32_t> island_bodies_{};	// ̏ɕׂ̂̔ԍ
+		};
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+/**
+ * @file NarrowPhaseBatch.h
+ * @brief `̑gݍ킹Ƃɂ܂Ƃ߂Ĕ肷i[tF[Y
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Game/Collisions/BoxContact.h>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief 茋(CollisionUtils.hContactResultƓg)
+		 */
+		struct NarrowPhaseResult {
+			bool hit = false;
+			float normal[3]{};
+			float penetration = 0.0f;
+			float contactPoint[3]{};
+			uint32_t feature = 0;
+		};
+
+		/**
+		 * @brief ܂Ƃ߂Ĕ肷i[tF[Y
+		 *
+		 * -̃yASoAŐς݁A4(SSE2)܂8(AVXŃrh)܂Ƃ߂Ĕ肷BSIMD1B
+		 * ރyA͈̔̕ςގԂ̂ŁAɂ͐ς܂Ȃ(IntersectSphere / IntersectSphereOBB𒼐ڎg)B
+		 * vZ̏Ԃ CollisionUtils.h  IntersectOBB ƑĂA
+		 * ʂ̓rbgPʂňv(FMAւ̕ῗȂ)B
+		 * :
+		 *	batch.Begin();
+		 *	for (...) { batch.AddBoxBox(a, b); }
+		 *	batch.Run();
+		 *	if (batch.GetResult(i).hit) { ... }
+		 */
+		class NarrowPhaseBatch final {
+		public:
+			//! @brief ςݒ̊Jn(mۂ͎g)
+			void Begin();
+
+			//! @brief -̃yAς(IntersectOBB(_a, _b)Ɠ) @return ԍ(GetResultɓn)
+			uint32_t AddBoxBox(const ContactBox& _a, const ContactBox& _b);
+
+			//! @brief ς񂾃yA܂Ƃ߂Ĕ肷
+			void Run();
+
+			const NarrowPhaseResult& GetResult(uint32_t _index) const { return results_[_index]; }
+			uint32_t GetCount() const { return static_cast<uint32_t>(results_.size()); }
+			static uint32_t GetLaneWidth();	// xɔ肷yA̐
+
+		private:
+			static constexpr size_t BOX_FIELDS = 15;		// S3 + 9 + ̑傫3
+
+			/**
+			 * @brief `̑gݍ킹SoA
+			 *	fields[i][n] nԖڂ̃yAiԖڂ̒lB[̔̕{܂ōŌ̃yAŖ߂
+			 *	z̑傫͏k߂Ɏg񂵁Acount܂łLƂ
+			 */
+			struct Group {
+				std::vector<float> fields[BOX_FIELDS * 2]{};
+				std::vector<uint32_t> indices{};	// results_̔ԍ
+				uint32_t fieldCount = 0;
+				size_t count = 0;
+			};
+
+			void Push(Group& _group, const float* _values);
+			void Pad(Group& _group);
+
+		private:
+			Group box_box_{};
+			std::vector<NarrowPhaseResult> results_{};
+		};
+	}
+}
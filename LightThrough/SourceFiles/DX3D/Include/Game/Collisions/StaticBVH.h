@@ -0,0 +1,99 @@
+#pragma once
+/**
+ * @file StaticBVH.h
+ * @brief ÓIȃRC_[p̍uBVH
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+#include <Game/Collisions/BroadPhase.h>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief BVHɓ镨
+		 */
+		struct StaticBVHItem {
+			AABB aabb{};
+			uint64_t userData = 0;	// EntityȂ
+		};
+
+		/**
+		 * @brief ÓIȃRC_[pBVH
+		 *
+		 * Ȃ܂Ƃ߂BuildAȍ~͍蒼܂ŕύXȂ(ꕔ̑} / 폜͖)B
+		 * SAH(\ʐς̃RXg)ŁAdSƂɃrɕĈԈʒuIԁB
+		 * m[h͔zɋl߁Aq͕Kׂ荇킹(left, left + 1)ɒuB
+		 * :
+		 *	bvh.Build(items);
+		 *	bvh.Query(aabb, [&](const StaticBVHItem& _item) { ...; return true; });
+		 */
+		class StaticBVH final {
+		public:
+			static constexpr uint32_t MAX_LEAF_ITEMS = 4;	// ȉȂ番ɗtɂ
+			static constexpr uint32_t MAX_DEPTH = 48;		// [͕Ȃ(QuerỹX^bN̑傫)
+			static constexpr uint32_t BIN_COUNT = 16;		// SAH̃r̐()
+
+			/**
+			 * @brief 蒼
+			 * @param _items 镨(g̓Rs[ĕבւ)
+			 */
+			void Build(const std::vector<StaticBVHItem>& _items);
+			//! @brief ɂ
+			void Clear();
+
+			/**
+			 * @brief AABBƏdȂ镨
+			 *	Ɨp̃X^bN͊֐̒Ɏ̂ŁAʁX̃Xbh瓯ɌĂł悢
+			 * @param _aabb ׂAABB
+			 * @param _func (const StaticBVHItem&) -> bool  falseԂƂőł؂
+			 * @return ׂm[h̐(vp)
+			 */
+			template<typename Func>
+			uint32_t Query(const AABB& _aabb, Func&& _func) const;
+
+			uint32_t GetItemCount() const { return static_cast<uint32_t>(items_.size()); }
+			uint32_t GetNodeCount() const { return static_cast<uint32_t>(nodes_.size()); }
+			uint32_t GetDepth() const { return depth_; }
+			float GetSAHCost() const { return sah_cost_; }	// ؑŜSAHRXg(̗ǂ̖ڈ)
+			bool Validate() const;	// qeɎ܂Ă邩 / S񂸂Ă邩(fobOp)
+
+		private:
+			/**
+			 * @brief m[h
+			 *	count > 0 ȂtŁAitems_[first, first + count) BȊO͎q first, first + 1
+			 */
+			struct Node {
+				AABB aabb{};
+				uint32_t first = 0;
+				uint32_t count = 0;
+
+				bool IsLeaf() const { return count > 0; }
+			};
+
+			//! @brief Ăr͈̔
+			struct BuildTask {
+				uint32_t node;
+				uint32_t begin;
+				uint32_t end;
+				uint32_t depth;
+			};
+
+			bool FindSplit(uint32_t _begin, uint32_t _end, uint32_t& _axis, float& _position) const;	// SAHŕʒu߂
+
+		private:
+			std::vector<Node> nodes_{};
+			std::vector<StaticBVHItem> items_{};
+			std::vector<float> centers_{};	// items_Ɠт̏dS(x, y, z)B鎞g
+			uint32_t depth_ = 0;
+			float sah_cost_ = 0.0f;
+		};
+	}
+}
+
+#include <Game/Collisions/StaticBVH.inl>
@@ -0,0 +1,48 @@
+#pragma once
+/**
+ * @file StaticBVH.inl
+ * @brief ÓIȃRC_[pBVH̃ev[g֐̒`
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Collisions/StaticBVH.h>
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief AABBƏdȂ镨
+		 *	[MAX_DEPTH܂łȂ̂ŁAX^bN͌Œ̑傫ő
+		 * @param _aabb ׂAABB
+		 * @param _func (const StaticBVHItem&) -> bool  falseԂƂőł؂
+		 * @return ׂm[h̐
+		 */
+		template<typename Func>
+		uint32_t StaticBVH::Query(const AABB& _aabb, Func&& _func) const
+		{
+			if (nodes_.empty()) { return 0; }
+
+			uint32_t stack[MAX_DEPTH + 2];
+			uint32_t top = 0;
+			uint32_t visited = 0;
+			stack[top++] = 0;
+			while (top > 0) {
+				const Node& node = nodes_[stack[--top]];
+				++visited;
+				if (!node.aabb.Overlaps(_aabb)) { continue; }
+
+				if (node.IsLeaf()) {
+					for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+						if (items_[i].aabb.Overlaps(_aabb) && !_func(items_[i])) { return visited; }
+					}
+				}
+				else {
+					stack[top++] = node.first + 1;
+					stack[top++] = node.first;
+				}
+			}
+			return visited;
+		}
+	}
+}
@@ -0,0 +1,113 @@
+#pragma once
+/**
+ * @file FrustumCuller.h
+ * @brief JO
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// memo: SoftwareShadowTesterƓADirectXMathECSɂ͈ˑȂ(sXMFLOAT4X4Ɠтfloat[16])
+
+namespace dx3d {
+	namespace culling {
+		/**
+		 * @brief 6
+		 *	(a, b, c, d)  a*x + b*y + c*z + d >= 0 B(a, b, c)͐Kς
+		 *	: , E, , , , 
+		 */
+		struct FrustumPlanes {
+			float planes[6][4]{};
+		};
+
+		/**
+		 * @brief X|bgCg̉~
+		 *	(lp)ׂ̂ŁAʂ̔ɉĊOڋƉ~Ŕ肷
+		 */
+		struct ConeBounds {
+			float apex[3]{};		// _(Cg̈ʒu)
+			float direction[3]{};	// (Kς)
+			float cosHalfAngle = 0.0f;
+			float sinHalfAngle = 1.0f;
+			float range = 0.0f;		// _ʂ܂ł̋
+		};
+
+		/**
+		 * @brief r[ x vWFNVs񂩂王̕ʂo
+		 *	DirectXMath̍sxNg(v * M)A[x0`1̎ˉeOɂ
+		 * @param _viewProj s(sD, 16)
+		 */
+		FrustumPlanes ExtractFrustumPlanes(const float* _viewProj);
+
+		/**
+		 * @brief JO
+		 *
+		 * `󂲂Ƃ̃[JAABB(SƔ̑傫)ƊOڋ[hɈڂSoAŎA
+		 * ʂƂɁuS܂ł̋ < -(AABB@ɓeaƋ̔ȁ)vȂOƂB
+		 * 4SSEł܂Ƃ߂čs(SSE1)B1̔łSSEłƓԂŌvẐŁAʂ͈vB
+		 * ς񂾌`͂̂܂܂ŁACullςĉxĂׂ(CgƂ̔Ȃ)B
+		 * :
+		 *	culler.Begin(count);
+		 *	for (...) { culler.Add(center, extents, radius, world); }
+		 *	culler.Cull(ExtractFrustumPlanes(viewProj));
+		 *	if (culler.IsVisible(i)) { ... }
+		 */
+		class FrustumCuller final {
+		public:
+			//! @brief ςݒ̊Jn(mۂ͎g)
+			void Begin(size_t _reserve = 0);
+
+			/**
+			 * @brief `ς
+			 * @param _center [JAABB̒S(xyz)
+			 * @param _extents [JAABB̔̑傫(xyz)
+			 * @param _radius _center𒆐SƂOڋ̔a
+			 * @param _world [hs(sD, 16)
+			 * @return ԍ(IsVisibleɓn)
+			 */
+			uint32_t Add(const float* _center, const float* _extents, float _radius, const float* _world);
+
+			//! @brief 傫̕Ȃ`ς(K鈵)
+			uint32_t AddUnbounded();
+
+			/**
+			 * @brief ς񂾌`܂Ƃ߂Ĕ肷
+			 * @param _frustum 
+			 * @param _cone ~(nullptr: ʂŔ肷)
+			 */
+			void Cull(const FrustumPlanes& _frustum, const ConeBounds* _cone = nullptr);
+
+			/**
+			 * @brief SSEŔ肷邩(r / ؂蕪p)
+			 *	false: 1肷BSSErhł͏1
+			 */
+			void SetSimdEnabled(bool _enabled) { simd_enabled_ = _enabled; }
+			bool IsSimdEnabled() const { return simd_enabled_; }
+
+			bool IsVisible(uint32_t _index) const { return visible_[_index] != 0; }
+			uint32_t GetCount() const { return count_; }
+			uint32_t GetVisibleCount() const { return visible_count_; }		// ߂CullŌ
+			uint32_t GetCulledCount() const { return count_ - visible_count_; }	// ߂CullŊOꂽ
+
+		private:
+			//! @brief [0, _end)1肷
+			void CullScalar(const FrustumPlanes& _frustum, const ConeBounds* _cone, uint32_t _end);
+			//! @brief [0, _end)4肷(_end4̔{)
+			void CullSimd(const FrustumPlanes& _frustum, const ConeBounds* _cone, uint32_t _end);
+
+		private:
+			bool simd_enabled_ = true;
+			uint32_t count_ = 0;
+			uint32_t visible_count_ = 0;
+			// [hł̒S / AABB̔̑傫 / Oڋ̔a(4̔{܂Ŗ߂)
+			std::vector<float> center_x_{}, center_y_{}, center_z_{};
+			std::vector<float> extent_x_{}, extent_y_{}, extent_z_{};
+			std::vector<float> radius_{};
+			std::vector<uint8_t> visible_{};
+		};
+	}
+}
@@ -0,0 +1,156 @@
+#pragma once
+/**
+ * @file LightClusterBuilder.h
+ * @brief NX^(tX^؂Ȕ)Ƃ̃Cg̊蓖
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// memo: FrustumCullerƓADirectXMathECSɂ͈ˑȂ(sXMFLOAT4X4Ɠтfloat[16])
+
+namespace dx3d {
+	class JobSystem;
+
+	namespace culling {
+		/**
+		 * @brief Cǧ`
+		 */
+		enum class ClusterLightShape : uint8_t {
+			Global,	// ǂɂł͂(s)BSNX^ɓ
+			Point,	// 
+			Spot,	// ~(؂`)
+		};
+
+		/**
+		 * @brief 蓖Ă郉Cg([h)
+		 */
+		struct ClusterLight {
+			float position[3]{};
+			float direction[3]{};	// Spot̂(Kς)
+			float range = 0.0f;		// Point / Spot
+			float cosOuter = -1.0f;	// Spot̂(ÕRTC)
+			ClusterLightShape shape = ClusterLightShape::Global;
+		};
+
+		/**
+		 * @brief NX^̕
+		 *	s͎wŋ؂BnearSliceDepthO͂܂Ƃ߂Ĉڂ̃XCXɂ
+		 */
+		struct ClusterGridDesc {
+			uint32_t tilesX = 16;
+			uint32_t tilesY = 9;
+			uint32_t slicesZ = 24;
+			float nearSliceDepth = 1.0f;
+		};
+
+		/**
+		 * @brief J(DirectXMath̍sxNgAn̓e)
+		 */
+		struct ClusterCamera {
+			float view[16]{};			// r[s(sD, 16)
+			float projScaleX = 1.0f;	// ˉes_11
+			float projScaleY = 1.0f;	// ˉes_22
+			float nearZ = 0.05f;
+			float farZ = 100.0f;
+		};
+
+		/**
+		 * @brief NX^Ƃ̃Cg̊蓖
+		 *
+		 * J̎ʂ̃^C x s̃XCXŋ؂(tNZ)A
+		 * Cg͈̔(Point: , Spot: `ދƉ~)ƏdȂNX^ɃCg̔ԍςށB
+		 * ͔LčŝŁAVF[_[ŃNX^IׂΓ͂Cg͕KĂB
+		 * XCXƂɕɑg݁AŌɈ̔zɋl߂B
+		 * ʂ̓VF[_[̍\obt@ɂ̂܂ܓn`:
+		 *	ranges[cluster * 2 + 0] = indices̐擪, ranges[cluster * 2 + 1] = 
+		 *	cluster = (slice * tilesY + tileY) * tilesX + tileX (tileY͉ʂ̏ォ)
+		 */
+		class LightClusterBuilder final {
+		public:
+			explicit LightClusterBuilder(const ClusterGridDesc& _desc = {}) : desc_(_desc) {}
+
+			/**
+			 * @brief 蓖Ă̎s
+			 * @param _camera J
+			 * @param _lights Cg(ԍ͂̕)
+			 * @param _jobSystem 񉻂ɎgJobSystem(nullptrȂ璼)
+			 */
+			void Build(const ClusterCamera& _camera, const std::vector<ClusterLight>& _lights, JobSystem* _jobSystem);
+
+			/**
+			 * @brief r[Ԃ̓_NX^(VF[_[ƓIѕ)
+			 * @param _viewPos _(xyz, z > 0)
+			 */
+			uint32_t FindCluster(const float* _viewPos) const;
+
+			/**
+			 * @brief sXCXI
+			 *	slice = (z < nearSliceDepth) ? 0 : 1 + floor(log(z) * sliceScale + sliceBias)
+			 */
+			uint32_t FindSlice(float _viewZ) const;
+
+			//! @brief NX^̔(r[, ɎgLÔ)
+			void GetClusterBounds(uint32_t _cluster, float* _outMin, float* _outMax) const;
+
+			const ClusterGridDesc& GetDesc() const { return desc_; }
+			uint32_t GetClusterCount() const { return desc_.tilesX * desc_.tilesY * desc_.slicesZ; }
+			const std::vector<uint32_t>& GetClusterRanges() const { return ranges_; }
+			const std::vector<uint32_t>& GetLightIndices() const { return indices_; }
+			float GetSliceScale() const { return slice_scale_; }		// VF[_[ɓn
+			float GetSliceBias() const { return slice_bias_; }			// VF[_[ɓn
+			float GetNearSliceDepth() const { return near_slice_; }	// VF[_[ɓn()
+			uint32_t GetMaxLightsPerCluster() const { return max_per_cluster_; }	// ߂BuildňԑNX^̃Cg
+
+		private:
+			/**
+			 * @brief r[ԂɈڂCg
+			 */
+			struct LightVolume {
+				uint32_t index = 0;
+				float center[3]{};	// ދ
+				float radius = 0.0f;
+				bool cone = false;	// true: ~ł肷
+				float apex[3]{};
+				float direction[3]{};
+				float cosHalf = 0.0f;
+				float sinHalf = 1.0f;
+				float range = 0.0f;
+			};
+
+			/**
+			 * @brief XCX̍Ɨpf[^
+			 */
+			struct SliceWork {
+				std::vector<float> extents{};		// ̕(min, max)ƍs̕(min, max)
+				std::vector<uint32_t> candidates{};	// sdȂ郉Cg(volumes_̔ԍ)
+				std::vector<uint32_t> rects{};		// ₲Ƃ̃^C͈̔(x0, x1, y0, y1)
+				std::vector<uint32_t> indices{};	// ̃XCX̊蓖(NX^)
+				uint32_t maxPerCluster = 0;
+			};
+
+			void SetupGrid(const ClusterCamera& _camera);
+			void BuildSlice(uint32_t _slice);
+
+		private:
+			ClusterGridDesc desc_{};
+			ClusterCamera camera_{};
+			float near_slice_ = 1.0f;
+			float slice_scale_ = 0.0f;
+			float slice_bias_ = 0.0f;
+			std::vector<float> slice_depths_{};	// XCX̋E(slicesZ + 1)
+			std::vector<float> tile_ndc_x_{};	// ^C̋E(tilesX + 1, )
+			std::vector<float> tile_ndc_y_{};	// ^C̋E(tilesY + 1, ォ)
+			std::vector<LightVolume> volumes_{};
+			std::vector<uint32_t> globals_{};	// SNX^ɓ郉Cg
+			std::vector<SliceWork> slices_{};
+			std::vector<uint32_t> ranges_{};
+			std::vector<uint32_t> indices_{};
+			uint32_t max_per_cluster_ = 0;
+		};
+	}
+}
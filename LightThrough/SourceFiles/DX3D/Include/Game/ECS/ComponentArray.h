@@ -7,8 +7,10 @@
  */
 
  // ---------- CN[h ---------- // 
-#include <unordered_map>
+#include <vector>
+#include <array>
 #include <memory>
+#include <functional>
 #include <typeindex>
 #include <type_traits>
 #include <cassert>
@@ -16,6 +18,18 @@
 
 namespace ecs
 {
+	/**
+	 * @brief R|[lgXg̃XibvVbg̃C^[tF[X
+	 *
+	 * g͌^(ComponentArray<Com>::Snapshot)Ɏ
+	 */
+	class IComponentSnapshot {
+	public:
+		virtual ~IComponentSnapshot() = default;
+		virtual std::size_t GetCount() const = 0;		// ۑComponent̐
+		virtual std::size_t GetByteSize() const = 0;	// ۑz̃oCgiȂǂ̃q[v͐Ȃj
+	};
+
 	/**
 	 * @brief R|[lgXg̃C^[tF[X
 	 *
@@ -28,6 +42,10 @@ namespace ecs
 		virtual void Remove(Entity _e) = 0;						// Component̍폜
 		virtual bool Has(Entity _e) const = 0;					// ComponentĂ邩
 		virtual void AddRaw(Entity _e, const void* _data) = 0;	// Component̒ǉivoid|C^Łj
+		virtual void AddRawBlock(const Entity* _entities, const void* _data, uint32_t _count) = 0;	// ܂Ƃ߂Ēǉi_dataCom[_count]j
+
+		virtual std::unique_ptr<IComponentSnapshot> CaptureSnapshot() const = 0;	// ̒gۂƕۑ
+		virtual void RestoreSnapshot(const IComponentSnapshot& _snapshot) = 0;		// ۑgɖ߂
 	};
 
 	/**
@@ -39,6 +57,12 @@ namespace ecs
 	template<typename Com>
 	class ComponentArray : public IComponentArray {
 	public:
+		/**
+		 * @brief XibvVbg߂ɌĂԏ
+		 *	|C^LbVȂǁARs[ł͎gȂgComponentp
+		 */
+		using RestoreHook = std::function<void(Entity, Com&)>;
+
 		void Insert(Entity _e, const Com& _component);
 		Com& Get(Entity _e);
 		//const std::vector<Com>& GetAllComponents() const;
@@ -49,11 +73,35 @@ namespace ecs
 		void Remove(Entity _e) override;
 		bool Has(Entity _e) const override;
 		void AddRaw(Entity _e, const void* _src) override;
+		void AddRawBlock(const Entity* _entities, const void* _src, uint32_t _count) override;
+
+		std::unique_ptr<IComponentSnapshot> CaptureSnapshot() const override;
+		void RestoreSnapshot(const IComponentSnapshot& _snapshot) override;
+		void SetRestoreHook(RestoreHook _hook) { restore_hook_ = std::move(_hook); }
 
 	private:
+		/**
+		 * @brief XibvVbg
+		 *	Sparse͖߂entityIDsgݒ̂ŎȂ
+		 */
+		struct Snapshot final : public IComponentSnapshot {
+			std::vector<Com> components{};
+			std::vector<Entity> entityIDs{};
+
+			std::size_t GetCount() const override { return components.size(); }
+			std::size_t GetByteSize() const override { return components.size() * (sizeof(Com) + sizeof(Entity)); }
+		};
+
+
+		using SparsePage = std::array<uint32_t, SPARSE_PAGE_SIZE>;
+
+		uint32_t FindSlot(Entity _e) const;				// EntityɑΉDenseIndex擾iSPARSE_NONEj
+		void SetSlot(uint32_t _entityIndex, uint32_t _slot);	// Sparseɏށiy[WΊmہj
+
 		std::vector<Com> components_{};	// ComponentVectorz
 		std::vector<Entity> entity_IDs_{};	// ComponentɑΉEntityVectorz
-		std::unordered_map<Entity, size_t> entity_to_index_{};	// EntityIndexΉ邽߂Map
+		std::vector<std::unique_ptr<SparsePage>> sparse_pages_{};	// EntityIndex -> Densëʒuiy[WPʂŊmہj
+		RestoreHook restore_hook_{};	// XibvVbg߂ɌĂԏ
 	};
 
 
@@ -7,6 +7,7 @@
  */
 
 // ---------- CN[h ---------- // 
+#include <cstring>
 #include <Game/ECS/Entity.h>
 #include <Game/ECS/ComponentArray.h>
 
@@ -22,8 +23,8 @@ namespace ecs {
 	template<typename Com>
 	void ComponentArray<Com>::Insert(Entity _e, const Com& _component)
 	{
-		assert(entity_to_index_.find(_e) == entity_to_index_.end());
-		entity_to_index_[_e] = components_.size();
+		assert(FindSlot(_e) == SPARSE_NONE);
+		SetSlot(_e.Index(), static_cast<uint32_t>(components_.size()));
 		entity_IDs_.push_back(_e);
 		components_.push_back(_component);
 	}
@@ -35,27 +36,26 @@ namespace ecs {
 	template<typename Com>
 	void ComponentArray<Com>::Remove(Entity _e)
 	{
-		auto it = entity_to_index_.find(_e);
+		const uint32_t index = FindSlot(_e);
 		// Ȃ
-		if (it == entity_to_index_.end()) {
+		if (index == SPARSE_NONE) {
 			DebugLogError("[ComponentArray] w肳ꂽEntityComponent݂Ȃ", _e.id_);
 			return;
 		}
 
-		const size_t index = entity_to_index_[_e];
-		const size_t lastIndex = components_.size() - 1;
+		const uint32_t lastIndex = static_cast<uint32_t>(components_.size() - 1);
 		// ƂƍŌ̗vfȂSwapȂ
 		if (index != lastIndex)
 		{
 			// 폜vfƍŌ̗vfւ
-			components_[index] = components_[lastIndex];
+			components_[index] = std::move(components_[lastIndex]);
 			entity_IDs_[index] = entity_IDs_[lastIndex];
-			entity_to_index_[entity_IDs_[index]] = index;
+			SetSlot(entity_IDs_[index].Index(), index);
 		}
 
 		components_.pop_back();
 		entity_IDs_.pop_back();
-		entity_to_index_.erase(_e);
+		SetSlot(_e.Index(), SPARSE_NONE);
 	}
 
 	/**
@@ -66,8 +66,9 @@ namespace ecs {
 	template<typename Com>
 	Com& ComponentArray<Com>::Get(Entity _e)
 	{
-		assert(entity_to_index_.find(_e) != entity_to_index_.end());
-		return components_[entity_to_index_[_e]];
+		const uint32_t index = FindSlot(_e);
+		assert(index != SPARSE_NONE);
+		return components_[index];
 	}
 
 	/**
@@ -78,7 +79,7 @@ namespace ecs {
 	template<typename Com>
 	bool ComponentArray<Com>::Has(Entity _e) const
 	{
-		return entity_to_index_.find(_e) != entity_to_index_.end();
+		return FindSlot(_e) != SPARSE_NONE;
 	}
 
 	/**
@@ -107,4 +108,133 @@ namespace ecs {
 		assert(_src != nullptr);
 		Insert(_e, *static_cast<const Com*>(_src));
 	}
+
+	/**
+	 * @brief Component܂Ƃ߂Ēǉ
+	 *	trivially copyableComponent͌ɍLmemcpyňxɎʂASparse
+	 *	ȊO͈InsertƓ
+	 * @param _entities	ǉEntity(_count, ܂ĂȂ)
+	 * @param _src		ǉComponent̕(Com[_count]Btrivially copyableȂ瑵ĂȂĂ悢)
+	 * @param _count	
+	 */
+	template<typename Com>
+	void ComponentArray<Com>::AddRawBlock(const Entity* _entities, const void* _src, uint32_t _count)
+	{
+		if (_count == 0) { return; }
+		assert(_entities != nullptr && _src != nullptr);
+
+		const uint32_t base = static_cast<uint32_t>(components_.size());
+		if constexpr (std::is_trivially_copyable_v<Com> && std::is_default_constructible_v<Com>) {
+			components_.resize(static_cast<std::size_t>(base) + _count);
+			std::memcpy(static_cast<void*>(components_.data() + base), _src, sizeof(Com) * _count);
+		}
+		else {
+			const auto* src = static_cast<const Com*>(_src);
+			components_.reserve(static_cast<std::size_t>(base) + _count);
+			components_.insert(components_.end(), src, src + _count);
+		}
+		entity_IDs_.insert(entity_IDs_.end(), _entities, _entities + _count);
+
+		for (uint32_t i = 0; i < _count; ++i) {
+			assert(FindSlot(_entities[i]) == SPARSE_NONE);
+			SetSlot(_entities[i].Index(), base + i);
+		}
+	}
+
+	/**
+	 * @brief ̒gۂƕۑ
+	 * @return XibvVbg
+	 */
+	template<typename Com>
+	std::unique_ptr<IComponentSnapshot> ComponentArray<Com>::CaptureSnapshot() const
+	{
+		auto snapshot = std::make_unique<Snapshot>();
+		snapshot->components = components_;
+		snapshot->entityIDs = entity_IDs_;
+		return snapshot;
+	}
+
+	/**
+	 * @brief ۑgɖ߂
+	 *	trivially copyableComponentmemcpyŖ߂AȊO̓Rs[Ŗ߂(mۂ͎g񂳂)
+	 *	Sparse͍̕ĂAۑEntity̕
+	 * @param _snapshot CaptureSnapshotŕۑ
+	 */
+	template<typename Com>
+	void ComponentArray<Com>::RestoreSnapshot(const IComponentSnapshot& _snapshot)
+	{
+		const auto& src = static_cast<const Snapshot&>(_snapshot);
+
+		for (const auto& e : entity_IDs_) {
+			SetSlot(e.Index(), SPARSE_NONE);
+		}
+
+		if constexpr (std::is_trivially_copyable_v<Com> && std::is_default_constructible_v<Com>) {
+			components_.resize(src.components.size());
+			if (!components_.empty()) {
+				std::memcpy(components_.data(), src.components.data(), components_.size() * sizeof(Com));
+			}
+		}
+		else {
+			components_ = src.components;
+		}
+		entity_IDs_ = src.entityIDs;
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(entity_IDs_.size()); ++i) {
+			SetSlot(entity_IDs_[i].Index(), i);
+		}
+
+		if (restore_hook_) {
+			for (std::size_t i = 0; i < components_.size(); ++i) {
+				restore_hook_(entity_IDs_[i], components_[i]);
+			}
+		}
+	}
+
+	/**
+	 * @brief EntityɑΉDenseIndex擾
+	 * @param _e		Entity
+	 * @return DenseIndexiĂȂ / VersionႤꍇSPARSE_NONEj
+	 */
+	template<typename Com>
+	uint32_t ComponentArray<Com>::FindSlot(Entity _e) const
+	{
+		const uint32_t entityIndex = _e.Index();
+		const uint32_t page = entityIndex >> SPARSE_PAGE_BITS;
+		if (page >= sparse_pages_.size() || !sparse_pages_[page]) {
+			return SPARSE_NONE;
+		}
+
+		const uint32_t slot = (*sparse_pages_[page])[entityIndex & SPARSE_PAGE_MASK];
+		// IndexłVersionႢijςEntityj͎ĂȂ
+		if (slot == SPARSE_NONE || entity_IDs_[slot] != _e) {
+			return SPARSE_NONE;
+		}
+		return slot;
+	}
+
+	/**
+	 * @brief SparseDenseIndex
+	 * @param _entityIndex	EntityIndex
+	 * @param _slot			DenseIndexiꍇSPARSE_NONEj
+	 */
+	template<typename Com>
+	void ComponentArray<Com>::SetSlot(uint32_t _entityIndex, uint32_t _slot)
+	{
+		const uint32_t page = _entityIndex >> SPARSE_PAGE_BITS;
+		if (page >= sparse_pages_.size()) {
+			// Ȃy[WKv͂Ȃ
+			if (_slot == SPARSE_NONE) { return; }
+			sparse_pages_.resize(page + 1);
+		}
+
+		auto& pagePtr = sparse_pages_[page];
+		if (!pagePtr) {
+			if (_slot == SPARSE_NONE) { return; }
+			pagePtr = std::make_unique<SparsePage>();
+			pagePtr->fill(SPARSE_NONE);
+		}
+
+		(*pagePtr)[_entityIndex & SPARSE_PAGE_MASK] = _slot;
+	}
 }
\ No newline at end of file
@@ -46,6 +46,22 @@ namespace ecs {
 	constexpr std::size_t MAX_COMPONENTS = 64;	// őComponent
 	using ComponentType = std::uint8_t;	// ComponentType( 0 ~ MAX_COMPONENT - 1 \鐮) 
 
+	constexpr uint32_t SPARSE_PAGE_BITS = 12;	// ComponentArraySparsey[WBit
+	constexpr uint32_t SPARSE_PAGE_SIZE = 1u << SPARSE_PAGE_BITS;	// 1y[WEntity
+	constexpr uint32_t SPARSE_PAGE_MASK = SPARSE_PAGE_SIZE - 1;
+	constexpr uint32_t SPARSE_NONE = 0xFFFFFFFFu;	// Sparse̋󂫃Xbg
+
+	constexpr std::size_t ARCHETYPE_CHUNK_BYTES = 16 * 1024;	// A[L^Cv1`ÑoCg
+	constexpr std::size_t COMMAND_ARENA_BLOCK_BYTES = 64 * 1024;	// R}hobt@̃A[i1ubÑoCg
+
+	/**
+	 * @brief Component̕ۑ
+	 */
+	enum class ComponentStorageType : uint8_t {
+		SparseSet,	// Component̎ނƂ̔zij
+		Archetype,	// SignatureƂ̃`N(SoA)
+	};
+
 
 	// ---------- System ---------- // 
 	using Signature = std::bitset<MAX_COMPONENTS>;	// eEntityComponentSignature
@@ -0,0 +1,33 @@
+#pragma once
+/**
+ * @file IRenderSystem.h
+ * @brief GPŨ\[XɐGVXẽC^[tF[X
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+// ---------- CN[h ---------- //
+#include <cassert>
+#include <d3d11.h>
+#include <Game/ECS/ISystem.h>
+
+namespace ecs {
+	/**
+	 * @brief `VXe̊
+	 *
+	 * GraphicsEngine(D3D11̃foCX / ReLXg)gSystem͂pB
+	 * wbhXsłGraphicsEnginêœo^Ȃ(ISystemSystem͂ǂł)B
+	 */
+	class IRenderSystem : public ISystem {
+	public:
+		explicit IRenderSystem(const SystemDesc& _desc)
+			: ISystem(_desc)
+			, engine_(*_desc.graphicsEngine)
+		{
+			assert(_desc.graphicsEngine && "`VXeGraphicsEngineƓo^łȂ");
+		}
+
+	protected:
+		dx3d::GraphicsEngine& engine_;
+	};
+}
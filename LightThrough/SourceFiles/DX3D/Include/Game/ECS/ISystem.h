@@ -21,9 +21,9 @@ namespace ecs {
 	public:
 		explicit ISystem(const SystemDesc& _desc)
 			: dx3d::Base(_desc.base)
-			, engine_(_desc.graphicsEngine)
 			, ecs_(_desc.ecs)
 			, scene_manager_(_desc.sceneManager)
+			, backend_(_desc.graphicsBackend)
 			, one_shot_(_desc.oneShot){}
 
 		virtual ~ISystem() = default;
@@ -51,7 +51,7 @@ namespace ecs {
 	protected:
 		ecs::Coordinator& ecs_; // ecs::Coordinatorւ̎Q
 		scene::SceneManager& scene_manager_;
-		dx3d::GraphicsEngine& engine_;
+		dx3d::IGraphicsBackend& backend_;	// `obNGh(GPŨ\[XɐGSystemIRenderSystemg)
 
 		bool one_shot_ = false; // xsVXe
 		bool active_ = true; // VXeANeBu
@@ -0,0 +1,99 @@
+#pragma once
+/**
+ * @file Query.h
+ * @brief SignatureɈvEntitÿꗗێNG
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <Game/ECS/Entity.h>
+#include <Game/ECS/ECSUtils.h>
+
+namespace ecs {
+	/**
+	 * @brief LbVꂽNG
+	 *
+	 * xSignatureo^ƁAEntitySignatureςxɍōXVB
+	 * 擾͈ꗗ̂܂܌邾Ȃ̂ŁAt[̌ĂяołEntityŜ𑖍ȂB
+	 * ꗗEntity̏(Index -> Version)ŕłB
+	 */
+	class Query final {
+	public:
+		explicit Query(const Signature& _signature) : signature_(_signature) {}
+
+		const Signature& GetSignature() const { return signature_; }
+
+		//! @brief vEntitÿꗗiRs[Ȃr[j
+		std::span<const Entity> View() const { return entities_; }
+		std::vector<Entity>::const_iterator begin() const { return entities_.begin(); }
+		std::vector<Entity>::const_iterator end() const { return entities_.end(); }
+		std::size_t size() const { return entities_.size(); }
+		bool empty() const { return entities_.empty(); }
+		Entity Front() const { return entities_.empty() ? Entity{} : entities_.front(); }
+		uint64_t GetVersion() const { return version_; }	// ꗗςxɐi(LbV̍蒼p)
+
+		/**
+		 * @brief Signaturev邩
+		 * @param _signature EntitySignature
+		 * @return true: v, false: sv
+		 */
+		bool Matches(const Signature& _signature) const { return (_signature & signature_) == signature_; }
+
+		/**
+		 * @brief EntitySignatureςɌĂяo
+		 * @param _e ΏۂEntity
+		 * @param _signature ύXSignature
+		 */
+		void EntitySignatureChanged(Entity _e, const Signature& _signature)
+		{
+			if (Matches(_signature)) { Insert(_e); }
+			else { Erase(_e); }
+		}
+
+		/**
+		 * @brief EntityjꂽɌĂяo
+		 * @param _e jꂽEntity
+		 */
+		void EntityDestroyed(Entity _e) { Erase(_e); }
+
+		//! @brief ꗗɂ(蒼OɌĂ)
+		void Clear()
+		{
+			entities_.clear();
+			++version_;
+		}
+
+	private:
+		void Insert(Entity _e)
+		{
+			// VEntity͖ɗ邱ƂقƂǂȂ̂ŐɊmF
+			if (entities_.empty() || entities_.back() < _e) {
+				entities_.push_back(_e);
+				++version_;
+				return;
+			}
+			auto it = std::lower_bound(entities_.begin(), entities_.end(), _e);
+			if (it != entities_.end() && *it == _e) { return; }
+			entities_.insert(it, _e);
+			++version_;
+		}
+
+		void Erase(Entity _e)
+		{
+			auto it = std::lower_bound(entities_.begin(), entities_.end(), _e);
+			if (it != entities_.end() && *it == _e) {
+				entities_.erase(it);
+				++version_;
+			}
+		}
+
+	private:
+		Signature signature_{};			// ΏۂSignature
+		std::vector<Entity> entities_{};	// vEntitÿꗗi\[gς݁j
+		uint64_t version_ = 0;				// ꗗ̕ύX
+	};
+}
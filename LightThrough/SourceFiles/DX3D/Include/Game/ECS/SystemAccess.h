@@ -0,0 +1,66 @@
+#pragma once
+/**
+ * @file SystemAccess.h
+ * @brief SystemGComponent / L\[X̐錾
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <Game/ECS/ECSUtils.h>
+
+namespace ecs {
+	/**
+	 * @brief ComponentȊŐL\[X
+	 *
+	 * rbgSystemm͓ɎsȂ
+	 */
+	enum class SystemResource : uint32_t {
+		None		= 0,
+		Graphics	= 1u << 0,	// DeferredContext / GPU\[X
+		Input		= 1u << 1,	// InputSystem
+		Scene		= 1u << 2,	// SceneManager
+		DebugDraw	= 1u << 3,	// DebugRenderSystem̃R}h
+		Shadow		= 1u << 4,	// ShadowMap / ShadowTesť
+		Contacts	= 1u << 5,	// CollisionResolveSystem̐ڐG
+		BroadPhase	= 1u << 6,	// ColliderSyncSystem̃u[htF[Y
+	};
+
+	constexpr SystemResource operator|(SystemResource _a, SystemResource _b) {
+		return static_cast<SystemResource>(static_cast<uint32_t>(_a) | static_cast<uint32_t>(_b));
+	}
+	constexpr bool operator&(SystemResource _a, SystemResource _b) {
+		return (static_cast<uint32_t>(_a) & static_cast<uint32_t>(_b)) != 0;
+	}
+
+	/**
+	 * @brief System̃ANZX錾
+	 *
+	 * RegisterSystem̎ɓnāAXPW[ˑ֌W(DAG)gނ̂ɎgB
+	 * 錾ȂSystemexclusiveŁAOSystemƕɓȂB
+	 */
+	struct SystemAccess {
+		Signature reads{};			// ǂComponent
+		Signature writes{};			// Component
+		SystemResource resources = SystemResource::None;	// gL\[X
+		bool exclusive = false;		// trueȂ瑼SystemƕɓȂ
+
+		/**
+		 * @brief ʂSystemƓɎsłȂ
+		 * @param _other rSystem̃ANZX錾
+		 * @return true: , false: Ɏsł
+		 */
+		bool ConflictsWith(const SystemAccess& _other) const
+		{
+			if (exclusive || _other.exclusive) { return true; }
+			if (resources & _other.resources) { return true; }
+			if ((writes & (_other.reads | _other.writes)).any()) { return true; }
+			if ((_other.writes & reads).any()) { return true; }
+			return false;
+		}
+
+		//! @brief 錾Ȃ(ƕɓȂ)
+		static SystemAccess Exclusive() { return SystemAccess{ .exclusive = true }; }
+	};
+}
@@ -0,0 +1,58 @@
+#pragma once
+/**
+ * @file HierarchyOrder.h
+ * @brief eqKw[ɕׂ
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// memo: P̂ŃeXg / vł悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	/**
+	 * @brief eqKw[(eKqO)ɕׂ
+	 *
+	 * m[h0琔ԍňAe̔ԍ(-1: [g)̔z񂩂тB
+	 * [̒ł͌̔ԍ̏BTCN͌Ő؂ă[gƂĈB
+	 * ׂz擪xȂ߂΁Aěʂ͕KvZς݂ɂȂB
+	 * :
+	 *	order.Build(parentOf);
+	 *	for (uint32_t i = 0; i < order.GetCount(); ++i) {
+	 *		const uint32_t node = order.GetOrder()[i];
+	 *		const int32_t parent = order.GetParents()[i];	// ׂʒu(-1: [g)
+	 *	}
+	 */
+	class HierarchyOrder final {
+	public:
+		//! @brief e̔ԍ[ɕׂ(mۂ͎g)
+		void Build(std::span<const int32_t> _parentOf);
+
+		uint32_t GetCount() const { return static_cast<uint32_t>(order_.size()); }
+		//! @brief ׂʒu  ̔ԍ
+		std::span<const uint32_t> GetOrder() const { return order_; }
+		//! @brief ׂʒu  eׂ̕ʒu(-1: [g)
+		std::span<const int32_t> GetParents() const { return parents_; }
+		//! @brief TCN؂m[h(̔ԍ)B̃m[h[gƂĈ
+		std::span<const uint32_t> GetCutNodes() const { return cut_nodes_; }
+		//! @brief Ԑ[m[h̐[([g0BȂ-1)
+		int32_t GetMaxDepth() const { return max_depth_; }
+
+	private:
+		std::vector<uint32_t> order_{};
+		std::vector<int32_t> parents_{};
+		std::vector<uint32_t> cut_nodes_{};
+		int32_t max_depth_ = -1;
+
+		// Ɨp
+		std::vector<int32_t> parent_of_{};
+		std::vector<int32_t> depth_{};
+		std::vector<uint32_t> chain_{};
+		std::vector<uint32_t> offsets_{};
+		std::vector<int32_t> position_{};
+	};
+}
@@ -0,0 +1,424 @@
+#pragma once
+/**
+ * @file ComponentBinary.h
+ * @brief R|[lg̃oCi(NbNV[p)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include <nlohmann/json.hpp>
+
+#include <Game/ECS/Entity.h>
+#include <Game/Serialization/ComponentReflection.h>
+
+namespace ecs_serial {
+	/**
+	 * @brief oCȉݐ
+	 */
+	class BinaryWriter
+	{
+	public:
+		void Write(const void* _data, std::size_t _size)
+		{
+			const auto* src = static_cast<const uint8_t*>(_data);
+			buffer_.insert(buffer_.end(), src, src + _size);
+		}
+
+		template<class T>
+		void WritePod(const T& _value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			Write(&_value, sizeof(T));
+		}
+
+		//! @brief 0Ŗ߂_align̔{̈ʒuɑ
+		void Align(std::size_t _align)
+		{
+			buffer_.resize((buffer_.size() + _align - 1) / _align * _align, 0);
+		}
+
+		//! @brief ݍς݂̈ʒuɏ㏑(wb_[̌㖄ߗp)
+		template<class T>
+		void Patch(std::size_t _offset, const T& _value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			std::memcpy(buffer_.data() + _offset, &_value, sizeof(T));
+		}
+
+		std::size_t GetSize() const { return buffer_.size(); }
+		const std::vector<uint8_t>& GetBuffer() const { return buffer_; }
+
+	private:
+		std::vector<uint8_t> buffer_{};
+	};
+
+	/**
+	 * @brief oCi̓ǂݍ݌
+	 *	͈͊OǂƂO𓊂
+	 */
+	class BinaryReader
+	{
+	public:
+		BinaryReader(const uint8_t* _data, std::size_t _size) : data_(_data), size_(_size) {}
+
+		//! @brief _sizei߂āAǂݔ΂擪Ԃ
+		const uint8_t* Skip(std::size_t _size)
+		{
+			if (_size > size_ - offset_) {
+				throw std::runtime_error("[ComponentBinary] ͈͊O̓ǂݍ");
+			}
+			const uint8_t* p = data_ + offset_;
+			offset_ += _size;
+			return p;
+		}
+
+		void Read(void* _dst, std::size_t _size)
+		{
+			std::memcpy(_dst, Skip(_size), _size);
+		}
+
+		template<class T>
+		T ReadPod()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T value;
+			Read(&value, sizeof(T));
+			return value;
+		}
+
+		void Align(std::size_t _align)
+		{
+			const std::size_t aligned = (offset_ + _align - 1) / _align * _align;
+			Skip(aligned - offset_);
+		}
+
+		std::size_t GetOffset() const { return offset_; }
+		std::size_t GetSize() const { return size_; }
+
+	private:
+		const uint8_t* data_ = nullptr;
+		std::size_t size_ = 0;
+		std::size_t offset_ = 0;
+	};
+
+	// ubÑf[^̑(ȉalignof̌^͂̂܂܃Rs[ł)
+	inline constexpr std::size_t BINARY_BLOCK_ALIGN = 16;
+
+	/**
+	 * @brief ^ToCiɏ
+	 *	to_json_valueƓ
+	 */
+	template<class T>
+	inline void write_binary_value(BinaryWriter& _w, const T& _src)
+	{
+		// Zp^/bool/enum
+		if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+			_w.WritePod(_src);
+		}
+		// ( + g)
+		else if constexpr (std::is_same_v<T, std::string>) {
+			_w.WritePod(static_cast<uint32_t>(_src.size()));
+			_w.Write(_src.data(), _src.size());
+		}
+		// Cz / std::array
+		else if constexpr (std::is_array_v<T> || is_std_array_v<T>) {
+			for (const auto& e : _src) {
+				write_binary_value(_w, e);
+			}
+		}
+		// vfl̂
+		else if constexpr (Vec4Like<T>) {
+			const float v[4]{ _src.x, _src.y, _src.z, _src.w };
+			_w.Write(v, sizeof(v));
+		}
+		// vfO̂
+		else if constexpr (Vec3Like<T>) {
+			const float v[3]{ _src.x, _src.y, _src.z };
+			_w.Write(v, sizeof(v));
+		}
+		// vf̂
+		else if constexpr (Vec2Like<T>) {
+			const float v[2]{ _src.x, _src.y };
+			_w.Write(v, sizeof(v));
+		}
+		// NX^
+		else if constexpr (std::is_class_v<T>) {
+			auto fields = TypeReflection<T>::Fields();
+			for_each(fields, [&](auto&& _f) {
+				write_binary_value(_w, _src.*(_f.member));
+				});
+		}
+		else {
+			static_assert(always_false_v<T>, "[ComponentBinary.h] Ή̌^܂");
+		}
+	}
+
+	/**
+	 * @brief oCi^Tɑ
+	 *	assign_valueƓ
+	 */
+	template<class T>
+	inline void read_binary_value(BinaryReader& _r, T& _dst)
+	{
+		// Zp^/bool/enum
+		if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+			_dst = _r.ReadPod<T>();
+		}
+		// ( + g)
+		else if constexpr (std::is_same_v<T, std::string>) {
+			const uint32_t length = _r.ReadPod<uint32_t>();
+			const auto* p = reinterpret_cast<const char*>(_r.Skip(length));
+			_dst.assign(p, length);
+		}
+		// Cz / std::array
+		else if constexpr (std::is_array_v<T> || is_std_array_v<T>) {
+			for (auto& e : _dst) {
+				read_binary_value(_r, e);
+			}
+		}
+		// vfl̂
+		else if constexpr (Vec4Like<T>) {
+			float v[4];
+			_r.Read(v, sizeof(v));
+			_dst.x = v[0]; _dst.y = v[1]; _dst.z = v[2]; _dst.w = v[3];
+		}
+		// vfO̂
+		else if constexpr (Vec3Like<T>) {
+			float v[3];
+			_r.Read(v, sizeof(v));
+			_dst.x = v[0]; _dst.y = v[1]; _dst.z = v[2];
+		}
+		// vf̂
+		else if constexpr (Vec2Like<T>) {
+			float v[2];
+			_r.Read(v, sizeof(v));
+			_dst.x = v[0]; _dst.y = v[1];
+		}
+		// NX^
+		else if constexpr (std::is_class_v<T>) {
+			auto fields = TypeReflection<T>::Fields();
+			for_each(fields, [&](auto&& _f) {
+				read_binary_value(_r, _dst.*(_f.member));
+				});
+		}
+		else {
+			static_assert(always_false_v<T>, "[ComponentBinary.h] Ή̌^܂");
+		}
+	}
+
+	/**
+	 * @brief ^T̕oCiǂݔ΂(炸ɔ͈͂m߂)
+	 *	read_binary_valueƓ
+	 */
+	template<class T>
+	inline void skip_binary_value(BinaryReader& _r)
+	{
+		// Zp^/bool/enum
+		if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+			_r.Skip(sizeof(T));
+		}
+		// ( + g)
+		else if constexpr (std::is_same_v<T, std::string>) {
+			_r.Skip(_r.ReadPod<uint32_t>());
+		}
+		// Cz
+		else if constexpr (std::is_array_v<T>) {
+			for (std::size_t i = 0; i < std::extent_v<T>; ++i) {
+				skip_binary_value<std::remove_extent_t<T>>(_r);
+			}
+		}
+		// std::array
+		else if constexpr (is_std_array_v<T>) {
+			for (std::size_t i = 0; i < std::tuple_size_v<T>; ++i) {
+				skip_binary_value<typename T::value_type>(_r);
+			}
+		}
+		// vfl / O / ̂
+		else if constexpr (Vec4Like<T>) { _r.Skip(sizeof(float) * 4); }
+		else if constexpr (Vec3Like<T>) { _r.Skip(sizeof(float) * 3); }
+		else if constexpr (Vec2Like<T>) { _r.Skip(sizeof(float) * 2); }
+		// NX^
+		else if constexpr (std::is_class_v<T>) {
+			auto fields = TypeReflection<T>::Fields();
+			for_each(fields, [&](auto&& _f) {
+				skip_binary_value<std::decay_t<decltype(std::declval<T>().*(_f.member))>>(_r);
+				});
+		}
+		else {
+			static_assert(always_false_v<T>, "[ComponentBinary.h] Ή̌^܂");
+		}
+	}
+
+	/**
+	 * @brief FNV-1aŃnbVɍ
+	 */
+	inline void hash_combine_bytes(uint64_t& _hash, const void* _data, std::size_t _size)
+	{
+		const auto* p = static_cast<const uint8_t*>(_data);
+		for (std::size_t i = 0; i < _size; ++i) {
+			_hash ^= p[i];
+			_hash *= 1099511628211ull;
+		}
+	}
+
+	/**
+	 * @brief oCi̕тnbVɍ
+	 *	tB[h̖O / ^ / Ԃς΃nbVς
+	 */
+	template<class T>
+	inline void hash_binary_layout(uint64_t& _hash)
+	{
+		auto mix = [&](uint64_t _v) { hash_combine_bytes(_hash, &_v, sizeof(_v)); };
+
+		if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+			mix(1); mix(sizeof(T)); mix(std::is_floating_point_v<T> ? 1 : 0);
+		}
+		else if constexpr (std::is_same_v<T, std::string>) {
+			mix(2);
+		}
+		else if constexpr (std::is_array_v<T>) {
+			mix(3); mix(std::extent_v<T>);
+			hash_binary_layout<std::remove_extent_t<T>>(_hash);
+		}
+		else if constexpr (is_std_array_v<T>) {
+			mix(3); mix(std::tuple_size_v<T>);
+			hash_binary_layout<typename T::value_type>(_hash);
+		}
+		else if constexpr (Vec4Like<T>) { mix(4); }
+		else if constexpr (Vec3Like<T>) { mix(5); }
+		else if constexpr (Vec2Like<T>) { mix(6); }
+		else if constexpr (std::is_class_v<T>) {
+			mix(7);
+			auto fields = TypeReflection<T>::Fields();
+			for_each(fields, [&](auto&& _f) {
+				hash_combine_bytes(_hash, _f.name.data(), _f.name.size());
+				hash_binary_layout<std::decay_t<decltype(std::declval<T>().*(_f.member))>>(_hash);
+				});
+		}
+	}
+
+	/**
+	 * @brief tNVtB[h̃oCg̍v
+	 */
+	template<class Tuple>
+	struct reflected_field_size : std::integral_constant<std::size_t, 0> {};
+
+	template<class T, class... MemberTs>
+	struct reflected_field_size<std::tuple<FieldInfo<T, MemberTs>...>>
+		: std::integral_constant<std::size_t, (std::size_t{ 0 } + ... + sizeof(MemberTs))> {};
+
+	template<class T>
+	inline constexpr std::size_t reflected_field_size_v = reflected_field_size<decltype(TypeReflection<T>::Fields())>::value;
+
+	/**
+	 * @brief ̂܂܃Rs[ăubNɂ^
+	 *	tNVtB[hőSoCg܂^Ɍ
+	 *	(tNVĂȂopfBOƁAт̕ωnbVŏEȂ)
+	 */
+	template<class T>
+	inline constexpr bool is_raw_block_v = std::is_trivially_copyable_v<T> && alignof(T) <= BINARY_BLOCK_ALIGN
+		&& reflected_field_size_v<T> == sizeof(T);
+
+	/**
+	 * @brief R|[lg̃ubN̕т̃nbV
+	 *	̂܂܃Rs[^sizeof / alignofƊetB[h̃ItZbg
+	 *	(o錾̏Ԃς肵ÂNbN͎gȂ)
+	 */
+	template<class T>
+	uint64_t ComputeLayoutHash()
+	{
+		uint64_t hash = 14695981039346656037ull;
+		const auto name = TypeReflection<T>::Name();
+		hash_combine_bytes(hash, name.data(), name.size());
+		hash_binary_layout<T>(hash);
+		if constexpr (is_raw_block_v<T>) {
+			const uint64_t layout[2]{ sizeof(T), alignof(T) };
+			hash_combine_bytes(hash, layout, sizeof(layout));
+
+			const T probe{};
+			const auto* base = reinterpret_cast<const uint8_t*>(&probe);
+			for_each(TypeReflection<T>::Fields(), [&](auto&& _f) {
+				const uint64_t offset = static_cast<uint64_t>(reinterpret_cast<const uint8_t*>(&(probe.*(_f.member))) - base);
+				hash_combine_bytes(hash, &offset, sizeof(offset));
+				});
+		}
+		return hash;
+	}
+
+	/**
+	 * @brief JSOÑR|[lgQ̃ubNƂď
+	 *	̂܂܃Rs[ł^ T[count]AȊO̓tB[hɋl߂
+	 * @param _src R|[lgJSON(Entity̏)
+	 * @param _w ݐ(BINARY_BLOCK_ALIGNɑĂ邱)
+	 */
+	template<class T>
+	void CookComponentBlock(const std::vector<const nlohmann::json*>& _src, BinaryWriter& _w)
+	{
+		for (const auto* j : _src) {
+			const T obj = Deserialize<T>(*j);
+			if constexpr (is_raw_block_v<T>) {
+				_w.Write(&obj, sizeof(T));
+			}
+			else {
+				write_binary_value(_w, obj);
+			}
+		}
+	}
+
+	/**
+	 * @brief ubN_count̃f[^Ƃēǂ߂邩m߂
+	 *	R|[lg͍炸ɓǂݔ΂BEntityOɑSubNɑ΂ČĂ
+	 * @param _count 
+	 * @param _r ǂݍ݌(ubN̐擪I[܂)
+	 * @return ߕsȂǂ߂: true(͈͊OǂƂ͗O)
+	 */
+	template<class T>
+	bool ValidateComponentBlock(uint32_t _count, BinaryReader& _r)
+	{
+		if constexpr (is_raw_block_v<T>) {
+			_r.Skip(sizeof(T) * static_cast<std::size_t>(_count));
+		}
+		else {
+			for (uint32_t i = 0; i < _count; ++i) {
+				skip_binary_value<T>(_r);
+			}
+		}
+		return _r.GetOffset() == _r.GetSize();
+	}
+
+	/**
+	 * @brief ubNǂŃR|[lg܂Ƃ߂Ēǉ
+	 *	̂܂܃Rs[ł^̓ubNComponentXgֈxɎʂ
+	 *	ȊO̓tB[hɓǂłA܂Ƃ߂Ēǉ
+	 *	\ύX̏ōŝŁASystemsɂ͌Ă΂Ȃ
+	 * @param _coord Coordinator
+	 * @param _entities ǉ(ubN̏)
+	 * @param _count 
+	 * @param _r ǂݍ݌(ubN̐擪)
+	 */
+	template<class T, class CoordinatorT>
+	void LoadComponentBlock(CoordinatorT& _coord, const ecs::Entity* _entities, uint32_t _count, BinaryReader& _r)
+	{
+		if constexpr (is_raw_block_v<T>) {
+			const uint8_t* data = _r.Skip(sizeof(T) * _count);
+			_coord.template AddComponentBlock<T>(_entities, data, _count);
+		}
+		else {
+			std::vector<T> objs(_count);
+			for (auto& obj : objs) {
+				read_binary_value(_r, obj);
+			}
+			_coord.template AddComponentBlock<T>(_entities, objs.data(), _count);
+		}
+	}
+} // namespace ecs_serial
@@ -7,6 +7,7 @@
  */
 
  /*---------- CN[h ----------*/
+#include <cstdint>
 #include <tuple>
 #include <string_view>
 #include <unordered_map>
@@ -25,6 +26,8 @@ namespace ecs {
 
 namespace ecs_serial {
 	using json = nlohmann::json;
+	class BinaryWriter;
+	class BinaryReader;
 
 	/**
 	 * @brief tB[h
@@ -71,12 +74,19 @@ namespace ecs_serial {
 		using AddFunc = std::function<void(ecs::Coordinator&, ecs::Entity&, const json&)>;
 		using HasFunc = std::function<bool(ecs::Coordinator&, ecs::Entity&)>;
 		using ToJsonFunc = std::function<json(ecs::Coordinator&, ecs::Entity&)>;
+		using CookFunc = std::function<void(const std::vector<const json*>&, BinaryWriter&)>;
+		using ValidateBlockFunc = std::function<bool(uint32_t, BinaryReader&)>;
+		using LoadBlockFunc = std::function<void(ecs::Coordinator&, const ecs::Entity*, uint32_t, BinaryReader&)>;
 
 		struct Entry
 		{
 			AddFunc add{};
 			HasFunc has{};
 			ToJsonFunc toJson{};
+			CookFunc cook{};			// JSON -> ubN(ComponentBinary.h)
+			ValidateBlockFunc validateBlock{};	// ubNǂ߂邩̊mF(EntityO)
+			LoadBlockFunc loadBlock{};	// ubN -> ܂Ƃ߂Ēǉ
+			uint64_t layoutHash = 0;	// ubN̕т̃nbV(NbNÂ̔p)
 			std::vector<VariantInfo> variants{};
 		};
 
@@ -96,11 +106,17 @@ namespace ecs_serial {
 		 * @param _add AddComponent s_
 		 * @param _has HasComponent s_
 		 * @param _toJson ToJson s_
+		 * @param _cook ubN̏݃_
+		 * @param _validateBlock ubN̊mF_
+		 * @param _loadBlock ubN̓ǂݍ݃_
+		 * @param _layoutHash ubN̕т̃nbV
 		 */
-		void Register(std::string_view _name, AddFunc _add, HasFunc _has, ToJsonFunc _toJson)
+		void Register(std::string_view _name, AddFunc _add, HasFunc _has, ToJsonFunc _toJson,
+			CookFunc _cook, ValidateBlockFunc _validateBlock, LoadBlockFunc _loadBlock, uint64_t _layoutHash)
 		{
 			assert(registry_.find(std::string(_name)) == registry_.end());
-			registry_[std::string(_name)] = Entry{ std::move(_add), std::move(_has), std::move(_toJson) };
+			registry_[std::string(_name)] = Entry{ std::move(_add), std::move(_has), std::move(_toJson),
+				std::move(_cook), std::move(_validateBlock), std::move(_loadBlock), _layoutHash };
 		}
 
 		/**
@@ -120,6 +136,16 @@ namespace ecs_serial {
 			return true;
 		}
 
+		/**
+		 * @brief OGg擾
+		 * @return Ȃnullptr
+		 */
+		const Entry* Find(const std::string& _name) const
+		{
+			auto it = registry_.find(_name);
+			return it == registry_.end() ? nullptr : &it->second;
+		}
+
 		bool Contains(const std::string& _name) const
 		{
 			return registry_.find(_name) != registry_.end();
@@ -235,7 +261,6 @@ namespace ecs_serial {
 		}
 		// Cz
 		else if constexpr (std::is_array_v<T>) {
-			using Elem = std::remove_extent_t<T>;
 			for (size_t i = 0; i < std::extent_v<T>; ++i) {
 				assign_value(_dst[i], _j.at(i));
 			}
@@ -416,6 +441,7 @@ template<> struct ecs_serial::TypeReflection<Type> { \
 
    /**
 	* @brief R|[lg̃tNVo^}N
+	*	gComponentBinary.hCN[hĂ
 	* @tparam ComponentT	R|[lg^
 	*/
 #define REGISTER_COMPONENT_REFLECTION(ComponentT) \
@@ -423,15 +449,8 @@ template<> struct ecs_serial::TypeReflection<Type> { \
         ecs_serial::ComponentRegistry::Get().Register( \
             ecs_serial::TypeReflection<ComponentT>::Name(), \
             [](ecs::Coordinator& _coord, ecs::Entity _e, const nlohmann::json& _j){ \
-                auto componentPtr = std::make_shared<ComponentT>( \
-                    ecs_serial::Deserialize<ComponentT>(_j) \
-                ); \
-                const auto type = _coord.GetComponentType<ComponentT>(); \
-                _coord.RequestAddComponentRaw( \
-                    _e, type, \
-                    [coord = &_coord, e = _e, componentPtr]() { \
-                        coord->AddComponent<ComponentT>(e, *componentPtr); \
-                    } \
+                _coord.RequestAddComponent<ComponentT>( \
+                    _e, ecs_serial::Deserialize<ComponentT>(_j) \
                 ); \
             }, \
             [](ecs::Coordinator& _coord, ecs::Entity _e) { \
@@ -441,6 +460,16 @@ template<> struct ecs_serial::TypeReflection<Type> { \
                 auto* p = _coord.GetComponent<ComponentT>(_e); \
                 if (!p) { return nlohmann::json::object(); } \
                 return ecs_serial::Serialize(*p); \
-            } \
+            }, \
+            [](const std::vector<const nlohmann::json*>& _src, ecs_serial::BinaryWriter& _w) { \
+                ecs_serial::CookComponentBlock<ComponentT>(_src, _w); \
+            }, \
+            [](uint32_t _count, ecs_serial::BinaryReader& _r) { \
+                return ecs_serial::ValidateComponentBlock<ComponentT>(_count, _r); \
+            }, \
+            [](ecs::Coordinator& _coord, const ecs::Entity* _entities, uint32_t _count, ecs_serial::BinaryReader& _r) { \
+                ecs_serial::LoadComponentBlock<ComponentT>(_coord, _entities, _count, _r); \
+            }, \
+            ecs_serial::ComputeLayoutHash<ComponentT>() \
         ); \
-    } while(0)
\ No newline at end of file
+    } while(0)
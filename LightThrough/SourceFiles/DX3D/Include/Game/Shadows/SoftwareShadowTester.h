@@ -0,0 +1,154 @@
+#pragma once
+/**
+ * @file SoftwareShadowTester.h
+ * @brief CPUŉes(CS_ShadowTest.hlslCPU)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+
+// memo: GPUȂĂ(T[o[ / eXgł)悤ɁADirectXMathECSɂ͈ˑȂ
+
+namespace dx3d {
+	class JobSystem;
+
+	namespace shadow {
+		/**
+		 * @brief 茋
+		 *	CS_ShadowTest.hlsloutFlagsƓl
+		 */
+		enum class ShadowTestFlag : uint32_t {
+			Lit = 0,			// ̒
+			Shadow = 1,			// e̒
+			OutUV = 2,			// VhE}bv͈̔͊O
+			OutZ = 3,			// [x͈̔͊O
+			ZeroW = 4,			// w0
+			OutRange = 5,		// Cg̓͂̊O
+			OutSideCone = 6,	// X|bgCg̉~̊O
+		};
+
+		/**
+		 * @brief Cg̏(CSParams̔Ɏg)
+		 */
+		struct ShadowLightParams {
+			float lightViewProj[16]{};		// sD(XMFLOAT4X4Ɠ)
+			float lightPos[3]{};
+			float lightDir[3]{};
+			float cosOuterAngle = -1.0f;
+			float cosInnerAngle = -1.0f;	// ɂ͎gȂ(CSParamsɍ킹ĎĂ)
+			float lightRange = 100000.0f;
+		};
+
+		/**
+		 * @brief [x`̐ݒ
+		 *	LightDepthRenderSystem̃r[|[g / X^CU[Xe[gƑ
+		 */
+		struct ShadowRasterDesc {
+			uint32_t width = 2048;
+			uint32_t height = 2048;
+			bool frontCounterClockwise = true;	// RasterizerStateDesc̊l
+			int32_t depthBias = 50;
+			float slopeScaledDepthBias = 2.0f;
+			float depthBiasClamp = 0.01f;
+		};
+
+		/**
+		 * @brief e𗎂Ƃ`
+		 *	g͌ĂяoAExecute̊ԂQƂ
+		 */
+		struct ShadowCaster {
+			const float* world = nullptr;		// [hs(sD, 16)
+			const float* positions = nullptr;	// _W(xyz * vertexCount)
+			uint32_t vertexCount = 0;
+			const uint32_t* indices = nullptr;	// Op`Xg
+			uint32_t indexCount = 0;
+		};
+
+		/**
+		 * @brief _Cg̋Ԃɓe
+		 */
+		struct ShadowProjection {
+			ShadowTestFlag flag = ShadowTestFlag::Lit;
+			bool needsSample = false;	// true: VhE}bvƂ̔rKv(flag͖m)
+			int32_t texelX = 0;
+			int32_t texelY = 0;
+			float depth = 0.0f;
+		};
+
+		/**
+		 * @brief _Cg̋ԂɓeAVhE}bvOɌ܂锻s
+		 *	oCAX / wZero / outUV / outZ /  / ~̔̓VF[_[ƓԂƎ
+		 * @param _light Cg
+		 * @param _point _(xyz)
+		 * @param _width VhE}bv̕
+		 * @param _height VhE}bv̍
+		 * @return e
+		 */
+		ShadowProjection ProjectShadowTestPoint(const ShadowLightParams& _light, const float* _point, uint32_t _width, uint32_t _height);
+
+		/**
+		 * @brief CPUł̉e
+		 *
+		 * 1. CgƂɓ_𓊉eAVhE}bvKveNZ͈̔͂߂
+		 * 2. ͈̔͂[x摜ƂăX^CY(Cg x s̑тƂɕ)
+		 *    Nbv / 16.8Œ菬_ւ̃Xibv / ニ[ / ʃJO / [xoCAX / LESS_EQUAL D3D11̋Kɍ킹
+		 * 3. _Ƃɐ[xr(_Ƃɕ)
+		 * Ɨp̃obt@͎g񂷂̂ŁAt[Ăłmۂ͂قƂǋNȂB
+		 */
+		class SoftwareShadowTester final {
+		public:
+			explicit SoftwareShadowTester(const ShadowRasterDesc& _desc = {}) : desc_(_desc) {}
+
+			/**
+			 * @brief e̎s
+			 * @param _lights Cg(̏ԂXCX̏)
+			 * @param _casters e𗎂Ƃ`
+			 * @param _points _(xyz * _pointCount)
+			 * @param _pointCount _̐
+			 * @param _jobSystem 񉻂ɎgJobSystem(nullptrȂ璼)
+			 * @param _outFlags  [light * _pointCount + point]
+			 */
+			void Execute(const std::vector<ShadowLightParams>& _lights, const std::vector<ShadowCaster>& _casters,
+				const float* _points, uint32_t _pointCount, JobSystem* _jobSystem, std::vector<ShadowTestFlag>& _outFlags);
+
+			const ShadowRasterDesc& GetDesc() const { return desc_; }
+			uint64_t GetLastRasterizedTexels() const { return last_rasterized_texels_; }	// ߂ŕ`[x摜̖ʐ(eNZ)
+
+		private:
+			/**
+			 * @brief Cg̍Ɨpf[^
+			 */
+			struct LightWork {
+				std::vector<float> clip{};				// NbvW(xyzw * _, S`)
+				std::vector<float> screen{};			// XN[W(xyz * _, NbvsvȒ_̂ݗL)
+				std::vector<uint8_t> outcodes{};		// _ǂ̖ʂ̊O
+				std::vector<uint32_t> vertexOffsets{};	// `󂲂Ƃ̐擪̒_
+				std::vector<float> depth{};				// [x摜(rect͈̔͂̂)
+				int32_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;	// [x摜͈̔ [x0, x1) x [y0, y1)
+			};
+
+			/**
+			 * @brief ш̃X^CY
+			 */
+			struct BandTask {
+				uint32_t light = 0;
+				int32_t y0 = 0;
+				int32_t y1 = 0;
+			};
+
+			void PrepareLight(uint32_t _light, const std::vector<ShadowLightParams>& _lights, const std::vector<ShadowCaster>& _casters,
+				const float* _points, uint32_t _pointCount);
+			void RasterizeBand(const BandTask& _task, const std::vector<ShadowCaster>& _casters);
+
+		private:
+			ShadowRasterDesc desc_{};
+			std::vector<LightWork> lights_{};
+			std::vector<ShadowProjection> projections_{};	// [light * pointCount + point]
+			std::vector<BandTask> tasks_{};
+			uint64_t last_rasterized_texels_ = 0;
+		};
+	}
+}
@@ -0,0 +1,211 @@
+/**
+ * @file JobSystem.cpp
+ * @brief [NXeB[ÕWuVXe
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <DX3D/Core/JobSystem.h>
+
+namespace {
+	thread_local const dx3d::JobSystem* t_owner = nullptr;	// ̃XbhWuVXe
+	thread_local uint32_t t_queue_index = 0;				// ̃Xbh̃L[Index
+}
+
+namespace dx3d {
+	/**
+	 * @brief RXgN^
+	 * @param _workerCount [J[(0ȂRA - 1)
+	 */
+	JobSystem::JobSystem(uint32_t _workerCount)
+	{
+		const unsigned hw = std::thread::hardware_concurrency();
+		const uint32_t workerCount = (_workerCount != 0) ? _workerCount : ((hw > 1) ? hw - 1 : 0);
+
+		queues_.reserve(workerCount + 1);
+		for (uint32_t i = 0; i < workerCount + 1; ++i) {
+			queues_.push_back(std::make_unique<WorkQueue>());
+		}
+
+		workers_.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i) {
+			workers_.emplace_back([this, i]() { WorkerLoop(i + 1); });
+		}
+	}
+
+	/**
+	 * @brief fXgN^
+	 *	ς܂ꂽ܂܎cĂWu͎sȂ
+	 */
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(sleep_mutex_);
+			stop_.store(true, std::memory_order_release);
+		}
+		sleep_cv_.notify_all();
+		for (auto& worker : workers_) {
+			worker.join();
+		}
+	}
+
+	/**
+	 * @brief Wuς
+	 * @param _job s鏈
+	 * @param _counter 𐔂JE^(svȂnullptr)
+	 */
+	void JobSystem::Run(JobFunc _job, JobCounter* _counter)
+	{
+		if (_counter) {
+			_counter->value_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// [J[Ȃ玩̃L[AȊO͋L̃L[
+		const uint32_t queue = (t_owner == this) ? t_queue_index : 0;
+		{
+			auto& q = *queues_[queue];
+			std::lock_guard lock(q.mutex);
+			q.jobs.push_back(Job{ std::move(_job), _counter });
+		}
+
+		pending_.fetch_add(1, std::memory_order_release);
+		{
+			// Q钼O̔ƓႢɂȂȂ悤ɁAxbNʂĂN
+			std::lock_guard lock(sleep_mutex_);
+		}
+		sleep_cv_.notify_one();
+	}
+
+	/**
+	 * @brief JE^0ɂȂ܂ő҂i҂ĂԂWusj
+	 * @param _counter ҂JE^
+	 */
+	void JobSystem::Wait(JobCounter& _counter)
+	{
+		const uint32_t queue = (t_owner == this) ? t_queue_index : 0;
+		while (!_counter.IsDone()) {
+			if (!TryRunOne(queue)) {
+				std::this_thread::yield();
+			}
+		}
+
+		std::exception_ptr error{};
+		{
+			std::lock_guard lock(_counter.error_mutex_);
+			std::swap(error, _counter.error_);
+		}
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+	//! @brief ̃XbhIndex
+	uint32_t JobSystem::GetCurrentThreadIndex()
+	{
+		return t_queue_index;
+	}
+
+	/**
+	 * @brief ̃L[̌납
+	 * @param _queue L[Index
+	 * @param _out Wu
+	 * @return true: ꂽ
+	 */
+	bool JobSystem::TryPop(uint32_t _queue, Job& _out)
+	{
+		auto& q = *queues_[_queue];
+		std::lock_guard lock(q.mutex);
+		if (q.jobs.empty()) { return false; }
+		_out = std::move(q.jobs.back());
+		q.jobs.pop_back();
+		return true;
+	}
+
+	/**
+	 * @brief ̃L[̑O瓐
+	 *	ׂ珇ɌĂ̂ŁAސ悪ӏɕ΂Ȃ
+	 * @param _thief ޑ̃L[Index
+	 * @param _out Wu
+	 * @return true: ꂽ
+	 */
+	bool JobSystem::TrySteal(uint32_t _thief, Job& _out)
+	{
+		const uint32_t count = static_cast<uint32_t>(queues_.size());
+		for (uint32_t i = 1; i < count; ++i) {
+			auto& q = *queues_[(_thief + i) % count];
+			std::lock_guard lock(q.mutex);
+			if (q.jobs.empty()) { continue; }
+			_out = std::move(q.jobs.front());
+			q.jobs.pop_front();
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Wus
+	 * @param _queue ̃L[Index
+	 * @return true: s, false: Ȃ
+	 */
+	bool JobSystem::TryRunOne(uint32_t _queue)
+	{
+		Job job;
+		if (!TryPop(_queue, job) && !TrySteal(_queue, job)) {
+			return false;
+		}
+		pending_.fetch_sub(1, std::memory_order_relaxed);
+		Execute(job);
+		return true;
+	}
+
+	/**
+	 * @brief Wu̎s
+	 *	O̓JE^ɗaWaitœBJE^͗OoĂK炷
+	 * @param _job sWu
+	 */
+	void JobSystem::Execute(Job& _job)
+	{
+		struct CounterGuard {
+			JobCounter* counter;
+			~CounterGuard() {
+				if (counter) {
+					counter->value_.fetch_sub(1, std::memory_order_acq_rel);
+				}
+			}
+		};
+		CounterGuard guard{ _job.counter };
+
+		try {
+			_job.func();
+		}
+		catch (...) {
+			// ҂lȂWu̗O͎󂯎肪Ȃ̂ŁÂ܂ܓ
+			if (!_job.counter) { throw; }
+			std::lock_guard lock(_job.counter->error_mutex_);
+			if (!_job.counter->error_) {
+				_job.counter->error_ = std::current_exception();
+			}
+		}
+	}
+
+	/**
+	 * @brief [J[Xbh̏
+	 * @param _index ̃L[Index
+	 */
+	void JobSystem::WorkerLoop(uint32_t _index)
+	{
+		t_owner = this;
+		t_queue_index = _index;
+
+		while (!stop_.load(std::memory_order_acquire)) {
+			if (TryRunOne(_index)) { continue; }
+
+			// Ȃΐς܂܂ŐQ
+			std::unique_lock lock(sleep_mutex_);
+			sleep_cv_.wait(lock, [&]() {
+				return stop_.load(std::memory_order_acquire) || pending_.load(std::memory_order_acquire) > 0;
+			});
+		}
+	}
+}
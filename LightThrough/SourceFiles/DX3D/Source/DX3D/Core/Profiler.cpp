@@ -0,0 +1,320 @@
+/**
+ * @file Profiler.cpp
+ * @brief XR[vPʂ̋Ԍv(t[vt@C)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include <DX3D/Core/Profiler.h>
+#include <DX3D/Core/JobSystem.h>
+#include <Debug/Debug.h>
+
+namespace {
+	/**
+	 * @brief Xbh̃Oobt@
+	 *	͎̂̃XbhÂNextFrameĂԃXbh
+	 */
+	struct ThreadRing {
+		std::unique_ptr<dx3d::ProfileEvent[]> events = std::make_unique<dx3d::ProfileEvent[]>(dx3d::Profiler::RING_SIZE);
+		std::atomic<uint64_t> head{ 0 };	// (݌v)
+		uint64_t read = 0;					// ς݂̐(݌v)
+		uint16_t thread = 0;
+		std::string name{};
+	};
+
+	/**
+	 * @brief vt@C̏
+	 */
+	struct ProfilerState {
+		std::mutex mutex{};	// rings̒ǉ /  / O̕ی
+		std::vector<std::unique_ptr<ThreadRing>> rings{};
+		std::atomic<bool> enabled{ true };
+		std::atomic<uint64_t> dropped{ 0 };
+		std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+		// (CXbĥ)
+		std::vector<dx3d::ProfileFrame> history = std::vector<dx3d::ProfileFrame>(dx3d::Profiler::HISTORY_FRAMES);
+		uint32_t historyHead = 0;	// ɏʒu
+		uint32_t historyCount = 0;
+		uint64_t frameIndex = 0;
+		uint64_t frameStartNs = 0;
+
+		// Lv`(CXbĥ)
+		std::vector<dx3d::ProfileFrame> capture{};
+		uint32_t captureRemaining = 0;
+		std::string capturePath{};
+	};
+
+	ProfilerState& State()
+	{
+		static ProfilerState state;
+		return state;
+	}
+
+	thread_local ThreadRing* t_ring = nullptr;	// ̃Xbh̃O
+	thread_local uint32_t t_depth = 0;			// ̃Xbh̓q̐[
+
+	/**
+	 * @brief ̃Xbh̃O擾(΍)
+	 */
+	ThreadRing& GetThreadRing()
+	{
+		if (t_ring) { return *t_ring; }
+
+		auto& state = State();
+		std::lock_guard lock(state.mutex);
+		auto ring = std::make_unique<ThreadRing>();
+		ring->thread = static_cast<uint16_t>(state.rings.size());
+		const uint32_t worker = dx3d::JobSystem::GetCurrentThreadIndex();
+		ring->name = (worker != 0) ? std::format("Worker {}", worker) : std::format("Thread {}", ring->thread);
+		t_ring = ring.get();
+		state.rings.push_back(std::move(ring));
+		return *t_ring;
+	}
+
+	/**
+	 * @brief JSON̕Ƃď悤ɂ
+	 */
+	std::string EscapeJson(const char* _str)
+	{
+		std::string out;
+		for (const char* p = _str; *p; ++p) {
+			if (*p == '"' || *p == '\\') { out += '\\'; }
+			if (static_cast<unsigned char>(*p) < 0x20) { continue; }
+			out += *p;
+		}
+		return out;
+	}
+}
+
+namespace dx3d {
+	void Profiler::SetEnabled(bool _enabled)
+	{
+		State().enabled.store(_enabled, std::memory_order_relaxed);
+	}
+
+	bool Profiler::IsEnabled()
+	{
+		return State().enabled.load(std::memory_order_relaxed);
+	}
+
+	uint64_t Profiler::NowNs()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - State().epoch).count());
+	}
+
+	/**
+	 * @brief Ԃ
+	 *	Oςł҂ɏ㏑(Ŏ̂Ă𐔂)
+	 */
+	void Profiler::Record(const char* _name, uint64_t _startNs, uint64_t _endNs, uint32_t _depth)
+	{
+		ThreadRing& ring = GetThreadRing();
+		const uint64_t head = ring.head.load(std::memory_order_relaxed);
+		ring.events[head & (RING_SIZE - 1)] = ProfileEvent{
+			.name = _name,
+			.startNs = _startNs,
+			.endNs = _endNs,
+			.thread = ring.thread,
+			.depth = static_cast<uint16_t>(_depth),
+		};
+		ring.head.store(head + 1, std::memory_order_release);
+	}
+
+	/**
+	 * @brief t[̋؂
+	 *	Ɏ傪i߂ď㏑ꂽ́AǂݏIheadĎ̂Ă
+	 */
+	void Profiler::NextFrame()
+	{
+		auto& state = State();
+		const uint64_t now = NowNs();
+
+		ProfileFrame& frame = state.history[state.historyHead];
+		frame.frameIndex = state.frameIndex++;
+		frame.startNs = state.frameStartNs;
+		frame.endNs = now;
+		frame.events.clear();	// mۍς݂̗͎̈g
+		state.frameStartNs = now;
+
+		{
+			std::lock_guard lock(state.mutex);
+			for (auto& ring : state.rings) {
+				const uint64_t head = ring->head.load(std::memory_order_acquire);
+				uint64_t from = ring->read;
+				if (head - from > RING_SIZE) {
+					state.dropped.fetch_add(head - RING_SIZE - from, std::memory_order_relaxed);
+					from = head - RING_SIZE;
+				}
+
+				const size_t base = frame.events.size();
+				for (uint64_t i = from; i < head; ++i) {
+					frame.events.push_back(ring->events[i & (RING_SIZE - 1)]);
+				}
+
+				// ǂłԂɏ㏑ꂽ̂Ă
+				const uint64_t after = ring->head.load(std::memory_order_acquire);
+				if (after - from > RING_SIZE) {
+					const uint64_t overwritten = (std::min)(after - RING_SIZE - from, head - from);
+					frame.events.erase(frame.events.begin() + base, frame.events.begin() + base + static_cast<size_t>(overwritten));
+					state.dropped.fetch_add(overwritten, std::memory_order_relaxed);
+				}
+				ring->read = head;
+			}
+		}
+
+		// Xbh -> Jn -> O ̏ɕׂ(\ / oŎg₷悤)
+		std::sort(frame.events.begin(), frame.events.end(), [](const ProfileEvent& _a, const ProfileEvent& _b) {
+			if (_a.thread != _b.thread) { return _a.thread < _b.thread; }
+			if (_a.startNs != _b.startNs) { return _a.startNs < _b.startNs; }
+			return _a.depth < _b.depth;
+			});
+
+		state.historyHead = (state.historyHead + 1) % HISTORY_FRAMES;
+		state.historyCount = (std::min)(state.historyCount + 1, HISTORY_FRAMES);
+
+		// Lv`
+		if (state.captureRemaining > 0) {
+			state.capture.push_back(frame);
+			if (--state.captureRemaining == 0) {
+				if (ExportChromeTrace(state.capture, state.capturePath)) {
+					DebugLogInfo("[Profiler] {}t[o܂: '{}'", state.capture.size(), state.capturePath);
+				}
+				state.capture.clear();
+			}
+		}
+	}
+
+	/**
+	 * @brief Lv`̊Jn
+	 *	NextFrameŉt[琔
+	 */
+	void Profiler::StartCapture(uint32_t _frames, const std::string& _path)
+	{
+		auto& state = State();
+		state.capture.clear();
+		state.capture.reserve(_frames);
+		state.captureRemaining = _frames;
+		state.capturePath = _path;
+	}
+
+	bool Profiler::IsCapturing()
+	{
+		return State().captureRemaining > 0;
+	}
+
+	uint32_t Profiler::GetCaptureRemaining()
+	{
+		return State().captureRemaining;
+	}
+
+	/**
+	 * @brief Chromẽg[X`ŏo
+	 *	Ԃ"X"(Jn + )At[͈ԉɕʂ̃gbNƂĕׂ
+	 */
+	bool Profiler::ExportChromeTrace(const std::vector<ProfileFrame>& _frames, const std::string& _path)
+	{
+		std::error_code ec;
+		const auto dir = std::filesystem::path(_path).parent_path();
+		if (!dir.empty()) { std::filesystem::create_directories(dir, ec); }
+
+		std::ofstream ofs(_path, std::ios::trunc);
+		if (!ofs.is_open()) {
+			DebugLogError("[Profiler] t@CJ܂ł: '{}'", _path);
+			return false;
+		}
+
+		const uint32_t threadCount = GetThreadCount();
+		ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		// Xbh
+		for (uint32_t t = 0; t < threadCount; ++t) {
+			ofs << std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}},\n",
+				t, EscapeJson(GetThreadName(t).c_str()));
+		}
+		ofs << std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"Frames\"}}}}", threadCount);
+
+		for (const auto& frame : _frames) {
+			ofs << std::format(",\n{{\"name\":\"Frame {}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+				frame.frameIndex, frame.startNs / 1000.0, (frame.endNs - frame.startNs) / 1000.0, threadCount);
+			for (const auto& e : frame.events) {
+				ofs << std::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+					EscapeJson(e.name), e.startNs / 1000.0, (e.endNs - e.startNs) / 1000.0, e.thread);
+			}
+		}
+		ofs << "\n]}\n";
+		return static_cast<bool>(ofs);
+	}
+
+	const ProfileFrame* Profiler::GetFrame(uint32_t _back)
+	{
+		auto& state = State();
+		if (_back >= state.historyCount) { return nullptr; }
+		const uint32_t index = (state.historyHead + HISTORY_FRAMES - 1 - _back) % HISTORY_FRAMES;
+		return &state.history[index];
+	}
+
+	uint32_t Profiler::GetFrameCount()
+	{
+		return State().historyCount;
+	}
+
+	void Profiler::SetCurrentThreadName(const std::string& _name)
+	{
+		ThreadRing& ring = GetThreadRing();
+		std::lock_guard lock(State().mutex);
+		ring.name = _name;
+	}
+
+	uint32_t Profiler::GetThreadCount()
+	{
+		auto& state = State();
+		std::lock_guard lock(state.mutex);
+		return static_cast<uint32_t>(state.rings.size());
+	}
+
+	std::string Profiler::GetThreadName(uint32_t _thread)
+	{
+		auto& state = State();
+		std::lock_guard lock(state.mutex);
+		return (_thread < state.rings.size()) ? state.rings[_thread]->name : std::string{};
+	}
+
+	uint64_t Profiler::GetDroppedCount()
+	{
+		return State().dropped.load(std::memory_order_relaxed);
+	}
+
+
+	/**
+	 * @brief vJn
+	 *	Off̊ԂɎn܂XR[v͌vȂ
+	 */
+	ProfileScope::ProfileScope(const char* _name)
+	{
+		if (!Profiler::IsEnabled()) { return; }
+		name_ = _name;
+		depth_ = t_depth++;
+		start_ns_ = Profiler::NowNs();
+	}
+
+	/**
+	 * @brief vI
+	 */
+	ProfileScope::~ProfileScope()
+	{
+		if (!name_) { return; }
+		const uint64_t end = Profiler::NowNs();
+		--t_depth;
+		Profiler::Record(name_, start_ns_, end, depth_);
+	}
+}
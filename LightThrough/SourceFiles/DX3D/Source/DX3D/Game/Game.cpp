@@ -5,6 +5,9 @@
 
  /*---------- CN[h ----------*/
 #include <DX3D/Game/Game.h>
+#include <DX3D/Game/GameSystems.h>
+#include <DX3D/Core/JobSystem.h>
+#include <DX3D/Core/Profiler.h>
 #include <DX3D/Graphics/GraphicsEngine.h>
 #include <DX3D/Graphics/GraphicsDevice.h>
 #include <DX3D/Game/Display.h>
@@ -13,140 +16,214 @@
 #include <DX3D/Graphics/Textures/TextureRegistry.h>
 #include <Game/InputSystem/InputSystem.h>
 
-#include <Game/Systems/Initialization/Resolve/ObjectResolveSystem.h>
-#include <Game/Systems/Initialization/Resolve/MoveDirectionSourceResolveSystem.h>
-#include <Game/Systems/Initialization/Resolve/LightReferenceResolveSystem.h>
-#include <Game/Systems/Initialization/Resolve/MeshHandleResolveSystem.h>
 #include <Game/Systems/Initialization/Resolve/TextureHandleResolveSystem.h>
-
-#include <Game/Systems/TransformSystem.h>
-#include <Game/Systems/CameraSystem.h>
 #include <Game/Systems/Renderers/LightDepthRenderSystem.h>
 #include <Game/Systems/Renderers/RenderSystem.h>
 #include <Game/Systems/Renderers/SpriteRenderSystem.h>
 #include <Game/Systems/Renderers/OutlineRenderSystem.h>
 #include <Game/Systems/Renderers/DebugRenderSystem.h>
-#include <Game/Systems/Collisions/ColliderSyncSystem.h>
-#include <Game/Systems/Collisions/CollisionResolveSystem.h>
-#include <Game/Systems/Physics/GroundDetectionSystem.h>
-#include <Game/Systems/Physics/ForceAccumulationSystem.h>
-#include <Game/Systems/Physics/IntegrationSystem.h>
-#include <Game/Systems/Physics/ClearForcesSystem.h>
-#include <Game/Systems/PlayerControllerSystem.h>
-#include <Game/Systems/Scenes/TitleSceneSystem.h>
-#include <Game/Systems/Gimmicks/ShadowTestSystem.h>
-#include <Game/Systems/Gimmicks/LightSpawnSystem.h>
-
-#include <Game/Components/Core/Name.h>
+
 #include <Game/Components/Core/Transform.h>
-#include <Game/Components/Core/ObjectRoot.h>
-#include <Game/Components/Core/ObjectChild.h>
 #include <Game/Components/Render/MeshRenderer.h>
 #include <Game/Components/Render/SpriteRenderer.h>
 #include <Game/Components/Render/Light.h>
 #include <Game/Components/Camera/Camera.h>
-#include <Game/Components/Input/CameraController.h>
-#include <Game/Components/Input/PlayerController.h>
-#include <Game/Components/Input/MoveDirectionSource.h>
 #include <Game/Components/Physics/Collider.h>
-#include <Game/Components/Physics/Rigidbody.h>
-#include <Game/Components/Physics/GroundContact.h>
-#include <Game/Components/GamePlay/LightPlaceRequest.h>
+
+#include <Game/ECS/SystemScheduler.h>
 
 #include <Debug/DebugUI.h>
 #include <Debug/Debug.h>
 
+
 #pragma region [J\bh
 namespace {
 
 	/**
-	 * @brief R|[lg̓o^
-	 * @param _ecs ECS̃R[fBl[^[
+	 * @brief `nSystem̓o^(GPUɐGSystem͂)
+	 * @return RegisterGameSystemsɓntbN
 	 */
-	void RegisterAllComponents(ecs::Coordinator& _ecs)
+	dx3d::GameSystemHooks MakeRenderHooks()
 	{
-		// todo: Componento^@\~BVXeo^iKŁAR|[lg}l[W̒ɂłɓo^Ă炻̃VOl`gAȂΐVɂƂ...
-		_ecs.RegisterComponent<ecs::Transform>();
-		_ecs.RegisterComponent<ecs::MeshRenderer>();
-		_ecs.RegisterComponent<ecs::SpriteRenderer>();
-		_ecs.RegisterComponent<ecs::Camera>();
-		_ecs.RegisterComponent<ecs::CameraController>();
-		_ecs.RegisterComponent<ecs::Collider>();
-		_ecs.RegisterComponent<ecs::Rigidbody>();
-		_ecs.RegisterComponent<ecs::GroundContact>();
-		_ecs.RegisterComponent<ecs::LightCommon>();
-		_ecs.RegisterComponent<ecs::SpotLight>();
-		_ecs.RegisterComponent<ecs::PlayerController>();
-		_ecs.RegisterComponent<ecs::MoveDirectionSource>();
-		_ecs.RegisterComponent<ecs::Name>();
-		_ecs.RegisterComponent<ecs::ObjectRoot>();
-		_ecs.RegisterComponent<ecs::ObjectChild>();
-		_ecs.RegisterComponent<ecs::LightPlaceRequest>();
+		using ecs::SystemAccess;
+		using ecs::SystemResource;
+
+		dx3d::GameSystemHooks hooks{};
+		hooks.resolve = [](ecs::SystemDesc& _systemDesc) {
+			_systemDesc.ecs.RegisterSystem<ecs::TextureHandleResolveSystem>(_systemDesc);
+		};
+		hooks.shadowPass = [](ecs::SystemDesc& _systemDesc) {
+			auto& ecs = _systemDesc.ecs;
+			ecs.RegisterSystem<ecs::LightDepthRenderSystem>(_systemDesc, SystemAccess{
+				.resources = SystemResource::Graphics | SystemResource::Shadow });
+		};
+		hooks.render = [](ecs::SystemDesc& _systemDesc) {
+			auto& ecs = _systemDesc.ecs;
+			ecs.RegisterSystem<ecs::RenderSystem>(_systemDesc, SystemAccess{
+				.reads = ecs.MakeSignature<ecs::Transform, ecs::MeshRenderer, ecs::Camera, ecs::LightCommon, ecs::SpotLight>(),
+				.resources = SystemResource::Graphics | SystemResource::Shadow | SystemResource::DebugDraw });
+			ecs.RegisterSystem<ecs::OutlineRenderSystem>(_systemDesc, SystemAccess{
+				.resources = SystemResource::Graphics });
+			ecs.RegisterSystem<ecs::SpriteRenderSystem>(_systemDesc, SystemAccess{
+				.reads = ecs.MakeSignature<ecs::Transform, ecs::SpriteRenderer>(),
+				.resources = SystemResource::Graphics });
+
+
+			ecs.RegisterSystem<ecs::DebugRenderSystem>(_systemDesc, SystemAccess{
+				.reads = ecs.MakeSignature<ecs::Camera, ecs::Collider>(),
+				.resources = SystemResource::Graphics | SystemResource::DebugDraw | SystemResource::Shadow });
+		};
+		return hooks;
 	}
+
 	/**
-	 * @brief VXe̓o^
-	 * @param _ecs ECS̃R[fBl[^[
+	 * @brief SystemXPW[̓v\
+	 * @param _scheduler \XPW[
 	 */
-	void RegisterAllSystems(ecs::SystemDesc& _systemDesc)
+	void RenderSchedulerStats(ecs::SystemScheduler& _scheduler)
 	{
-		auto& ecs = _systemDesc.ecs;
-
-		// ---------- ֌W ----------
-		_systemDesc.oneShot = true;
-		ecs.RegisterSystem<ecs::ObjectResolveSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::MoveDirectionSourceResolveSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::LightReferenceResolveSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::MeshHandleResolveSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::TextureHandleResolveSystem>(_systemDesc);
-
-		// ---------- Q[֌W ----------
-		_systemDesc.oneShot = false;
-
-		// ͊֌W
-		ecs.RegisterSystem<ecs::PlayerControllerSystem>(_systemDesc);
-
-		ecs.RegisterSystem<ecs::LightSpawnSystem>(_systemDesc);
-
-		// ͂̏Wv
-		ecs.RegisterSystem<ecs::ForceAccumulationSystem>(_systemDesc);
-
-		// \ xʒủKp
-		ecs.RegisterSystem<ecs::IntegrationSystem>(_systemDesc);
-
-		// Transform  Collider(worldOBB ) 𓯊
-		ecs.RegisterSystem<ecs::ColliderSyncSystem>(_systemDesc);
+#if defined(DEBUG) || defined(_DEBUG)
+		using Phase = ecs::SystemScheduler::Phase;
 
-		// ShadowMap(Cg[x) ̍XV
-		ecs.RegisterSystem<ecs::LightDepthRenderSystem>(_systemDesc);
-
-		// e̒ɂ邩
-		ecs.RegisterSystem<ecs::ShadowTestSystem>(_systemDesc);
-		// oEECȂ
-		ecs.RegisterSystem<ecs::CollisionResolveSystem>(_systemDesc);
-		// nʐڒn
-		ecs.RegisterSystem<ecs::GroundDetectionSystem>(_systemDesc);
-
-
-		// ͂̃NA
-		ecs.RegisterSystem<ecs::ClearForcesSystem>(_systemDesc);
-
-		// ^CgƎ̍XV
-		ecs.RegisterSystem<ecs::TitleSceneSystem>(_systemDesc);
+		ImGui::Begin("System Scheduler");
+		bool parallel = _scheduler.IsParallel();
+		if (ImGui::Checkbox("Parallel", &parallel)) {
+			_scheduler.SetParallel(parallel);
+		}
 
-		// eqȂ
-		ecs.RegisterSystem<ecs::TransformSystem>(_systemDesc);
+		for (auto phase : { Phase::FixedUpdate, Phase::Update }) {
+			const auto& stats = _scheduler.GetStats(phase);
+			const char* label = (phase == Phase::Update) ? "Update" : "FixedUpdate";
+			// work / criticalPath x̏
+			const float parallelism = (stats.criticalPathMs > 0.0f) ? stats.workMs / stats.criticalPathMs : 1.0f;
+			ImGui::Text("%s: wall %.3f ms / work %.3f ms / critical path %.3f ms (x%.2f)",
+				label, stats.wallMs, stats.workMs, stats.criticalPathMs, parallelism);
+		}
+		ImGui::Text("systems %u / edges %u / workers %u",
+			_scheduler.GetStats(Phase::Update).systemCount,
+			_scheduler.GetStats(Phase::Update).edgeCount,
+			_scheduler.GetStats(Phase::Update).workerCount);
+
+		if (ImGui::BeginTable("Systems", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+			ImGui::TableSetupColumn("System");
+			ImGui::TableSetupColumn("Fixed ms");
+			ImGui::TableSetupColumn("Update ms");
+			ImGui::TableHeadersRow();
+			for (size_t i = 0; i < _scheduler.GetSystemCount(); ++i) {
+				ImGui::TableNextRow();
+				ImGui::TableSetColumnIndex(0);
+				ImGui::TextUnformatted(_scheduler.GetSystemName(i));
+				// ŒoHɊ܂܂̂͐Fς
+				for (auto phase : { Phase::FixedUpdate, Phase::Update }) {
+					ImGui::TableNextColumn();
+					const float ms = _scheduler.GetLastSystemMs(i, phase);
+					if (_scheduler.IsOnCriticalPath(i, phase)) {
+						ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%.3f *", ms);
+					}
+					else {
+						ImGui::Text("%.3f", ms);
+					}
+				}
+			}
+			ImGui::EndTable();
+		}
+		ImGui::End();
+#endif
+	}
 
-		// JE`n
-		ecs.RegisterSystem<ecs::CameraSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::RenderSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::OutlineRenderSystem>(_systemDesc);
-		ecs.RegisterSystem<ecs::SpriteRenderSystem>(_systemDesc);
+	/**
+	 * @brief vt@C̃tCOt\
+	 *	XbhƂɈiAq̐[ŉɐςށB̓t[̎
+	 */
+	void RenderProfiler()
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		using dx3d::Profiler;
+		static dx3d::ProfileFrame snapshot{};	// \̃t[(~߂ĂԂ͍XVȂ)
+		static bool paused = false;
+		static float pauseOverMs = 0.0f;		// ̃t[Ԃ𒴂~߂(0: ~߂Ȃ)
+		static int captureFrames = 120;
+
+		ImGui::Begin("Profiler");
+		bool enabled = Profiler::IsEnabled();
+		if (ImGui::Checkbox("Enabled", &enabled)) {
+			Profiler::SetEnabled(enabled);
+		}
+		ImGui::SameLine();
+		ImGui::Checkbox("Pause", &paused);
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(120.0f);
+		ImGui::DragFloat("Pause over (ms)", &pauseOverMs, 0.1f, 0.0f, 1000.0f);
+
+		// Chromẽg[X`ŏo
+		ImGui::SetNextItemWidth(120.0f);
+		ImGui::InputInt("Frames", &captureFrames);
+		captureFrames = (std::max)(captureFrames, 1);
+		ImGui::SameLine();
+		if (Profiler::IsCapturing()) {
+			ImGui::Text("Capturing... %u", Profiler::GetCaptureRemaining());
+		}
+		else if (ImGui::Button("Capture")) {
+			Profiler::StartCapture(static_cast<uint32_t>(captureFrames), "DebugLog/ProfileTrace.json");
+		}
+		ImGui::Text("dropped %llu", static_cast<unsigned long long>(Profiler::GetDroppedCount()));
 
+		if (!paused) {
+			if (const auto* latest = Profiler::GetFrame(0)) {
+				snapshot = *latest;
+				const float ms = static_cast<float>(snapshot.endNs - snapshot.startNs) / 1000000.0f;
+				if (pauseOverMs > 0.0f && ms > pauseOverMs) { paused = true; }
+			}
+		}
 
-		ecs.RegisterSystem<ecs::DebugRenderSystem>(_systemDesc);
+		const uint64_t frameNs = (snapshot.endNs > snapshot.startNs) ? snapshot.endNs - snapshot.startNs : 1;
+		ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(snapshot.frameIndex), frameNs / 1000000.0);
+		ImGui::Separator();
+
+		constexpr float ROW_HEIGHT = 18.0f;
+		const float width = (std::max)(ImGui::GetContentRegionAvail().x, 100.0f);
+		const double scale = width / static_cast<double>(frameNs);
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+		// Cxg̓Xbh -> Jn̏ɕł
+		size_t begin = 0;
+		while (begin < snapshot.events.size()) {
+			const uint16_t thread = snapshot.events[begin].thread;
+			size_t end = begin;
+			uint16_t maxDepth = 0;
+			while (end < snapshot.events.size() && snapshot.events[end].thread == thread) {
+				maxDepth = (std::max)(maxDepth, snapshot.events[end].depth);
+				++end;
+			}
 
-		// SVXe
-		ecs.InitAllSystems();
+			ImGui::TextUnformatted(Profiler::GetThreadName(thread).c_str());
+			const ImVec2 origin = ImGui::GetCursorScreenPos();
+			ImGui::InvisibleButton(("##thread" + std::to_string(thread)).c_str(), ImVec2(width, ROW_HEIGHT * (maxDepth + 1)));
+			const bool rowHovered = ImGui::IsItemHovered();
+
+			for (size_t i = begin; i < end; ++i) {
+				const auto& e = snapshot.events[i];
+				// t[܂Ԃ͒[Ő؂
+				const uint64_t s = (std::max)(e.startNs, snapshot.startNs) - snapshot.startNs;
+				const uint64_t t = (std::min)((std::max)(e.endNs, snapshot.startNs), snapshot.endNs) - snapshot.startNs;
+				const ImVec2 p0(origin.x + static_cast<float>(s * scale), origin.y + ROW_HEIGHT * e.depth);
+				const ImVec2 p1((std::max)(origin.x + static_cast<float>(t * scale), p0.x + 1.0f), p0.y + ROW_HEIGHT - 1.0f);
+
+				// OƂɐFŒ
+				const float hue = static_cast<float>(std::hash<const void*>{}(e.name) % 360) / 360.0f;
+				drawList->AddRectFilled(p0, p1, ImColor::HSV(hue, 0.55f, 0.8f));
+				drawList->PushClipRect(p0, p1, true);
+				drawList->AddText(ImVec2(p0.x + 2.0f, p0.y + 1.0f), IM_COL32(0, 0, 0, 255), e.name);
+				drawList->PopClipRect();
+
+				if (rowHovered && ImGui::IsMouseHoveringRect(p0, p1)) {
+					ImGui::SetTooltip("%s\n%.3f ms", e.name, (e.endNs - e.startNs) / 1000000.0);
+				}
+			}
+			begin = end;
+		}
+		ImGui::End();
+#endif
 	}
 } // namespace anonymous
 #pragma endregion
@@ -164,6 +241,7 @@ namespace dx3d {
 	{
 		// fobOO
 		debug::Debug::Init(true);
+		Profiler::SetCurrentThreadName("Main");
 		// COM̏(WIC/DirectXTexp
 		HRESULT hrCo = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
 		if (FAILED(hrCo) && hrCo != RPC_E_CHANGED_MODE) {
@@ -185,23 +263,32 @@ namespace dx3d {
 
 
 			// InputSystem
-			input::InputSystem::Get().Init(static_cast<HWND>(display_->GetHandle()));
+			input::InputSystem::Get().Init(display_->GetHandle());
+
+			// WuVXe̐
+			job_system_ = std::make_unique<JobSystem>();
 			// ECS̃R[fBl[^[̐
 			ecs_coordinator_ = std::make_unique<ecs::Coordinator>(dx3d::BaseDesc{ logger_ });
 			ecs_coordinator_->Init();
+			ecs_coordinator_->SetJobSystem(job_system_.get());
 
 			// SceneManageȑ
 			scene_manager_ = std::make_unique<scene::SceneManager>(scene::SceneManagerDesc{ {logger_}, *ecs_coordinator_ });
 
 			// Component̓o^
-			RegisterAllComponents(*ecs_coordinator_);
+			RegisterGameComponents(*ecs_coordinator_);
 
 			// Scene̐Eǂݍ݁EANeBx[g
 			ChangeScene("TestScene");
 
 			// System̓o^
-			ecs::SystemDesc systemDesc{ {logger_ }, *ecs_coordinator_, *scene_manager_, *graphics_engine_, graphics_engine_->GetMeshRegistry(), graphics_engine_->GetTextureRegistry()};
-			RegisterAllSystems(systemDesc);
+			ecs::SystemDesc systemDesc{ {logger_ }, *ecs_coordinator_, *scene_manager_, graphics_engine_->GetBackend(), graphics_engine_->GetMeshRegistry(), *job_system_ };
+			systemDesc.graphicsEngine = graphics_engine_.get();
+			systemDesc.textureRegistry = &graphics_engine_->GetTextureRegistry();
+			systemDesc.shadowTestBackend = _desc.shadowTestBackend;
+			RegisterGameSystems(systemDesc, MakeRenderHooks());
+			debug::DebugUI::ResistDebugFunction([this]() { RenderSchedulerStats(ecs_coordinator_->GetSystemScheduler()); });
+			debug::DebugUI::ResistDebugFunction([]() { RenderProfiler(); });
 
 			// EntityjR[obNݒ
 			// sceneEntityj邽
@@ -245,7 +332,10 @@ namespace dx3d {
 	{
 		const auto& debugRenderSystem = ecs_coordinator_->GetSystem<ecs::DebugRenderSystem>();
 		// ͂̍XV
-		input::InputSystem::Get().Update();
+		{
+			DX3D_PROFILE_SCOPE("Input");
+			input::InputSystem::Get().Update();
+		}
 		dx3d::Point mouseDelta = input::InputSystem::Get().GetMouseDelta();
 
 		// Ԃ̍XV
@@ -257,10 +347,13 @@ namespace dx3d {
 
 		// `O
 		// Xbv`FC̃Zbg
-		graphics_engine_->SetSwapChain(display_->GetSwapChain());
-		graphics_engine_->BeginFrame();
+		{
+			DX3D_PROFILE_SCOPE("BeginFrame");
+			graphics_engine_->SetSwapChain(display_->GetSwapChain());
+			graphics_engine_->BeginFrame();
+		}
 
-		if (input::InputSystem::Get().IsKeyTrigger(VK_RETURN))
+		if (input::InputSystem::Get().IsKeyTrigger(input::Key::Return))
 		{
 			scene_manager_->ChangeScene("TestScene");
 		}
@@ -284,17 +377,27 @@ namespace dx3d {
 		// System̍XV
 		accumulated_time_ += dt;
 		while (accumulated_time_ >= fixed_time_step_) {
+			DX3D_PROFILE_SCOPE("FixedStep");
 			ecs_coordinator_->FixedUpdateAllSystems(fixed_time_step_);
 			accumulated_time_ -= fixed_time_step_;
 		}
-		ecs_coordinator_->UpdateAllSystems(dt);
+		{
+			DX3D_PROFILE_SCOPE("Update");
+			ecs_coordinator_->UpdateAllSystems(dt);
+		}
 		ecs_coordinator_->FlushPending();
 
 		// fobOUI̕`
-		debug::DebugUI::Render();
+		{
+			DX3D_PROFILE_SCOPE("DebugUI");
+			debug::DebugUI::Render();
+		}
 
 		// `
-		graphics_engine_->EndFrame();
+		{
+			DX3D_PROFILE_SCOPE("EndFrame");
+			graphics_engine_->EndFrame();
+		}
 
 #ifdef defined(_DEBUG) || defined(DEBUG)
 		if (auto* dev = graphics_engine_->GetGraphicsDevice().GetD3DDevice().Get()) {
@@ -308,6 +411,8 @@ namespace dx3d {
 		}
 #endif // _DEBUG || DEBUG
 
+		// t[̋؂(Ԃ̉)
+		Profiler::NextFrame();
 	}
 
 	//! @brief V[̕ۑ
@@ -343,5 +448,4 @@ namespace dx3d {
 		ecs_coordinator_->ReactivateAllSystems();	// VXe̍ăANeBu
 		ecs_coordinator_->FlushPending();			// ۗ̕ύX𔽉f
 	}
-
-}
\ No newline at end of file
+}
@@ -0,0 +1,162 @@
+/**
+ * @file GameSystems.cpp
+ * @brief Q[Component / System̓o^
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <DX3D/Game/GameSystems.h>
+#include <Game/ECS/Coordinator.h>
+
+#include <Game/Systems/Initialization/Resolve/ObjectResolveSystem.h>
+#include <Game/Systems/Initialization/Resolve/MoveDirectionSourceResolveSystem.h>
+#include <Game/Systems/Initialization/Resolve/LightReferenceResolveSystem.h>
+#include <Game/Systems/Initialization/Resolve/MeshHandleResolveSystem.h>
+
+#include <Game/Systems/TransformSystem.h>
+#include <Game/Systems/CameraSystem.h>
+#include <Game/Systems/Collisions/ColliderSyncSystem.h>
+#include <Game/Systems/Collisions/CollisionResolveSystem.h>
+#include <Game/Systems/Physics/GroundDetectionSystem.h>
+#include <Game/Systems/Physics/ForceAccumulationSystem.h>
+#include <Game/Systems/Physics/IntegrationSystem.h>
+#include <Game/Systems/Physics/ClearForcesSystem.h>
+#include <Game/Systems/PlayerControllerSystem.h>
+#include <Game/Systems/Scenes/TitleSceneSystem.h>
+#include <Game/Systems/Gimmicks/ShadowCasterSystem.h>
+#include <Game/Systems/Gimmicks/ShadowTestSystem.h>
+#include <Game/Systems/Gimmicks/LightSpawnSystem.h>
+
+#include <Game/Components/Core/Name.h>
+#include <Game/Components/Core/Transform.h>
+#include <Game/Components/Core/ObjectRoot.h>
+#include <Game/Components/Core/ObjectChild.h>
+#include <Game/Components/Render/MeshRenderer.h>
+#include <Game/Components/Render/SpriteRenderer.h>
+#include <Game/Components/Render/Light.h>
+#include <Game/Components/Camera/Camera.h>
+#include <Game/Components/Input/CameraController.h>
+#include <Game/Components/Input/PlayerController.h>
+#include <Game/Components/Input/MoveDirectionSource.h>
+#include <Game/Components/Physics/Collider.h>
+#include <Game/Components/Physics/Rigidbody.h>
+#include <Game/Components/Physics/GroundContact.h>
+#include <Game/Components/GamePlay/LightPlaceRequest.h>
+
+
+namespace dx3d {
+
+	//! @brief R|[lg̓o^
+	void RegisterGameComponents(ecs::Coordinator& _ecs)
+	{
+		// todo: Componento^@\~BVXeo^iKŁAR|[lg}l[W̒ɂłɓo^Ă炻̃VOl`gAȂΐVɂƂ...
+		_ecs.RegisterComponent<ecs::Transform>();
+		_ecs.RegisterComponent<ecs::MeshRenderer>();
+		_ecs.RegisterComponent<ecs::SpriteRenderer>();
+		_ecs.RegisterComponent<ecs::Camera>();
+		_ecs.RegisterComponent<ecs::CameraController>();
+		_ecs.RegisterComponent<ecs::Collider>();
+		_ecs.RegisterComponent<ecs::Rigidbody>();
+		_ecs.RegisterComponent<ecs::GroundContact>();
+		_ecs.RegisterComponent<ecs::LightCommon>();
+		_ecs.RegisterComponent<ecs::SpotLight>();
+		_ecs.RegisterComponent<ecs::PlayerController>();
+		_ecs.RegisterComponent<ecs::MoveDirectionSource>();
+		_ecs.RegisterComponent<ecs::Name>();
+		_ecs.RegisterComponent<ecs::ObjectRoot>();
+		_ecs.RegisterComponent<ecs::ObjectChild>();
+		_ecs.RegisterComponent<ecs::LightPlaceRequest>();
+	}
+
+	//! @brief VXe̓o^
+	void RegisterGameSystems(ecs::SystemDesc& _systemDesc, const GameSystemHooks& _hooks)
+	{
+		auto& ecs = _systemDesc.ecs;
+
+		// ---------- ֌W ----------
+		_systemDesc.oneShot = true;
+		ecs.RegisterSystem<ecs::ObjectResolveSystem>(_systemDesc);
+		ecs.RegisterSystem<ecs::MoveDirectionSourceResolveSystem>(_systemDesc);
+		ecs.RegisterSystem<ecs::LightReferenceResolveSystem>(_systemDesc);
+		ecs.RegisterSystem<ecs::MeshHandleResolveSystem>(_systemDesc);
+		if (_hooks.resolve) { _hooks.resolve(_systemDesc); }
+
+		// ---------- Q[֌W ----------
+		_systemDesc.oneShot = false;
+		// memo: ǂݏComponent / L\[X錾ƁAȂSystemm͕ɓB
+		//       ̓m͓o^̂܂܁B錾ȂSystem͑OƕɂȂȂB
+		using ecs::SystemAccess;
+		using ecs::SystemResource;
+
+		// ͊֌W
+		ecs.RegisterSystem<ecs::PlayerControllerSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::MoveDirectionSource, ecs::CameraController>(),
+			.writes = ecs.MakeSignature<ecs::Transform, ecs::PlayerController, ecs::Rigidbody, ecs::GroundContact, ecs::LightCommon>(),
+			.resources = SystemResource::Input });
+
+		// Entity𒼐ڐ̂Ő錾Ȃ
+		ecs.RegisterSystem<ecs::LightSpawnSystem>(_systemDesc);
+
+		// ͂̏Wv
+		ecs.RegisterSystem<ecs::ForceAccumulationSystem>(_systemDesc, SystemAccess{
+			.writes = ecs.MakeSignature<ecs::Rigidbody>() });
+
+		// \ xʒủKp
+		ecs.RegisterSystem<ecs::IntegrationSystem>(_systemDesc, SystemAccess{
+			.writes = ecs.MakeSignature<ecs::Rigidbody, ecs::Transform>() });
+
+		// Transform  Collider(worldOBB ) 𓯊 (ꂽĂ镨̂͋N)
+		ecs.RegisterSystem<ecs::ColliderSyncSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::Transform>(),
+			.writes = ecs.MakeSignature<ecs::Collider, ecs::Rigidbody>(),
+			.resources = SystemResource::BroadPhase });
+
+		// CgsƃCgƂɉe𗎂Ƃ`̑I
+		ecs.RegisterSystem<ecs::ShadowCasterSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::Transform, ecs::MeshRenderer, ecs::LightCommon, ecs::SpotLight>(),
+			.resources = SystemResource::Shadow });
+
+		// ShadowMap(Cg[x) ̍XV
+		if (_hooks.shadowPass) { _hooks.shadowPass(_systemDesc); }
+
+		// e̒ɂ邩
+		ecs.RegisterSystem<ecs::ShadowTestSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::Transform, ecs::LightCommon, ecs::SpotLight, ecs::Collider>(),
+			.resources = SystemResource::Graphics | SystemResource::Shadow });
+		// oEECȂ
+		ecs.RegisterSystem<ecs::CollisionResolveSystem>(_systemDesc, SystemAccess{
+			.writes = ecs.MakeSignature<ecs::Transform, ecs::Rigidbody, ecs::Collider>(),
+			.resources = SystemResource::Shadow | SystemResource::Contacts | SystemResource::BroadPhase });
+		// nʐڒn
+		ecs.RegisterSystem<ecs::GroundDetectionSystem>(_systemDesc, SystemAccess{
+			.writes = ecs.MakeSignature<ecs::GroundContact>(),
+			.resources = SystemResource::Contacts });
+
+
+		// ͂̃NA
+		ecs.RegisterSystem<ecs::ClearForcesSystem>(_systemDesc, SystemAccess{
+			.writes = ecs.MakeSignature<ecs::Rigidbody>() });
+
+		// ^CgƎ̍XV
+		ecs.RegisterSystem<ecs::TitleSceneSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::LightCommon, ecs::SpotLight>(),
+			.writes = ecs.MakeSignature<ecs::Transform>(),
+			.resources = SystemResource::Scene });
+
+		// eqȂ(ŒXebv̍ŌɂATransformworldVersioni߂)
+		ecs.RegisterSystem<ecs::TransformSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::ObjectChild, ecs::Name>(),
+			.writes = ecs.MakeSignature<ecs::Transform>() });
+
+		// JE`n
+		ecs.RegisterSystem<ecs::CameraSystem>(_systemDesc, SystemAccess{
+			.reads = ecs.MakeSignature<ecs::ObjectChild>(),
+			.writes = ecs.MakeSignature<ecs::Transform, ecs::Camera, ecs::CameraController>(),
+			.resources = SystemResource::Input });
+		if (_hooks.render) { _hooks.render(_systemDesc); }
+
+		// SVXe
+		ecs.InitAllSystems();
+	}
+}
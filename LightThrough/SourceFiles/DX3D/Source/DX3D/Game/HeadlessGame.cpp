@@ -0,0 +1,185 @@
+/**
+ * @file HeadlessGame.cpp
+ * @brief EBhE /  / GPUȂŃQ[System
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <DX3D/Game/HeadlessGame.h>
+#include <DX3D/Game/GameSystems.h>
+#include <DX3D/Core/JobSystem.h>
+#include <DX3D/Core/Profiler.h>
+#include <DX3D/Graphics/NullGraphicsBackend.h>
+#include <DX3D/Graphics/Meshes/MeshRegistry.h>
+#include <DX3D/Graphics/Meshes/PrimitiveFactory.h>
+#include <Game/ECS/SystemScheduler.h>
+
+#include <Debug/Debug.h>
+
+
+namespace dx3d {
+
+	/**
+	 * @brief RXgN^
+	 * @param _desc wbhXs̐ݒ
+	 */
+	HeadlessGame::HeadlessGame(const HeadlessGameDesc& _desc)
+		: Base({ *std::make_unique<Logger>(_desc.logLevel).release() }),
+		logger_ptr_(&logger_),
+		desc_(_desc)
+	{
+		// fobOO(R\[͏oȂ)
+		debug::Debug::Init(false);
+		Profiler::SetCurrentThreadName("Main");
+
+		// `obNGhMesh(CPǓ`󂾂)
+		backend_ = std::make_unique<NullGraphicsBackend>();
+		mesh_registry_ = std::make_unique<MeshRegistry>();
+		PrimitiveFactory::CreateCube(*backend_, *mesh_registry_);
+		PrimitiveFactory::CreateSphere(*backend_, *mesh_registry_);
+		PrimitiveFactory::CreateQuad(*backend_, *mesh_registry_);
+
+		// WuVXe̐
+		job_system_ = std::make_unique<JobSystem>();
+		// ECS̃R[fBl[^[̐
+		ecs_coordinator_ = std::make_unique<ecs::Coordinator>(dx3d::BaseDesc{ logger_ });
+		ecs_coordinator_->Init();
+		ecs_coordinator_->SetJobSystem(job_system_.get());
+
+		// SceneManageȑ
+		scene_manager_ = std::make_unique<scene::SceneManager>(scene::SceneManagerDesc{ {logger_}, *ecs_coordinator_ });
+
+		// Component̓o^
+		RegisterGameComponents(*ecs_coordinator_);
+
+		// Scene̐Eǂݍ݁EANeBx[g
+		scene_manager_->ChangeScene(desc_.scene);
+		ecs_coordinator_->ReactivateAllSystems();
+		ecs_coordinator_->FlushPending();
+
+		// System̓o^(`n͖BGPÛŉeCPU)
+		ecs::SystemDesc systemDesc{ {logger_ }, *ecs_coordinator_, *scene_manager_, *backend_, *mesh_registry_, *job_system_ };
+		systemDesc.shadowTestBackend = ShadowTestBackend::Cpu;
+		RegisterGameSystems(systemDesc, GameSystemHooks{});
+
+		// EntityjR[obNݒ
+		ecs_coordinator_->SetOnEntityDestroyedCallback(
+			[this](ecs::Entity _e) {
+				scene_manager_->OnEntityDestroyed(_e);
+			}
+		);
+
+		DX3DLogInfo("wbhXsJn");
+	}
+
+	HeadlessGame::~HeadlessGame()
+	{
+		DX3DLogInfo("wbhXsI");
+		debug::Debug::Shutdown();
+	}
+
+	/**
+	 * @brief wbhXł̎s
+	 *	1t[ = ŒXV1 + XV1(dt͌Œ)B / fobOUI / V[̃L[͌Ȃ
+	 */
+	uint32_t HeadlessGame::Run()
+	{
+		using Phase = ecs::SystemScheduler::Phase;
+		using clock = std::chrono::high_resolution_clock;
+
+		auto& scheduler = ecs_coordinator_->GetSystemScheduler();
+
+		// SystemƂ̎(tF[YƂɍvƍő)
+		struct SystemTiming {
+			double totalMs[2]{};
+			float maxMs[2]{};
+		};
+		std::vector<SystemTiming> timings;	// ˑOt͍ŏ̍XVō̂ŁAWvɑ
+		double frameTotalMs = 0.0;
+		float frameMaxMs = 0.0f;
+		GraphicsBackendStats peakFrame{};	// `悪ԑt[
+
+		DebugLogInfo("[HeadlessGame] {}  {} t[s", desc_.scene, desc_.frames);
+		Profiler::StartCapture(desc_.frames, "DebugLog/HeadlessTrace.json");
+
+		uint32_t frame = 0;
+		for (; frame < desc_.frames; ++frame) {
+			const auto frameStart = clock::now();
+			{
+				DX3D_PROFILE_SCOPE("BeginFrame");
+				backend_->BeginFrame();
+			}
+			{
+				DX3D_PROFILE_SCOPE("FixedStep");
+				ecs_coordinator_->FixedUpdateAllSystems(desc_.fixedTimeStep);
+			}
+			{
+				DX3D_PROFILE_SCOPE("Update");
+				ecs_coordinator_->UpdateAllSystems(desc_.fixedTimeStep);
+			}
+			ecs_coordinator_->FlushPending();
+			{
+				DX3D_PROFILE_SCOPE("EndFrame");
+				backend_->EndFrame();
+			}
+			const float frameMs = std::chrono::duration<float, std::milli>(clock::now() - frameStart).count();
+			frameTotalMs += frameMs;
+			frameMaxMs = (std::max)(frameMaxMs, frameMs);
+
+			// Wv(System̐̓V[ŕςȂ)
+			timings.resize(scheduler.GetSystemCount());
+			for (size_t i = 0; i < timings.size(); ++i) {
+				for (auto phase : { Phase::FixedUpdate, Phase::Update }) {
+					const size_t p = static_cast<size_t>(phase);
+					const float ms = scheduler.GetLastSystemMs(i, phase);
+					timings[i].totalMs[p] += ms;
+					timings[i].maxMs[p] = (std::max)(timings[i].maxMs[p], ms);
+				}
+			}
+			if (backend_->GetLastFrameStats().drawCalls >= peakFrame.drawCalls) {
+				peakFrame = backend_->GetLastFrameStats();
+			}
+
+			Profiler::NextFrame();
+		}
+
+		// |[g
+		const double frames = (std::max)(frame, 1u);
+		std::string report = std::format("headless run: {} {} frames, dt {:.4f} s, backend Null\n",
+			desc_.scene, frame, desc_.fixedTimeStep);
+		report += std::format("frame: avg {:.3f} ms / max {:.3f} ms\n", frameTotalMs / frames, frameMaxMs);
+		report += std::format("{:<48} {:>10} {:>10} {:>10} {:>10}\n", "system", "fixed avg", "fixed max", "upd avg", "upd max");
+		for (size_t i = 0; i < timings.size(); ++i) {
+			const auto& t = timings[i];
+			const size_t f = static_cast<size_t>(Phase::FixedUpdate);
+			const size_t u = static_cast<size_t>(Phase::Update);
+			report += std::format("{:<48} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}\n",
+				scheduler.GetSystemName(i), t.totalMs[f] / frames, t.maxMs[f], t.totalMs[u] / frames, t.maxMs[u]);
+		}
+		const auto& total = backend_->GetStats();
+		report += std::format("backend total: buffers {} ({} KB) / uploads {} ({} KB) / pipelines {} / draws {} / instances {}\n",
+			total.buffersCreated, total.bufferBytes / 1024, total.uploads, total.uploadBytes / 1024,
+			total.pipelines, total.drawCalls, total.instances);
+		report += std::format("backend peak frame: draws {} / instances {} / indices {} / upload {} KB\n",
+			peakFrame.drawCalls, peakFrame.instances, peakFrame.indices, peakFrame.uploadBytes / 1024);
+
+		std::error_code ec;
+		std::filesystem::create_directories(std::filesystem::path(desc_.reportPath).parent_path(), ec);
+		if (std::ofstream ofs(desc_.reportPath); ofs) {
+			ofs << report;
+		}
+		else {
+			DebugLogError("[HeadlessGame] {} J܂", desc_.reportPath);
+		}
+		debug::Debug::Log(debug::Debug::LogLevel::LOG_INFO, std::string_view(report));
+		std::cout << report << std::flush;	// rht@[̃Oɂc
+		return frame;
+	}
+}
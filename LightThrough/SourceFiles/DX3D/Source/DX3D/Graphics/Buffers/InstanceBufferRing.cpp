@@ -0,0 +1,81 @@
+/**
+ * @file InstanceBufferRing.cpp
+ * @brief g񂷃CX^Xobt@
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <cstring>
+#include <DX3D/Graphics/Buffers/InstanceBufferRing.h>
+#include <Debug/Debug.h>
+
+namespace dx3d {
+	InstanceBufferRing::InstanceBufferRing(IGraphicsBackend& _backend, GraphicsQueue _queue, uint32_t _stride, std::string _name)
+		: backend_(_backend), queue_(_queue), stride_(_stride), name_(std::move(_name))
+	{
+	}
+
+	InstanceBufferRing::~InstanceBufferRing()
+	{
+		End();
+		for (auto& id : buffers_) { backend_.ReleaseBuffer(id); }
+	}
+
+	/**
+	 * @brief t[̏݊Jn
+	 *	D3D11̃obt@4GB܂łȂ̂ŁA𒴂镪͏Ȃ
+	 */
+	bool InstanceBufferRing::Begin(uint32_t _instanceCount)
+	{
+		if (mapped_data_) { return false; }
+
+		const uint64_t required = static_cast<uint64_t>(_instanceCount) * stride_;
+		const auto frame = allocator_.BeginFrame(required);
+		auto& buffer = buffers_[frame.slot];
+
+		if (frame.recreate || !buffer.IsValid()) {
+			if (frame.capacity > UINT32_MAX) {
+				DebugLogError("[InstanceBufferRing] '{}' ̃CX^X܂: {} bytes", name_, required);
+				return false;
+			}
+			backend_.ReleaseBuffer(buffer);
+			buffer = backend_.CreateDynamicVertexBuffer(static_cast<uint32_t>(frame.capacity), stride_);
+			if (!buffer.IsValid()) {
+				DebugLogError("[InstanceBufferRing] '{}' ̃obt@쐬Ɏs", name_);
+				return false;
+			}
+			DebugLogInfo("[InstanceBufferRing] '{}' slot {}  {} KB ō쐬 (őgp {} KB)",
+				name_, frame.slot, frame.capacity / 1024, (std::max)(allocator_.GetHighWaterMark(), required) / 1024);
+		}
+
+		// XbgƂɃobt@Ă̂ŁADISCARDĂGPUgĂ̈Ƃ͂ԂȂ
+		mapped_data_ = static_cast<uint8_t*>(backend_.MapDiscard(buffer, queue_));
+		if (!mapped_data_) {
+			DebugLogError("[InstanceBufferRing] '{}' MapɎs", name_);
+			return false;
+		}
+		return true;
+	}
+
+	uint32_t InstanceBufferRing::Write(const void* _data, uint32_t _count)
+	{
+		if (!mapped_data_) { return INVALID_INSTANCE; }
+
+		const uint64_t bytes = static_cast<uint64_t>(_count) * stride_;
+		const uint64_t offset = allocator_.Allocate(bytes, stride_);
+		if (offset == InstanceRingAllocator::INVALID_OFFSET) {
+			DebugLogWarning("[InstanceBufferRing] '{}' ɓ肫Ȃ̂{}̂Ă܂", name_, _count);
+			return INVALID_INSTANCE;
+		}
+		std::memcpy(mapped_data_ + offset, _data, static_cast<size_t>(bytes));
+		return static_cast<uint32_t>(offset / stride_);
+	}
+
+	void InstanceBufferRing::End()
+	{
+		if (!mapped_data_) { return; }
+		backend_.Unmap(buffers_[allocator_.GetSlot()], queue_, allocator_.GetUsedBytes());
+		mapped_data_ = nullptr;
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+/**
+ * @file InstanceBufferRing.h
+ * @brief g񂷃CX^Xobt@
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <array>
+#include <string>
+#include <cstdint>
+#include <DX3D/Core/Core.h>
+#include <DX3D/Graphics/GraphicsBackend.h>
+#include <DX3D/Graphics/Buffers/InstanceRingAllocator.h>
+
+namespace dx3d {
+	/**
+	 * @brief g񂷃CX^Xobt@
+	 *
+	 * t[蒼ɁAt[Ƃ̓Iobt@(FRAMES_IN_FLIGHT)ԂɎgB
+	 * Begin1񂾂Map(WRITE_DISCARD)Aob`ƂWriteŐ؂oďAEndŕB
+	 * obt@̍쐬 / Map͕`obNGhɔĈŁANull̃obNGhł̂܂ܓB
+	 * :
+	 *	ring.Begin(total);
+	 *	batch.instanceOffset = ring.Write(batch.instances.data(), count);
+	 *	ring.End();
+	 *	engine.RenderInstanced(vb, ib, *ring.GetBuffer(), count, batch.instanceOffset, key);
+	 */
+	class InstanceBufferRing final {
+	public:
+		static constexpr uint32_t INVALID_INSTANCE = ~0u;
+
+		/**
+		 * @brief RXgN^
+		 * @param _backend obt@`obNGh
+		 * @param _queue MapɎgReLXg(`ɎĝƓ)
+		 * @param _stride CX^X1̑傫
+		 * @param _name OɏoO
+		 */
+		InstanceBufferRing(IGraphicsBackend& _backend, GraphicsQueue _queue, uint32_t _stride, std::string _name);
+		~InstanceBufferRing();
+
+		InstanceBufferRing(const InstanceBufferRing&) = delete;
+		InstanceBufferRing& operator=(const InstanceBufferRing&) = delete;
+
+		/**
+		 * @brief t[̏݊Jn
+		 *	̃obt@ɐi݁AȂ΍蒼ĂMap
+		 * @param _instanceCount t[ŏCX^X̐
+		 * @return : true
+		 */
+		bool Begin(uint32_t _instanceCount);
+
+		/**
+		 * @brief ob`
+		 * @param _data CX^Xf[^
+		 * @param _count 
+		 * @return JnCX^X(DrawIndexedInstancedStartInstanceLocation)BȂINVALID_INSTANCE
+		 */
+		uint32_t Write(const void* _data, uint32_t _count);
+
+		//! @brief t[̏ݏI(Unmap)
+		void End();
+
+		VertexBuffer* GetBuffer() const { return backend_.GetVertexBuffer(buffers_[allocator_.GetSlot()]); }	// t[̃obt@(Null: nullptr)
+		const InstanceRingAllocator& GetAllocator() const { return allocator_; }
+		uint32_t GetStride() const { return stride_; }
+
+	private:
+		IGraphicsBackend& backend_;
+		GraphicsQueue queue_ = GraphicsQueue::Deferred;
+		uint32_t stride_ = 0;
+		std::string name_{};
+		InstanceRingAllocator allocator_{};
+		std::array<GraphicsBufferId, InstanceRingAllocator::FRAMES_IN_FLIGHT> buffers_{};
+
+		uint8_t* mapped_data_ = nullptr;	// Map̏ݐ
+	};
+}
@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file InstanceRingAllocator.h
+ * @brief CX^Xf[^pO̊蓖ČvZ
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <array>
+#include <cstdint>
+#include <algorithm>
+
+// memo: D3DɈˑȂ(e / ʒu / őgpʂ̌vZ)Bobt@̍쐬 / Map͎(InstanceBufferRing)s
+
+namespace dx3d {
+	/**
+	 * @brief CX^Xf[^pO̊蓖ČvZ
+	 *
+	 * `撆̃t[(FRAMES_IN_FLIGHT)̃obt@ԂɎgAt[̒ł̓ob`ƂɑO؂oB
+	 * ȂȂXbg2{L΂(k߂Ȃ)̂ŁAt[ō蒼͋NȂȂB
+	 */
+	class InstanceRingAllocator final {
+	public:
+		static constexpr uint32_t FRAMES_IN_FLIGHT = 3;
+		static constexpr uint64_t MIN_CAPACITY = 64 * 1024;	// ŏɊmۂoCg
+		static constexpr uint64_t INVALID_OFFSET = ~0ull;
+
+		/**
+		 * @brief t[̊Jn
+		 */
+		struct FrameBegin {
+			uint32_t slot = 0;		// t[Ŏgobt@
+			uint64_t capacity = 0;	// ̃obt@̑傫(oCg)
+			bool recreate = false;	// true: 蒼Kv( / L΂)
+		};
+
+		/**
+		 * @brief t[̊Jn
+		 *	̃Xbgɐi݁A_requiredBytesȂΐL΂
+		 * @param _requiredBytes t[ŎgoCg
+		 */
+		FrameBegin BeginFrame(uint64_t _requiredBytes)
+		{
+			slot_ = (slot_ + 1) % FRAMES_IN_FLIGHT;
+			cursor_ = 0;
+
+			FrameBegin result{ .slot = slot_, .capacity = capacities_[slot_] };
+			if (_requiredBytes > capacities_[slot_] || capacities_[slot_] == 0) {
+				uint64_t capacity = (std::max)(capacities_[slot_], MIN_CAPACITY);
+				while (capacity < _requiredBytes) { capacity *= 2; }
+				capacities_[slot_] = capacity;
+				result.capacity = capacity;
+				result.recreate = true;
+				++grow_count_;
+			}
+			return result;
+		}
+
+		/**
+		 * @brief t[̃obt@؂o
+		 * @param _bytes oCg
+		 * @param _align 擪̔{ɑ(_̑傫)
+		 * @return 擪̃oCgʒu(ȂINVALID_OFFSET)
+		 */
+		uint64_t Allocate(uint64_t _bytes, uint64_t _align)
+		{
+			const uint64_t offset = (_align > 1) ? (cursor_ + _align - 1) / _align * _align : cursor_;
+			if (offset + _bytes > capacities_[slot_]) { return INVALID_OFFSET; }
+			cursor_ = offset + _bytes;
+			high_water_mark_ = (std::max)(high_water_mark_, cursor_);
+			return offset;
+		}
+
+		uint32_t GetSlot() const { return slot_; }
+		uint64_t GetUsedBytes() const { return cursor_; }						// t[ŎgoCg
+		uint64_t GetCapacity(uint32_t _slot) const { return capacities_[_slot]; }
+		uint64_t GetHighWaterMark() const { return high_water_mark_; }			// 1t[Ŏgő̃oCg
+		uint32_t GetGrowCount() const { return grow_count_; }					// 蒼(݌v)
+
+	private:
+		std::array<uint64_t, FRAMES_IN_FLIGHT> capacities_{};
+		uint32_t slot_ = FRAMES_IN_FLIGHT - 1;	// ŏBeginFrame0ɂȂ悤
+		uint64_t cursor_ = 0;
+		uint64_t high_water_mark_ = 0;
+		uint32_t grow_count_ = 0;
+	};
+}
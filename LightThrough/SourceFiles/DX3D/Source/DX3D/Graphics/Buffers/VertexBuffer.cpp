@@ -22,7 +22,7 @@ namespace dx3d
 		vertex_size_(_desc.vertexSize),
 		vertex_list_size_(_desc.vertexListSize)
 	{
-		if (!_desc.vertexList) {
+		if (!_desc.vertexList && !_desc.dynamic) {
 			DX3DLogThrowInvalidArg("VertexList  ݂܂");
 		}
 		if (!_desc.vertexListSize) {
@@ -36,11 +36,15 @@ namespace dx3d
 		// Ŝ̃TCYvZ
 		buffDesc.ByteWidth = _desc.vertexListSize;
 		buffDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		if (_desc.dynamic) {
+			buffDesc.Usage = D3D11_USAGE_DYNAMIC;
+			buffDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		}
 
 		D3D11_SUBRESOURCE_DATA initData{};
 		initData.pSysMem = _desc.vertexList;
 
-		DX3DGraphicsLogThrowOnFail(device_.CreateBuffer(&buffDesc, &initData, &buffer_), "VertexBuffer CreateBufferɎs܂");
+		DX3DGraphicsLogThrowOnFail(device_.CreateBuffer(&buffDesc, _desc.vertexList ? &initData : nullptr, &buffer_), "VertexBuffer CreateBufferɎs܂");
 	}
 
 	ID3D11Buffer* VertexBuffer::GetBuffer() const noexcept
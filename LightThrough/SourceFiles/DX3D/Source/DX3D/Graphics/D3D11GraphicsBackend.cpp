@@ -0,0 +1,180 @@
+/**
+ * @file D3D11GraphicsBackend.cpp
+ * @brief Direct3D 11̕`obNGh
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <DX3D/Graphics/D3D11GraphicsBackend.h>
+#include <DX3D/Graphics/GraphicsDevice.h>
+#include <DX3D/Graphics/DeviceContext.h>
+#include <DX3D/Graphics/SwapChain.h>
+#include <DX3D/Graphics/PipelineCache.h>
+#include <DX3D/Graphics/GraphicsPipelineState.h>
+#include <DX3D/Graphics/Buffers/VertexBuffer.h>
+#include <DX3D/Graphics/Buffers/IndexBuffer.h>
+#include <Debug/Debug.h>
+
+namespace dx3d {
+	D3D11GraphicsBackend::D3D11GraphicsBackend(GraphicsDevice& _device, DeviceContext& _deferred, PipelineCache& _pipelineCache)
+		: device_(_device), deferred_context_(_deferred), pipeline_cache_(_pipelineCache)
+	{
+	}
+
+	//! @brief `Jn
+	void D3D11GraphicsBackend::BeginFrame()
+	{
+		DirectX::XMFLOAT4 clearColor = { 0.0f, 0.0f, 0.0f, 0.0f };
+#if defined(_DEBUG) || defined(DEBUG)
+		clearColor = { 0.2f, 0.3f, 0.5f, 1.0f };
+#endif
+		deferred_context_.ClearAndSetBackBuffer(*swap_chain_, clearColor);	// FŃNA
+	}
+
+	//! @brief `I
+	void D3D11GraphicsBackend::EndFrame()
+	{
+		// R}hXgs
+		device_.ExecuteCommandList(deferred_context_);
+
+		// ʂɕ\
+		swap_chain_->Present();
+		RecordFrameEnd();
+	}
+
+	/**
+	 * @brief `
+	 *	xReLXgDeviceContextoRŁAReLXgD3D𒼐ڒ@
+	 */
+	void D3D11GraphicsBackend::Draw(const GraphicsDrawCall& _call)
+	{
+		if (!_call.vertexBuffer || !_call.indexBuffer) { return; }
+		const uint32_t indexCount = _call.indexCount ? _call.indexCount : _call.indexBuffer->GetIndexCount();
+		auto pso = pipeline_cache_.GetOrCreate(_call.key);
+
+		if (_call.queue == GraphicsQueue::Immediate) {
+			auto* immediateContext = device_.GetImmediateContext();
+
+			// ReLXgɃpCvCXe[gZbg
+			pso->Apply(immediateContext);
+
+			ID3D11Buffer* vbs[2] = { _call.vertexBuffer->GetBuffer(), _call.instanceBuffer ? _call.instanceBuffer->GetBuffer() : nullptr };
+			UINT strides[2] = { _call.vertexBuffer->GetVertexSize(), _call.instanceBuffer ? _call.instanceBuffer->GetVertexSize() : 0 };
+			UINT offsets[2] = { 0, 0 };
+			immediateContext->IASetVertexBuffers(0, _call.instanceBuffer ? 2 : 1, vbs, strides, offsets);
+			immediateContext->IASetIndexBuffer(_call.indexBuffer->GetBuffer(), DXGI_FORMAT_R32_UINT, 0);
+
+			// `
+			immediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			if (_call.instanceBuffer) {
+				immediateContext->DrawIndexedInstanced(indexCount, _call.instanceCount, 0, 0, _call.startInstance);
+			}
+			else {
+				immediateContext->DrawIndexed(indexCount, 0, 0);
+			}
+		}
+		else {
+			deferred_context_.SetGraphicsPipelineState(*pso);
+			// VhE}bv̓Cg̃r[|[gg
+			if (_call.key.GetVS() != VertexShaderKind::ShadowMap) {
+				deferred_context_.SetViewportSize(swap_chain_->GetSize());
+			}
+			deferred_context_.SetIndexBuffer(*_call.indexBuffer);
+			if (_call.instanceBuffer) {
+				deferred_context_.SetVertexBuffers(*_call.vertexBuffer, *_call.instanceBuffer);
+				deferred_context_.DrawIndexedInstanced(indexCount, _call.instanceCount, 0, 0, _call.startInstance);
+			}
+			else {
+				deferred_context_.SetVertexBuffer(*_call.vertexBuffer);
+				deferred_context_.DrawIndexed(indexCount, 0, 0);
+			}
+		}
+		RecordDraw(_call);
+	}
+
+	VertexBufferPtr D3D11GraphicsBackend::CreateVertexBuffer(const void* _vertices, uint32_t _bytes, uint32_t _stride)
+	{
+		if (!_vertices || _bytes == 0 || _stride == 0) { return {}; }
+
+		auto buffer = device_.CreateVertexBuffer({ _vertices, _bytes, _stride });
+		if (buffer) { RecordBufferCreated(_bytes); }
+		return buffer;
+	}
+
+	IndexBufferPtr D3D11GraphicsBackend::CreateIndexBuffer(const uint32_t* _indices, uint32_t _indexCount)
+	{
+		if (!_indices || _indexCount == 0) { return {}; }
+
+		auto buffer = device_.CreateIndexBuffer({ _indices, _indexCount });
+		if (buffer) { RecordBufferCreated(static_cast<uint64_t>(_indexCount) * sizeof(uint32_t)); }
+		return buffer;
+	}
+
+	GraphicsBufferId D3D11GraphicsBackend::CreateDynamicVertexBuffer(uint32_t _bytes, uint32_t _stride)
+	{
+		if (_bytes == 0 || _stride == 0) { return {}; }
+
+		auto buffer = device_.CreateVertexBuffer({
+			.vertexList = nullptr,
+			.vertexListSize = _bytes,
+			.vertexSize = _stride,
+			.dynamic = true,
+			});
+		if (!buffer) { return {}; }
+
+		GraphicsBufferId id{};
+		if (!free_ids_.empty()) {
+			id.index = free_ids_.back();
+			free_ids_.pop_back();
+			buffers_[id.index] = std::move(buffer);
+		}
+		else {
+			id.index = static_cast<uint32_t>(buffers_.size());
+			buffers_.push_back(std::move(buffer));
+		}
+		RecordBufferCreated(_bytes);
+		return id;
+	}
+
+	void D3D11GraphicsBackend::ReleaseBuffer(GraphicsBufferId _id)
+	{
+		if (!_id.IsValid() || _id.index >= buffers_.size() || !buffers_[_id.index]) { return; }
+		buffers_[_id.index].reset();
+		free_ids_.push_back(_id.index);
+	}
+
+	void* D3D11GraphicsBackend::MapDiscard(GraphicsBufferId _id, GraphicsQueue _queue)
+	{
+		auto* buffer = GetVertexBuffer(_id);
+		if (!buffer) { return nullptr; }
+
+		D3D11_MAPPED_SUBRESOURCE mapped{};
+		if (FAILED(GetContext(_queue)->Map(buffer->GetBuffer(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
+			DebugLogError("[D3D11GraphicsBackend] MapɎs: buffer {}", _id.index);
+			return nullptr;
+		}
+		return mapped.pData;
+	}
+
+	void D3D11GraphicsBackend::Unmap(GraphicsBufferId _id, GraphicsQueue _queue, uint64_t _writtenBytes)
+	{
+		auto* buffer = GetVertexBuffer(_id);
+		if (!buffer) { return; }
+		GetContext(_queue)->Unmap(buffer->GetBuffer(), 0);
+		RecordUpload(_writtenBytes);
+	}
+
+	VertexBuffer* D3D11GraphicsBackend::GetVertexBuffer(GraphicsBufferId _id) const
+	{
+		if (!_id.IsValid() || _id.index >= buffers_.size()) { return nullptr; }
+		return buffers_[_id.index].get();
+	}
+
+	ID3D11DeviceContext* D3D11GraphicsBackend::GetContext(GraphicsQueue _queue) const
+	{
+		return (_queue == GraphicsQueue::Immediate)
+			? device_.GetImmediateContext()
+			: deferred_context_.GetDeferredContext().Get();
+	}
+}
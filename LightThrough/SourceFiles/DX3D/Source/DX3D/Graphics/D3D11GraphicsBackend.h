@@ -0,0 +1,61 @@
+#pragma once
+/**
+ * @file D3D11GraphicsBackend.h
+ * @brief Direct3D 11̕`obNGh
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <vector>
+#include <d3d11.h>
+#include <DX3D/Graphics/GraphicsBackend.h>
+
+namespace dx3d {
+	class PipelineCache;
+
+	/**
+	 * @brief Direct3D 11̕`obNGh
+	 *
+	 * ܂GraphicsEngineڍsĂNA / ` / R}hXg̎s / Present󂯎B
+	 */
+	class D3D11GraphicsBackend final : public IGraphicsBackend {
+	public:
+		/**
+		 * @brief RXgN^
+		 * @param _device foCX
+		 * @param _deferred `ςޒxReLXg
+		 * @param _pipelineCache pCvCXe[g̎擾
+		 */
+		D3D11GraphicsBackend(GraphicsDevice& _device, DeviceContext& _deferred, PipelineCache& _pipelineCache);
+
+		GraphicsBackendKind GetKind() const override { return GraphicsBackendKind::D3D11; }
+
+		void SetSwapChain(SwapChain& _swapChain) { swap_chain_ = &_swapChain; }
+		SwapChain* GetSwapChain() const { return swap_chain_; }
+
+		void BeginFrame() override;
+		void EndFrame() override;
+		void Draw(const GraphicsDrawCall& _call) override;
+
+		VertexBufferPtr CreateVertexBuffer(const void* _vertices, uint32_t _bytes, uint32_t _stride) override;
+		IndexBufferPtr CreateIndexBuffer(const uint32_t* _indices, uint32_t _indexCount) override;
+		GraphicsBufferId CreateDynamicVertexBuffer(uint32_t _bytes, uint32_t _stride) override;
+		void ReleaseBuffer(GraphicsBufferId _id) override;
+		void* MapDiscard(GraphicsBufferId _id, GraphicsQueue _queue) override;
+		void Unmap(GraphicsBufferId _id, GraphicsQueue _queue, uint64_t _writtenBytes) override;
+		VertexBuffer* GetVertexBuffer(GraphicsBufferId _id) const override;
+
+	private:
+		ID3D11DeviceContext* GetContext(GraphicsQueue _queue) const;	// L[ɑΉReLXg
+
+	private:
+		GraphicsDevice& device_;
+		DeviceContext& deferred_context_;
+		PipelineCache& pipeline_cache_;
+		SwapChain* swap_chain_ = nullptr;
+
+		std::vector<VertexBufferPtr> buffers_{};	// Iobt@(nullptr: ς)
+		std::vector<uint32_t> free_ids_{};			// ėpłԍ
+	};
+}
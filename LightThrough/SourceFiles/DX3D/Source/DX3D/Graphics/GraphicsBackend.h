@@ -0,0 +1,163 @@
+#pragma once
+/**
+ * @file GraphicsBackend.h
+ * @brief `obNGh̃C^[tF[X
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <cstdint>
+#include <unordered_set>
+#include <initializer_list>
+#include <DX3D/Core/Core.h>
+#include <DX3D/Graphics/PipelineKey.h>
+
+// memo: D3DɈˑȂ(Null̎GPUĂ / WindowsȊOłg悤)
+
+namespace dx3d {
+	/**
+	 * @brief `obNGh̎
+	 */
+	enum class GraphicsBackendKind : uint8_t {
+		D3D11,	// Direct3D 11ŕ`悷
+		Null,	// GPUg킸ɍ쐬 / `̐L^(EBhEȂ)
+	};
+
+	/**
+	 * @brief ǂ̃ReLXgŎs邩
+	 */
+	enum class GraphicsQueue : uint8_t {
+		Deferred,	// xReLXg(EndFrameł܂Ƃ߂Ďs)
+		Immediate,	// ReLXg
+	};
+
+	/**
+	 * @brief obNGhōobt@̔ԍ
+	 */
+	struct GraphicsBufferId {
+		static constexpr uint32_t INVALID = ~0u;
+		uint32_t index = INVALID;
+		bool IsValid() const { return index != INVALID; }
+	};
+
+	/**
+	 * @brief `
+	 *	obt@D3D11̎g(Null͐)
+	 */
+	struct GraphicsDrawCall {
+		const VertexBuffer* vertexBuffer = nullptr;
+		const IndexBuffer* indexBuffer = nullptr;
+		const VertexBuffer* instanceBuffer = nullptr;	// nullptr: CX^X`悵Ȃ
+		uint32_t indexCount = 0;
+		uint32_t instanceCount = 1;
+		uint32_t startInstance = 0;
+		PipelineKey key{};
+		GraphicsQueue queue = GraphicsQueue::Deferred;
+	};
+
+	/**
+	 * @brief 쐬 / `̋L^
+	 */
+	struct GraphicsBackendStats {
+		uint64_t buffersCreated = 0;	// obt@̐
+		uint64_t bufferBytes = 0;		// obt@̍voCg
+		uint64_t uploads = 0;			// Map̉
+		uint64_t uploadBytes = 0;		// MapŏoCg
+		uint64_t pipelines = 0;			// ߂ĎgPSO̐(VF[_[̑gݍ킹)
+		uint64_t drawCalls = 0;
+		uint64_t instances = 0;
+		uint64_t indices = 0;
+	};
+
+	/**
+	 * @brief `obNGh
+	 *
+	 * GraphicsEnginẽt[̊Jn / Iƕ`Ag񂷓Iobt@̍쐬 / MapɒʂB
+	 * D3D11͍̎܂ŒʂGPUŕ`ANull̎GPUɐG炸ɐƃoCgL^B
+	 * L^(GetStats / GetLastFrameStats)͂ǂ̎ł悤ɎB
+	 */
+	class IGraphicsBackend {
+	public:
+		virtual ~IGraphicsBackend() = default;
+
+		virtual GraphicsBackendKind GetKind() const = 0;
+		bool IsNullBackend() const { return GetKind() == GraphicsBackendKind::Null; }
+
+		//! @brief t[̊Jn
+		virtual void BeginFrame() = 0;
+		//! @brief t[̏I(D3D11: R}hXg̎sPresent)
+		virtual void EndFrame() = 0;
+		//! @brief `
+		virtual void Draw(const GraphicsDrawCall& _call) = 0;
+
+		/**
+		 * @brief g̕ςȂ_obt@̍쐬(bVp)
+		 * @param _vertices _f[^
+		 * @param _bytes 傫
+		 * @param _stride _̑傫
+		 * @return obt@(Null: nullptrB쐬̋L^c)
+		 */
+		virtual VertexBufferPtr CreateVertexBuffer(const void* _vertices, uint32_t _bytes, uint32_t _stride) = 0;
+		/**
+		 * @brief g̕ςȂCfbNXobt@̍쐬(bVp)
+		 * @return obt@(Null: nullptrB쐬̋L^c)
+		 */
+		virtual IndexBufferPtr CreateIndexBuffer(const uint32_t* _indices, uint32_t _indexCount) = 0;
+
+		/**
+		 * @brief CPU疈t[钸_obt@̍쐬
+		 * @param _bytes 傫
+		 * @param _stride _̑傫
+		 */
+		virtual GraphicsBufferId CreateDynamicVertexBuffer(uint32_t _bytes, uint32_t _stride) = 0;
+		virtual void ReleaseBuffer(GraphicsBufferId _id) = 0;
+		/**
+		 * @brief Ŝ̂ĂďݗpɊJ(WRITE_DISCARD)
+		 * @return ݐ(s: nullptr)
+		 */
+		virtual void* MapDiscard(GraphicsBufferId _id, GraphicsQueue _queue) = 0;
+		/**
+		 * @brief 
+		 * @param _writtenBytes oCg(L^p)
+		 */
+		virtual void Unmap(GraphicsBufferId _id, GraphicsQueue _queue, uint64_t _writtenBytes) = 0;
+		//! @brief `ɓnobt@(Null: nullptr)
+		virtual VertexBuffer* GetVertexBuffer(GraphicsBufferId _id) const = 0;
+
+		const GraphicsBackendStats& GetStats() const { return stats_; }					// N̗݌v
+		const GraphicsBackendStats& GetLastFrameStats() const { return last_frame_stats_; }	// ߂̃t[
+
+	protected:
+		//! @brief L^(Ă)
+		void RecordBufferCreated(uint64_t _bytes)
+		{
+			for (auto* s : { &stats_, &frame_stats_ }) { ++s->buffersCreated; s->bufferBytes += _bytes; }
+		}
+		void RecordUpload(uint64_t _bytes)
+		{
+			for (auto* s : { &stats_, &frame_stats_ }) { ++s->uploads; s->uploadBytes += _bytes; }
+		}
+		void RecordDraw(const GraphicsDrawCall& _call)
+		{
+			const bool newPipeline = seen_pipelines_.insert(_call.key).second;
+			for (auto* s : { &stats_, &frame_stats_ }) {
+				s->pipelines += newPipeline ? 1 : 0;
+				++s->drawCalls;
+				s->instances += _call.instanceCount;
+				s->indices += static_cast<uint64_t>(_call.indexCount) * _call.instanceCount;
+			}
+		}
+		void RecordFrameEnd()
+		{
+			last_frame_stats_ = frame_stats_;
+			frame_stats_ = {};
+		}
+
+	private:
+		GraphicsBackendStats stats_{};
+		GraphicsBackendStats frame_stats_{};
+		GraphicsBackendStats last_frame_stats_{};
+		std::unordered_set<PipelineKey, PipelineKeyHash> seen_pipelines_{};
+	};
+}
@@ -15,6 +15,8 @@
 #include <DX3D/Graphics/Buffers/VertexBuffer.h>
 #include <DX3D/Graphics/Buffers/IndexBuffer.h>
 
+#include <DX3D/Graphics/D3D11GraphicsBackend.h>
+
 #include <DX3D/Graphics/Meshes/PrimitiveFactory.h>
 #include <DX3D/Graphics/Textures/TextureRegistry.h>
 
@@ -25,6 +27,9 @@ namespace dx3d {
 	GraphicsEngine::GraphicsEngine(const GraphicsEngineDesc& _desc)
 		: Base(_desc.base)
 	{
+		// bVWXg̐
+		mesh_registry_ = std::make_unique<MeshRegistry>();
+
 		graphics_device_ = std::make_shared<GraphicsDevice>(GraphicsDeviceDesc{ logger_ });
 		
 		deferred_context_ = graphics_device_->CreateDeviceContext();
@@ -35,13 +40,12 @@ namespace dx3d {
 		// pCvCLbV̐
 		pipeline_cache_ = graphics_device_->CreatePipelineCache({*shader_cache_});
 
-		// bVWXg̐
-		mesh_registry_ = std::make_unique<MeshRegistry>();
-		
+		backend_ = std::make_unique<D3D11GraphicsBackend>(*graphics_device_, *deferred_context_, *pipeline_cache_);
+
 		// MeshOɐĂ
-		PrimitiveFactory::CreateCube(*graphics_device_, *mesh_registry_);
-		PrimitiveFactory::CreateSphere(*graphics_device_, *mesh_registry_);
-		PrimitiveFactory::CreateQuad(*graphics_device_, *mesh_registry_);
+		PrimitiveFactory::CreateCube(*backend_, *mesh_registry_);
+		PrimitiveFactory::CreateSphere(*backend_, *mesh_registry_);
+		PrimitiveFactory::CreateQuad(*backend_, *mesh_registry_);
 		//PrimitiveFactory::CreateLine(*graphics_device_, *mesh_registry_);
 
 		// eNX`WXg̐
@@ -71,10 +75,17 @@ namespace dx3d {
 	{
 		return graphics_device_->GetImmediateContext();
 	}
+	//! @brief ʃTCY擾(Xbv`FC0)
+	const Rect& GraphicsEngine::GetScreenSize()
+	{
+		static const Rect empty{};
+		return swap_chain_ ? swap_chain_->GetSize() : empty;
+	}
 	//! @brief Xbv`FCݒ
 	void GraphicsEngine::SetSwapChain(SwapChain& _swapChain)
 	{
 		swap_chain_ = &_swapChain;
+		static_cast<D3D11GraphicsBackend&>(*backend_).SetSwapChain(_swapChain);
 	}
 	//! @brief bVWXg擾
 	MeshRegistry& GraphicsEngine::GetMeshRegistry() noexcept
@@ -85,69 +96,50 @@ namespace dx3d {
 	//! @brief `Jn
 	void GraphicsEngine::BeginFrame()
 	{
-		auto& context = *deferred_context_;
-		DirectX::XMFLOAT4 clearColor = { 0.0f, 0.0f, 0.0f, 0.0f };
-#ifdef _DEBUG || DEBUG
-		clearColor = { 0.2, 0.3f, 0.5f, 1.0f };
-#endif
-		context.ClearAndSetBackBuffer(*swap_chain_, clearColor);	// FŃNA
+		backend_->BeginFrame();
 	}
 
 
 	//! @brief `揈
 	void GraphicsEngine::Render(VertexBuffer& _vb, IndexBuffer& _ib, PipelineKey _key)
 	{
-		auto pso = pipeline_cache_->GetOrCreate(_key);
-		deferred_context_->SetGraphicsPipelineState(*pso);
-		deferred_context_->SetViewportSize(swap_chain_->GetSize());
-		deferred_context_->SetVertexBuffer(_vb);
-		deferred_context_->SetIndexBuffer(_ib);
-		deferred_context_->DrawIndexed(_ib.GetIndexCount(), 0, 0);
+		backend_->Draw({
+			.vertexBuffer = &_vb,
+			.indexBuffer = &_ib,
+			.key = _key,
+			});
 	}
 
 	//! @brief xReLXgł̃CX^X`
 	void dx3d::GraphicsEngine::RenderInstanced(VertexBuffer& _vb, IndexBuffer& _ib, VertexBuffer& _instanceVB, uint32_t _instanceCount, uint32_t _startInstance, PipelineKey _key)
 	{
-		auto pso = pipeline_cache_->GetOrCreate(_key);
-		deferred_context_->SetGraphicsPipelineState(*pso);
-
-		if (_key.GetVS() != VertexShaderKind::ShadowMap) {
-			deferred_context_->SetViewportSize(swap_chain_->GetSize());
-		}
-		deferred_context_->SetVertexBuffers(_vb, _instanceVB);
-		deferred_context_->SetIndexBuffer(_ib);
-		deferred_context_->DrawIndexedInstanced(_ib.GetIndexCount(), _instanceCount, 0, 0, _startInstance);
+		backend_->Draw({
+			.vertexBuffer = &_vb,
+			.indexBuffer = &_ib,
+			.instanceBuffer = &_instanceVB,
+			.instanceCount = _instanceCount,
+			.startInstance = _startInstance,
+			.key = _key,
+			});
 	}
 	//! @brief ReLXgł̃CX^X`
 	void GraphicsEngine::RenderInstancedOnImmediate(VertexBuffer& _vb, IndexBuffer& _ib, VertexBuffer& _instanceVB, uint32_t _instanceCount, uint32_t _startInstance, PipelineKey _key)
 	{
-		auto immediateContext = graphics_device_->GetImmediateContext();
-
-		// ReLXgɃpCvCXe[gZbg
-		auto pso = pipeline_cache_->GetOrCreate(_key);
-		pso->Apply(immediateContext);
-
-		ID3D11Buffer* vbs[2] = { _vb.GetBuffer(), _instanceVB.GetBuffer() };
-		UINT strides[2] = { _vb.GetVertexSize(), _instanceVB.GetVertexSize() };
-		UINT offsets[2] = { 0, 0 };
-		immediateContext->IASetVertexBuffers(0, 2, vbs, strides, offsets);
-
-		immediateContext->IASetIndexBuffer(_ib.GetBuffer(), DXGI_FORMAT_R32_UINT, 0);
-		// `
-		immediateContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		immediateContext->DrawIndexedInstanced(_ib.GetIndexCount(), _instanceCount, 0, 0, _startInstance);
+		backend_->Draw({
+			.vertexBuffer = &_vb,
+			.indexBuffer = &_ib,
+			.instanceBuffer = &_instanceVB,
+			.instanceCount = _instanceCount,
+			.startInstance = _startInstance,
+			.key = _key,
+			.queue = GraphicsQueue::Immediate,
+			});
 	}
 
 	//! @brief `I
 	void dx3d::GraphicsEngine::EndFrame()
 	{
-		auto& context = *deferred_context_;
-		auto& device = *graphics_device_;
-		// R}hXgs
-		device.ExecuteCommandList(context);
-
-		// ʂɕ\
-		swap_chain_->Present();
+		backend_->EndFrame();
 	}
 
 } // namespace dx3d
\ No newline at end of file
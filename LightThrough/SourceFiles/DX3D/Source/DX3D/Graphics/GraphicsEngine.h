@@ -13,6 +13,7 @@
 #include <DX3D/Graphics/SwapChain.h>
 #include <DX3D/Graphics/PipelineCache.h>
 #include <DX3D/Graphics/PipelineKey.h>
+#include <DX3D/Graphics/GraphicsBackend.h>
 #include <DX3D/Graphics/Meshes/MeshRegistry.h>
 
 
@@ -34,6 +35,10 @@ namespace dx3d {
 		explicit GraphicsEngine(const GraphicsEngineDesc& _desc);
 		virtual ~GraphicsEngine() override;
 		
+		//! @brief `obNGh(D3D11)擾
+		//! memo: GPUg킸ɓGraphicsEngine炸AHeadlessGameNullGraphicsBackend𒼐ڎ
+		IGraphicsBackend& GetBackend() noexcept { return *backend_; }
+
 		GraphicsDevice& GetGraphicsDevice() noexcept;
 		DeviceContext& GetDeferredContext() noexcept;
 		ID3D11DeviceContext* GetImmediateContext() noexcept;
@@ -43,7 +48,7 @@ namespace dx3d {
 		TextureRegistry& GetTextureRegistry() noexcept { return *texture_registry_; }
 		//! @brief VF[_[LbV擾
 		ShaderCache& GetShaderCache() noexcept { return *shader_cache_; };
-		const Rect& GetScreenSize() { return swap_chain_->GetSize(); }
+		const Rect& GetScreenSize();
 
 		void SetSwapChain(SwapChain& _swapChain);
 		
@@ -74,5 +79,6 @@ namespace dx3d {
 		SwapChain* swap_chain_{};
 		std::unique_ptr<MeshRegistry> mesh_registry_{};
 		std::unique_ptr<TextureRegistry> texture_registry_{};
+		std::unique_ptr<IGraphicsBackend> backend_{};
 	};
 }
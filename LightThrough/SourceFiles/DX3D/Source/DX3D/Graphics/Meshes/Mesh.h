@@ -7,13 +7,31 @@
  */
 
  // ---------- CN[h ---------- //
-#include <DX3D/Graphics/Buffers/IndexBuffer.h>
-#include <DX3D/Graphics/Buffers/VertexBuffer.h>
+#include <vector>
+#include <cstdint>
+#include <DirectXMath.h>
+#include <DX3D/Core/Core.h>
 
 namespace dx3d {
+	/**
+	 * @brief bṼ[JԂł̑傫(MeshRegistryւ̓o^ɒ_狁߂)
+	 */
+	struct MeshBounds {
+		DirectX::XMFLOAT3 center{};		// AABB̒S
+		DirectX::XMFLOAT3 extents{};	// AABB̔̑傫
+		float radius = 0.0f;			// center𒆐SƂOڋ̔a
+		bool valid = false;				// false: _߂Ȃ
+	};
+
 	struct Mesh {
-		std::shared_ptr<VertexBuffer> vb;
-		std::shared_ptr<IndexBuffer> ib;
+		VertexBufferPtr vb;	// Null̃obNGhłnullptr
+		IndexBufferPtr ib;
 		uint32_t indexCount{};
+
+		// CPǓ`(eCPUȂǂŎg)
+		std::vector<DirectX::XMFLOAT3> positions{};
+		std::vector<uint32_t> indices{};
+
+		MeshBounds bounds{};	// JOp
 	};
 }
\ No newline at end of file
@@ -71,6 +71,9 @@ namespace dx3d {
 			});
 		mesh->ib = _device.CreateIndexBuffer({ indices.data(), static_cast<uint32_t>(indices.size()) });
 		mesh->indexCount = static_cast<uint32_t>(indices.size());
+		mesh->positions.reserve(vertices.size());
+		for (const auto& v : vertices) { mesh->positions.push_back(v.position); }
+		mesh->indices = std::move(indices);
 
 		// bV̓o^
 		_registry.Register(mesh, _key);
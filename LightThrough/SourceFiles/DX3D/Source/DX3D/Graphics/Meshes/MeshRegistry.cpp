@@ -4,11 +4,43 @@
  */
 
  // ---------- CN[h ---------- //
+#include <cmath>
+#include <algorithm>
 #include <DX3D/Graphics/Meshes/MeshRegistry.h>
 #include <DX3D/Graphics/Meshes/Mesh.h>
 
 #include <Debug/Debug.h>
 
+namespace {
+	/**
+	 * @brief _烍[JAABBƊOڋ߂
+	 */
+	void ComputeBounds(dx3d::Mesh& _mesh)
+	{
+		if (_mesh.positions.empty()) { return; }
+
+		DirectX::XMFLOAT3 minP = _mesh.positions.front();
+		DirectX::XMFLOAT3 maxP = minP;
+		for (const auto& p : _mesh.positions) {
+			minP = { (std::min)(minP.x, p.x), (std::min)(minP.y, p.y), (std::min)(minP.z, p.z) };
+			maxP = { (std::max)(maxP.x, p.x), (std::max)(maxP.y, p.y), (std::max)(maxP.z, p.z) };
+		}
+
+		auto& b = _mesh.bounds;
+		b.center = { (minP.x + maxP.x) * 0.5f, (minP.y + maxP.y) * 0.5f, (minP.z + maxP.z) * 0.5f };
+		b.extents = { (maxP.x - minP.x) * 0.5f, (maxP.y - minP.y) * 0.5f, (maxP.z - minP.z) * 0.5f };
+
+		// AABB̊p܂ł菬܂邱Ƃ̂ŁA_܂ł̍ő勗g
+		float maxSq = 0.0f;
+		for (const auto& p : _mesh.positions) {
+			const float dx = p.x - b.center.x, dy = p.y - b.center.y, dz = p.z - b.center.z;
+			maxSq = (std::max)(maxSq, dx * dx + dy * dy + dz * dz);
+		}
+		b.radius = std::sqrt(maxSq);
+		b.valid = true;
+	}
+}
+
 namespace dx3d {
 
     /**
@@ -19,6 +51,11 @@ namespace dx3d {
 	 */
     MeshHandle MeshRegistry::Register(std::shared_ptr<Mesh> _mesh, const std::string& _name)
     {
+        // JOp̑傫
+        if (_mesh && !_mesh->bounds.valid) {
+            ComputeBounds(*_mesh);
+        }
+
         // VID𐶐(0͖lƂĎĂ)
         HandleType newId = static_cast<HandleType>(meshes_.size() + 1); 
         meshes_.push_back(std::move(_mesh));
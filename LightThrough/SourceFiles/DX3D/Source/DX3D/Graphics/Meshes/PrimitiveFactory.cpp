@@ -8,7 +8,7 @@
  // ---------- CN[h ---------- // 
 #include <DirectXMath.h>
 #include <DX3D/Graphics/Meshes/PrimitiveFactory.h>
-#include <DX3D/Graphics/GraphicsDevice.h>
+#include <DX3D/Graphics/GraphicsBackend.h>
 #include <DX3D/Graphics/Buffers/Vertex.h>
 #include <DX3D/Graphics/Meshes/MeshRegistry.h>
 #include <DX3D/Graphics/Meshes/MeshHandle.h>
@@ -18,11 +18,11 @@
 namespace dx3d {
 	/**
 	 * @brief L[u
-	 * @param _device OtBbNXfoCX
+	 * @param _backend obt@`obNGh
 	 * @param _registry bVWXg
 	 * @return bṼnh
 	 */
-	MeshHandle PrimitiveFactory::CreateCube(GraphicsDevice& _device, MeshRegistry& _registry)
+	MeshHandle PrimitiveFactory::CreateCube(IGraphicsBackend& _backend, MeshRegistry& _registry)
 	{
 		// 24_i6ʁ~4j: eʂŒ_𕪗Aʖ@ݒ
 		const Vertex cubeVertices[] = {
@@ -80,23 +80,21 @@ namespace dx3d {
 		};
 
 		auto mesh = std::make_shared<Mesh>();
-		mesh->vb = _device.CreateVertexBuffer({
-			cubeVertices,
-			static_cast<uint32_t>(sizeof(cubeVertices)),
-			static_cast<uint32_t>(sizeof(Vertex))
-			});
-		mesh->ib = _device.CreateIndexBuffer({ cubeIndices, static_cast<uint32_t>(std::size(cubeIndices)) });
+		mesh->vb = _backend.CreateVertexBuffer(cubeVertices, static_cast<uint32_t>(sizeof(cubeVertices)), static_cast<uint32_t>(sizeof(Vertex)));
+		mesh->ib = _backend.CreateIndexBuffer(cubeIndices, static_cast<uint32_t>(std::size(cubeIndices)));
 		mesh->indexCount = static_cast<uint32_t>(std::size(cubeIndices));
+		for (const auto& v : cubeVertices) { mesh->positions.push_back(v.position); }
+		mesh->indices.assign(std::begin(cubeIndices), std::end(cubeIndices));
 
 		return _registry.Register(mesh, "Cube");
 	}
 	/**
 	 * @brief NAbh
-	 * @param _device OtBbNXfoCX
+	 * @param _backend obt@`obNGh
 	 * @param _registry bVWXg
 	 * @return bṼnh
 	 */
-	MeshHandle PrimitiveFactory::CreateQuad(GraphicsDevice& _device, MeshRegistry& _registry)
+	MeshHandle PrimitiveFactory::CreateQuad(IGraphicsBackend& _backend, MeshRegistry& _registry)
 	{
 		const Vertex quadVertices[] = {
 			{{-0.5f, -0.5f, 0.0f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f}},	// 0
@@ -111,13 +109,11 @@ namespace dx3d {
 
 		// bV̍쐬
 		auto mesh = std::make_shared<Mesh>();
-		mesh->vb = _device.CreateVertexBuffer({
-			quadVertices,
-			static_cast<uint32_t>(std::size(quadVertices) * sizeof(Vertex)),
-			static_cast<uint32_t>(sizeof(Vertex))
-			});
-		mesh->ib = _device.CreateIndexBuffer({ quadIndices, std::size(quadIndices) });
+		mesh->vb = _backend.CreateVertexBuffer(quadVertices, static_cast<uint32_t>(std::size(quadVertices) * sizeof(Vertex)), static_cast<uint32_t>(sizeof(Vertex)));
+		mesh->ib = _backend.CreateIndexBuffer(quadIndices, static_cast<uint32_t>(std::size(quadIndices)));
 		mesh->indexCount = std::size(quadIndices);
+		for (const auto& v : quadVertices) { mesh->positions.push_back(v.position); }
+		mesh->indices.assign(std::begin(quadIndices), std::end(quadIndices));
 
 
 		return _registry.Register(mesh, "Quad");
@@ -125,14 +121,14 @@ namespace dx3d {
 
 	/**
 	 * @brief XtBA
-	 * @param _device OtBbNXfoCX
+	 * @param _backend obt@`obNGh
 	 * @param _registry bVWXg
 	 * @param _slices ox̕
 	 * @param _stacks ܓx̕
 	 * @param _radius a
 	 * @return bṼnh
 	 */
-	MeshHandle PrimitiveFactory::CreateSphere(GraphicsDevice& _device, MeshRegistry& _registry, uint32_t _slices, uint32_t _stacks)
+	MeshHandle PrimitiveFactory::CreateSphere(IGraphicsBackend& _backend, MeshRegistry& _registry, uint32_t _slices, uint32_t _stacks)
 	{
 		using namespace DirectX;
 
@@ -212,14 +208,12 @@ namespace dx3d {
 		}
 
 		auto mesh = std::make_shared<Mesh>();
-
-		mesh->vb = _device.CreateVertexBuffer({
-			sphereVertices.data(),
-			static_cast<uint32_t>(sphereVertices.size() * sizeof(Vertex)),
-			static_cast<uint32_t>(sizeof(Vertex))
-			});
-		mesh->ib = _device.CreateIndexBuffer({ sphereIndices.data(), (uint32_t)sphereIndices.size() });
+		mesh->vb = _backend.CreateVertexBuffer(sphereVertices.data(), static_cast<uint32_t>(sphereVertices.size() * sizeof(Vertex)), static_cast<uint32_t>(sizeof(Vertex)));
+		mesh->ib = _backend.CreateIndexBuffer(sphereIndices.data(), (uint32_t)sphereIndices.size());
 		mesh->indexCount = (uint32_t)sphereIndices.size();
+		mesh->positions.reserve(sphereVertices.size());
+		for (const auto& v : sphereVertices) { mesh->positions.push_back(v.position); }
+		mesh->indices = sphereIndices;
 
 		return _registry.Register(mesh, "Sphere");
 	}
@@ -7,17 +7,19 @@
  */
 
  /*---------- CN[h ----------*/
+#include <cstdint>
 
 namespace dx3d {
-	class GraphicsDevice;
+	class IGraphicsBackend;
 	struct MeshHandle;
 	class MeshRegistry;
 
+	// memo: obt@̓obNGhōBNull̃obNGh̓obt@Ȃ̂ŁACPǓ`(positions / indices)ɂȂ
 	namespace PrimitiveFactory {
-		MeshHandle CreateCube(GraphicsDevice& _device, MeshRegistry& _registry);
-		MeshHandle CreateQuad(GraphicsDevice& _device, MeshRegistry& _registry);
-		MeshHandle CreateSphere(GraphicsDevice& _device, MeshRegistry& _registry, uint32_t _slices = 10, uint32_t _stacks = 10);
-		//ecs::Mesh CreateLine(GraphicsDevice& _device, DirectX::XMFLOAT3 _start, DirectX::XMFLOAT3 _end);
+		MeshHandle CreateCube(IGraphicsBackend& _backend, MeshRegistry& _registry);
+		MeshHandle CreateQuad(IGraphicsBackend& _backend, MeshRegistry& _registry);
+		MeshHandle CreateSphere(IGraphicsBackend& _backend, MeshRegistry& _registry, uint32_t _slices = 10, uint32_t _stacks = 10);
+		//ecs::Mesh CreateLine(IGraphicsBackend& _backend, DirectX::XMFLOAT3 _start, DirectX::XMFLOAT3 _end);
 
 	}	// namespace PrimitiveFactory
 }	// namespace dx3d
\ No newline at end of file
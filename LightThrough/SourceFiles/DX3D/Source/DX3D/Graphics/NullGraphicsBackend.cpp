@@ -0,0 +1,77 @@
+/**
+ * @file NullGraphicsBackend.cpp
+ * @brief GPUgȂ`obNGh
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <DX3D/Graphics/NullGraphicsBackend.h>
+
+namespace dx3d {
+	void NullGraphicsBackend::BeginFrame()
+	{
+	}
+
+	void NullGraphicsBackend::EndFrame()
+	{
+		++frame_count_;
+		RecordFrameEnd();
+	}
+
+	void NullGraphicsBackend::Draw(const GraphicsDrawCall& _call)
+	{
+		RecordDraw(_call);
+	}
+
+	VertexBufferPtr NullGraphicsBackend::CreateVertexBuffer(const void*, uint32_t _bytes, uint32_t _stride)
+	{
+		if (_bytes == 0 || _stride == 0) { return {}; }
+		RecordBufferCreated(_bytes);
+		return {};
+	}
+
+	IndexBufferPtr NullGraphicsBackend::CreateIndexBuffer(const uint32_t*, uint32_t _indexCount)
+	{
+		if (_indexCount == 0) { return {}; }
+		RecordBufferCreated(static_cast<uint64_t>(_indexCount) * sizeof(uint32_t));
+		return {};
+	}
+
+	GraphicsBufferId NullGraphicsBackend::CreateDynamicVertexBuffer(uint32_t _bytes, uint32_t _stride)
+	{
+		if (_bytes == 0 || _stride == 0) { return {}; }
+
+		GraphicsBufferId id{};
+		if (!free_ids_.empty()) {
+			id.index = free_ids_.back();
+			free_ids_.pop_back();
+		}
+		else {
+			id.index = static_cast<uint32_t>(buffers_.size());
+			buffers_.emplace_back();
+		}
+		buffers_[id.index].resize(_bytes);
+		RecordBufferCreated(_bytes);
+		return id;
+	}
+
+	void NullGraphicsBackend::ReleaseBuffer(GraphicsBufferId _id)
+	{
+		if (!_id.IsValid() || _id.index >= buffers_.size() || buffers_[_id.index].empty()) { return; }
+		buffers_[_id.index] = {};	// ƕԂ
+		free_ids_.push_back(_id.index);
+	}
+
+	void* NullGraphicsBackend::MapDiscard(GraphicsBufferId _id, GraphicsQueue)
+	{
+		if (!_id.IsValid() || _id.index >= buffers_.size() || buffers_[_id.index].empty()) { return nullptr; }
+		return buffers_[_id.index].data();
+	}
+
+	void NullGraphicsBackend::Unmap(GraphicsBufferId _id, GraphicsQueue, uint64_t _writtenBytes)
+	{
+		if (!_id.IsValid() || _id.index >= buffers_.size()) { return; }
+		RecordUpload(_writtenBytes);
+	}
+}
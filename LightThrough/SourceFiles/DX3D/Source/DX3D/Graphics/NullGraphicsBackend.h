@@ -0,0 +1,45 @@
+#pragma once
+/**
+ * @file NullGraphicsBackend.h
+ * @brief GPUgȂ`obNGh
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ /*---------- CN[h ----------*/
+#include <vector>
+#include <cstdint>
+#include <DX3D/Graphics/GraphicsBackend.h>
+
+namespace dx3d {
+	/**
+	 * @brief GPUgȂ`obNGh
+	 *
+	 * 쐬 / Map / `󂯕tāAƃoCgL^邾B
+ * bVp̃obt@͍炸nullptrԂ(Meshpositions / indicesCPǓ`󂾂)B
+	 * Iobt@CPŨŎ̂ŁAޑ(InstanceBufferRingȂ)͂̂܂ܓB
+	 */
+	class NullGraphicsBackend final : public IGraphicsBackend {
+	public:
+		GraphicsBackendKind GetKind() const override { return GraphicsBackendKind::Null; }
+
+		void BeginFrame() override;
+		void EndFrame() override;
+		void Draw(const GraphicsDrawCall& _call) override;
+
+		VertexBufferPtr CreateVertexBuffer(const void* _vertices, uint32_t _bytes, uint32_t _stride) override;
+		IndexBufferPtr CreateIndexBuffer(const uint32_t* _indices, uint32_t _indexCount) override;
+		GraphicsBufferId CreateDynamicVertexBuffer(uint32_t _bytes, uint32_t _stride) override;
+		void ReleaseBuffer(GraphicsBufferId _id) override;
+		void* MapDiscard(GraphicsBufferId _id, GraphicsQueue _queue) override;
+		void Unmap(GraphicsBufferId _id, GraphicsQueue _queue, uint64_t _writtenBytes) override;
+		VertexBuffer* GetVertexBuffer(GraphicsBufferId) const override { return nullptr; }
+
+		uint64_t GetFrameCount() const { return frame_count_; }
+
+	private:
+		std::vector<std::vector<uint8_t>> buffers_{};	// obt@̒g(: ς)
+		std::vector<uint32_t> free_ids_{};				// ėpłԍ
+		uint64_t frame_count_ = 0;
+	};
+}
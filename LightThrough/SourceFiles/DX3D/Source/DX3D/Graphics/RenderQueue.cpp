@@ -0,0 +1,170 @@
+/**
+ * @file RenderQueue.cpp
+ * @brief 64bit̕`L[ŕׂ`L[
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ /*---------- CN[h ----------*/
+#include <array>
+#include <algorithm>
+#include <DX3D/Graphics/RenderQueue.h>
+
+namespace dx3d {
+	namespace {
+		constexpr uint32_t TRANSPARENT_SHIFT = 64 - RenderQueue::PASS_BITS - 1;	// 59
+		// s
+		constexpr uint32_t OPAQUE_PIPELINE_SHIFT = TRANSPARENT_SHIFT - RenderQueue::PIPELINE_BITS;	// 36
+		constexpr uint32_t OPAQUE_MESH_SHIFT = OPAQUE_PIPELINE_SHIFT - RenderQueue::MESH_BITS;		// 16
+		// 
+		constexpr uint32_t TRANSPARENT_DEPTH_SHIFT = TRANSPARENT_SHIFT - RenderQueue::DEPTH_BITS;	// 43
+		constexpr uint32_t TRANSPARENT_PIPELINE_SHIFT = TRANSPARENT_DEPTH_SHIFT - RenderQueue::PIPELINE_BITS;	// 20
+
+		constexpr uint64_t Mask(uint32_t _bits) { return (1ull << _bits) - 1; }
+
+		static_assert(OPAQUE_MESH_SHIFT == RenderQueue::DEPTH_BITS, "[RenderQueue] s̃L[64bitɎ܂ĂȂ");
+		static_assert(TRANSPARENT_PIPELINE_SHIFT == RenderQueue::MESH_BITS, "[RenderQueue] ̃L[64bitɎ܂ĂȂ");
+
+		constexpr uint32_t RADIX_BITS = 11;
+		constexpr uint32_t RADIX_BUCKETS = 1u << RADIX_BITS;
+		constexpr uint32_t RADIX_PASSES = (64 + RADIX_BITS - 1) / RADIX_BITS;
+	}
+
+	uint64_t RenderQueue::MakeKey(uint32_t _pass, PipelineKey _pipeline, uint32_t _meshId, bool _transparent, float _depth01)
+	{
+		const float depth = std::clamp(_depth01, 0.0f, 1.0f);
+		const uint64_t quantized = static_cast<uint64_t>(depth * static_cast<float>(Mask(DEPTH_BITS)) + 0.5f);
+		const uint64_t pipeline = _pipeline.value & Mask(PIPELINE_BITS);
+		const uint64_t mesh = (std::min)(_meshId, MAX_MESH_ID);
+
+		uint64_t key = (static_cast<uint64_t>(_pass) & Mask(PASS_BITS)) << (64 - PASS_BITS);
+		if (_transparent) {
+			key |= 1ull << TRANSPARENT_SHIFT;
+			key |= (Mask(DEPTH_BITS) - quantized) << TRANSPARENT_DEPTH_SHIFT;	// 
+			key |= pipeline << TRANSPARENT_PIPELINE_SHIFT;
+			key |= mesh;
+		}
+		else {
+			key |= pipeline << OPAQUE_PIPELINE_SHIFT;
+			key |= mesh << OPAQUE_MESH_SHIFT;
+			key |= quantized;	// O
+		}
+		return key;
+	}
+
+	PipelineKey RenderQueue::GetPipelineKey(uint64_t _key)
+	{
+		PipelineKey result{};
+		const uint32_t shift = IsTransparent(_key) ? TRANSPARENT_PIPELINE_SHIFT : OPAQUE_PIPELINE_SHIFT;
+		result.value = static_cast<uint32_t>((_key >> shift) & Mask(PIPELINE_BITS));
+		return result;
+	}
+
+	uint32_t RenderQueue::GetMeshId(uint64_t _key)
+	{
+		const uint32_t shift = IsTransparent(_key) ? 0 : OPAQUE_MESH_SHIFT;
+		return static_cast<uint32_t>((_key >> shift) & Mask(MESH_BITS));
+	}
+
+	uint64_t RenderQueue::GetBatchBits(uint64_t _key)
+	{
+		return IsTransparent(_key)
+			? _key & ~(Mask(DEPTH_BITS) << TRANSPARENT_DEPTH_SHIFT)
+			: _key & ~Mask(DEPTH_BITS);
+	}
+
+	void RenderQueue::Clear()
+	{
+		entries_.clear();
+		payloads_.clear();
+		draws_.clear();
+	}
+
+	/**
+	 * @brief L[ŕׂĂ܂Ƃ߂
+	 *	ɏ5bit(pass, )ŕĂA؂育ƂLSDŕׂB
+	 *	sƔ̓L[̕тႤ̂ŁAĂƋ؂̒ŒlςȂĔ΂B
+	 *	͐[xʂɂ̂ŁAׂ荇ĂԂ܂Ƃ܂(̏Ԃ͕Ȃ)
+	 */
+	void RenderQueue::Sort()
+	{
+		const size_t count = entries_.size();
+		payloads_.clear();
+		draws_.clear();
+		last_sort_passes_ = 0;
+		if (count == 0) { return; }
+		scratch_.resize(count);
+
+		// 5bitŕ
+		constexpr uint32_t GROUP_SHIFT = TRANSPARENT_SHIFT;
+		constexpr uint32_t GROUP_COUNT = 1u << (64 - GROUP_SHIFT);
+		std::array<uint32_t, GROUP_COUNT + 1> groupBegin{};
+		for (const auto& e : entries_) { ++groupBegin[(e.key >> GROUP_SHIFT) + 1]; }
+		uint32_t usedGroups = 0;
+		for (uint32_t g = 0; g < GROUP_COUNT; ++g) {
+			usedGroups += (groupBegin[g + 1] != 0) ? 1 : 0;
+			groupBegin[g + 1] += groupBegin[g];
+		}
+		if (usedGroups > 1) {
+			std::array<uint32_t, GROUP_COUNT> cursor{};
+			std::copy(groupBegin.begin(), groupBegin.end() - 1, cursor.begin());
+			for (const auto& e : entries_) { scratch_[cursor[e.key >> GROUP_SHIFT]++] = e; }
+			entries_.swap(scratch_);
+			++last_sort_passes_;
+		}
+
+		// ؂育Ƃɉ59bitLSDŕׂ
+		for (uint32_t g = 0; g < GROUP_COUNT; ++g) {
+			const uint32_t begin = groupBegin[g];
+			const uint32_t end = groupBegin[g + 1];
+			if (end - begin < 2) { continue; }
+			Entry* src = entries_.data() + begin;
+			Entry* dst = scratch_.data() + begin;
+			const uint32_t n = end - begin;
+
+			// S̃qXgOxɐ
+			std::array<std::array<uint32_t, RADIX_BUCKETS>, RADIX_PASSES> histograms{};
+			for (uint32_t i = 0; i < n; ++i) {
+				const uint64_t key = src[i].key;
+				for (uint32_t p = 0; p < RADIX_PASSES; ++p) {
+					++histograms[p][(key >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+				}
+			}
+
+			for (uint32_t p = 0; p < RADIX_PASSES; ++p) {
+				auto& histogram = histograms[p];
+				// Sľ͕בւĂςȂ
+				if (histogram[(src[0].key >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1)] == n) { continue; }
+
+				uint32_t offset = 0;
+				for (auto& h : histogram) {
+					const uint32_t c = h;
+					h = offset;
+					offset += c;
+				}
+				for (uint32_t i = 0; i < n; ++i) {
+					dst[histogram[(src[i].key >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++] = src[i];
+				}
+				std::swap(src, dst);
+				++last_sort_passes_;
+			}
+			// ʂƗp̕ɎcĂ߂
+			if (src != entries_.data() + begin) {
+				std::copy(src, src + n, entries_.data() + begin);
+			}
+		}
+
+		// [xȊOŗׂ荇̂܂Ƃ߂
+		payloads_.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			payloads_[i] = entries_[i].payload;
+			const uint64_t bits = GetBatchBits(entries_[i].key);
+			if (draws_.empty() || GetBatchBits(draws_.back().key) != bits) {
+				draws_.push_back({ entries_[i].key, static_cast<uint32_t>(i), 1 });
+			}
+			else {
+				++draws_.back().count;
+			}
+		}
+	}
+}
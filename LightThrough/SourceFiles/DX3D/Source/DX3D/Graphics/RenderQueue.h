@@ -0,0 +1,95 @@
+#pragma once
+/**
+ * @file RenderQueue.h
+ * @brief 64bit̕`L[ŕׂ`L[
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ /*---------- CN[h ----------*/
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <DX3D/Graphics/PipelineKey.h>
+
+// memo: D3DɈˑȂ(L[̑gݗ / בւ / ܂Ƃ߂邾)Bobt@ւ݂̏ƕ`͎傪s
+
+namespace dx3d {
+	/**
+	 * @brief `L[
+	 *
+	 * CX^XƂ64bit̃L[ƒg̔ԍ(payload)ς݁AL[\[gĂ
+	 * [xȊOŗׂ荇̂̃CX^X`ɂ܂Ƃ߂B
+	 * L[̕(ʂ):
+	 *	s: [pass 4][0 1][PipelineKey 23][mesh 20][[x 16]            ... pCvC  bV  O
+	 *	: [pass 4][1 1][̐[x 16][PipelineKey 23][mesh 20]    ... ([xȂpCvC)
+	 * :
+	 *	queue.Clear();
+	 *	queue.Add(RenderQueue::MakeKey(0, psoKey, mesh.id, false, depth01), instanceIndex);
+	 *	queue.Sort();
+	 *	for (auto& d : queue.GetDraws()) { ... queue.GetPayloads()[d.first + i] ... }
+	 */
+	class RenderQueue final {
+	public:
+		static constexpr uint32_t PASS_BITS = 4;
+		static constexpr uint32_t PIPELINE_BITS = 23;	// PipelineKeyreservedȊO
+		static constexpr uint32_t MESH_BITS = 20;
+		static constexpr uint32_t DEPTH_BITS = 16;
+		static constexpr uint32_t MAX_MESH_ID = (1u << MESH_BITS) - 1;
+
+		/**
+		 * @brief ׂ̕`
+		 */
+		struct Draw {
+			uint64_t key = 0;		// 擪̃L[
+			uint32_t first = 0;		// GetPayloads()̐擪
+			uint32_t count = 0;		// CX^X
+		};
+
+		/**
+		 * @brief L[̑gݗ
+		 * @param _pass `Ԃ̑傫ȋ؂(0 ` 15)
+		 * @param _pipeline pCvC
+		 * @param _meshId bV̔ԍ(MAX_MESH_ID܂)
+		 * @param _transparent true: ׂ
+		 * @param _depth01 J̋(0: O ` 1: )
+		 */
+		static uint64_t MakeKey(uint32_t _pass, PipelineKey _pipeline, uint32_t _meshId, bool _transparent, float _depth01);
+
+		static PipelineKey GetPipelineKey(uint64_t _key);
+		static uint32_t GetMeshId(uint64_t _key);
+		static uint32_t GetPass(uint64_t _key) { return static_cast<uint32_t>(_key >> (64 - PASS_BITS)); }
+		static bool IsTransparent(uint64_t _key) { return ((_key >> (63 - PASS_BITS)) & 1) != 0; }
+
+		//! @brief ςݒ̊Jn(mۂ͎g)
+		void Clear();
+		//! @brief ς
+		void Add(uint64_t _key, uint32_t _payload) { entries_.push_back({ _key, _payload }); }
+		void Reserve(size_t _count) { entries_.reserve(_count); }
+
+		/**
+		 * @brief L[ŕׂĂ܂Ƃ߂
+		 *	11bitLSD\[g()BS̃L[œlɂȂĂ錅͔΂
+		 */
+		void Sort();
+
+		size_t GetCount() const { return entries_.size(); }
+		const std::vector<uint32_t>& GetPayloads() const { return payloads_; }	// ׂ̒g̔ԍ
+		const std::vector<Draw>& GetDraws() const { return draws_; }
+		uint32_t GetLastSortPasses() const { return last_sort_passes_; }	// ߂SortŎۂɕבւ̐
+
+	private:
+		struct Entry {
+			uint64_t key;
+			uint32_t payload;
+		};
+
+		static uint64_t GetBatchBits(uint64_t _key);	// [x(ꂪȂ܂Ƃ߂)
+
+		std::vector<Entry> entries_{};
+		std::vector<Entry> scratch_{};
+		std::vector<uint32_t> payloads_{};
+		std::vector<Draw> draws_{};
+		uint32_t last_sort_passes_ = 0;
+	};
+}
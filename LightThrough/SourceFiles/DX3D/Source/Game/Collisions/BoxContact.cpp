@@ -0,0 +1,256 @@
+/**
+ * @file BoxContact.cpp
+ * @brief m̐ڐG_̐(ʂ̃NbsO)
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <algorithm>
+#include <Game/Collisions/BoxContact.h>
+
+namespace dx3d {
+	namespace collision {
+		namespace {
+			constexpr uint32_t MAX_CLIP_VERTICES = 8;	// lp`lp`Ő؂ƍő8_
+
+			//! @brief NbsO̒_
+			struct ClipVertex {
+				float p[3]{};
+				uint32_t id = 0;	// 0`3: ˖ʂ̒_, 4`: NbvŐ܂ꂽ_(ʂ̔ԍ * 4 + ̕)
+			};
+
+			inline float Dot(const float* _a, const float* _b) { return _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2]; }
+			inline void Sub(const float* _a, const float* _b, float* _out) { for (int k = 0; k < 3; ++k) { _out[k] = _a[k] - _b[k]; } }
+			inline void Cross(const float* _a, const float* _b, float* _out)
+			{
+				_out[0] = _a[1] * _b[2] - _a[2] * _b[1];
+				_out[1] = _a[2] * _b[0] - _a[0] * _b[2];
+				_out[2] = _a[0] * _b[1] - _a[1] * _b[0];
+			}
+
+			/**
+			 * @brief ʂ̓(dot(p, n) <= d)Ɏc
+			 * @return o͂̒_
+			 */
+			uint32_t ClipByPlane(const ClipVertex* _in, uint32_t _count, const float* _n, float _d, uint32_t _plane, ClipVertex* _out)
+			{
+				uint32_t outCount = 0;
+				for (uint32_t i = 0; i < _count; ++i) {
+					const ClipVertex& cur = _in[i];
+					const ClipVertex& next = _in[(i + 1) % _count];
+					const float dc = Dot(cur.p, _n) - _d;
+					const float dn = Dot(next.p, _n) - _d;
+
+					if (dc <= 0.0f && outCount < MAX_CLIP_VERTICES) {
+						_out[outCount++] = cur;
+					}
+					// ӂʂ܂Ȃ_𑫂
+					if ((dc <= 0.0f) != (dn <= 0.0f) && outCount < MAX_CLIP_VERTICES) {
+						const float t = dc / (dc - dn);
+						ClipVertex& v = _out[outCount++];
+						for (int k = 0; k < 3; ++k) { v.p[k] = cur.p[k] + (next.p[k] - cur.p[k]) * t; }
+						v.id = 4 + _plane * 4 + (cur.id & 3);
+					}
+				}
+				return outCount;
+			}
+
+			/**
+			 * @brief ʓm̐ڐG
+			 * @param _ref ʂ
+			 * @param _inc ˖ʂ
+			 * @param _refAxis ʂ̎̔ԍ
+			 * @param _refNormal ʂ̊O̖@(ˑ̔̕)
+			 */
+			uint32_t FaceContacts(const ContactBox& _ref, const ContactBox& _inc, int _refAxis, const float* _refNormal, uint32_t _featureBase, ContactPointInput* _out, uint32_t _maxPoints)
+			{
+				// ˖: ʂ̖@ƈԌ
+				int incAxis = 0;
+				float best = -1.0f;
+				for (int k = 0; k < 3; ++k) {
+					const float d = std::fabs(Dot(_inc.axis[k], _refNormal));
+					if (d > best) { best = d; incAxis = k; }
+				}
+				const float incSign = (Dot(_inc.axis[incAxis], _refNormal) > 0.0f) ? -1.0f : 1.0f;
+				const int u = (incAxis + 1) % 3;
+				const int v = (incAxis + 2) % 3;
+
+				// ˖ʂ̎l_()
+				static constexpr float CORNER_SIGN[4][2] = { { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+				ClipVertex bufferA[MAX_CLIP_VERTICES]{};
+				ClipVertex bufferB[MAX_CLIP_VERTICES]{};
+				for (uint32_t i = 0; i < 4; ++i) {
+					for (int k = 0; k < 3; ++k) {
+						bufferA[i].p[k] = _inc.center[k]
+							+ _inc.axis[incAxis][k] * incSign * _inc.half[incAxis]
+							+ _inc.axis[u][k] * CORNER_SIGN[i][0] * _inc.half[u]
+							+ _inc.axis[v][k] * CORNER_SIGN[i][1] * _inc.half[v];
+					}
+					bufferA[i].id = i;
+				}
+
+				// ʂ̎l()ŃNbsO
+				uint32_t count = 4;
+				ClipVertex* in = bufferA;
+				ClipVertex* out = bufferB;
+				uint32_t plane = 0;
+				for (int s = 1; s <= 2; ++s) {
+					const int t = (_refAxis + s) % 3;
+					const float c = Dot(_ref.center, _ref.axis[t]);
+					const float n[3] = { -_ref.axis[t][0], -_ref.axis[t][1], -_ref.axis[t][2] };
+					count = ClipByPlane(in, count, _ref.axis[t], c + _ref.half[t], plane++, out);
+					std::swap(in, out);
+					if (count == 0) { return 0; }
+					count = ClipByPlane(in, count, n, -c + _ref.half[t], plane++, out);
+					std::swap(in, out);
+					if (count == 0) { return 0; }
+				}
+
+				// ʂɂ_c
+				const float refOffset = Dot(_ref.center, _refNormal) + _ref.half[_refAxis];
+				const uint32_t incFace = static_cast<uint32_t>(incAxis * 2 + (incSign > 0.0f ? 0 : 1));
+				ContactPointInput points[MAX_CLIP_VERTICES]{};
+				uint32_t pointCount = 0;
+				for (uint32_t i = 0; i < count; ++i) {
+					const float separation = Dot(in[i].p, _refNormal) - refOffset;
+					if (separation > 0.0f) { continue; }
+
+					ContactPointInput& p = points[pointCount++];
+					for (int k = 0; k < 3; ++k) { p.position[k] = in[i].p[k] - _refNormal[k] * separation * 0.5f; }
+					p.penetration = -separation;
+					p.featureId = _featureBase | (incFace << 5) | in[i].id;
+				}
+
+				pointCount = ReduceContactPoints(points, pointCount, _refNormal, _maxPoints);
+				std::copy(points, points + pointCount, _out);
+				return pointCount;
+			}
+
+			/**
+			 * @brief ӓm̐ڐG
+			 *	@̕ɈԏoĂӓm̍ŋߐړ_̒_
+			 */
+			uint32_t EdgeContact(const ContactBox& _a, const ContactBox& _b, int _edgeA, int _edgeB, const float* _normal, float _penetration, uint32_t _featureBase, ContactPointInput* _out)
+			{
+				float pA[3]{}, pB[3]{};
+				for (int k = 0; k < 3; ++k) { pA[k] = _a.center[k]; pB[k] = _b.center[k]; }
+				for (int j = 0; j < 3; ++j) {
+					if (j != _edgeA) {
+						const float s = (Dot(_a.axis[j], _normal) > 0.0f) ? _a.half[j] : -_a.half[j];
+						for (int k = 0; k < 3; ++k) { pA[k] += _a.axis[j][k] * s; }
+					}
+					if (j != _edgeB) {
+						const float s = (Dot(_b.axis[j], _normal) < 0.0f) ? _b.half[j] : -_b.half[j];
+						for (int k = 0; k < 3; ++k) { pB[k] += _b.axis[j][k] * s; }
+					}
+				}
+
+				// 񒼐̍ŋߐړ_(ӂ̒ŃNv)
+				const float* dA = _a.axis[_edgeA];
+				const float* dB = _b.axis[_edgeB];
+				float r[3];
+				Sub(pA, pB, r);
+				const float b = Dot(dA, dB);
+				const float c = Dot(dA, r);
+				const float f = Dot(dB, r);
+				const float denom = 1.0f - b * b;
+				float s = 0.0f, t = 0.0f;
+				if (denom > 1e-6f) {
+					s = std::clamp((b * f - c) / denom, -_a.half[_edgeA], _a.half[_edgeA]);
+					t = std::clamp((f + b * s), -_b.half[_edgeB], _b.half[_edgeB]);
+				}
+
+				for (int k = 0; k < 3; ++k) {
+					_out[0].position[k] = ((pA[k] + dA[k] * s) + (pB[k] + dB[k] * t)) * 0.5f;
+				}
+				_out[0].penetration = _penetration;
+				_out[0].featureId = _featureBase;
+				return 1;
+			}
+		}
+
+		/**
+		 * @brief m̐ڐG_𐶐
+		 */
+		uint32_t GenerateBoxContacts(
+			const ContactBox& _a, const ContactBox& _b,
+			const float* _normal, float _penetration, uint32_t _feature,
+			ContactPointInput* _out, uint32_t _maxPoints)
+		{
+			_maxPoints = std::clamp(_maxPoints, 1u, MAX_MANIFOLD_POINTS);
+			const uint32_t axisId = _feature >> 1;
+			const uint32_t featureBase = _feature << 8;
+
+			// A̖: @͂̂܂ÅO
+			if (axisId < 3) {
+				return FaceContacts(_a, _b, static_cast<int>(axisId), _normal, featureBase, _out, _maxPoints);
+			}
+			// B̖: @𔽓]B̊O
+			if (axisId < 6) {
+				const float n[3] = { -_normal[0], -_normal[1], -_normal[2] };
+				return FaceContacts(_b, _a, static_cast<int>(axisId - 3), n, featureBase, _out, _maxPoints);
+			}
+			// ӓm
+			const uint32_t edge = axisId - 6;
+			return EdgeContact(_a, _b, static_cast<int>(edge / 3), static_cast<int>(edge % 3), _normal, _penetration, featureBase, _out);
+		}
+
+		/**
+		 * @brief ڐG_܂Ō炷
+		 */
+		uint32_t ReduceContactPoints(ContactPointInput* _points, uint32_t _count, const float* _normal, uint32_t _maxPoints)
+		{
+			if (_count <= _maxPoints) { return _count; }
+
+			// I񂾓_擪ɋl߂Ă
+			auto pick = [&](uint32_t _slot, uint32_t _index) { std::swap(_points[_slot], _points[_index]); };
+
+			// 1. Ԑ[_
+			uint32_t best = 0;
+			for (uint32_t i = 1; i < _count; ++i) {
+				if (_points[i].penetration > _points[best].penetration) { best = i; }
+			}
+			pick(0, best);
+			if (_maxPoints == 1) { return 1; }
+
+			// 2. ԉ_
+			best = 1;
+			float bestValue = -1.0f;
+			for (uint32_t i = 1; i < _count; ++i) {
+				float d[3];
+				Sub(_points[i].position, _points[0].position, d);
+				const float value = Dot(d, d);
+				if (value > bestValue) { bestValue = value; best = i; }
+			}
+			pick(1, best);
+			if (_maxPoints == 2) { return 2; }
+
+			// 3. / 4. _Ԑ̗ŁAԗꂽ_(Op`̖ʐςő)
+			float edge[3];
+			Sub(_points[1].position, _points[0].position, edge);
+			auto side = [&](uint32_t _i) {
+				float d[3], c[3];
+				Sub(_points[_i].position, _points[0].position, d);
+				Cross(edge, d, c);
+				return Dot(c, _normal);
+			};
+
+			uint32_t most = 2, least = 2;
+			for (uint32_t i = 3; i < _count; ++i) {
+				if (side(i) > side(most)) { most = i; }
+				if (side(i) < side(least)) { least = i; }
+			}
+			// ʐς傫Ɏ
+			const bool mostFirst = std::fabs(side(most)) >= std::fabs(side(least));
+			const uint32_t first = mostFirst ? most : least;
+			uint32_t second = mostFirst ? least : most;
+			pick(2, first);
+			if (second == 2) { second = first; }	// ւňړ
+			if (_maxPoints == 3 || second == 2) { return 3; }
+			pick(3, second);
+			return 4;
+		}
+	}
+}
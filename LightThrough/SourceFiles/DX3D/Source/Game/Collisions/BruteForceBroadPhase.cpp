@@ -0,0 +1,69 @@
+/**
+ * @file BruteForceBroadPhase.cpp
+ * @brief SyA𒲂ׂu[htF[Y(rp)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Collisions/BruteForceBroadPhase.h>
+
+namespace dx3d {
+	namespace collision {
+		//! @brief vLV̍쐬
+		ProxyId BruteForceBroadPhase::CreateProxy(const AABB& _aabb, uint64_t _userData)
+		{
+			ProxyId id;
+			if (free_list_.empty()) {
+				id = static_cast<ProxyId>(proxies_.size());
+				proxies_.emplace_back();
+			}
+			else {
+				id = free_list_.back();
+				free_list_.pop_back();
+			}
+			proxies_[id] = Proxy{ _aabb, _userData, true };
+			++proxy_count_;
+			return id;
+		}
+
+		//! @brief vLV̍폜
+		void BruteForceBroadPhase::DestroyProxy(ProxyId _proxy)
+		{
+			proxies_[_proxy].alive = false;
+			free_list_.push_back(_proxy);
+			--proxy_count_;
+		}
+
+		//! @brief vLV̈ړ
+		bool BruteForceBroadPhase::MoveProxy(ProxyId _proxy, const AABB& _aabb)
+		{
+			proxies_[_proxy].aabb = _aabb;
+			return true;
+		}
+
+		/**
+		 * @brief dȂĂyA̍XV
+		 *	SyA𒲂גđOƍ
+		 */
+		void BruteForceBroadPhase::UpdatePairs(std::vector<BroadPhasePair>& _added, std::vector<BroadPhasePair>& _removed)
+		{
+			_added.clear();
+			_removed.clear();
+
+			next_.clear();
+			const ProxyId count = static_cast<ProxyId>(proxies_.size());
+			for (ProxyId a = 0; a < count; ++a) {
+				if (!proxies_[a].alive) { continue; }
+				for (ProxyId b = a + 1; b < count; ++b) {
+					if (!proxies_[b].alive) { continue; }
+					if (!proxies_[a].aabb.Overlaps(proxies_[b].aabb)) { continue; }
+					next_.push_back(BroadPhasePair{ a, b, proxies_[a].userData, proxies_[b].userData });
+				}
+			}
+
+			DiffPairs(pairs_, next_, _added, _removed);
+			pairs_.swap(next_);
+		}
+	}
+}
@@ -0,0 +1,112 @@
+/**
+ * @file ContactManifold.cpp
+ * @brief Xebv܂ŕێڐG}jtH[h
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <algorithm>
+#include <Game/Collisions/ContactManifold.h>
+
+namespace dx3d {
+	namespace collision {
+		namespace {
+			// @傫ςAO̐ڐGƂ͕ʕƂĈpȂ(18x)
+			constexpr float NORMAL_KEEP_COS = 0.95f;
+		}
+
+		//! @brief Xebv̊Jn
+		void ContactManifoldCache::BeginStep()
+		{
+			++step_;
+			point_count_ = 0;
+			matched_count_ = 0;
+		}
+
+		/**
+		 * @brief Xebv̐ڐGŃ}jtH[hXV
+		 */
+		ContactManifold& ContactManifoldCache::Update(uint64_t _userA, uint64_t _userB, const float* _normal, const ContactPointInput* _points, uint32_t _count)
+		{
+			const uint64_t key = MakeKey(_userA, _userB);
+			auto [it, inserted] = index_.try_emplace(key, static_cast<uint32_t>(manifolds_.size()));
+			if (inserted) {
+				manifolds_.emplace_back();
+				manifolds_.back().key = key;
+			}
+			ContactManifold& m = manifolds_[it->second];
+
+			// p邩(tɂȂ / @傫ς͈̂pȂ)
+			const bool sameOrder = !inserted && m.userA == _userA && m.userB == _userB;
+			const float cosNormal = m.normal[0] * _normal[0] + m.normal[1] * _normal[1] + m.normal[2] * _normal[2];
+			const bool keep = sameOrder && cosNormal >= NORMAL_KEEP_COS;
+
+			ManifoldPoint old[MAX_MANIFOLD_POINTS];
+			const uint32_t oldCount = keep ? m.pointCount : 0;
+			std::copy(m.points, m.points + oldCount, old);
+
+			m.userA = _userA;
+			m.userB = _userB;
+			std::copy(_normal, _normal + 3, m.normal);
+			m.pointCount = (std::min)(_count, MAX_MANIFOLD_POINTS);
+			m.lastStep = step_;
+
+			for (uint32_t i = 0; i < m.pointCount; ++i) {
+				ManifoldPoint& p = m.points[i];
+				p = ManifoldPoint{};
+				std::copy(_points[i].position, _points[i].position + 3, p.position);
+				p.penetration = _points[i].penetration;
+				p.featureId = _points[i].featureId;
+
+				// ̓_̗ݐσCpXp
+				for (uint32_t j = 0; j < oldCount; ++j) {
+					if (old[j].featureId != p.featureId) { continue; }
+					p.normalImpulse = old[j].normalImpulse;
+					p.tangentImpulse[0] = old[j].tangentImpulse[0];
+					p.tangentImpulse[1] = old[j].tangentImpulse[1];
+					++matched_count_;
+					break;
+				}
+			}
+			point_count_ += m.pointCount;
+			return m;
+		}
+
+		/**
+		 * @brief Xebv̏I
+		 *	XebvōXVȂyÂĂ(Ō̗vfŖ߂)
+		 */
+		void ContactManifoldCache::EndStep()
+		{
+			for (uint32_t i = 0; i < static_cast<uint32_t>(manifolds_.size());) {
+				if (manifolds_[i].lastStep == step_) {
+					++i;
+					continue;
+				}
+				index_.erase(manifolds_[i].key);
+				if (i + 1 != manifolds_.size()) {
+					manifolds_[i] = manifolds_.back();
+					index_[manifolds_[i].key] = i;
+				}
+				manifolds_.pop_back();
+			}
+		}
+
+		//! @brief SĎ̂Ă
+		void ContactManifoldCache::Clear()
+		{
+			manifolds_.clear();
+			index_.clear();
+			point_count_ = 0;
+			matched_count_ = 0;
+		}
+
+		//! @brief yÃ}jtH[hT
+		const ContactManifold* ContactManifoldCache::Find(uint64_t _key) const
+		{
+			auto it = index_.find(_key);
+			return (it != index_.end()) ? &manifolds_[it->second] : nullptr;
+		}
+	}
+}
@@ -0,0 +1,194 @@
+/**
+ * @file ContactSolver.cpp
+ * @brief CpX@̐ڐG\o[
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <algorithm>
+#include <Game/Collisions/ContactSolver.h>
+
+namespace dx3d {
+	namespace collision {
+		namespace {
+			inline float Dot(const float* _a, const float* _b) { return _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2]; }
+
+			//! @brief xɃCpX(vA -= invA * P, vB += invB * P)
+			inline void ApplyImpulse(SolverBody& _a, SolverBody& _b, const float* _dir, float _impulse)
+			{
+				for (int k = 0; k < 3; ++k) {
+					_a.velocity[k] -= _dir[k] * _impulse * _a.invMass;
+					_b.velocity[k] += _dir[k] * _impulse * _b.invMass;
+				}
+			}
+
+			//! @brief @ɒ
+			void BuildTangents(const float* _n, float* _t0, float* _t1)
+			{
+				// @ƈԕsłȂ
+				if (std::fabs(_n[0]) >= 0.57735f) {
+					_t0[0] = _n[1]; _t0[1] = -_n[0]; _t0[2] = 0.0f;
+				}
+				else {
+					_t0[0] = 0.0f; _t0[1] = _n[2]; _t0[2] = -_n[1];
+				}
+				const float len = std::sqrt(Dot(_t0, _t0));
+				for (int k = 0; k < 3; ++k) { _t0[k] /= len; }
+				_t1[0] = _n[1] * _t0[2] - _n[2] * _t0[1];
+				_t1[1] = _n[2] * _t0[0] - _n[0] * _t0[2];
+				_t1[2] = _n[0] * _t0[1] - _n[1] * _t0[0];
+			}
+		}
+
+		/**
+		 * @brief 
+		 *	PreStep(L /  / EH[X^[g)  x̔  ђʂ߂
+		 */
+		void ContactSolver::Solve(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds, float _dt, const ContactSolverSettings& _settings)
+		{
+			stats_ = {};
+			for (auto& body : _bodies) {
+				body.positionCorrection[0] = body.positionCorrection[1] = body.positionCorrection[2] = 0.0f;
+			}
+			stats_.manifoldCount = static_cast<uint32_t>(_manifolds.size());
+			if (_manifolds.empty() || _dt <= 0.0f) { return; }
+
+			start_velocities_.resize(_bodies.size() * 3);
+			for (size_t i = 0; i < _bodies.size(); ++i) {
+				std::copy(_bodies[i].velocity, _bodies[i].velocity + 3, &start_velocities_[i * 3]);
+			}
+
+			PreStep(_bodies, _manifolds, _settings);
+			for (uint32_t i = 0; i < _settings.iterations; ++i) {
+				stats_.lastImpulseDelta = SolveOnce(_bodies, _manifolds);
+				++stats_.iterations;
+			}
+
+			// ʒuÂxŐiłȂAς߂(xŐi񂾂Ƃɂ)
+			if (_settings.positionsIntegrated) {
+				for (size_t i = 0; i < _bodies.size(); ++i) {
+					for (int k = 0; k < 3; ++k) {
+						_bodies[i].positionCorrection[k] = (_bodies[i].velocity[k] - start_velocities_[i * 3 + k]) * _dt;
+					}
+				}
+			}
+			SolvePosition(_bodies, _manifolds, _settings);
+		}
+
+		/**
+		 * @brief ̑Ȍ
+		 *	iȂ̂ŁALʂ͐ڐG_ɂ炸 1 / (invA + invB)
+		 */
+		void ContactSolver::PreStep(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds, const ContactSolverSettings& _settings)
+		{
+			for (auto& m : _manifolds) {
+				SolverBody& a = _bodies[m.bodyA];
+				SolverBody& b = _bodies[m.bodyB];
+				BuildTangents(m.normal, m.tangent[0], m.tangent[1]);
+
+				const float invMassSum = a.invMass + b.invMass;
+				const float mass = (invMassSum > 0.0f) ? 1.0f / invMassSum : 0.0f;
+
+				float relVel[3];
+				for (int k = 0; k < 3; ++k) { relVel[k] = b.velocity[k] - a.velocity[k]; }
+				const float vn = Dot(relVel, m.normal);
+
+				for (uint32_t i = 0; i < m.pointCount; ++i) {
+					auto& p = m.points[i];
+					p.normalMass = mass;
+					p.tangentMass = mass;
+
+					// (ђʂSolvePositionŖ߂̂ŁAxɂ͓Ȃ)
+					p.velocityBias = (vn < -_settings.restitutionThreshold) ? -m.restitution * vn : 0.0f;
+
+					stats_.pointCount++;
+					if (!_settings.warmStart) {
+						p.normalImpulse = 0.0f;
+						p.tangentImpulse[0] = 0.0f;
+						p.tangentImpulse[1] = 0.0f;
+						continue;
+					}
+					// ÕXebv̗ݐσCpX̂܂܉Ă
+					ApplyImpulse(a, b, m.normal, p.normalImpulse);
+					ApplyImpulse(a, b, m.tangent[0], p.tangentImpulse[0]);
+					ApplyImpulse(a, b, m.tangent[1], p.tangentImpulse[1]);
+				}
+			}
+		}
+
+		/**
+		 * @brief SڐG񂸂
+		 *	C͖̏@̃CpXɈˑ̂ŁAC  @̏
+		 * @return CpX̕ω̍ől
+		 */
+		float ContactSolver::SolveOnce(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds)
+		{
+			float maxDelta = 0.0f;
+			for (auto& m : _manifolds) {
+				SolverBody& a = _bodies[m.bodyA];
+				SolverBody& b = _bodies[m.bodyB];
+				if (a.invMass + b.invMass <= 0.0f) { continue; }
+
+				for (uint32_t i = 0; i < m.pointCount; ++i) {
+					auto& p = m.points[i];
+
+					// C(ݐϒl }mu * @CpX Ɏ߂)
+					const float maxFriction = m.friction * p.normalImpulse;
+					for (int t = 0; t < 2; ++t) {
+						float relVel[3];
+						for (int k = 0; k < 3; ++k) { relVel[k] = b.velocity[k] - a.velocity[k]; }
+						const float vt = Dot(relVel, m.tangent[t]);
+						const float old = p.tangentImpulse[t];
+						p.tangentImpulse[t] = std::clamp(old - vt * p.tangentMass, -maxFriction, maxFriction);
+						const float delta = p.tangentImpulse[t] - old;
+						ApplyImpulse(a, b, m.tangent[t], delta);
+						maxDelta = (std::max)(maxDelta, std::fabs(delta));
+					}
+
+					// @(ݐϒl͉Ԃ)
+					float relVel[3];
+					for (int k = 0; k < 3; ++k) { relVel[k] = b.velocity[k] - a.velocity[k]; }
+					const float vn = Dot(relVel, m.normal);
+					const float old = p.normalImpulse;
+					p.normalImpulse = (std::max)(old + (p.velocityBias - vn) * p.normalMass, 0.0f);
+					const float delta = p.normalImpulse - old;
+					ApplyImpulse(a, b, m.normal, delta);
+					maxDelta = (std::max)(maxDelta, std::fabs(delta));
+				}
+			}
+			return maxDelta;
+		}
+
+		/**
+		 * @brief ђʂ߂ړʂ
+		 *	̈ړʂŎcђʂςÄꕔ(baumgarte)ԂB񌩐ς蒼̂ŗݐς͂Ȃ
+		 */
+		void ContactSolver::SolvePosition(std::vector<SolverBody>& _bodies, std::vector<ContactManifold>& _manifolds, const ContactSolverSettings& _settings)
+		{
+			for (uint32_t iter = 0; iter < _settings.positionIterations; ++iter) {
+				for (auto& m : _manifolds) {
+					SolverBody& a = _bodies[m.bodyA];
+					SolverBody& b = _bodies[m.bodyB];
+					if (a.invMass + b.invMass <= 0.0f) { continue; }
+
+					for (uint32_t i = 0; i < m.pointCount; ++i) {
+						const auto& p = m.points[i];
+						float relMove[3];
+						for (int k = 0; k < 3; ++k) { relMove[k] = b.positionCorrection[k] - a.positionCorrection[k]; }
+						const float penetration = p.penetration - Dot(relMove, m.normal);
+						const float correction = (std::min)(_settings.baumgarte * (penetration - _settings.slop), _settings.maxCorrection);
+						if (correction <= 0.0f) { continue; }
+
+						const float impulse = correction * p.normalMass;
+						for (int k = 0; k < 3; ++k) {
+							a.positionCorrection[k] -= m.normal[k] * impulse * a.invMass;
+							b.positionCorrection[k] += m.normal[k] * impulse * b.invMass;
+						}
+					}
+				}
+			}
+		}
+	}
+}
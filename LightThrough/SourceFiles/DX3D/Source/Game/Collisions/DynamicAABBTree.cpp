@@ -0,0 +1,470 @@
+/**
+ * @file DynamicAABBTree.cpp
+ * @brief IAABBc[̃u[htF[Y
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Collisions/DynamicAABBTree.h>
+#include <cassert>
+
+namespace dx3d {
+	namespace collision {
+		/**
+		 * @brief RXgN^
+		 * @param _margin fat AABB̗]
+		 * @param _displacementScale ړɐL΂{
+		 */
+		DynamicAABBTree::DynamicAABBTree(float _margin, float _displacementScale)
+			: margin_(_margin)
+			, displacement_scale_(_displacementScale)
+		{
+		}
+
+		/**
+		 * @brief vLV̍쐬
+		 * @param _aabb `AABB
+		 * @param _userData l
+		 * @return vLVID
+		 */
+		ProxyId DynamicAABBTree::CreateProxy(const AABB& _aabb, uint64_t _userData)
+		{
+			const int32_t leaf = AllocateNode();
+			Node& node = nodes_[leaf];
+			node.aabb = MakeFatAABB(_aabb, nullptr);
+			node.tight = _aabb;
+			node.userData = _userData;
+			node.height = 0;
+
+			InsertLeaf(leaf);
+			MarkMoved(leaf);
+			++proxy_count_;
+			return leaf;
+		}
+
+		/**
+		 * @brief vLV̍폜
+		 *	IDg񂳂ĂȂ悤ɁAĂyA͂ňꗗOĂ
+		 * @param _proxy vLVID
+		 */
+		void DynamicAABBTree::DestroyProxy(ProxyId _proxy)
+		{
+			assert(0 <= _proxy && _proxy < static_cast<int32_t>(nodes_.size()) && nodes_[_proxy].IsLeaf());
+
+			auto it = std::remove_if(pairs_.begin(), pairs_.end(), [&](const BroadPhasePair& _pair) {
+				if (_pair.proxyA != _proxy && _pair.proxyB != _proxy) { return false; }
+				destroyed_pairs_.push_back(_pair);
+				return true;
+				});
+			pairs_.erase(it, pairs_.end());
+
+			if (nodes_[_proxy].moved) {
+				std::replace(move_buffer_.begin(), move_buffer_.end(), _proxy, NULL_PROXY);
+			}
+
+			RemoveLeaf(_proxy);
+			FreeNode(_proxy);
+			--proxy_count_;
+		}
+
+		/**
+		 * @brief vLV̈ړ
+		 *	fat AABBɎ܂ĂԂ͉Ȃ
+		 * @param _proxy vLVID
+		 * @param _aabb ړ̌`AABB
+		 * @return true: ꒼
+		 */
+		bool DynamicAABBTree::MoveProxy(ProxyId _proxy, const AABB& _aabb)
+		{
+			assert(0 <= _proxy && _proxy < static_cast<int32_t>(nodes_.size()) && nodes_[_proxy].IsLeaf());
+			Node& node = nodes_[_proxy];
+
+			float displacement[3];
+			for (int i = 0; i < 3; ++i) {
+				displacement[i] = (_aabb.min[i] + _aabb.max[i] - node.tight.min[i] - node.tight.max[i]) * 0.5f;
+			}
+			node.tight = _aabb;
+
+			if (node.aabb.Contains(_aabb)) {
+				// kŗ]傫Ȃ肷蒼
+				AABB huge = _aabb;
+				const float limit = margin_ * 4.0f;
+				for (int i = 0; i < 3; ++i) {
+					huge.min[i] -= limit;
+					huge.max[i] += limit;
+				}
+				if (huge.Contains(node.aabb)) { return false; }
+			}
+
+			RemoveLeaf(_proxy);
+			nodes_[_proxy].aabb = MakeFatAABB(_aabb, displacement);
+			InsertLeaf(_proxy);
+			MarkMoved(_proxy);
+			return true;
+		}
+
+		/**
+		 * @brief dȂĂyA̍XV
+		 *	vLVc[ɖ₢킹BǂĂȂyA͂̂܂܎c
+		 * @param _added O񂩂瑝yA
+		 * @param _removed O񂩂猸yA
+		 */
+		void DynamicAABBTree::UpdatePairs(std::vector<BroadPhasePair>& _added, std::vector<BroadPhasePair>& _removed)
+		{
+			_added.clear();
+			_removed.clear();
+			_removed.swap(destroyed_pairs_);
+
+			// vLV̎W߂
+			candidates_.clear();
+			for (const ProxyId proxy : move_buffer_) {
+				if (proxy == NULL_PROXY) { continue; }
+				const Node& query = nodes_[proxy];
+				Query(query.aabb, [&](ProxyId _other) {
+					if (_other == proxy) { return true; }
+					// Ăꍇ͏ID̑炾
+					if (nodes_[_other].moved && _other < proxy) { return true; }
+
+					const ProxyId a = (std::min)(proxy, _other);
+					const ProxyId b = (std::max)(proxy, _other);
+					candidates_.push_back(BroadPhasePair{ a, b, nodes_[a].userData, nodes_[b].userData });
+					return true;
+					});
+			}
+			std::sort(candidates_.begin(), candidates_.end());
+
+			// ÕyAuǂĂȂvƁû܂ށvɕ
+			kept_.clear();
+			stale_.clear();
+			for (const auto& pair : pairs_) {
+				if (nodes_[pair.proxyA].moved || nodes_[pair.proxyB].moved) {
+					stale_.push_back(pair);
+				}
+				else {
+					kept_.push_back(pair);
+				}
+			}
+
+			DiffPairs(stale_, candidates_, _added, _removed);
+
+			pairs_.clear();
+			std::merge(kept_.begin(), kept_.end(), candidates_.begin(), candidates_.end(), std::back_inserter(pairs_));
+
+			for (const ProxyId proxy : move_buffer_) {
+				if (proxy != NULL_PROXY) { nodes_[proxy].moved = false; }
+			}
+			move_buffer_.clear();
+		}
+
+		/**
+		 * @brief eq֌W /  / AABB̐̊mF
+		 * @return true: Ȃ
+		 */
+		bool DynamicAABBTree::Validate() const
+		{
+			if (root_ == NULL_PROXY) { return proxy_count_ == 0; }
+			if (nodes_[root_].parent != NULL_PROXY) { return false; }
+
+			std::size_t leaves = 0;
+			std::vector<int32_t> stack{ root_ };
+			while (!stack.empty()) {
+				const int32_t index = stack.back();
+				stack.pop_back();
+				const Node& node = nodes_[index];
+
+				if (node.IsLeaf()) {
+					if (node.height != 0 || !node.aabb.Contains(node.tight)) { return false; }
+					++leaves;
+					continue;
+				}
+
+				const Node& c1 = nodes_[node.child1];
+				const Node& c2 = nodes_[node.child2];
+				if (c1.parent != index || c2.parent != index) { return false; }
+				if (node.height != 1 + (std::max)(c1.height, c2.height)) { return false; }
+				if (!node.aabb.Contains(c1.aabb) || !node.aabb.Contains(c2.aabb)) { return false; }
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+			return leaves == proxy_count_;
+		}
+
+		/**
+		 * @brief m[h̊m
+		 *	󂫃XgΔzL΂
+		 * @return m[hIndex
+		 */
+		int32_t DynamicAABBTree::AllocateNode()
+		{
+			if (free_list_ == NULL_PROXY) {
+				const int32_t index = static_cast<int32_t>(nodes_.size());
+				nodes_.emplace_back();
+				return index;
+			}
+
+			const int32_t index = free_list_;
+			free_list_ = nodes_[index].next;
+			nodes_[index] = Node{};
+			return index;
+		}
+
+		//! @brief m[h󂫃Xgɖ߂
+		void DynamicAABBTree::FreeNode(int32_t _node)
+		{
+			Node& node = nodes_[_node];
+			node.next = free_list_;
+			node.height = -1;
+			node.moved = false;
+			free_list_ = _node;
+		}
+
+		/**
+		 * @brief t̑}
+		 *	Zɂ̕\ʐς̑ԏꏊォT
+		 * @param _leaf }t
+		 */
+		void DynamicAABBTree::InsertLeaf(int32_t _leaf)
+		{
+			if (root_ == NULL_PROXY) {
+				root_ = _leaf;
+				nodes_[_leaf].parent = NULL_PROXY;
+				return;
+			}
+
+			const AABB leafAABB = nodes_[_leaf].aabb;
+			int32_t index = root_;
+			while (!nodes_[index].IsLeaf()) {
+				const Node& node = nodes_[index];
+				const float area = node.aabb.SurfaceArea();
+				const float combinedArea = AABB::Union(node.aabb, leafAABB).SurfaceArea();
+
+				// ŌZɂRXgƁAɍ~낵ɑ镪
+				const float cost = 2.0f * combinedArea;
+				const float inheritanceCost = 2.0f * (combinedArea - area);
+
+				const auto childCost = [&](int32_t _child) {
+					const Node& child = nodes_[_child];
+					const float unionArea = AABB::Union(child.aabb, leafAABB).SurfaceArea();
+					return (child.IsLeaf() ? unionArea : unionArea - child.aabb.SurfaceArea()) + inheritanceCost;
+					};
+				const float cost1 = childCost(node.child1);
+				const float cost2 = childCost(node.child2);
+
+				if (cost < cost1 && cost < cost2) { break; }
+				index = (cost1 < cost2) ? node.child1 : node.child2;
+			}
+
+			const int32_t sibling = index;
+			const int32_t oldParent = nodes_[sibling].parent;
+			const int32_t newParent = AllocateNode();	// nodes_Lт邱Ƃ̂ŁAQƂ͌Ŏ
+
+			Node& parent = nodes_[newParent];
+			parent.parent = oldParent;
+			parent.aabb = AABB::Union(leafAABB, nodes_[sibling].aabb);
+			parent.height = nodes_[sibling].height + 1;
+			parent.child1 = sibling;
+			parent.child2 = _leaf;
+			nodes_[sibling].parent = newParent;
+			nodes_[_leaf].parent = newParent;
+
+			if (oldParent == NULL_PROXY) {
+				root_ = newParent;
+			}
+			else if (nodes_[oldParent].child1 == sibling) {
+				nodes_[oldParent].child1 = newParent;
+			}
+			else {
+				nodes_[oldParent].child2 = newParent;
+			}
+
+			Refit(nodes_[_leaf].parent);
+		}
+
+		/**
+		 * @brief t̎O
+		 *	eČZcɕtւ
+		 * @param _leaf Ot
+		 */
+		void DynamicAABBTree::RemoveLeaf(int32_t _leaf)
+		{
+			if (_leaf == root_) {
+				root_ = NULL_PROXY;
+				return;
+			}
+
+			const int32_t parent = nodes_[_leaf].parent;
+			const int32_t grandParent = nodes_[parent].parent;
+			const int32_t sibling = (nodes_[parent].child1 == _leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+
+			if (grandParent == NULL_PROXY) {
+				root_ = sibling;
+				nodes_[sibling].parent = NULL_PROXY;
+				FreeNode(parent);
+				return;
+			}
+
+			if (nodes_[grandParent].child1 == parent) {
+				nodes_[grandParent].child1 = sibling;
+			}
+			else {
+				nodes_[grandParent].child2 = sibling;
+			}
+			nodes_[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+
+		/**
+		 * @brief eɌAABBƍ𒼂
+		 * @param _node Jnm[h
+		 */
+		void DynamicAABBTree::Refit(int32_t _node)
+		{
+			int32_t index = _node;
+			while (index != NULL_PROXY) {
+				index = Balance(index);
+
+				Node& node = nodes_[index];
+				const Node& c1 = nodes_[node.child1];
+				const Node& c2 = nodes_[node.child2];
+				node.height = 1 + (std::max)(c1.height, c2.height);
+				node.aabb = AABB::Union(c1.aabb, c2.aabb);
+
+				index = node.parent;
+			}
+		}
+
+		/**
+		 * @brief ]č𑵂
+		 *	E̍2ȏႦ΁A̎qグ
+		 * @param _node Ώۂ̃m[h(A)
+		 * @return ]ɂ̈ʒuɗm[h
+		 */
+		int32_t DynamicAABBTree::Balance(int32_t _node)
+		{
+			const int32_t iA = _node;
+			Node& A = nodes_[iA];
+			if (A.IsLeaf() || A.height < 2) { return iA; }
+
+			const int32_t iB = A.child1;
+			const int32_t iC = A.child2;
+			Node& B = nodes_[iB];
+			Node& C = nodes_[iC];
+			const int32_t balance = C.height - B.height;
+
+			// e̎qAtւ
+			const auto replaceInParent = [&](int32_t _newChild) {
+				const int32_t parent = nodes_[_newChild].parent;
+				if (parent == NULL_PROXY) {
+					root_ = _newChild;
+				}
+				else if (nodes_[parent].child1 == iA) {
+					nodes_[parent].child1 = _newChild;
+				}
+				else {
+					nodes_[parent].child2 = _newChild;
+				}
+				};
+
+			// Cグ
+			if (balance > 1) {
+				const int32_t iF = C.child1;
+				const int32_t iG = C.child2;
+				Node& F = nodes_[iF];
+				Node& G = nodes_[iG];
+
+				C.child1 = iA;
+				C.parent = A.parent;
+				A.parent = iC;
+				replaceInParent(iC);
+
+				if (F.height > G.height) {
+					C.child2 = iF;
+					A.child2 = iG;
+					G.parent = iA;
+					A.aabb = AABB::Union(B.aabb, G.aabb);
+					C.aabb = AABB::Union(A.aabb, F.aabb);
+					A.height = 1 + (std::max)(B.height, G.height);
+					C.height = 1 + (std::max)(A.height, F.height);
+				}
+				else {
+					C.child2 = iG;
+					A.child2 = iF;
+					F.parent = iA;
+					A.aabb = AABB::Union(B.aabb, F.aabb);
+					C.aabb = AABB::Union(A.aabb, G.aabb);
+					A.height = 1 + (std::max)(B.height, F.height);
+					C.height = 1 + (std::max)(A.height, G.height);
+				}
+				return iC;
+			}
+
+			// Bグ
+			if (balance < -1) {
+				const int32_t iD = B.child1;
+				const int32_t iE = B.child2;
+				Node& D = nodes_[iD];
+				Node& E = nodes_[iE];
+
+				B.child1 = iA;
+				B.parent = A.parent;
+				A.parent = iB;
+				replaceInParent(iB);
+
+				if (D.height > E.height) {
+					B.child2 = iD;
+					A.child1 = iE;
+					E.parent = iA;
+					A.aabb = AABB::Union(C.aabb, E.aabb);
+					B.aabb = AABB::Union(A.aabb, D.aabb);
+					A.height = 1 + (std::max)(C.height, E.height);
+					B.height = 1 + (std::max)(A.height, D.height);
+				}
+				else {
+					B.child2 = iE;
+					A.child1 = iD;
+					D.parent = iA;
+					A.aabb = AABB::Union(C.aabb, D.aabb);
+					B.aabb = AABB::Union(A.aabb, E.aabb);
+					A.height = 1 + (std::max)(C.height, D.height);
+					B.height = 1 + (std::max)(A.height, E.height);
+				}
+				return iB;
+			}
+
+			return iA;
+		}
+
+		/**
+		 * @brief fat AABB̍쐬
+		 * @param _aabb `AABB
+		 * @param _displacement ړ(nullptrȂ])
+		 * @return fat AABB
+		 */
+		AABB DynamicAABBTree::MakeFatAABB(const AABB& _aabb, const float* _displacement) const
+		{
+			AABB fat = _aabb;
+			for (int i = 0; i < 3; ++i) {
+				fat.min[i] -= margin_;
+				fat.max[i] += margin_;
+				if (!_displacement) { continue; }
+
+				// Ăɐ肵ĐL΂Ă
+				const float d = _displacement[i] * displacement_scale_;
+				if (d < 0.0f) { fat.min[i] += d; }
+				else { fat.max[i] += d; }
+			}
+			return fat;
+		}
+
+		//! @brief UpdatePairsŖ₢킹
+		void DynamicAABBTree::MarkMoved(int32_t _leaf)
+		{
+			if (nodes_[_leaf].moved) { return; }
+			nodes_[_leaf].moved = true;
+			move_buffer_.push_back(_leaf);
+		}
+	}
+}
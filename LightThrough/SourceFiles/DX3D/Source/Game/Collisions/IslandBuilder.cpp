@@ -0,0 +1,99 @@
+/**
+ * @file IslandBuilder.cpp
+ * @brief ڐGłȂ̂̂܂Ƃ܂()̍\z
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <numeric>
+#include <utility>
+#include <Game/Collisions/IslandBuilder.h>
+
+namespace dx3d {
+	namespace collision {
+		//! @brief ̂̓ɂ
+		void IslandBuilder::Reset(uint32_t _bodyCount)
+		{
+			parent_.resize(_bodyCount);
+			std::iota(parent_.begin(), parent_.end(), 0u);
+			rank_.assign(_bodyCount, 0);
+			island_of_.clear();
+			island_start_.clear();
+			island_bodies_.clear();
+		}
+
+		/**
+		 * @brief ̂Ă铇̑\
+		 *	ǂoH͔k߂(path halving)
+		 */
+		uint32_t IslandBuilder::Find(uint32_t _body)
+		{
+			while (parent_[_body] != _body) {
+				parent_[_body] = parent_[parent_[_body]];
+				_body = parent_[_body];
+			}
+			return _body;
+		}
+
+		//! @brief ̂̕𓯂ɂ(Ⴂ؂؂̉ɂȂ)
+		void IslandBuilder::Union(uint32_t _a, uint32_t _b)
+		{
+			uint32_t ra = Find(_a);
+			uint32_t rb = Find(_b);
+			if (ra == rb) { return; }
+			if (rank_[ra] < rank_[rb]) { std::swap(ra, rb); }
+			parent_[rb] = ra;
+			if (rank_[ra] == rank_[rb]) { ++rank_[ra]; }
+		}
+
+		/**
+		 * @brief Ƃɕׂ̂
+		 *	̔ԍ́A̒ňԏ̂̔ԍ̏ɐU(v\[g)
+		 */
+		void IslandBuilder::Build()
+		{
+			const uint32_t count = GetBodyCount();
+			constexpr uint32_t NONE = UINT32_MAX;
+
+			// \Ƃɓ̔ԍU
+			std::vector<uint32_t>& rootIsland = rank_;	// rank͂gȂ̂ōƗpɎ؂
+			rootIsland.assign(count, NONE);
+			island_of_.resize(count);
+			island_start_.clear();
+			for (uint32_t i = 0; i < count; ++i) {
+				const uint32_t root = Find(i);
+				if (rootIsland[root] == NONE) {
+					rootIsland[root] = static_cast<uint32_t>(island_start_.size());
+					island_start_.push_back(0);
+				}
+				island_of_[i] = rootIsland[root];
+				++island_start_[island_of_[i]];
+			}
+
+			//   擪̈ʒu
+			uint32_t offset = 0;
+			for (auto& start : island_start_) {
+				const uint32_t n = start;
+				start = offset;
+				offset += n;
+			}
+			island_start_.push_back(offset);
+
+			island_bodies_.resize(count);
+			std::vector<uint32_t>& cursor = rootIsland;
+			cursor.assign(island_start_.begin(), island_start_.end() - 1);
+			for (uint32_t i = 0; i < count; ++i) {
+				island_bodies_[cursor[island_of_[i]]++] = i;
+			}
+		}
+
+		//! @brief ɑ镨̂̔ԍ
+		std::span<const uint32_t> IslandBuilder::GetIsland(uint32_t _island) const
+		{
+			const uint32_t begin = island_start_[_island];
+			const uint32_t end = island_start_[_island + 1];
+			return std::span<const uint32_t>(island_bodies_.data() + begin, end - begin);
+		}
+	}
+}
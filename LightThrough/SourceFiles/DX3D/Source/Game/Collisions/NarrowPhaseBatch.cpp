@@ -0,0 +1,338 @@
+/**
+ * @file NarrowPhaseBatch.cpp
+ * @brief `̑gݍ킹Ƃɂ܂Ƃ߂Ĕ肷i[tF[Y
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Collisions/NarrowPhaseBatch.h>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+#if defined(__AVX__)
+#define DX3D_NARROWPHASE_AVX 1
+#include <immintrin.h>
+#elif defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define DX3D_NARROWPHASE_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace dx3d {
+	namespace collision {
+		namespace {
+			// memo: ̖{̂̓[̌^ŏɃev[gɂĂB
+			//       1[łCollisionUtils.h̊֐ƓԂŌvẐŁASIMDłʂɂȂ
+
+			//! @brief 1[(SIMD)
+			struct ScalarLanes {
+				using V = float;
+				using M = bool;
+				static constexpr uint32_t WIDTH = 1;
+				static V Load(const float* _p) { return *_p; }
+				static void Store(float* _p, V _v) { *_p = _v; }
+				static V Set(float _s) { return _s; }
+				static V Add(V _a, V _b) { return _a + _b; }
+				static V Sub(V _a, V _b) { return _a - _b; }
+				static V Mul(V _a, V _b) { return _a * _b; }
+				static V Div(V _a, V _b) { return _a / _b; }
+				static V Abs(V _a) { return std::fabs(_a); }
+				static V Sqrt(V _a) { return std::sqrt(_a); }
+				static M Lt(V _a, V _b) { return _a < _b; }
+				static M And(M _a, M _b) { return _a && _b; }
+				static M AndNot(M _a, M _b) { return _a && !_b; }
+				static M True() { return true; }
+				static V Select(M _m, V _a, V _b) { return _m ? _a : _b; }
+			};
+
+#if DX3D_NARROWPHASE_SSE
+			//! @brief 4[(SSE2)
+			struct SimdLanes {
+				using V = __m128;
+				using M = __m128;
+				static constexpr uint32_t WIDTH = 4;
+				static V Load(const float* _p) { return _mm_loadu_ps(_p); }
+				static void Store(float* _p, V _v) { _mm_storeu_ps(_p, _v); }
+				static V Set(float _s) { return _mm_set1_ps(_s); }
+				static V Add(V _a, V _b) { return _mm_add_ps(_a, _b); }
+				static V Sub(V _a, V _b) { return _mm_sub_ps(_a, _b); }
+				static V Mul(V _a, V _b) { return _mm_mul_ps(_a, _b); }
+				static V Div(V _a, V _b) { return _mm_div_ps(_a, _b); }
+				static V Abs(V _a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), _a); }
+				static V Sqrt(V _a) { return _mm_sqrt_ps(_a); }
+				static M Lt(V _a, V _b) { return _mm_cmplt_ps(_a, _b); }
+				static M And(M _a, M _b) { return _mm_and_ps(_a, _b); }
+				static M AndNot(M _a, M _b) { return _mm_andnot_ps(_b, _a); }
+				static M True() { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+				static V Select(M _m, V _a, V _b) { return _mm_or_ps(_mm_and_ps(_m, _a), _mm_andnot_ps(_m, _b)); }
+			};
+#elif DX3D_NARROWPHASE_AVX
+			//! @brief 8[(AVX)
+			struct SimdLanes {
+				using V = __m256;
+				using M = __m256;
+				static constexpr uint32_t WIDTH = 8;
+				static V Load(const float* _p) { return _mm256_loadu_ps(_p); }
+				static void Store(float* _p, V _v) { _mm256_storeu_ps(_p, _v); }
+				static V Set(float _s) { return _mm256_set1_ps(_s); }
+				static V Add(V _a, V _b) { return _mm256_add_ps(_a, _b); }
+				static V Sub(V _a, V _b) { return _mm256_sub_ps(_a, _b); }
+				static V Mul(V _a, V _b) { return _mm256_mul_ps(_a, _b); }
+				static V Div(V _a, V _b) { return _mm256_div_ps(_a, _b); }
+				static V Abs(V _a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _a); }	// AVX(1)ɂ256bit̐߂̂ŕō
+				static V Sqrt(V _a) { return _mm256_sqrt_ps(_a); }
+				static M Lt(V _a, V _b) { return _mm256_cmp_ps(_a, _b, _CMP_LT_OQ); }
+				static M And(M _a, M _b) { return _mm256_and_ps(_a, _b); }
+				static M AndNot(M _a, M _b) { return _mm256_andnot_ps(_b, _a); }
+				static M True() { return _mm256_cmp_ps(_mm256_setzero_ps(), _mm256_setzero_ps(), _CMP_EQ_OQ); }
+				static V Select(M _m, V _a, V _b) { return _mm256_or_ps(_mm256_and_ps(_m, _a), _mm256_andnot_ps(_m, _b)); }
+			};
+#else
+			using SimdLanes = ScalarLanes;
+#endif
+
+			// o͂̕([ƂɏoĂ猋ʂɎU炷)
+			enum OutField : uint32_t {
+				OUT_HIT,
+				OUT_NORMAL_X, OUT_NORMAL_Y, OUT_NORMAL_Z,
+				OUT_PENETRATION,
+				OUT_POINT_X, OUT_POINT_Y, OUT_POINT_Z,
+				OUT_FEATURE,
+				OUT_COUNT,
+			};
+
+			template <class L>
+			struct LaneBox {
+				typename L::V c[3], ax[3][3], h[3];
+			};
+
+			template <class L>
+			LaneBox<L> LoadBox(const std::vector<float>* _fields, size_t _i)
+			{
+				LaneBox<L> b;
+				for (int k = 0; k < 3; ++k) {
+					b.c[k] = L::Load(&_fields[k][_i]);
+					b.h[k] = L::Load(&_fields[12 + k][_i]);
+					for (int j = 0; j < 3; ++j) { b.ax[j][k] = L::Load(&_fields[3 + j * 3 + k][_i]); }
+				}
+				return b;
+			}
+
+			//! @brief math::DotƓ
+			template <class L>
+			typename L::V Dot(const typename L::V* _a, const typename L::V* _b)
+			{
+				return L::Add(L::Add(L::Mul(_a[0], _b[0]), L::Mul(_a[1], _b[1])), L::Mul(_a[2], _b[2]));
+			}
+
+			//! @brief ProjectRadiusƓ
+			template <class L>
+			typename L::V ProjectRadius(const LaneBox<L>& _b, const typename L::V* _axis)
+			{
+				return L::Add(L::Add(
+					L::Mul(L::Abs(Dot<L>(_b.ax[0], _axis)), _b.h[0]),
+					L::Mul(L::Abs(Dot<L>(_b.ax[1], _axis)), _b.h[1])),
+					L::Mul(L::Abs(Dot<L>(_b.ax[2], _axis)), _b.h[2]));
+			}
+
+			//! @brief std::clampƓIѕ(v < lo Ȃ loAhi < v Ȃ hi)
+			template <class L>
+			typename L::V Clamp(typename L::V _v, typename L::V _lo, typename L::V _hi)
+			{
+				const typename L::V r = L::Select(L::Lt(_hi, _v), _hi, _v);
+				return L::Select(L::Lt(_v, _lo), _lo, r);
+			}
+
+			//! @brief OBBœ_Ɉԋ߂_
+			template <class L>
+			void ClosestOnBox(const LaneBox<L>& _b, const typename L::V* _d, typename L::V* _out)
+			{
+				const typename L::V minusOne = L::Set(-1.0f);
+				typename L::V l[3];
+				for (int j = 0; j < 3; ++j) {
+					l[j] = Clamp<L>(Dot<L>(_d, _b.ax[j]), L::Mul(_b.h[j], minusOne), _b.h[j]);
+				}
+				for (int k = 0; k < 3; ++k) {
+					_out[k] = L::Add(L::Add(L::Add(_b.c[k], L::Mul(_b.ax[0][k], l[0])), L::Mul(_b.ax[1][k], l[1])), L::Mul(_b.ax[2][k], l[2]));
+				}
+			}
+
+			/**
+			 * @brief -(IntersectOBBƓ)
+			 *	_őł؂ɁA[ƂɁuĂ邩včŌ܂ŉ
+			 */
+			template <class L>
+			void BoxBoxKernel(const std::vector<float>* _fields, size_t _i, float (*_out)[L::WIDTH])
+			{
+				using V = typename L::V;
+				using M = typename L::M;
+				constexpr float EPS = 1e-6f;
+				const LaneBox<L> a = LoadBox<L>(_fields, _i);
+				const LaneBox<L> b = LoadBox<L>(_fields + 15, _i);
+				const V eps = L::Set(EPS);
+				const V zero = L::Set(0.0f);
+				const V minusOne = L::Set(-1.0f);
+
+				V T[3];
+				for (int k = 0; k < 3; ++k) { T[k] = L::Sub(b.c[k], a.c[k]); }
+
+				// : A3, B3, ӓm9{(Oςׂꂽ̂͂̃[΂)
+				V axes[15][3];
+				M valid[15];
+				for (int i = 0; i < 3; ++i) {
+					for (int k = 0; k < 3; ++k) {
+						axes[i][k] = a.ax[i][k];
+						axes[3 + i][k] = b.ax[i][k];
+					}
+					valid[i] = valid[3 + i] = L::True();
+				}
+				for (int i = 0; i < 3; ++i) {
+					for (int j = 0; j < 3; ++j) {
+						const V* u = a.ax[i];
+						const V* v = b.ax[j];
+						const V cr[3] = {
+							L::Sub(L::Mul(u[1], v[2]), L::Mul(u[2], v[1])),
+							L::Sub(L::Mul(u[2], v[0]), L::Mul(u[0], v[2])),
+							L::Sub(L::Mul(u[0], v[1]), L::Mul(u[1], v[0])),
+						};
+						const V len2 = Dot<L>(cr, cr);
+						const V inv = L::Div(L::Set(1.0f), L::Sqrt(len2));
+						const int n = 6 + i * 3 + j;
+						valid[n] = L::Lt(eps, len2);
+						for (int k = 0; k < 3; ++k) { axes[n][k] = L::Mul(cr[k], inv); }
+					}
+				}
+
+				M alive = L::True();
+				V minPenetration = L::Set(FLT_MAX);
+				V bestAxis[3] = { zero, zero, zero };
+				V bestFeature = zero;
+				for (int n = 0; n < 15; ++n) {
+					const V* axis = axes[n];
+					const V absSum = L::Add(L::Add(L::Abs(axis[0]), L::Abs(axis[1])), L::Abs(axis[2]));
+					const M use = L::AndNot(valid[n], L::Lt(absSum, eps));
+
+					const V rA = ProjectRadius<L>(a, axis);
+					const V rB = ProjectRadius<L>(b, axis);
+					const V dist = L::Abs(Dot<L>(T, axis));
+					const V overlap = L::Sub(L::Add(rA, rB), dist);
+					alive = L::AndNot(alive, L::And(use, L::Lt(overlap, zero)));
+
+					// Ԑ󂢎(AB)
+					const M update = L::And(use, L::Lt(overlap, minPenetration));
+					const M flip = L::Lt(Dot<L>(axis, T), zero);
+					minPenetration = L::Select(update, overlap, minPenetration);
+					for (int k = 0; k < 3; ++k) {
+						bestAxis[k] = L::Select(update, L::Select(flip, L::Mul(axis[k], minusOne), axis[k]), bestAxis[k]);
+					}
+					const V feature = L::Select(flip, L::Set(n * 2.0f + 1.0f), L::Set(n * 2.0f));
+					bestFeature = L::Select(update, feature, bestFeature);
+				}
+
+				// ŋߐړ_̒_
+				V dA[3], dB[3], onA[3], onB[3];
+				for (int k = 0; k < 3; ++k) {
+					dA[k] = L::Sub(b.c[k], a.c[k]);
+					dB[k] = L::Sub(a.c[k], b.c[k]);
+				}
+				ClosestOnBox<L>(a, dA, onA);
+				ClosestOnBox<L>(b, dB, onB);
+
+				L::Store(_out[OUT_HIT], L::Select(alive, L::Set(1.0f), zero));
+				L::Store(_out[OUT_PENETRATION], minPenetration);
+				L::Store(_out[OUT_FEATURE], bestFeature);
+				for (int k = 0; k < 3; ++k) {
+					L::Store(_out[OUT_NORMAL_X + k], bestAxis[k]);
+					L::Store(_out[OUT_POINT_X + k], L::Mul(L::Add(onA[k], onB[k]), L::Set(0.5f)));
+				}
+			}
+
+			//! @brief SoA̕(S3 + 9 + ̑傫3)
+			void WriteBox(const ContactBox& _box, float* _out)
+			{
+				std::copy(_box.center, _box.center + 3, _out);
+				for (int j = 0; j < 3; ++j) { std::copy(_box.axis[j], _box.axis[j] + 3, _out + 3 + j * 3); }
+				std::copy(_box.half, _box.half + 3, _out + 12);
+			}
+
+		}
+
+		//! @brief ςݒ̊Jn
+		void NarrowPhaseBatch::Begin()
+		{
+			box_box_.indices.clear();
+			box_box_.count = 0;
+			box_box_.fieldCount = BOX_FIELDS * 2;
+			results_.clear();
+		}
+
+		uint32_t NarrowPhaseBatch::AddBoxBox(const ContactBox& _a, const ContactBox& _b)
+		{
+			float values[BOX_FIELDS * 2];
+			WriteBox(_a, values);
+			WriteBox(_b, values + BOX_FIELDS);
+			Push(box_box_, values);
+			return box_box_.indices.back();
+		}
+
+		void NarrowPhaseBatch::Push(Group& _group, const float* _values)
+		{
+			// ȂȂ܂Ƃ߂čL(tB[hƂpush_back葬)
+			if (_group.count + SimdLanes::WIDTH > _group.fields[0].size()) {
+				const size_t size = (std::max)(_group.fields[0].size() * 2, static_cast<size_t>(64));
+				for (uint32_t f = 0; f < _group.fieldCount; ++f) { _group.fields[f].resize(size); }
+			}
+			for (uint32_t f = 0; f < _group.fieldCount; ++f) { _group.fields[f][_group.count] = _values[f]; }
+			++_group.count;
+			_group.indices.push_back(static_cast<uint32_t>(results_.size()));
+			results_.emplace_back();
+		}
+
+		//! @brief [̔̕{܂ōŌ̃yAŖ߂(ʂ͎̂Ă)
+		void NarrowPhaseBatch::Pad(Group& _group)
+		{
+			const size_t padded = (_group.count + SimdLanes::WIDTH - 1) / SimdLanes::WIDTH * SimdLanes::WIDTH;
+			for (uint32_t f = 0; f < _group.fieldCount; ++f) {
+				auto& field = _group.fields[f];
+				std::fill(field.begin() + _group.count, field.begin() + padded, field[_group.count - 1]);
+			}
+		}
+
+		/**
+		 * @brief ς񂾃yA܂Ƃ߂Ĕ肷
+		 */
+		void NarrowPhaseBatch::Run()
+		{
+			using L = SimdLanes;
+			auto run = [this](Group& _group, void (*_kernel)(const std::vector<float>*, size_t, float(*)[L::WIDTH])) {
+				const size_t count = _group.count;
+				if (count == 0) { return; }
+				Pad(_group);
+
+				float out[OUT_COUNT][L::WIDTH];
+				for (size_t i = 0; i < count; i += L::WIDTH) {
+					_kernel(_group.fields, i, out);
+					const size_t lanes = (std::min)(static_cast<size_t>(L::WIDTH), count - i);
+					for (size_t l = 0; l < lanes; ++l) {
+						NarrowPhaseResult& r = results_[_group.indices[i + l]];
+						r.hit = out[OUT_HIT][l] != 0.0f;
+						r.penetration = out[OUT_PENETRATION][l];
+						r.feature = static_cast<uint32_t>(out[OUT_FEATURE][l]);
+						for (int k = 0; k < 3; ++k) {
+							r.normal[k] = out[OUT_NORMAL_X + k][l];
+							r.contactPoint[k] = out[OUT_POINT_X + k][l];
+						}
+					}
+				}
+			};
+			run(box_box_, &BoxBoxKernel<L>);
+		}
+
+		//! @brief xɔ肷yA̐
+		uint32_t NarrowPhaseBatch::GetLaneWidth()
+		{
+			return SimdLanes::WIDTH;
+		}
+	}
+}
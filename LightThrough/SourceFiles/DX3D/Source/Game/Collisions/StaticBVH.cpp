@@ -0,0 +1,237 @@
+/**
+ * @file StaticBVH.cpp
+ * @brief ÓIȃRC_[p̍uBVH
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cfloat>
+#include <algorithm>
+#include <utility>
+#include <Game/Collisions/StaticBVH.h>
+
+namespace dx3d {
+	namespace collision {
+		namespace {
+			constexpr float TRAVERSAL_COST = 1.0f;	// m[hHRXg(Ƃ̔1Ƃ)
+
+			//! @brief AABB(UnionĂɂȂ)
+			AABB EmptyAABB()
+			{
+				AABB aabb;
+				for (int k = 0; k < 3; ++k) {
+					aabb.min[k] = FLT_MAX;
+					aabb.max[k] = -FLT_MAX;
+				}
+				return aabb;
+			}
+
+			void Grow(AABB& _aabb, const float* _point)
+			{
+				for (int k = 0; k < 3; ++k) {
+					_aabb.min[k] = (std::min)(_aabb.min[k], _point[k]);
+					_aabb.max[k] = (std::max)(_aabb.max[k], _point[k]);
+				}
+			}
+
+			void Grow(AABB& _aabb, const AABB& _other)
+			{
+				for (int k = 0; k < 3; ++k) {
+					_aabb.min[k] = (std::min)(_aabb.min[k], _other.min[k]);
+					_aabb.max[k] = (std::max)(_aabb.max[k], _other.max[k]);
+				}
+			}
+
+			//! @brief r
+			struct Bin {
+				AABB bounds = EmptyAABB();
+				uint32_t count = 0;
+			};
+		}
+
+		/**
+		 * @brief 蒼
+		 *	珇ɁA͈͂SAHœɕĂ(ċAɍƗp̃X^bN)
+		 */
+		void StaticBVH::Build(const std::vector<StaticBVHItem>& _items)
+		{
+			Clear();
+			if (_items.empty()) { return; }
+
+			items_ = _items;
+			centers_.resize(items_.size() * 3);
+			for (size_t i = 0; i < items_.size(); ++i) {
+				for (int k = 0; k < 3; ++k) {
+					centers_[i * 3 + k] = (items_[i].aabb.min[k] + items_[i].aabb.max[k]) * 0.5f;
+				}
+			}
+
+			// tł 2n - 1 Ŏ܂
+			nodes_.reserve(items_.size() * 2);
+			nodes_.emplace_back();
+
+			std::vector<BuildTask> tasks;
+			tasks.push_back({ 0, 0, static_cast<uint32_t>(items_.size()), 0 });
+			while (!tasks.empty()) {
+				const BuildTask task = tasks.back();
+				tasks.pop_back();
+				depth_ = (std::max)(depth_, task.depth);
+
+				AABB bounds = items_[task.begin].aabb;
+				for (uint32_t i = task.begin + 1; i < task.end; ++i) {
+					Grow(bounds, items_[i].aabb);
+				}
+				nodes_[task.node].aabb = bounds;
+
+				const uint32_t count = task.end - task.begin;
+				if (count <= MAX_LEAF_ITEMS || task.depth >= MAX_DEPTH) {
+					nodes_[task.node].first = task.begin;
+					nodes_[task.node].count = count;
+					continue;
+				}
+
+				// ʒu߂āAdS菬OɏW߂
+				uint32_t axis = 0;
+				float position = 0.0f;
+				uint32_t mid = task.begin;
+				if (FindSplit(task.begin, task.end, axis, position)) {
+					uint32_t i = task.begin;
+					uint32_t j = task.end;
+					while (i < j) {
+						if (centers_[i * 3 + axis] < position) { ++i; continue; }
+						--j;
+						std::swap(items_[i], items_[j]);
+						for (int k = 0; k < 3; ++k) { std::swap(centers_[i * 3 + k], centers_[j * 3 + k]); }
+					}
+					mid = i;
+				}
+				// dSSdȂĂ(Ȃ)͔ɂ
+				if (mid == task.begin || mid == task.end) {
+					mid = task.begin + count / 2;
+				}
+
+				const uint32_t left = static_cast<uint32_t>(nodes_.size());
+				nodes_.emplace_back();
+				nodes_.emplace_back();
+				nodes_[task.node].first = left;
+				nodes_[task.node].count = 0;
+				tasks.push_back({ left, task.begin, mid, task.depth + 1 });
+				tasks.push_back({ left + 1, mid, task.end, task.depth + 1 });
+			}
+			centers_.clear();
+
+			// ؑŜ̃RXg(̕\ʐςŊҒl)
+			const float rootArea = (std::max)(nodes_[0].aabb.SurfaceArea(), FLT_MIN);
+			sah_cost_ = 0.0f;
+			for (const Node& node : nodes_) {
+				const float ratio = node.aabb.SurfaceArea() / rootArea;
+				sah_cost_ += node.IsLeaf() ? ratio * static_cast<float>(node.count) : ratio * TRAVERSAL_COST;
+			}
+		}
+
+		//! @brief ɂ
+		void StaticBVH::Clear()
+		{
+			nodes_.clear();
+			items_.clear();
+			centers_.clear();
+			depth_ = 0;
+			sah_cost_ = 0.0f;
+		}
+
+		/**
+		 * @brief SAHŕʒu߂
+		 *	OƂdS͈̔͂BIN_COUNT̃rɕAr̋ڂƂ
+		 *	(̕\ʐ * ̐ + E̕\ʐ * E̐) ԏI
+		 * @param _axis I񂾎
+		 * @param _position I񂾈ʒu(dS菬)
+		 * @return ʒu
+		 */
+		bool StaticBVH::FindSplit(uint32_t _begin, uint32_t _end, uint32_t& _axis, float& _position) const
+		{
+			AABB centerBounds = EmptyAABB();
+			for (uint32_t i = _begin; i < _end; ++i) {
+				Grow(centerBounds, &centers_[i * 3]);
+			}
+
+			// ÕrɈxɐU蕪
+			Bin bins[3][BIN_COUNT];
+			float lo[3]{};
+			float scale[3]{};
+			for (int axis = 0; axis < 3; ++axis) {
+				const float extent = centerBounds.max[axis] - centerBounds.min[axis];
+				lo[axis] = centerBounds.min[axis];
+				scale[axis] = (extent > 0.0f) ? static_cast<float>(BIN_COUNT) / extent : 0.0f;
+			}
+			for (uint32_t i = _begin; i < _end; ++i) {
+				for (int axis = 0; axis < 3; ++axis) {
+					const uint32_t b = (std::min)(static_cast<uint32_t>((centers_[i * 3 + axis] - lo[axis]) * scale[axis]), BIN_COUNT - 1);
+					Grow(bins[axis][b].bounds, items_[i].aabb);
+					++bins[axis][b].count;
+				}
+			}
+
+			float bestCost = FLT_MAX;
+			bool found = false;
+			for (uint32_t axis = 0; axis < 3; ++axis) {
+				if (scale[axis] <= 0.0f) { continue; }
+
+				// Eݐς\ʐςƐ
+				float rightArea[BIN_COUNT]{};
+				uint32_t rightCount[BIN_COUNT]{};
+				AABB acc = EmptyAABB();
+				uint32_t n = 0;
+				for (uint32_t b = BIN_COUNT - 1; b > 0; --b) {
+					Grow(acc, bins[axis][b].bounds);
+					n += bins[axis][b].count;
+					rightArea[b] = (n > 0) ? acc.SurfaceArea() : 0.0f;
+					rightCount[b] = n;
+				}
+
+				// ݐςȂA b (r b - 1  b ̊) ̃RXg
+				acc = EmptyAABB();
+				n = 0;
+				for (uint32_t b = 1; b < BIN_COUNT; ++b) {
+					Grow(acc, bins[axis][b - 1].bounds);
+					n += bins[axis][b - 1].count;
+					if (n == 0 || rightCount[b] == 0) { continue; }
+
+					const float cost = acc.SurfaceArea() * static_cast<float>(n) + rightArea[b] * static_cast<float>(rightCount[b]);
+					if (cost < bestCost) {
+						bestCost = cost;
+						_axis = axis;
+						_position = lo[axis] + static_cast<float>(b) / scale[axis];
+						found = true;
+					}
+				}
+			}
+			return found;
+		}
+
+		/**
+		 * @brief ̊mF
+		 *	qAABBeɎ܂Ă邩AS傤ǈ񂸂tɓĂ邩
+		 */
+		bool StaticBVH::Validate() const
+		{
+			if (nodes_.empty()) { return items_.empty(); }
+
+			std::vector<uint32_t> seen(items_.size(), 0);
+			for (const Node& node : nodes_) {
+				if (node.IsLeaf()) {
+					if (node.first + node.count > items_.size()) { return false; }
+					for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+						if (!node.aabb.Contains(items_[i].aabb)) { return false; }
+						++seen[i];
+					}
+				}
+				else {
+					if (node.first + 1 >= nodes_.size()) { return false; }
+					if (!node.aabb.Contains(nodes_[node.first].aabb) || !node.aabb.Contains(nodes_[node.first + 1].aabb)) { return false; }
+				}
+			}
+			return std::all_of(seen.begin(), seen.end(), [](uint32_t _n) { return _n == 1; });
+		}
+	}
+}
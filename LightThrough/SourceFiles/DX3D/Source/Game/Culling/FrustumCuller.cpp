@@ -0,0 +1,225 @@
+/**
+ * @file FrustumCuller.cpp
+ * @brief JO
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Culling/FrustumCuller.h>
+#include <cmath>
+#include <algorithm>
+#include <initializer_list>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define DX3D_CULLING_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace dx3d {
+	namespace culling {
+		namespace {
+			constexpr float UNBOUNDED = 1.0e30f;	// K鈵̑傫(ǂ̕ʂł-Ȃ)
+		}
+
+		/**
+		 * @brief ʂ̎o(Gribb / Hartmann)
+		 *	clip = v * M Ȃ̂ŁAi c_i Ƃ : c3 + c0, E: c3 - c0, : c3 + c1, : c3 - c1, : c2, : c3 - c2
+		 */
+		FrustumPlanes ExtractFrustumPlanes(const float* _viewProj)
+		{
+			auto col = [_viewProj](int _c, int _r) { return _viewProj[_r * 4 + _c]; };
+
+			FrustumPlanes result{};
+			for (int r = 0; r < 4; ++r) {
+				result.planes[0][r] = col(3, r) + col(0, r);
+				result.planes[1][r] = col(3, r) - col(0, r);
+				result.planes[2][r] = col(3, r) + col(1, r);
+				result.planes[3][r] = col(3, r) - col(1, r);
+				result.planes[4][r] = col(2, r);
+				result.planes[5][r] = col(3, r) - col(2, r);
+			}
+			for (auto& p : result.planes) {
+				const float len = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+				if (len > 0.0f) {
+					for (float& v : p) { v /= len; }
+				}
+			}
+			return result;
+		}
+
+		void FrustumCuller::Begin(size_t _reserve)
+		{
+			count_ = 0;
+			visible_count_ = 0;
+			for (auto* v : { &center_x_, &center_y_, &center_z_, &extent_x_, &extent_y_, &extent_z_, &radius_ }) {
+				v->clear();
+				v->reserve(_reserve + 3);
+			}
+			visible_.clear();
+			visible_.reserve(_reserve + 3);
+		}
+
+		/**
+		 * @brief `ς
+		 *	S͍sňڂAAABB|M|Ŕ̑傫ڂ(Arvo)B͈ԑ傫̊g嗦|
+		 */
+		uint32_t FrustumCuller::Add(const float* _center, const float* _extents, float _radius, const float* _world)
+		{
+			const float* m = _world;
+			const float cx = _center[0], cy = _center[1], cz = _center[2];
+			const float ex = _extents[0], ey = _extents[1], ez = _extents[2];
+
+			center_x_.push_back(cx * m[0] + cy * m[4] + cz * m[8] + m[12]);
+			center_y_.push_back(cx * m[1] + cy * m[5] + cz * m[9] + m[13]);
+			center_z_.push_back(cx * m[2] + cy * m[6] + cz * m[10] + m[14]);
+			extent_x_.push_back(ex * std::fabs(m[0]) + ey * std::fabs(m[4]) + ez * std::fabs(m[8]));
+			extent_y_.push_back(ex * std::fabs(m[1]) + ey * std::fabs(m[5]) + ez * std::fabs(m[9]));
+			extent_z_.push_back(ex * std::fabs(m[2]) + ey * std::fabs(m[6]) + ez * std::fabs(m[10]));
+
+			const float sx = m[0] * m[0] + m[1] * m[1] + m[2] * m[2];
+			const float sy = m[4] * m[4] + m[5] * m[5] + m[6] * m[6];
+			const float sz = m[8] * m[8] + m[9] * m[9] + m[10] * m[10];
+			radius_.push_back(_radius * std::sqrt((std::max)({ sx, sy, sz })));
+
+			visible_.push_back(1);
+			return count_++;
+		}
+
+		uint32_t FrustumCuller::AddUnbounded()
+		{
+			for (auto* v : { &center_x_, &center_y_, &center_z_ }) { v->push_back(0.0f); }
+			for (auto* v : { &extent_x_, &extent_y_, &extent_z_, &radius_ }) { v->push_back(UNBOUNDED); }
+			visible_.push_back(1);
+			return count_++;
+		}
+
+		/**
+		 * @brief ς񂾌`܂Ƃ߂Ĕ肷
+		 *	~͊OڋŔ肷(̋ / ʂ / _̂ǂꂩŊO)
+		 */
+		void FrustumCuller::Cull(const FrustumPlanes& _frustum, const ConeBounds* _cone)
+		{
+			visible_count_ = 0;
+			if (count_ == 0) { return; }
+
+			// 4̔{܂Ŗ߂(߂͌ȂɂĐȂ)
+			const uint32_t padded = (count_ + 3) & ~3u;
+			for (auto* v : { &center_x_, &center_y_, &center_z_, &extent_x_, &extent_y_, &extent_z_, &radius_ }) {
+				v->resize(padded, 0.0f);
+			}
+			visible_.resize(padded, 0);
+
+			if (simd_enabled_) {
+				CullSimd(_frustum, _cone, padded);
+			}
+			else {
+				CullScalar(_frustum, _cone, padded);
+			}
+			// ߂𗎂Ƃ
+			for (auto* v : { &center_x_, &center_y_, &center_z_, &extent_x_, &extent_y_, &extent_z_, &radius_ }) {
+				v->resize(count_);
+			}
+			visible_.resize(count_);
+
+			for (uint32_t i = 0; i < count_; ++i) { visible_count_ += visible_[i]; }
+		}
+
+		/**
+		 * @brief 1肷
+		 *	Z̏ԂCullSimdƓɂĂ(ʂv邽)
+		 */
+		void FrustumCuller::CullScalar(const FrustumPlanes& _frustum, const ConeBounds* _cone, uint32_t _end)
+		{
+			for (uint32_t i = 0; i < _end; ++i) {
+				bool outside = false;
+				for (const auto& pl : _frustum.planes) {
+					const float dist = (pl[0] * center_x_[i] + pl[1] * center_y_[i]) + (pl[2] * center_z_[i] + pl[3]);
+					const float rb = (std::fabs(pl[0]) * extent_x_[i] + std::fabs(pl[1]) * extent_y_[i]) + std::fabs(pl[2]) * extent_z_[i];
+					outside |= (dist + (std::min)(rb, radius_[i])) < 0.0f;
+				}
+				if (_cone) {
+					const float vx = center_x_[i] - _cone->apex[0];
+					const float vy = center_y_[i] - _cone->apex[1];
+					const float vz = center_z_[i] - _cone->apex[2];
+					const float lenSq = (vx * vx + vy * vy) + vz * vz;
+					const float along = (vx * _cone->direction[0] + vy * _cone->direction[1]) + vz * _cone->direction[2];
+					const float perp = std::sqrt((std::max)(lenSq - along * along, 0.0f));
+					const float sideDist = _cone->cosHalfAngle * perp - along * _cone->sinHalfAngle;
+					outside |= sideDist > radius_[i] || along > radius_[i] + _cone->range || along < 0.0f - radius_[i];
+				}
+				visible_[i] = outside ? 0 : 1;
+			}
+		}
+
+#if DX3D_CULLING_SSE
+		//! @brief 4SSEŔ肷
+		void FrustumCuller::CullSimd(const FrustumPlanes& _frustum, const ConeBounds* _cone, uint32_t _end)
+		{
+			// ʂ4ׂ`ŎĂ
+			struct PlaneLanes { __m128 a, b, c, d, absA, absB, absC; };
+			PlaneLanes planes[6];
+			const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+			for (int p = 0; p < 6; ++p) {
+				const float* pl = _frustum.planes[p];
+				planes[p].a = _mm_set1_ps(pl[0]);
+				planes[p].b = _mm_set1_ps(pl[1]);
+				planes[p].c = _mm_set1_ps(pl[2]);
+				planes[p].d = _mm_set1_ps(pl[3]);
+				planes[p].absA = _mm_and_ps(planes[p].a, signMask);
+				planes[p].absB = _mm_and_ps(planes[p].b, signMask);
+				planes[p].absC = _mm_and_ps(planes[p].c, signMask);
+			}
+			const ConeBounds cone = _cone ? *_cone : ConeBounds{};
+			const __m128 coneAx = _mm_set1_ps(cone.apex[0]), coneAy = _mm_set1_ps(cone.apex[1]), coneAz = _mm_set1_ps(cone.apex[2]);
+			const __m128 coneDx = _mm_set1_ps(cone.direction[0]), coneDy = _mm_set1_ps(cone.direction[1]), coneDz = _mm_set1_ps(cone.direction[2]);
+			const __m128 coneCos = _mm_set1_ps(cone.cosHalfAngle), coneSin = _mm_set1_ps(cone.sinHalfAngle);
+			const __m128 coneRange = _mm_set1_ps(cone.range);
+
+			for (uint32_t i = 0; i < _end; i += 4) {
+				const __m128 cx = _mm_loadu_ps(&center_x_[i]);
+				const __m128 cy = _mm_loadu_ps(&center_y_[i]);
+				const __m128 cz = _mm_loadu_ps(&center_z_[i]);
+				const __m128 ex = _mm_loadu_ps(&extent_x_[i]);
+				const __m128 ey = _mm_loadu_ps(&extent_y_[i]);
+				const __m128 ez = _mm_loadu_ps(&extent_z_[i]);
+				const __m128 rs = _mm_loadu_ps(&radius_[i]);
+
+				__m128 outside = _mm_setzero_ps();
+				for (const auto& pl : planes) {
+					const __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pl.a, cx), _mm_mul_ps(pl.b, cy)),
+						_mm_add_ps(_mm_mul_ps(pl.c, cz), pl.d));
+					const __m128 rb = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pl.absA, ex), _mm_mul_ps(pl.absB, ey)), _mm_mul_ps(pl.absC, ez));
+					const __m128 r = _mm_min_ps(rb, rs);
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, r), _mm_setzero_ps()));
+				}
+
+				if (_cone) {
+					// _璆Sւ̃xNgƐɕ
+					const __m128 vx = _mm_sub_ps(cx, coneAx);
+					const __m128 vy = _mm_sub_ps(cy, coneAy);
+					const __m128 vz = _mm_sub_ps(cz, coneAz);
+					const __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+					const __m128 along = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, coneDx), _mm_mul_ps(vy, coneDy)), _mm_mul_ps(vz, coneDz));
+					const __m128 perp = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lenSq, _mm_mul_ps(along, along)), _mm_setzero_ps()));
+					const __m128 sideDist = _mm_sub_ps(_mm_mul_ps(coneCos, perp), _mm_mul_ps(along, coneSin));
+					outside = _mm_or_ps(outside, _mm_cmpgt_ps(sideDist, rs));
+					outside = _mm_or_ps(outside, _mm_cmpgt_ps(along, _mm_add_ps(rs, coneRange)));
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(along, _mm_sub_ps(_mm_setzero_ps(), rs)));
+				}
+
+				const int mask = _mm_movemask_ps(outside);
+				for (uint32_t lane = 0; lane < 4; ++lane) {
+					visible_[i + lane] = ((mask >> lane) & 1) ? 0 : 1;
+				}
+			}
+		}
+#else
+		//! @brief SSErhł1
+		void FrustumCuller::CullSimd(const FrustumPlanes& _frustum, const ConeBounds* _cone, uint32_t _end)
+		{
+			CullScalar(_frustum, _cone, _end);
+		}
+#endif
+	}
+}
@@ -0,0 +1,282 @@
+/**
+ * @file LightClusterBuilder.cpp
+ * @brief NX^(tX^؂Ȕ)Ƃ̃Cg̊蓖
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/Culling/LightClusterBuilder.h>
+#include <DX3D/Core/JobSystem.h>
+#include <cmath>
+#include <algorithm>
+
+namespace dx3d {
+	namespace culling {
+		namespace {
+			// L(CPUGPUŋE̊ۂ߂Ă肱ڂȂ悤)
+			constexpr float DEPTH_PADDING = 1.0e-3f;	// sɑ΂銄
+			constexpr float NDC_PADDING = 1.0e-3f;		// ^C̋E(NDC)
+
+			//! @brief _sňڂ(sxNg, w = 1)
+			void TransformPoint(const float* _m, const float* _p, float* _out)
+			{
+				for (int c = 0; c < 3; ++c) {
+					_out[c] = _p[0] * _m[c] + _p[1] * _m[4 + c] + _p[2] * _m[8 + c] + _m[12 + c];
+				}
+			}
+
+			//! @brief sňڂĐK(w = 0)
+			void TransformDirection(const float* _m, const float* _d, float* _out)
+			{
+				for (int c = 0; c < 3; ++c) {
+					_out[c] = _d[0] * _m[c] + _d[1] * _m[4 + c] + _d[2] * _m[8 + c];
+				}
+				const float len = std::sqrt(_out[0] * _out[0] + _out[1] * _out[1] + _out[2] * _out[2]);
+				if (len > 0.0f) {
+					for (int c = 0; c < 3; ++c) { _out[c] /= len; }
+				}
+			}
+
+			//! @brief ^C͈̔(NDC)XCX̉s[_zn, _zf]ɍL̃r[Ԃł̕
+			void TileExtent(float _ndc0, float _ndc1, float _zn, float _zf, float _scale, float& _outMin, float& _outMax)
+			{
+				_outMin = (std::min)(_ndc0 * _zn, _ndc0 * _zf) / _scale;
+				_outMax = (std::max)(_ndc1 * _zn, _ndc1 * _zf) / _scale;
+			}
+		}
+
+		/**
+		 * @brief 蓖Ă̎s
+		 *
+		 * 1. Cgr[ԂɈڂAދ(Spot͐`ވԏ)Ɖ~߂
+		 * 2. XCXƂɁAsdȂ郉CgIŃ^C͈̔͂iANX^̔Ƌ / ~Ŕ肷(XCXƂɕ)
+		 * 3. XCXƂ̌ʂ̔zɋl߂
+		 */
+		void LightClusterBuilder::Build(const ClusterCamera& _camera, const std::vector<ClusterLight>& _lights, JobSystem* _jobSystem)
+		{
+			SetupGrid(_camera);
+
+			volumes_.clear();
+			globals_.clear();
+			for (uint32_t i = 0; i < _lights.size(); ++i) {
+				const auto& light = _lights[i];
+				if (light.shape == ClusterLightShape::Global) {
+					globals_.push_back(i);
+					continue;
+				}
+				if (!(light.range > 0.0f)) { continue; }	// ǂɂ͂Ȃ
+
+				LightVolume v{ .index = i, .range = light.range };
+				TransformPoint(camera_.view, light.position, v.apex);
+				for (int c = 0; c < 3; ++c) { v.center[c] = v.apex[c]; }
+				v.radius = light.range;
+
+				const float cosHalf = (std::min)(light.cosOuter, 1.0f);
+				if (light.shape == ClusterLightShape::Spot && cosHalf > 0.0f) {
+					TransformDirection(camera_.view, light.direction, v.direction);
+					v.cone = true;
+					v.cosHalf = cosHalf;
+					v.sinHalf = std::sqrt((std::max)(0.0f, 1.0f - cosHalf * cosHalf));
+					// `ދ: 45xȉ͒_Ɖʂ鋅ALΉ̉~ԓɂ鋅
+					const float offset = (cosHalf >= 0.70710678f) ? light.range / (2.0f * cosHalf) : light.range * cosHalf;
+					v.radius = (cosHalf >= 0.70710678f) ? offset : light.range * v.sinHalf;
+					for (int c = 0; c < 3; ++c) { v.center[c] = v.apex[c] + v.direction[c] * offset; }
+				}
+				volumes_.push_back(v);
+			}
+
+			// XCXƂɑg(ރNX^dȂȂ̂ŁÂ܂ܕɂł)
+			const uint32_t sliceCount = desc_.slicesZ;
+			slices_.resize(sliceCount);
+			ranges_.assign(static_cast<size_t>(GetClusterCount()) * 2, 0);
+			auto build = [this](uint32_t _begin, uint32_t _end) {
+				for (uint32_t s = _begin; s < _end; ++s) { BuildSlice(s); }
+				};
+			if (_jobSystem) { _jobSystem->ParallelFor(0, sliceCount, 1, build); }
+			else { build(0, sliceCount); }
+
+			// l߂
+			size_t total = 0;
+			for (auto& slice : slices_) { total += slice.indices.size(); }
+			indices_.resize(total);
+			max_per_cluster_ = 0;
+			const uint32_t clustersPerSlice = desc_.tilesX * desc_.tilesY;
+			uint32_t base = 0;
+			for (uint32_t s = 0; s < sliceCount; ++s) {
+				const auto& slice = slices_[s];
+				std::copy(slice.indices.begin(), slice.indices.end(), indices_.begin() + base);
+				for (uint32_t c = s * clustersPerSlice; c < (s + 1) * clustersPerSlice; ++c) {
+					ranges_[c * 2 + 0] += base;
+				}
+				base += static_cast<uint32_t>(slice.indices.size());
+				max_per_cluster_ = (std::max)(max_per_cluster_, slice.maxPerCluster);
+			}
+		}
+
+		uint32_t LightClusterBuilder::FindSlice(float _viewZ) const
+		{
+			if (!(_viewZ >= near_slice_)) { return 0; }
+			const float s = 1.0f + std::floor(std::log(_viewZ) * slice_scale_ + slice_bias_);
+			return (std::min)(static_cast<uint32_t>(s), desc_.slicesZ - 1);
+		}
+
+		uint32_t LightClusterBuilder::FindCluster(const float* _viewPos) const
+		{
+			const float z = (std::max)(_viewPos[2], camera_.nearZ);
+			const float ndcX = _viewPos[0] * camera_.projScaleX / z;
+			const float ndcY = _viewPos[1] * camera_.projScaleY / z;
+			const float fx = std::floor((ndcX * 0.5f + 0.5f) * static_cast<float>(desc_.tilesX));
+			const float fy = std::floor((0.5f - ndcY * 0.5f) * static_cast<float>(desc_.tilesY));
+			const uint32_t x = static_cast<uint32_t>(std::clamp(fx, 0.0f, static_cast<float>(desc_.tilesX - 1)));
+			const uint32_t y = static_cast<uint32_t>(std::clamp(fy, 0.0f, static_cast<float>(desc_.tilesY - 1)));
+			return (FindSlice(_viewPos[2]) * desc_.tilesY + y) * desc_.tilesX + x;
+		}
+
+		void LightClusterBuilder::GetClusterBounds(uint32_t _cluster, float* _outMin, float* _outMax) const
+		{
+			const uint32_t x = _cluster % desc_.tilesX;
+			const uint32_t y = (_cluster / desc_.tilesX) % desc_.tilesY;
+			const uint32_t s = _cluster / (desc_.tilesX * desc_.tilesY);
+			const float zn = slice_depths_[s];
+			const float zf = slice_depths_[s + 1];
+			TileExtent(tile_ndc_x_[x], tile_ndc_x_[x + 1], zn, zf, camera_.projScaleX, _outMin[0], _outMax[0]);
+			TileExtent(tile_ndc_y_[y + 1], tile_ndc_y_[y], zn, zf, camera_.projScaleY, _outMin[1], _outMax[1]);
+			_outMin[2] = zn;
+			_outMax[2] = zf;
+		}
+
+		/**
+		 * @brief XCX̋E / ^C̋ĚvZ
+		 *	XCX0: [nearZ, nearSliceDepth], XCXk(1 `): nearSliceDepth * (farZ / nearSliceDepth)^((k - 1) / (slicesZ - 1)) 玟܂
+		 */
+		void LightClusterBuilder::SetupGrid(const ClusterCamera& _camera)
+		{
+			camera_ = _camera;
+			desc_.tilesX = (std::max)(desc_.tilesX, 1u);
+			desc_.tilesY = (std::max)(desc_.tilesY, 1u);
+			desc_.slicesZ = (std::max)(desc_.slicesZ, 1u);
+			camera_.nearZ = (std::max)(camera_.nearZ, 1.0e-4f);
+			camera_.farZ = (std::max)(camera_.farZ, camera_.nearZ * 2.0f);
+
+			near_slice_ = desc_.nearSliceDepth;
+			if (!(near_slice_ > camera_.nearZ && near_slice_ < camera_.farZ)) {
+				near_slice_ = std::sqrt(camera_.nearZ * camera_.farZ);
+			}
+			const uint32_t expSlices = desc_.slicesZ - 1;
+			slice_scale_ = (expSlices > 0) ? static_cast<float>(expSlices) / std::log(camera_.farZ / near_slice_) : 0.0f;
+			slice_bias_ = -std::log(near_slice_) * slice_scale_;
+
+			slice_depths_.resize(desc_.slicesZ + 1);
+			slice_depths_[0] = camera_.nearZ;
+			for (uint32_t k = 1; k < desc_.slicesZ; ++k) {
+				slice_depths_[k] = near_slice_ * std::exp(static_cast<float>(k - 1) / slice_scale_);
+			}
+			slice_depths_[desc_.slicesZ] = camera_.farZ;
+
+			tile_ndc_x_.resize(desc_.tilesX + 1);
+			for (uint32_t i = 0; i <= desc_.tilesX; ++i) {
+				tile_ndc_x_[i] = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(desc_.tilesX);
+			}
+			tile_ndc_y_.resize(desc_.tilesY + 1);
+			for (uint32_t j = 0; j <= desc_.tilesY; ++j) {
+				tile_ndc_y_[j] = 1.0f - 2.0f * static_cast<float>(j) / static_cast<float>(desc_.tilesY);
+			}
+		}
+
+		/**
+		 * @brief XCX̊蓖
+		 *	ranges_̃ItZbg̓XCX̒ł̈ʒu(Buildŋl߂鎞ɑ)
+		 */
+		void LightClusterBuilder::BuildSlice(uint32_t _slice)
+		{
+			auto& work = slices_[_slice];
+			work.candidates.clear();
+			work.rects.clear();
+			work.indices.clear();
+			work.maxPerCluster = 0;
+
+			const uint32_t tilesX = desc_.tilesX;
+			const uint32_t tilesY = desc_.tilesY;
+			const float zn = slice_depths_[_slice] * (1.0f - DEPTH_PADDING);
+			const float zf = slice_depths_[_slice + 1] * (1.0f + DEPTH_PADDING);
+
+			//  / sƂ̃r[Ԃł̕(L)
+			work.extents.resize(static_cast<size_t>(tilesX + tilesY) * 2);
+			float* cMin = work.extents.data();
+			float* cMax = cMin + tilesX;
+			float* rMin = cMax + tilesX;
+			float* rMax = rMin + tilesY;
+			for (uint32_t i = 0; i < tilesX; ++i) {
+				TileExtent(tile_ndc_x_[i] - NDC_PADDING, tile_ndc_x_[i + 1] + NDC_PADDING, zn, zf, camera_.projScaleX, cMin[i], cMax[i]);
+			}
+			for (uint32_t j = 0; j < tilesY; ++j) {
+				TileExtent(tile_ndc_y_[j + 1] - NDC_PADDING, tile_ndc_y_[j] + NDC_PADDING, zn, zf, camera_.projScaleY, rMin[j], rMax[j]);
+			}
+
+			// sdȂ郉CgƁAdȂ^C͈̔
+			for (uint32_t n = 0; n < volumes_.size(); ++n) {
+				const auto& v = volumes_[n];
+				if (v.center[2] + v.radius < zn || v.center[2] - v.radius > zf) { continue; }
+
+				uint32_t x0 = 0, x1 = tilesX, y0 = 0, y1 = tilesY;
+				while (x0 < tilesX && cMax[x0] < v.center[0] - v.radius) { ++x0; }
+				while (x1 > x0 && cMin[x1 - 1] > v.center[0] + v.radius) { --x1; }
+				while (y0 < tilesY && rMin[y0] > v.center[1] + v.radius) { ++y0; }
+				while (y1 > y0 && rMax[y1 - 1] < v.center[1] - v.radius) { --y1; }
+				if (x0 >= x1 || y0 >= y1) { continue; }
+
+				work.candidates.push_back(n);
+				work.rects.insert(work.rects.end(), { x0, x1, y0, y1 });
+			}
+
+			// NX^Ƃɔ
+			for (uint32_t y = 0; y < tilesY; ++y) {
+				for (uint32_t x = 0; x < tilesX; ++x) {
+					const uint32_t cluster = (_slice * tilesY + y) * tilesX + x;
+					const uint32_t offset = static_cast<uint32_t>(work.indices.size());
+					work.indices.insert(work.indices.end(), globals_.begin(), globals_.end());
+
+					const float boxMin[3] = { cMin[x], rMin[y], zn };
+					const float boxMax[3] = { cMax[x], rMax[y], zf };
+					float boxCenter[3], boxRadius2 = 0.0f;
+					for (int c = 0; c < 3; ++c) {
+						boxCenter[c] = (boxMin[c] + boxMax[c]) * 0.5f;
+						const float h = boxMax[c] - boxCenter[c];
+						boxRadius2 += h * h;
+					}
+					const float boxRadius = std::sqrt(boxRadius2);
+
+					for (uint32_t n = 0; n < work.candidates.size(); ++n) {
+						const uint32_t* rect = &work.rects[n * 4];
+						if (x < rect[0] || x >= rect[1] || y < rect[2] || y >= rect[3]) { continue; }
+						const auto& v = volumes_[work.candidates[n]];
+
+						// Ɣ
+						float dist2 = 0.0f;
+						for (int c = 0; c < 3; ++c) {
+							const float d = (std::max)({ boxMin[c] - v.center[c], 0.0f, v.center[c] - boxMax[c] });
+							dist2 += d * d;
+						}
+						if (dist2 > v.radius * v.radius) { continue; }
+
+						// ~Ɣދ
+						if (v.cone) {
+							const float to[3] = { boxCenter[0] - v.apex[0], boxCenter[1] - v.apex[1], boxCenter[2] - v.apex[2] };
+							const float along = to[0] * v.direction[0] + to[1] * v.direction[1] + to[2] * v.direction[2];
+							const float perp = std::sqrt((std::max)(0.0f, to[0] * to[0] + to[1] * to[1] + to[2] * to[2] - along * along));
+							if (v.cosHalf * perp - along * v.sinHalf > boxRadius) { continue; }
+							if (along > boxRadius + v.range || along < -boxRadius) { continue; }
+						}
+						work.indices.push_back(v.index);
+					}
+
+					const uint32_t count = static_cast<uint32_t>(work.indices.size()) - offset;
+					ranges_[cluster * 2 + 0] = offset;
+					ranges_[cluster * 2 + 1] = count;
+					work.maxPerCluster = (std::max)(work.maxPerCluster, count);
+				}
+			}
+		}
+	}
+}
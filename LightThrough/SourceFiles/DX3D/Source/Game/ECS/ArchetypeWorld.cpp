@@ -0,0 +1,396 @@
+/**
+ * @file ArchetypeWorld.cpp
+ * @brief A[L^Cv(`N)ComponentXg[W
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/ECS/ArchetypeWorld.h>
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+#include <Debug/Debug.h>
+
+namespace {
+	//! @brief _align̔{ɐ؂グ
+	std::size_t AlignUp(std::size_t _value, std::size_t _align)
+	{
+		return (_value + _align - 1) & ~(_align - 1);
+	}
+
+	constexpr uint32_t EMPTY_ARCHETYPE_CAPACITY = 1024;	// ComponentȂA[L^Cv1`N̍s
+}
+
+namespace ecs {
+	// ---------- Archetype ---------- //
+
+	/**
+	 * @brief RXgN^
+	 * @param _signature ̃A[L^CvSignature
+	 * @param _infos ComponentTypeƂ̌^
+	 */
+	Archetype::Archetype(const Signature& _signature, const std::array<ComponentTypeInfo, MAX_COMPONENTS>& _infos)
+		: signature_(_signature)
+		, infos_(_infos)
+	{
+		std::size_t rowBytes = 0;
+		std::size_t alignSum = 0;
+		for (std::size_t i = 0; i < MAX_COMPONENTS; ++i) {
+			if (!signature_.test(i)) { continue; }
+			const auto& info = infos_[i];
+			assert(info.IsRegistered());
+			types_.push_back(static_cast<ComponentType>(i));
+			rowBytes += info.size;
+			alignSum += info.align;
+			chunk_align_ = (std::max)(chunk_align_, info.align);
+		}
+
+		if (types_.empty()) {
+			chunk_capacity_ = EMPTY_ARCHETYPE_CAPACITY;
+			return;
+		}
+
+		// 񂲂Ƃ̃ACg̗]Ăs߂
+		const std::size_t usable = (ARCHETYPE_CHUNK_BYTES > alignSum) ? ARCHETYPE_CHUNK_BYTES - alignSum : 0;
+		chunk_capacity_ = (std::max)(static_cast<uint32_t>(usable / rowBytes), 1u);
+
+		// ׂ
+		std::size_t offset = 0;
+		for (auto type : types_) {
+			const auto& info = infos_[type];
+			offset = AlignUp(offset, info.align);
+			column_offsets_[type] = offset;
+			offset += info.size * chunk_capacity_;
+		}
+		chunk_bytes_ = offset;
+	}
+
+	/**
+	 * @brief fXgN^
+	 */
+	Archetype::~Archetype()
+	{
+		for (std::size_t c = 0; c < chunks_.size(); ++c) {
+			auto& chunk = *chunks_[c];
+			for (auto type : types_) {
+				const auto& info = infos_[type];
+				std::byte* column = GetColumn(type, c);
+				for (uint32_t row = 0; row < chunk.count; ++row) {
+					info.destroy(column + info.size * row);
+				}
+			}
+			if (chunk.data) {
+				::operator delete(chunk.data, std::align_val_t(chunk_align_));
+			}
+		}
+	}
+
+	/**
+	 * @brief `N̗̐擪擾
+	 * @param _type ComponentType
+	 * @param _chunk `NIndex
+	 * @return ̐擪
+	 */
+	std::byte* Archetype::GetColumn(ComponentType _type, std::size_t _chunk)
+	{
+		assert(HasType(_type));
+		return chunks_[_chunk]->data + column_offsets_[_type];
+	}
+
+	/**
+	 * @brief sComponent擾
+	 * @param _type ComponentType
+	 * @param _chunk `NIndex
+	 * @param _row s
+	 * @return Component̃|C^
+	 */
+	void* Archetype::GetComponent(ComponentType _type, uint32_t _chunk, uint32_t _row)
+	{
+		return GetColumn(_type, _chunk) + infos_[_type].size * _row;
+	}
+
+	/**
+	 * @brief s̊m
+	 *	Component̒g͍\zȂ̂ŁAĂяoō\z邱
+	 * @param _e sɓEntity
+	 * @param _outChunk mۂ`NIndex
+	 * @param _outRow mۂs
+	 */
+	void Archetype::AllocateRow(Entity _e, uint32_t& _outChunk, uint32_t& _outRow)
+	{
+		// Ō̃`N܂ĂV`Nm
+		if (chunks_.empty() || chunks_.back()->count >= chunk_capacity_) {
+			auto chunk = std::make_unique<Chunk>();
+			if (chunk_bytes_ > 0) {
+				chunk->data = static_cast<std::byte*>(::operator new(chunk_bytes_, std::align_val_t(chunk_align_)));
+			}
+			chunk->entities.resize(chunk_capacity_);
+			chunks_.push_back(std::move(chunk));
+		}
+
+		auto& chunk = *chunks_.back();
+		_outChunk = static_cast<uint32_t>(chunks_.size() - 1);
+		_outRow = chunk.count++;
+		chunk.entities[_outRow] = _e;
+		++entity_count_;
+	}
+
+	/**
+	 * @brief s̍폜
+	 *	sComponentjāAA[L^Cv̍Ō̍sŌ𖄂߂
+	 * @param _chunk `NIndex
+	 * @param _row s
+	 * @return ߂̂߂ɈړĂEntityiړȂȂ疳Entityj
+	 */
+	Entity Archetype::RemoveRow(uint32_t _chunk, uint32_t _row)
+	{
+		for (auto type : types_) {
+			infos_[type].destroy(GetComponent(type, _chunk, _row));
+		}
+
+		const uint32_t lastChunk = static_cast<uint32_t>(chunks_.size() - 1);
+		auto& last = *chunks_[lastChunk];
+		const uint32_t lastRow = last.count - 1;
+
+		Entity moved{};
+		// ƂƍŌ̍sȂSwapȂ
+		if (_chunk != lastChunk || _row != lastRow) {
+			for (auto type : types_) {
+				const auto& info = infos_[type];
+				void* src = GetComponent(type, lastChunk, lastRow);
+				info.moveConstruct(GetComponent(type, _chunk, _row), src);
+				info.destroy(src);
+			}
+			moved = last.entities[lastRow];
+			chunks_[_chunk]->entities[_row] = moved;
+		}
+
+		--last.count;
+		--entity_count_;
+		// ɂȂ`N͉
+		if (last.count == 0) {
+			if (last.data) {
+				::operator delete(last.data, std::align_val_t(chunk_align_));
+			}
+			chunks_.pop_back();
+		}
+		return moved;
+	}
+
+
+	// ---------- ArchetypeWorld ---------- //
+
+	ArchetypeWorld::ArchetypeWorld() = default;
+	ArchetypeWorld::~ArchetypeWorld() = default;
+
+	/**
+	 * @brief Componenť^̓o^
+	 * @param _type ComponentType
+	 * @param _info ^
+	 */
+	void ArchetypeWorld::RegisterComponentType(ComponentType _type, const ComponentTypeInfo& _info)
+	{
+		assert(_type < MAX_COMPONENTS);
+		assert(!infos_[_type].IsRegistered());
+		infos_[_type] = _info;
+	}
+
+	/**
+	 * @brief Component̒ǉ
+	 * @param _e ǉEntity
+	 * @param _type ǉComponent̎
+	 * @param _data ǉComponent̃f[^ւ̃|C^
+	 */
+	void ArchetypeWorld::AddComponent(Entity _e, ComponentType _type, const void* _data)
+	{
+		assert(_data != nullptr);
+		const uint32_t index = _e.Index();
+		if (index >= locations_.size()) {
+			locations_.resize(static_cast<std::size_t>(index) + 1);
+			location_owners_.resize(static_cast<std::size_t>(index) + 1);
+		}
+
+		auto& location = locations_[index];
+		// O̎(jς)͎̏gȂ
+		if (location_owners_[index] != _e) {
+			assert(location.archetype == nullptr);
+			location = EntityLocation{};
+			location_owners_[index] = _e;
+		}
+
+		Archetype* src = location.archetype;
+		if (src && src->HasType(_type)) {
+			DebugLogError("[ArchetypeWorld] w肳ꂽEntity͂łComponentĂ", _e.id_);
+			return;
+		}
+
+		// ړ̃A[L^Cv߂
+		Archetype* dst = src ? src->add_edges_[_type] : nullptr;
+		if (!dst) {
+			Signature sig = src ? src->GetSignature() : Signature{};
+			sig.set(_type);
+			dst = GetOrCreateArchetype(sig);
+			if (src) { src->add_edges_[_type] = dst; }
+		}
+
+		if (src) {
+			MoveEntity(_e, location, dst);
+		}
+		else {
+			dst->AllocateRow(_e, location.chunk, location.row);
+			location.archetype = dst;
+		}
+
+		infos_[_type].copyConstruct(dst->GetComponent(_type, location.chunk, location.row), _data);
+	}
+
+	/**
+	 * @brief Component̍폜
+	 * @param _e 폜Entity
+	 * @param _type 폜Component̎
+	 */
+	void ArchetypeWorld::RemoveComponent(Entity _e, ComponentType _type)
+	{
+		if (!HasComponent(_e, _type)) {
+			DebugLogError("[ArchetypeWorld] w肳ꂽEntityComponent݂Ȃ", _e.id_);
+			return;
+		}
+
+		auto& location = locations_[_e.Index()];
+		Archetype* src = location.archetype;
+
+		Signature sig = src->GetSignature();
+		sig.reset(_type);
+		// ȂȂsƏ
+		if (sig.none()) {
+			RemoveFromArchetype(location);
+			location = EntityLocation{};
+			return;
+		}
+
+		Archetype* dst = src->remove_edges_[_type];
+		if (!dst) {
+			dst = GetOrCreateArchetype(sig);
+			src->remove_edges_[_type] = dst;
+		}
+		MoveEntity(_e, location, dst);
+	}
+
+	/**
+	 * @brief EntityjꂽۂɌĂяo
+	 * @param _e jꂽEntity
+	 */
+	void ArchetypeWorld::EntityDestroyed(Entity _e)
+	{
+		if (!FindLocation(_e)) { return; }
+
+		const uint32_t index = _e.Index();
+		RemoveFromArchetype(locations_[index]);
+		locations_[index] = EntityLocation{};
+		location_owners_[index] = Entity{};
+	}
+
+	/**
+	 * @brief ComponentĂ邩
+	 * @param _e mFEntity
+	 * @param _type mFComponent̎
+	 * @return L: true, : false
+	 */
+	bool ArchetypeWorld::HasComponent(Entity _e, ComponentType _type) const
+	{
+		const auto* location = FindLocation(_e);
+		return location && location->archetype->HasType(_type);
+	}
+
+	/**
+	 * @brief Component̎擾
+	 * @param _e 擾Entity
+	 * @param _type 擾Component̎
+	 * @return Component̃|C^
+	 */
+	void* ArchetypeWorld::GetComponent(Entity _e, ComponentType _type)
+	{
+		assert(HasComponent(_e, _type));
+		const auto& location = locations_[_e.Index()];
+		return location.archetype->GetComponent(_type, location.chunk, location.row);
+	}
+
+	/**
+	 * @brief A[L^Cv̎擾i΍쐬j
+	 * @param _signature A[L^CvSignature
+	 * @return A[L^Cv
+	 */
+	Archetype* ArchetypeWorld::GetOrCreateArchetype(const Signature& _signature)
+	{
+		auto it = archetypes_.find(_signature);
+		if (it != archetypes_.end()) {
+			return it->second.get();
+		}
+
+		auto archetype = std::make_unique<Archetype>(_signature, infos_);
+		Archetype* ptr = archetype.get();
+		archetypes_.emplace(_signature, std::move(archetype));
+		archetype_list_.push_back(ptr);
+		return ptr;
+	}
+
+	/**
+	 * @brief Entity̍s̈ʒu擾
+	 * @param _e ΏۂEntity
+	 * @return s̈ʒuiĂȂnullptrj
+	 */
+	const ArchetypeWorld::EntityLocation* ArchetypeWorld::FindLocation(Entity _e) const
+	{
+		const uint32_t index = _e.Index();
+		if (index >= locations_.size()) { return nullptr; }
+		if (location_owners_[index] != _e) { return nullptr; }
+		if (!locations_[index].archetype) { return nullptr; }
+		return &locations_[index];
+	}
+
+	/**
+	 * @brief ʂ̃A[L^Cv֍sړ
+	 *	ʂComponent̓[uAړɂComponent͖\ẑ܂
+	 * @param _e ړEntity
+	 * @param _location Entity̍s̈ʒuiړɍXVj
+	 * @param _dst ړ̃A[L^Cv
+	 */
+	void ArchetypeWorld::MoveEntity(Entity _e, EntityLocation& _location, Archetype* _dst)
+	{
+		Archetype* src = _location.archetype;
+		uint32_t dstChunk = 0;
+		uint32_t dstRow = 0;
+		_dst->AllocateRow(_e, dstChunk, dstRow);
+
+		for (auto type : src->GetTypes()) {
+			if (!_dst->HasType(type)) { continue; }
+			infos_[type].moveConstruct(
+				_dst->GetComponent(type, dstChunk, dstRow),
+				src->GetComponent(type, _location.chunk, _location.row));
+		}
+
+		// ̍s̓[uς + 폜ComponentȂ̂ŁA܂Ƃ߂Ĕj
+		RemoveFromArchetype(_location);
+
+		_location.archetype = _dst;
+		_location.chunk = dstChunk;
+		_location.row = dstRow;
+	}
+
+	/**
+	 * @brief ̃A[L^Cvs폜
+	 *	߂ňړEntitÿʒuXV
+	 * @param _location 폜s̈ʒu
+	 */
+	void ArchetypeWorld::RemoveFromArchetype(EntityLocation& _location)
+	{
+		const Entity moved = _location.archetype->RemoveRow(_location.chunk, _location.row);
+		if (moved.IsInitialized()) {
+			auto& movedLocation = locations_[moved.Index()];
+			movedLocation.chunk = _location.chunk;
+			movedLocation.row = _location.row;
+		}
+	}
+}
@@ -0,0 +1,145 @@
+#pragma once
+/**
+ * @file ArchetypeWorld.h
+ * @brief A[L^Cv(`N)ComponentXg[W
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <Game/ECS/Entity.h>
+#include <Game/ECS/ECSUtils.h>
+
+namespace ecs {
+	/**
+	 * @brief ^Component̏
+	 *
+	 * `NŌ^m炸ɃRs[ / [u / j邽߂̊֐܂Ƃ߂
+	 */
+	struct ComponentTypeInfo {
+		std::size_t size = 0;
+		std::size_t align = 1;
+		void (*copyConstruct)(void* _dst, const void* _src) = nullptr;
+		void (*moveConstruct)(void* _dst, void* _src) = nullptr;
+		void (*destroy)(void* _ptr) = nullptr;
+
+		bool IsRegistered() const { return size != 0; }
+
+		template<typename Com>
+		static ComponentTypeInfo Make();
+	};
+
+	/**
+	 * @brief A[L^Cv
+	 *
+	 * SignatureEntityŒTCỸ`NSoAŋl߂ĕێB
+	 * `NComponentƂɘAɂȂĂB
+	 */
+	class Archetype final {
+	public:
+		/**
+		 * @brief `N
+		 */
+		struct Chunk {
+			std::byte* data = nullptr;		// f[^
+			std::vector<Entity> entities{};	// sɑΉEntity
+			uint32_t count = 0;				// gp̍s
+		};
+
+		Archetype(const Signature& _signature, const std::array<ComponentTypeInfo, MAX_COMPONENTS>& _infos);
+		~Archetype();
+
+		Archetype(const Archetype&) = delete;
+		Archetype& operator=(const Archetype&) = delete;
+
+		const Signature& GetSignature() const { return signature_; }
+		uint32_t GetChunkCapacity() const { return chunk_capacity_; }
+		std::size_t GetChunkCount() const { return chunks_.size(); }
+		Chunk& GetChunk(std::size_t _index) { return *chunks_[_index]; }
+		uint32_t GetEntityCount() const { return entity_count_; }
+
+		const std::vector<ComponentType>& GetTypes() const { return types_; }
+		bool HasType(ComponentType _type) const { return signature_.test(_type); }
+		std::byte* GetColumn(ComponentType _type, std::size_t _chunk);	// `N̗̐擪擾
+		void* GetComponent(ComponentType _type, uint32_t _chunk, uint32_t _row);	// sComponent擾
+
+		void AllocateRow(Entity _e, uint32_t& _outChunk, uint32_t& _outRow);	// s̊mہig͖\zj
+		Entity RemoveRow(uint32_t _chunk, uint32_t _row);	// s̍폜iŌ̍sŖ߂j
+
+		Archetype* add_edges_[MAX_COMPONENTS]{};	// Component1ǉ̃LbV
+		Archetype* remove_edges_[MAX_COMPONENTS]{};	// Component1폜̃LbV
+
+	private:
+		Signature signature_{};
+		std::vector<ComponentType> types_{};	// ĂComponentTypëꗗ
+		std::array<std::size_t, MAX_COMPONENTS> column_offsets_{};	// `Ñ̗ItZbg
+		const std::array<ComponentTypeInfo, MAX_COMPONENTS>& infos_;
+		uint32_t chunk_capacity_ = 0;	// 1`N̍s
+		std::size_t chunk_bytes_ = 0;	// 1`N̗f[^̃oCg
+		std::size_t chunk_align_ = alignof(std::max_align_t);	// f[^̃ACg
+		uint32_t entity_count_ = 0;
+		std::vector<std::unique_ptr<Chunk>> chunks_{};
+	};
+
+	/**
+	 * @brief A[L^Cv[h
+	 *
+	 * ComponentManager̃A[L^Cvp̃obNGhB
+	 * Component̒ǉ / 폜Entity̍sA[L^CvԂňړB
+	 * [Note] \ύX(ǉ / 폜 / j)ƂEntityƁA߂ňړEntityComponent̃|C^͖ɂȂ
+	 */
+	class ArchetypeWorld final {
+	public:
+		ArchetypeWorld();
+		~ArchetypeWorld();
+
+		void RegisterComponentType(ComponentType _type, const ComponentTypeInfo& _info);	// Componenť^̓o^
+
+		void AddComponent(Entity _e, ComponentType _type, const void* _data);	// Component̒ǉ
+		void RemoveComponent(Entity _e, ComponentType _type);	// Component̍폜
+		void EntityDestroyed(Entity _e);	// EntityjꂽۂɌĂяo
+
+		bool HasComponent(Entity _e, ComponentType _type) const;	// ComponentĂ邩
+		void* GetComponent(Entity _e, ComponentType _type);		// Component̎擾
+
+		/**
+		 * @brief w肵ComponentׂĎEntityPʂő
+		 * @param _types ComponentType̗iComsƓԁj
+		 * @param _func (Entity, Coms&...)
+		 */
+		template<typename... Coms, typename Func>
+		void ForEach(const std::array<ComponentType, sizeof...(Coms)>& _types, Func&& _func);
+
+		std::size_t GetArchetypeCount() const { return archetypes_.size(); }
+
+	private:
+		/**
+		 * @brief Entity̍s̈ʒu
+		 */
+		struct EntityLocation {
+			Archetype* archetype = nullptr;
+			uint32_t chunk = 0;
+			uint32_t row = 0;
+		};
+
+		Archetype* GetOrCreateArchetype(const Signature& _signature);
+		const EntityLocation* FindLocation(Entity _e) const;
+		void MoveEntity(Entity _e, EntityLocation& _location, Archetype* _dst);	// ʂ̃A[L^Cv֍sړ
+		void RemoveFromArchetype(EntityLocation& _location);	// ̃A[L^Cvs폜
+
+	private:
+		std::array<ComponentTypeInfo, MAX_COMPONENTS> infos_{};	// ComponentTypeƂ̌^
+		std::unordered_map<Signature, std::unique_ptr<Archetype>> archetypes_{};	// Signature -> A[L^Cv
+		std::vector<Archetype*> archetype_list_{};	// p
+		std::vector<EntityLocation> locations_{};	// EntityIndex -> s̈ʒu
+		std::vector<Entity> location_owners_{};	// EntityIndex -> sĂEntityiVersionmFpj
+	};
+}
+
+#include <Game/ECS/ArchetypeWorld.inl>
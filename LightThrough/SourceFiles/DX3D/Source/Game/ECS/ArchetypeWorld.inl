@@ -0,0 +1,61 @@
+#pragma once
+/**
+ * @file ArchetypeWorld.inl
+ * @brief A[L^Cv[h̃ev[g֐̒`
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <new>
+#include <utility>
+#include <Game/ECS/ArchetypeWorld.h>
+
+namespace ecs {
+	/**
+	 * @brief Componenť^쐬
+	 * @param <Com> Component̎
+	 * @return ^
+	 */
+	template<typename Com>
+	ComponentTypeInfo ComponentTypeInfo::Make()
+	{
+		ComponentTypeInfo info{};
+		info.size = sizeof(Com);
+		info.align = alignof(Com);
+		info.copyConstruct = [](void* _dst, const void* _src) { ::new(_dst) Com(*static_cast<const Com*>(_src)); };
+		info.moveConstruct = [](void* _dst, void* _src) { ::new(_dst) Com(std::move(*static_cast<Com*>(_src))); };
+		info.destroy = [](void* _ptr) { static_cast<Com*>(_ptr)->~Com(); };
+		return info;
+	}
+
+	/**
+	 * @brief w肵ComponentׂĎEntityPʂő
+	 * @param _types ComponentType̗iComsƓԁj
+	 * @param _func (Entity, Coms&...)
+	 */
+	template<typename... Coms, typename Func>
+	void ArchetypeWorld::ForEach(const std::array<ComponentType, sizeof...(Coms)>& _types, Func&& _func)
+	{
+		Signature sig;
+		for (auto type : _types) { sig.set(type); }
+
+		for (auto* archetype : archetype_list_) {
+			if ((archetype->GetSignature() & sig) != sig) { continue; }
+
+			for (std::size_t c = 0; c < archetype->GetChunkCount(); ++c) {
+				auto& chunk = archetype->GetChunk(c);
+				// ̐擪܂Ƃ߂Ď擾āAs͐`ɑ
+				std::size_t i = 0;
+				std::array<std::byte*, sizeof...(Coms)> columns{};
+				for (auto type : _types) { columns[i++] = archetype->GetColumn(type, c); }
+
+				[&]<std::size_t... I>(std::index_sequence<I...>) {
+					for (uint32_t row = 0; row < chunk.count; ++row) {
+						_func(chunk.entities[row], reinterpret_cast<Coms*>(columns[I])[row]...);
+					}
+				}(std::index_sequence_for<Coms...>{});
+			}
+		}
+	}
+}
@@ -0,0 +1,143 @@
+/**
+ * @file CommandBuffer.cpp
+ * @brief \ύX(ǉ / 폜 / j)𗭂߂ĂR}hobt@
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/ECS/CommandBuffer.h>
+#include <algorithm>
+
+namespace {
+	thread_local uint32_t t_current_system = 0;	// ̃XbhŎsSystem(o^ + 1)
+}
+
+namespace ecs {
+	//! @brief fXgN^
+	CommandBuffer::~CommandBuffer()
+	{
+		Clear();
+	}
+
+	/**
+	 * @brief Component̍폜L^
+	 * @param _key Ԃ̃L[
+	 * @param _e ΏۂEntity
+	 * @param _type 폜ComponentType
+	 */
+	void CommandBuffer::RemoveComponent(const CommandKey& _key, Entity _e, ComponentType _type)
+	{
+		commands_.push_back(Command{
+			.key = _key,
+			.e = _e,
+			.type = CommandType::RemoveComponent,
+			.component = _type,
+			});
+	}
+
+	/**
+	 * @brief Entity̔jL^
+	 * @param _key Ԃ̃L[
+	 * @param _e jEntity
+	 */
+	void CommandBuffer::DestroyEntity(const CommandKey& _key, Entity _e)
+	{
+		commands_.push_back(Command{
+			.key = _key,
+			.e = _e,
+			.type = CommandType::DestroyEntity,
+			});
+	}
+
+	//! @brief A[i̎gp
+	std::size_t CommandBuffer::GetArenaUsedBytes() const
+	{
+		std::size_t used = 0;
+		for (auto& block : blocks_) {
+			used += block.used;
+		}
+		return used;
+	}
+
+	/**
+	 * @brief ĝĂ
+	 */
+	void CommandBuffer::Clear()
+	{
+		for (auto& command : commands_) {
+			if (command.payload && command.destroy) {
+				command.destroy(command.payload);
+			}
+		}
+		commands_.clear();
+
+		for (auto& block : blocks_) {
+			block.used = 0;
+		}
+		current_block_ = 0;
+	}
+
+	/**
+	 * @brief A[im
+	 *	̃ubNɓȂΎ̃ubNցBΒǉ
+	 * @param _size TCY
+	 * @param _align ACg
+	 * @return mۂ̈
+	 */
+	void* CommandBuffer::Allocate(std::size_t _size, std::size_t _align)
+	{
+		const auto tryAllocate = [_size, _align](Block& _block) -> void* {
+			const auto base = reinterpret_cast<std::uintptr_t>(_block.data.get());
+			const std::uintptr_t aligned = (base + _block.used + _align - 1) & ~static_cast<std::uintptr_t>(_align - 1);
+			const std::size_t end = static_cast<std::size_t>(aligned - base) + _size;
+			if (end > _block.size) { return nullptr; }
+			_block.used = end;
+			return reinterpret_cast<void*>(aligned);
+			};
+
+		for (; current_block_ < blocks_.size(); ++current_block_) {
+			if (void* p = tryAllocate(blocks_[current_block_])) { return p; }
+		}
+
+		// 傫ComponentłK悤ɁAACg̗]T
+		const std::size_t size = (std::max)(COMMAND_ARENA_BLOCK_BYTES, _size + _align);
+		blocks_.push_back(Block{ std::make_unique<std::byte[]>(size), size, 0 });
+		current_block_ = blocks_.size() - 1;
+		return tryAllocate(blocks_.back());
+	}
+
+	/**
+	 * @brief ̃obt@̃R}h𔽉f鏇ɕׂ
+	 *	(batch, system) ň\[ĝŁAL[m̓obt@ -> L^̂܂܁B
+	 *	System̋L^͈̃XbhȂ̂ŁAǂ̃[J[œĂʂ̏Ԃ͕ςȂ
+	 * @param _buffers Ώۂ̃obt@
+	 * @param _out ׂR}hւ̃|C^
+	 */
+	void CommandBuffer::Merge(const std::vector<std::unique_ptr<CommandBuffer>>& _buffers, std::vector<const Command*>& _out)
+	{
+		_out.clear();
+		for (auto& buffer : _buffers) {
+			for (auto& command : buffer->commands_) {
+				_out.push_back(&command);
+			}
+		}
+
+		const auto less = [](const Command* _a, const Command* _b) { return _a->key < _b->key; };
+		if (!std::is_sorted(_out.begin(), _out.end(), less)) {
+			std::stable_sort(_out.begin(), _out.end(), less);
+		}
+	}
+
+	//! @brief ̃XbhŎsSystemݒ
+	void CommandBuffer::SetCurrentSystem(uint32_t _system)
+	{
+		t_current_system = _system;
+	}
+
+	//! @brief ̃XbhŎsSystem
+	uint32_t CommandBuffer::GetCurrentSystem()
+	{
+		return t_current_system;
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+/**
+ * @file CommandBuffer.h
+ * @brief \ύX(ǉ / 폜 / j)𗭂߂ĂR}hobt@
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <type_traits>
+#include <Game/ECS/Entity.h>
+#include <Game/ECS/ECSUtils.h>
+
+namespace ecs {
+	/**
+	 * @brief R}h̎
+	 */
+	enum class CommandType : uint8_t {
+		AddComponent,
+		RemoveComponent,
+		DestroyEntity,
+	};
+
+	/**
+	 * @brief L^ꂽԂ߂L[
+	 *
+	 * ̃obt@܂Ƃ߂鎞 (batch, system) ̏ŕגB
+	 * L[m̓obt@Index -> L^B
+	 */
+	struct CommandKey {
+		uint32_t batch = 0;		// System̈ꊇs̑OŐiޔԍ
+		uint32_t system = 0;	// L^System̓o^ + 1 (SystemOȂ0)
+
+		bool operator<(const CommandKey& _other) const {
+			if (batch != _other.batch) { return batch < _other.batch; }
+			return system < _other.system;
+		}
+	};
+
+	/**
+	 * @brief R}h(POD)
+	 *	ǉComponent̒g̓obt@̃A[iɒuāApayloadŎw
+	 */
+	struct Command {
+		CommandKey key{};
+		Entity e{};
+		CommandType type = CommandType::AddComponent;
+		ComponentType component = 0;
+		void* payload = nullptr;				// ǉComponent
+		void (*destroy)(void*) = nullptr;	// payload̔j(grAȂnullptr)
+	};
+
+	/**
+	 * @brief R}hobt@
+	 *
+	 * R}h͐`ɐςނŁAComponent̒g̓ubNPʂ̃ovAP[^ɒuB
+	 * ClearĂubN͎Ȃ̂ŁAt[炢̗ʂȂmۂ͋NȂB
+	 * ̃obt@͈̃Xbh炾ށB
+	 */
+	class CommandBuffer final {
+	public:
+		CommandBuffer() = default;
+		~CommandBuffer();
+
+		CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		/**
+		 * @brief Component̒ǉL^
+		 * @param _key Ԃ̃L[
+		 * @param _e ΏۂEntity
+		 * @param _type ǉComponentType
+		 * @param _component ǉComponentiA[iɃRs[j
+		 */
+		template<typename Com>
+		void AddComponent(const CommandKey& _key, Entity _e, ComponentType _type, const Com& _component);
+		void RemoveComponent(const CommandKey& _key, Entity _e, ComponentType _type);	// Component̍폜L^
+		void DestroyEntity(const CommandKey& _key, Entity _e);	// Entity̔jL^
+
+		const std::vector<Command>& GetCommands() const { return commands_; }
+		bool Empty() const { return commands_.empty(); }
+		std::size_t GetArenaUsedBytes() const;	// A[i̎gp
+
+		/**
+		 * @brief ĝĂ
+		 *	fȂComponentŔjBubN͍ėp
+		 */
+		void Clear();
+
+		/**
+		 * @brief ̃obt@̃R}h𔽉f鏇ɕׂ
+		 * @param _buffers Ώۂ̃obt@(IndexL[m̏ԂɂȂ)
+		 * @param _out ׂR}hւ̃|C^
+		 */
+		static void Merge(const std::vector<std::unique_ptr<CommandBuffer>>& _buffers, std::vector<const Command*>& _out);
+
+		/**
+		 * @brief ̃XbhŎsSystem
+		 *	XPW[System̎sOŐݒ肷
+		 */
+		static void SetCurrentSystem(uint32_t _system);
+		static uint32_t GetCurrentSystem();
+
+	private:
+		/**
+		 * @brief A[ĩubN
+		 */
+		struct Block {
+			std::unique_ptr<std::byte[]> data{};
+			std::size_t size = 0;
+			std::size_t used = 0;
+		};
+
+		void* Allocate(std::size_t _size, std::size_t _align);	// A[im
+
+		template<typename Com>
+		static void DestroyPayload(void* _ptr) { static_cast<Com*>(_ptr)->~Com(); }
+
+	private:
+		std::vector<Command> commands_{};
+		std::vector<Block> blocks_{};
+		std::size_t current_block_ = 0;	// mۂĂubN
+	};
+}
+
+#include <Game/ECS/CommandBuffer.inl>
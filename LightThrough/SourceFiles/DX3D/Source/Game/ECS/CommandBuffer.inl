@@ -0,0 +1,37 @@
+#pragma once
+/**
+ * @file CommandBuffer.inl
+ * @brief R}hobt@̃ev[g֐̒`
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <new>
+#include <Game/ECS/CommandBuffer.h>
+
+namespace ecs {
+	/**
+	 * @brief Component̒ǉL^
+	 * @param <Com> ǉComponent̎
+	 * @param _key Ԃ̃L[
+	 * @param _e ΏۂEntity
+	 * @param _type ǉComponentType
+	 * @param _component ǉComponent
+	 */
+	template<typename Com>
+	void CommandBuffer::AddComponent(const CommandKey& _key, Entity _e, ComponentType _type, const Com& _component)
+	{
+		void* payload = Allocate(sizeof(Com), alignof(Com));
+		new (payload) Com(_component);
+
+		commands_.push_back(Command{
+			.key = _key,
+			.e = _e,
+			.type = CommandType::AddComponent,
+			.component = _type,
+			.payload = payload,
+			.destroy = std::is_trivially_destructible_v<Com> ? nullptr : &DestroyPayload<Com>,
+			});
+	}
+}
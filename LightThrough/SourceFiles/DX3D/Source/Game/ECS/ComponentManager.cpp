@@ -7,8 +7,21 @@
 
  // ---------- CN[h ---------- // 
 #include <Game/ECS/ComponentManager.h>
+#include <Game/ECS/ComponentArray.h>
 
 namespace ecs {
+	/**
+	 * @brief RXgN^
+	 * @param _storage Component̕ۑ
+	 */
+	ComponentManager::ComponentManager(ComponentStorageType _storage)
+		: storage_type_(_storage)
+	{
+		if (storage_type_ == ComponentStorageType::Archetype) {
+			archetype_world_ = std::make_unique<ArchetypeWorld>();
+		}
+	}
+
 	/**
 	 * @brief Component̒ǉivoid|C^Łj
 	 * @param _e ǉEntity
@@ -17,6 +30,10 @@ namespace ecs {
 	 */
 	void ComponentManager::AddComponent(Entity _e, ComponentType _type, const void* _data)
 	{
+		if (archetype_world_) {
+			archetype_world_->AddComponent(_e, _type, _data);
+			return;
+		}
 		component_arrays_by_type_[_type]->AddRaw(_e, _data);
 	}
 
@@ -27,13 +44,47 @@ namespace ecs {
 	 */
 	void ComponentManager::RemoveComponent(Entity _e, ComponentType _type)
 	{
+		if (archetype_world_) {
+			archetype_world_->RemoveComponent(_e, _type);
+			return;
+		}
 		component_arrays_by_type_[_type]->Remove(_e);
 	}
+	/**
+	 * @brief SComponentXg̃XibvVbg
+	 * @param _out ComponentTypeƂ̕ۑ
+	 */
+	void ComponentManager::CaptureSnapshot(std::array<std::unique_ptr<IComponentSnapshot>, MAX_COMPONENTS>& _out) const
+	{
+		assert(!archetype_world_ && "Archetype̓XibvVbgΉ");
+		for (ComponentType type = 0; type < next_component_type_; ++type) {
+			_out[type] = component_arrays_by_type_[type]->CaptureSnapshot();
+		}
+	}
+
+	/**
+	 * @brief SComponentXgXibvVbgɖ߂
+	 *	XibvVbǧɓo^ꂽComponent͐GȂ
+	 * @param _snapshot CaptureSnapshotŕۑ
+	 */
+	void ComponentManager::RestoreSnapshot(const std::array<std::unique_ptr<IComponentSnapshot>, MAX_COMPONENTS>& _snapshot)
+	{
+		assert(!archetype_world_ && "Archetype̓XibvVbgΉ");
+		for (ComponentType type = 0; type < next_component_type_; ++type) {
+			if (!_snapshot[type]) { continue; }
+			component_arrays_by_type_[type]->RestoreSnapshot(*_snapshot[type]);
+		}
+	}
+
 	/**
 	 * @brief EntityjꂽۂɌĂяo
 	 */
 	void ComponentManager::EntityDestroyed(Entity _e)
 	{
+		if (archetype_world_) {
+			archetype_world_->EntityDestroyed(_e);
+			return;
+		}
 		for (auto& pair : this->component_arrays_) {
 			pair.second->EntityDestroyed(_e);
 		}
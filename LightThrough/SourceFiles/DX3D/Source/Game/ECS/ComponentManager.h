@@ -12,13 +12,16 @@
 #include <memory>
 #include <cassert>
 #include <array>
+#include <functional>
 
 #include <Game/ECS/Entity.h>
 #include <Game/ECS/ECSUtils.h>
+#include <Game/ECS/ArchetypeWorld.h>
 
 namespace ecs {
 	// ---------- O錾 ---------- //
 	class IComponentArray;	// R|[lgz̃C^[tF[X
+	class IComponentSnapshot;	// R|[lgz̃XibvVbg
 	template<typename Com> class ComponentArray;	// R|[lgzNX
 
 	/**
@@ -26,9 +29,12 @@ namespace ecs {
 	 *
 	 * R|[lg̊ǗSNX
 	 * eR|[lg̃XgێAEntityɑ΂ăR|[lg̒ǉA폜A擾sB
+	 * ۑSparseSet(ނƂ̔z)Archetype(SignatureƂ̃`N)IׂB
 	 */
 	class ComponentManager final{
 	public:
+		explicit ComponentManager(ComponentStorageType _storage = ComponentStorageType::SparseSet);
+
 		template<typename Com>
 		void RegisterComponent();	// ComponentXg̓o^
 		template<typename Com>
@@ -39,9 +45,23 @@ namespace ecs {
 		ComponentType GetComponentType();	// ComponentType擾
 
 		void AddComponent(Entity _e, ComponentType _type, const void* _data);
+		template<typename Com>
+		void AddComponentBlock(const Entity* _entities, const void* _data, uint32_t _count);	// ܂Ƃ߂Ēǉi_dataCom[_count]j
 		void RemoveComponent(Entity _e, ComponentType _type);	// Component̍폜
 		void EntityDestroyed(Entity _e);	// EntityjꂽۂɌĂяo
 
+		/**
+		 * @brief SComponentXg̃XibvVbg(SparseSet̂)
+		 * @param _out ComponentTypeƂ̕ۑ
+		 */
+		void CaptureSnapshot(std::array<std::unique_ptr<IComponentSnapshot>, MAX_COMPONENTS>& _out) const;
+		void RestoreSnapshot(const std::array<std::unique_ptr<IComponentSnapshot>, MAX_COMPONENTS>& _snapshot);	// SComponentXg߂
+		template<typename Com>
+		void SetSnapshotRestoreHook(std::function<void(Entity, Com&)> _hook);	// ߂ɌĂԏ̐ݒ
+
+		ComponentStorageType GetStorageType() const { return storage_type_; }
+		ArchetypeWorld* GetArchetypeWorld() { return archetype_world_.get(); }	// ArchetypeȊOȂnullptr
+
 	private:
 		template<typename Com>
 		ComponentArray<Com>* GetComponentArray();	// ComponentXg̎擾
@@ -51,6 +71,9 @@ namespace ecs {
 		std::unordered_map<std::type_index, ComponentType> component_types_;	// R|[lgɑΉ鐮ێMap
 		std::array<IComponentArray*, MAX_COMPONENTS> component_arrays_by_type_{}; // ComponentTypeComponentArray擾邽߂̔z
 		ComponentType next_component_type_ = 0;	// ɓo^R|[lgType
+
+		ComponentStorageType storage_type_ = ComponentStorageType::SparseSet;	// Component̕ۑ
+		std::unique_ptr<ArchetypeWorld> archetype_world_{};	// ArchetypẽXg[W
 	};
 
 }
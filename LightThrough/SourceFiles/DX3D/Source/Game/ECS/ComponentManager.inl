@@ -23,12 +23,19 @@ namespace ecs {
 	{
 		// [ToDo] typeid(Com)Ƃ̔rȂāAtype_index(typeid(Com))ɂCopilot񂪌Ă̂Ń
 		const std::type_index type = typeid(Com);
-		assert(component_arrays_.find(type) == component_arrays_.end());
+		assert(component_types_.find(type) == component_types_.end());
 
 		// ComponentTypeo^
 		assert(next_component_type_ < MAX_COMPONENTS);
 		ComponentType id = next_component_type_++;
 		component_types_[type] = id;
+
+		// ArchetypeȂ^񂾂o^
+		if (archetype_world_) {
+			archetype_world_->RegisterComponentType(id, ComponentTypeInfo::Make<Com>());
+			return;
+		}
+
 		// ComponentXgo^
 		component_arrays_[type] = std::make_unique<ComponentArray<Com>>();
 		// ComponentTypeComponentArray擾邽߂̔zɓo^
@@ -44,6 +51,9 @@ namespace ecs {
 	template<typename Com>
 	Com* ComponentManager::GetComponent(Entity _e)
 	{
+		if (archetype_world_) {
+			return static_cast<Com*>(archetype_world_->GetComponent(_e, GetComponentType<Com>()));
+		}
 		return &GetComponentArray<Com>()->Get(_e);
 	}
 
@@ -56,9 +66,34 @@ namespace ecs {
 	template<typename Com>
 	bool ComponentManager::HasComponent(Entity _e)
 	{
+		if (archetype_world_) {
+			return archetype_world_->HasComponent(_e, GetComponentType<Com>());
+		}
 		return GetComponentArray<Com>()->Has(_e);
 	}
 
+	/**
+	 * @brief Component܂Ƃ߂Ēǉ
+	 *	SparseSetComponentXgɈxɎʂBArchetype͈ړ
+	 * @param <Com> ǉComponent̎
+	 * @param _entities ǉEntity
+	 * @param _data ǉComponent̕(Com[_count])
+	 * @param _count 
+	 */
+	template<typename Com>
+	void ComponentManager::AddComponentBlock(const Entity* _entities, const void* _data, uint32_t _count)
+	{
+		if (archetype_world_) {
+			const ComponentType type = GetComponentType<Com>();
+			const auto* src = static_cast<const std::byte*>(_data);
+			for (uint32_t i = 0; i < _count; ++i) {
+				archetype_world_->AddComponent(_entities[i], type, src + sizeof(Com) * i);
+			}
+			return;
+		}
+		GetComponentArray<Com>()->AddRawBlock(_entities, _data, _count);
+	}
+
 	/**
 	 * @brief Component^Cv̎擾
 	 * @param <Com> 擾Component̎
@@ -67,9 +102,22 @@ namespace ecs {
 	template<typename Com>
 	ComponentType ComponentManager::GetComponentType()
 	{
-		const std::type_index type = typeid(Com);
-		assert(component_types_.find(type) != component_types_.end());
-		return component_types_[type];
+		// memo: sɂĂ΂̂ŁAoperator[]ł͂Ȃfindœǂ
+		auto it = component_types_.find(typeid(Com));
+		assert(it != component_types_.end());
+		return it->second;
+	}
+
+	/**
+	 * @brief XibvVbg߂ɌĂԏ̐ݒ
+	 * @param <Com> ΏۂComponent̎
+	 * @param _hook (Entity, Com&)
+	 */
+	template<typename Com>
+	void ComponentManager::SetSnapshotRestoreHook(std::function<void(Entity, Com&)> _hook)
+	{
+		if (archetype_world_) { return; }	// Archetype̓XibvVbgΉ
+		GetComponentArray<Com>()->SetRestoreHook(std::move(_hook));
 	}
 
 	/**
@@ -80,8 +128,8 @@ namespace ecs {
 	template<typename Com>
 	ComponentArray<Com>* ComponentManager::GetComponentArray()
 	{
-		const std::type_index type = typeid(Com);
-		assert(component_arrays_.find(type) != component_arrays_.end());
-		return static_cast<ComponentArray<Com>*>(component_arrays_[type].get());
+		auto it = component_arrays_.find(typeid(Com));
+		assert(it != component_arrays_.end());
+		return static_cast<ComponentArray<Com>*>(it->second.get());
 	}
 }
\ No newline at end of file
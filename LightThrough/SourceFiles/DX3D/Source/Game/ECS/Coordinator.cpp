@@ -11,18 +11,30 @@
 #include <Game/ECS/EntityManager.h>
 #include <Game/ECS/ComponentManager.h>
 #include <Game/ECS/SystemManager.h>
+#include <Game/ECS/QueryManager.h>
+#include <Game/ECS/SystemScheduler.h>
+#include <DX3D/Core/JobSystem.h>
+#include <DX3D/Core/Profiler.h>
+#include <cassert>
+#include <chrono>
+#include <algorithm>
 
 #include <Game/GameLogUtils.h>
 
 namespace ecs {
 	/**
 	 * @brief 
+	 * @param _storage Component̕ۑ
 	 */
-	void Coordinator::Init()
+	void Coordinator::Init(ComponentStorageType _storage)
 	{
 		entity_manager_ = std::make_unique<EntityManager>();
-		component_manager_ = std::make_unique<ComponentManager>();
+		component_manager_ = std::make_unique<ComponentManager>(_storage);
 		system_manager_ = std::make_unique<SystemManager>();
+		query_manager_ = std::make_unique<QueryManager>();
+
+		command_buffers_.clear();
+		command_buffers_.push_back(std::make_unique<CommandBuffer>());
 	}
 
 	/**
@@ -48,6 +60,7 @@ namespace ecs {
 
 		component_manager_->EntityDestroyed(_e);
 		system_manager_->EntityDestroyed(_e);
+		query_manager_->EntityDestroyed(_e);
 		entity_manager_->Destroy(_e);
 
 		if (on_entity_destroyed_) {
@@ -65,24 +78,13 @@ namespace ecs {
 		return entity_manager_->GetAllEntities();
 	}
 
-	//! @brief Component̒ǉNGXg
-	void Coordinator::RequestAddComponentRaw(Entity _e, ComponentType _type, std::function<void()> _apply)
-	{
-		pending_adds_.push_back(
-			PendingAdd{
-			.e = _e,
-			.type = _type,
-			.apply = std::move(_apply)
-			});
-	}
-
 	/**
 	 * @brief Entity̔jNGXg
 	 * @param _e
 	 */
 	void Coordinator::RequestDestroyEntity(Entity _e)
 	{
-		pending_destroys_.push_back(_e);
+		GetCommandBuffer().DestroyEntity(MakeCommandKey(), _e);
 	}
 
 	//! @brief EntityLǂmF
@@ -107,6 +109,7 @@ namespace ecs {
 		sig.set(_type, true);
 		entity_manager_->SetSignature(_e, sig);
 		system_manager_->EntitySignatureChanged(_e, sig);
+		query_manager_->EntitySignatureChanged(_e, sig);
 	}
 
 	/**
@@ -124,6 +127,109 @@ namespace ecs {
 		sig.set(_type, false);
 		entity_manager_->SetSignature(_e, sig);
 		system_manager_->EntitySignatureChanged(_e, sig);
+		query_manager_->EntitySignatureChanged(_e, sig);
+	}
+
+	/**
+	 * @brief [h̃XibvVbgۑ
+	 * @param _name XibvVbg
+	 * @return : true, s: false
+	 */
+	bool Coordinator::CaptureSnapshot(const std::string& _name)
+	{
+		if (component_manager_->GetStorageType() != ComponentStorageType::SparseSet) {
+			GameLogError("[ECS:Coordinator] Archetype̓XibvVbgΉ");
+			return false;
+		}
+		DX3D_PROFILE_SCOPE("CaptureSnapshot");
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		auto snapshot = std::make_unique<WorldSnapshot>();
+		snapshot->entities = *entity_manager_;
+		component_manager_->CaptureSnapshot(snapshot->components);
+
+		snapshot->entityCount = static_cast<uint32_t>(entity_manager_->GetAllEntities().size());
+		snapshot->byteSize = entity_manager_->GetByteSize();
+		for (const auto& component : snapshot->components) {
+			if (component) { snapshot->byteSize += component->GetByteSize(); }
+		}
+		snapshot->captureMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		GameLogFInfo("[ECS:Coordinator] XibvVbg '{}' ۑ: Entity {} / {} KB / {:.3f} ms",
+			_name, snapshot->entityCount, snapshot->byteSize / 1024, snapshot->captureMs);
+		snapshots_[_name] = std::move(snapshot);
+		return true;
+	}
+
+	/**
+	 * @brief [hXibvVbgɖ߂
+	 * @param _name XibvVbg
+	 * @return : true, s: false
+	 */
+	bool Coordinator::RestoreSnapshot(const std::string& _name)
+	{
+		auto it = snapshots_.find(_name);
+		if (it == snapshots_.end()) {
+			GameLogFError("[ECS:Coordinator] XibvVbg '{}' ݂Ȃ", _name);
+			return false;
+		}
+		DX3D_PROFILE_SCOPE("RestoreSnapshot");
+		const auto start = std::chrono::high_resolution_clock::now();
+		auto& snapshot = *it->second;
+
+		// ۗ̕ύX͍̃[hɑ΂ċL^ꂽ̂Ȃ̂Ŏ̂Ă
+		for (auto& buffer : command_buffers_) {
+			buffer->Clear();
+		}
+
+		// XibvVbgɖEntity͔jꂽƂɂ(System̃LbV / V[̈ꗗ̑|)
+		for (auto e : entity_manager_->GetAllEntities()) {
+			if (snapshot.entities.IsValid(e)) { continue; }
+			system_manager_->EntityDestroyed(e);
+			query_manager_->EntityDestroyed(e);
+			if (on_entity_destroyed_) {
+				on_entity_destroyed_(e);
+			}
+		}
+
+		// ւ
+		*entity_manager_ = snapshot.entities;
+		component_manager_->RestoreSnapshot(snapshot.components);
+
+		// System̏ΏۂƃNGSignature蒼
+		const auto entities = entity_manager_->GetAllEntities();
+		system_manager_->RebuildEntities(entities, *entity_manager_);
+		query_manager_->Rebuild(entities, *entity_manager_);
+
+		snapshot.lastRestoreMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		GameLogFInfo("[ECS:Coordinator] XibvVbg '{}' ɖ߂܂: Entity {} / {:.3f} ms",
+			_name, snapshot.entityCount, snapshot.lastRestoreMs);
+		return true;
+	}
+
+	/**
+	 * @brief ۑĂXibvVbg̈ꗗ
+	 * @return Öꗗ
+	 */
+	std::vector<WorldSnapshotInfo> Coordinator::GetSnapshotInfos() const
+	{
+		std::vector<WorldSnapshotInfo> infos;
+		infos.reserve(snapshots_.size());
+		for (const auto& [name, snapshot] : snapshots_) {
+			WorldSnapshotInfo info{
+				.name = name,
+				.entityCount = snapshot->entityCount,
+				.byteSize = snapshot->byteSize,
+				.captureMs = snapshot->captureMs,
+				.lastRestoreMs = snapshot->lastRestoreMs,
+			};
+			for (const auto& component : snapshot->components) {
+				if (component) { info.componentCount += static_cast<uint32_t>(component->GetCount()); }
+			}
+			infos.push_back(std::move(info));
+		}
+		std::sort(infos.begin(), infos.end(), [](const auto& _a, const auto& _b) { return _a.name < _b.name; });
+		return infos;
 	}
 
 	void Coordinator::ReactivateAllSystems()
@@ -131,6 +237,22 @@ namespace ecs {
 		system_manager_->ReactivateAllSystems();
 	}
 
+	//! @brief SystemXPW[̎擾
+	SystemScheduler& Coordinator::GetSystemScheduler()
+	{
+		return system_manager_->GetScheduler();
+	}
+
+	//! @brief sɎgJobSystem̐ݒ
+	void Coordinator::SetJobSystem(dx3d::JobSystem* _jobSystem)
+	{
+		const uint32_t threadCount = _jobSystem ? _jobSystem->GetThreadCount() : 1;
+		while (command_buffers_.size() < threadCount) {
+			command_buffers_.push_back(std::make_unique<CommandBuffer>());
+		}
+		system_manager_->GetScheduler().SetJobSystem(_jobSystem);
+	}
+
 	const std::vector<std::shared_ptr<ISystem>>& Coordinator::GetAllSystems()
 	{
 		return system_manager_->GetAllSystemsInOrder();
@@ -152,9 +274,9 @@ namespace ecs {
 	*/
 	void Coordinator::FixedUpdateAllSystems(float _fixedDt)
 	{
-		for (auto& system : system_manager_->GetAllSystemsInOrder()) {
-			system->FixedUpdate(_fixedDt);
-		}
+		++command_batch_;
+		system_manager_->FixedUpdateAllSystems(_fixedDt);
+		++command_batch_;
 	}
 
 	/**
@@ -163,43 +285,91 @@ namespace ecs {
 	 */
 	void Coordinator::UpdateAllSystems(float _dt)
 	{
+		++command_batch_;
 		system_manager_->UpdateAllSystems(_dt);
+		++command_batch_;
 	}
 
-	//! @brief ۗ̕ύX𔽉f
+	/**
+	 * @brief ۗ̕ύX𔽉f
+	 *	SXbh̃R}hobt@܂Ƃ߂āAL^ɈxŔf
+	 */
 	void Coordinator::FlushPending()
 	{
-		// ComponentǉNGXg̔f
-		for (auto& add : pending_adds_) {
-			add.apply();
+		DX3D_PROFILE_SCOPE("FlushPending");
+		CommandBuffer::Merge(command_buffers_, merged_commands_);
+		for (auto* command : merged_commands_) {
+			ExecuteCommand(*command);
 		}
-		pending_adds_.clear();
-		// Component폜NGXg̔f
-		for (auto& remove : pending_removes_) {
-			RemoveComponent(remove.e, remove.type);
+		merged_commands_.clear();
+
+		for (auto& buffer : command_buffers_) {
+			buffer->Clear();
 		}
-		pending_removes_.clear();
-		// EntityjNGXg̔f
-		for (auto& e : pending_destroys_) {
-			DestroyEntity(e);
+	}
+
+	/**
+	 * @brief R}hf
+	 *	ɔjꂽEntityւ̒ǉ / 폜͔΂
+	 * @param _command fR}h
+	 */
+	void Coordinator::ExecuteCommand(const Command& _command)
+	{
+		switch (_command.type) {
+		case CommandType::AddComponent:
+			if (!entity_manager_->IsValid(_command.e)) { return; }
+			AddComponentRaw(_command.e, _command.component, _command.payload);
+			break;
+		case CommandType::RemoveComponent:
+			if (!entity_manager_->IsValid(_command.e)) { return; }
+			RemoveComponent(_command.e, _command.component);
+			break;
+		case CommandType::DestroyEntity:
+			DestroyEntity(_command.e);
+			break;
+		default:
+			break;
 		}
-		pending_destroys_.clear();
+	}
+
+	/**
+	 * @brief ̃Xbh̃R}hobt@
+	 *	[J[ȊO0Ԃg
+	 * @return R}hobt@
+	 */
+	CommandBuffer& Coordinator::GetCommandBuffer()
+	{
+		const uint32_t index = dx3d::JobSystem::GetCurrentThreadIndex();
+		assert(index < command_buffers_.size() && "SetJobSystemœnĂȂJobSystem̃[J[Ă΂ꂽ");
+		return *command_buffers_[index];
+	}
+
+	//! @brief L^R}h̃L[
+	CommandKey Coordinator::MakeCommandKey() const
+	{
+		return CommandKey{ command_batch_, CommandBuffer::GetCurrentSystem() };
 	}
 
 	/**
 	 * @brief w肵SignatureĂEntitÿꗗ擾
 	 *	GetEntitiesWithComponentsĂяo`Ǝv
+	 *	g̓NG̃Rs[Ȃ̂ŁAt[ĂԂȂGetQueryg
 	 * @param _signature w肷Signature
 	 * @return EntityVector^Xg
 	 */
 	std::vector<Entity> Coordinator::GetEntitiesWithSignature(Signature _signature)
 	{
-		std::vector<Entity> result;
-		for (auto& e : entity_manager_->GetAllEntities()) {
-			if ((entity_manager_->GetSignature(e) & _signature) == _signature) {
-				result.push_back(e);	// ĂȂǉ
-			}
+		// Signature͑SEntityΏ
+		if (_signature.none()) {
+			return entity_manager_->GetAllEntities();
 		}
-		return result;
+		const auto view = GetQuery(_signature).View();
+		return std::vector<Entity>(view.begin(), view.end());
+	}
+
+	//! @brief w肵SignaturẽLbVꂽNG擾
+	const Query& Coordinator::GetQuery(const Signature& _signature)
+	{
+		return query_manager_->GetOrCreate(_signature, *entity_manager_);
 	}
 }
\ No newline at end of file
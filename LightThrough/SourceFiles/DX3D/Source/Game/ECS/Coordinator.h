@@ -9,10 +9,16 @@
  // ---------- CN[h ---------- //
 #include <vector>
 #include <memory>
+#include <string>
 #include <functional>
+#include <unordered_map>
 #include <DX3D/Core/Common.h>
 #include <Game/ECS/ECSUtils.h>
 #include <Game/ECS/ISystem.h>
+#include <Game/ECS/Query.h>
+#include <Game/ECS/SystemAccess.h>
+#include <Game/ECS/CommandBuffer.h>
+#include <Game/ECS/WorldSnapshot.h>
 
 namespace ecs {
 	// ---------- O錾 ---------- // 
@@ -20,6 +26,8 @@ namespace ecs {
 	class EntityManager;
 	class ComponentManager;
 	class SystemManager;
+	class QueryManager;
+	class SystemScheduler;
 
 	/**
 	 * @brief ECSR[fBl[^
@@ -30,7 +38,11 @@ namespace ecs {
 	public:
 		Coordinator(const dx3d::BaseDesc& _desc) : Base(_desc) {}
 
-		void Init();
+		/**
+		 * @brief 
+		 * @param _storage Component̕ۑ
+		 */
+		void Init(ComponentStorageType _storage = ComponentStorageType::SparseSet);
 
 		// ---------- Entity֘A ---------- //
 		/**
@@ -64,6 +76,7 @@ namespace ecs {
 		std::vector<Entity> GetEntitiesWithComponents();
 		/**
 		 * @brief Entity̔jNGXg
+		 *	[J[XbhœSystemĂׂ
 		 * @param _e: jEntity
 		 */
 		void RequestDestroyEntity(Entity _e);
@@ -75,6 +88,22 @@ namespace ecs {
 		 */
 		std::vector<Entity> GetEntitiesWithSignature(Signature _signature); // w肵SignatureĂEntitÿꗗ擾
 
+		/**
+		 * @brief w肵SignaturẽLbVꂽNG擾
+		 *	񂾂Entity𑖍Aȍ~Signature̕ωōXV
+		 *	ԂQƂCoordinatorĂԂ͗L
+		 * @param _signature: w肷Signature
+		 * @return NG
+		 */
+		const Query& GetQuery(const Signature& _signature);
+		/**
+		 * @brief ̃R|[lgĂEntitỹNG擾
+		 * @tparam ...Coms : R|[lǧ^Xg
+		 * @return NG
+		 */
+		template<typename... Coms>
+		const Query& GetQuery();
+
 		/**
 		 * @brief EntityLǂmF
 		 * @param _e : mFEntity
@@ -89,6 +118,16 @@ namespace ecs {
 		template<typename Com>
 		Com* AddComponent(Entity _e, const Com& _component);	// Component̒ǉ
 		void AddComponentRaw(Entity _e, ComponentType _type, const void* _data);
+		/**
+		 * @brief Component܂Ƃ߂ĒǉiNbNς݃V[̓ǂݍݗpj
+		 *	ComponentXgɂ͈xɎʂASignature̍XVƒʒmEntityƂɍs
+		 *	Systemsɂ͌Ă΂ȂƁiRequestngj
+		 * @param _entities ǉEntity
+		 * @param _data ǉComponent̕(Com[_count])
+		 * @param _count 
+		 */
+		template<typename Com>
+		void AddComponentBlock(const Entity* _entities, const void* _data, uint32_t _count);
 
 		template<typename Com>
 		void RemoveComponent(Entity _e);	// Component̍폜
@@ -107,28 +146,88 @@ namespace ecs {
 		template<typename Com>
 		ComponentType GetComponentType();	// ComponentType擾
 
+		/**
+		 * @brief w肵ComponentׂĎEntity𑖍
+		 *	ArchetypeȂ`N`ɑ
+		 *	ɍ\ύX(ǉ / 폜 / j)͂ȂƁiRequestngj
+		 * @tparam ...Coms : R|[lǧ^Xg
+		 * @param _func (Entity, Coms&...)
+		 */
+		template<typename... Coms, typename Func>
+		void ForEach(Func&& _func);
+
 		/**
 		 * @brief R|[lg̒ǉNGXg
+		 *	g͍̃Xbh̃R}hobt@ɃRs[AFlushPendingŔf
+		 *	[J[XbhœSystemĂׂ
 		 * @param _e ΏۂEntity
-		 * @param _type ǉComponentType
-		 * @param _apply ǉ
+		 * @param _component ǉComponent
 		 */
-		void RequestAddComponentRaw(Entity _e, ComponentType _type, std::function<void()> _apply);
 		template<typename Com>
 		void RequestAddComponent(Entity _e, const Com& _component);
 		template<typename Com>
 		void RequestRemoveComponent(Entity _e);	// Component̍폜NGXg
 
 
+		// ---------- XibvVbg֘A ---------- //
+		/**
+		 * @brief [h̃XibvVbgۑ
+		 *	EntityManagerƑSComponentXgۂƃRs[(SparseSet̂)
+		 *	OΏ㏑Bۗ̕ύX͊܂܂Ȃ̂ŁAFlushPendinǧɌĂ
+		 * @param _name XibvVbg
+		 * @return : true, s: false
+		 */
+		bool CaptureSnapshot(const std::string& _name);
+		/**
+		 * @brief [hXibvVbgɖ߂
+		 *	XibvVbgɖEntity͔jŒʒmASystem̏ΏۂƃNG͍蒼
+		 *	ۗ̕ύX͎̂ĂBSystem̎sɂ͌Ă΂Ȃ
+		 * @param _name XibvVbg
+		 * @return : true, s: false
+		 */
+		bool RestoreSnapshot(const std::string& _name);
+		bool HasSnapshot(const std::string& _name) const { return snapshots_.contains(_name); }
+		void DeleteSnapshot(const std::string& _name) { snapshots_.erase(_name); }
+		std::vector<WorldSnapshotInfo> GetSnapshotInfos() const;	// ۑĂXibvVbg̈ꗗ(O)
+		/**
+		 * @brief XibvVbg߂ɌĂԏ̐ݒ
+		 *	Rs[ł͎gȂg(|C^ / LbV)Componentp
+		 * @param _hook (Entity, Com&)
+		 */
+		template<typename Com>
+		void SetSnapshotRestoreHook(std::function<void(Entity, Com&)> _hook);
+
+
 		// ---------- System֘A ---------- //
+		/**
+		 * @brief System̓o^
+		 * @param _desc System̐
+		 * @param _access ǂݏComponent / L\[X̐錾iȗƕɓȂj
+		 */
 		template<typename Sys>
-		void RegisterSystem(const SystemDesc& _desc);		// System̓o^
+		void RegisterSystem(const SystemDesc& _desc, const SystemAccess& _access = SystemAccess::Exclusive());
 		template<typename Sys>
 		void SetSystemSignature(Signature& _signature);	// SystemSignatureݒ
 		template<typename Sys>
 		std::shared_ptr<Sys> GetSystem();	// System̎擾
 		void ReactivateAllSystems(); // o^ꂽSystemׂčăANeBu
 
+		/**
+		 * @brief Componenť^XgSignature
+		 * @tparam ...Coms : R|[lǧ^Xg
+		 * @return Signature
+		 */
+		template<typename... Coms>
+		Signature MakeSignature();
+
+		SystemScheduler& GetSystemScheduler();	// SystemXPW[̎擾
+		/**
+		 * @brief sɎgJobSystem̐ݒ
+		 *	XbhƂ̃R}hobt@ŗpӂ̂ŁA[J[RequestOɌĂ
+		 * @param _jobSystem JobSystem
+		 */
+		void SetJobSystem(dx3d::JobSystem* _jobSystem);
+
 		const std::vector<std::shared_ptr<ISystem>>& GetAllSystems();
 
 
@@ -136,7 +235,7 @@ namespace ecs {
 		void InitAllSystems();	// o^ꂽSystem̏
 		void FixedUpdateAllSystems(float _fixedDt); // o^ꂽSystem̌ŒXV
 		void UpdateAllSystems(float _dt);	// o^ꂽSystem̍XV
-		void FlushPending(); // ۗ̕ύX𔽉f
+		void FlushPending(); // ۗ̕ύXL^ɔfiSystem̎sɂ͌Ă΂Ȃj
 
 
 
@@ -145,33 +244,23 @@ namespace ecs {
 		void SetOnEntityDestroyedCallback(OnEntityDestroyed _callback) {on_entity_destroyed_ = std::move(_callback); }
 
 	private:
-		/**
-		 * @brief ۗ̒ǉ
-		 */
-		struct PendingAdd {
-			Entity e;
-			ComponentType type;
-			std::function<void()> apply;
-		};
-
-		/**
-		 * @brief ۗ̍폜
-		 */
-		struct PendingRemove {
-			Entity e;
-			ComponentType type;
-		};
+		CommandBuffer& GetCommandBuffer();	// ̃Xbh̃R}hobt@
+		CommandKey MakeCommandKey() const;	// L^R}h̃L[
+		void ExecuteCommand(const Command& _command);	// R}hf
 
 		std::unique_ptr<EntityManager> entity_manager_{};		// Entity}l[W
 		std::unique_ptr<ComponentManager> component_manager_{};	// Component}l[W
 		std::unique_ptr<SystemManager> system_manager_{};		// System}l[W
+		std::unique_ptr<QueryManager> query_manager_{};			// NG}l[W
 
-		std::vector<PendingAdd> pending_adds_{};		// ۗ̒ǉ
-		std::vector<PendingRemove> pending_removes_{};	// ۗ̍폜
-		std::vector<Entity> pending_destroys_{};		// ۗ̔j
+		std::vector<std::unique_ptr<CommandBuffer>> command_buffers_{};	// ۗ̕ύX [0]: [J[ȊO, [1 ~]: [J[
+		std::vector<const Command*> merged_commands_{};	// f鏇ɕׂR}hig񂵁j
+		uint32_t command_batch_ = 0;	// System̈ꊇs̑OŐi
 
 		OnEntityDestroyed on_entity_destroyed_{};	// Entityj̃R[obN
 
+		std::unordered_map<std::string, std::unique_ptr<WorldSnapshot>> snapshots_{};	// O -> XibvVbg
+
 	};
 }
 
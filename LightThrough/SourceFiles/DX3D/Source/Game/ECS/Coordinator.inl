@@ -8,12 +8,15 @@
 
 
 // ---------- CN[h ---------- // 
+#include <cassert>
 #include <Game/ECS/Coordinator.h>
 #include <Game/ECS/ECSUtils.h>
 #include <Game/ECS/EntityManager.h>
 #include <Game/ECS/ComponentManager.h>
 #include <Game/ECS/SystemManager.h>
+#include <Game/ECS/QueryManager.h>
 #include <Game/Serialization/ComponentReflection.h>
+#include <Game/Serialization/ComponentBinary.h>
 
 namespace ecs {
 	/**
@@ -44,6 +47,31 @@ namespace ecs {
 
 		return GetComponent<Com>(_e);
 	}
+
+	/**
+	 * @brief Component܂Ƃ߂Ēǉ
+	 * @param <Com> ǉComponent̎
+	 * @param _entities ǉEntity
+	 * @param _data ǉComponent̕(Com[_count])
+	 * @param _count 
+	 */
+	template<typename Com>
+	void Coordinator::AddComponentBlock(const Entity* _entities, const void* _data, uint32_t _count)
+	{
+		assert(CommandBuffer::GetCurrentSystem() == 0 && "SystemsRequestAddComponentg");
+		const ComponentType type = component_manager_->GetComponentType<Com>();
+		// ǉ
+		component_manager_->AddComponentBlock<Com>(_entities, _data, _count);
+
+		// Signature̍XV
+		for (uint32_t i = 0; i < _count; ++i) {
+			auto sig = entity_manager_->GetSignature(_entities[i]);
+			sig.set(type, true);
+			entity_manager_->SetSignature(_entities[i], sig);
+			system_manager_->EntitySignatureChanged(_entities[i], sig);
+			query_manager_->EntitySignatureChanged(_entities[i], sig);
+		}
+	}
 	 
 
 	/**
@@ -59,6 +87,17 @@ namespace ecs {
 		RemoveComponent(_e, type);
 	}
 
+	/**
+	 * @brief XibvVbg߂ɌĂԏ̐ݒ
+	 * @param <Com> ΏۂComponent̎
+	 * @param _hook (Entity, Com&)
+	 */
+	template<typename Com>
+	void Coordinator::SetSnapshotRestoreHook(std::function<void(Entity, Com&)> _hook)
+	{
+		component_manager_->SetSnapshotRestoreHook<Com>(std::move(_hook));
+	}
+
 	/**
 	 * @brief EntityComponent擾
 	 * @param <Com> 擾Component̎
@@ -79,14 +118,7 @@ namespace ecs {
 	template<typename Com>
 	inline std::vector<Entity> Coordinator::GetEntitiesWithComponent()
 	{
-		std::vector<Entity> result;
-		for (const auto& e : entity_manager_->GetAllEntities()) {
-			if (component_manager_->HasComponent<Com>(e)) {
-				result.push_back(e);	// ĂȂǉ
-			}
-		}
-
-		return result;
+		return GetEntitiesWithComponents<Com>();
 	}
 
 
@@ -104,6 +136,19 @@ namespace ecs {
 		return GetEntitiesWithSignature(sig);
 	}
 
+	/**
+	 * @brief w肳ꂽComponentĂEntitỹNG擾
+	 * @param <...Coms> w肷镡Component
+	 * @return NG
+	 */
+	template<typename ...Coms>
+	inline const Query& Coordinator::GetQuery()
+	{
+		Signature sig;
+		(sig.set(component_manager_->GetComponentType<Coms>()), ...);
+		return GetQuery(sig);
+	}
+
 	/**
 	 * @brief EntityComponentĂ邩mF
 	 * @param <Com> mFComponent̎
@@ -129,14 +174,36 @@ namespace ecs {
 		return component_manager_->GetComponentType<Com>();
 	}
 
+	/**
+	 * @brief w肵ComponentׂĎEntity𑖍
+	 * @param <...Coms> Component̎
+	 * @param _func (Entity, Coms&...)
+	 */
+	template<typename ...Coms, typename Func>
+	void Coordinator::ForEach(Func&& _func)
+	{
+		if (auto* world = component_manager_->GetArchetypeWorld()) {
+			const std::array<ComponentType, sizeof...(Coms)> types{ component_manager_->GetComponentType<Coms>()... };
+			world->ForEach<Coms...>(types, std::forward<Func>(_func));
+			return;
+		}
+
+		for (auto& e : GetEntitiesWithComponents<Coms...>()) {
+			_func(e, *component_manager_->GetComponent<Coms>(e)...);
+		}
+	}
 
+	/**
+	 * @brief EntityComponent̒ǉNGXgo
+	 * @param <Com> ǉComponent̎
+	 * @param _e ǉEntity
+	 * @param _component ǉComponent
+	 */
 	template<typename Com>
 	inline void Coordinator::RequestAddComponent(Entity _e, const Com& _component)
 	{
 		const ComponentType type = GetComponentType<Com>();
-		RequestAddComponentRaw(_e, type, [this, _e, _component]() mutable {
-			AddComponent<Com>(_e, _component);
-			});
+		GetCommandBuffer().AddComponent(MakeCommandKey(), _e, type, _component);
 	}
 
 	/**
@@ -148,7 +215,7 @@ namespace ecs {
 	inline void Coordinator::RequestRemoveComponent(Entity _e)
 	{
 		auto componentType = component_manager_->GetComponentType<Com>();
-		pending_removes_.push_back({ _e, componentType });
+		GetCommandBuffer().RemoveComponent(MakeCommandKey(), _e, componentType);
 	}
 
 	/**
@@ -156,9 +223,22 @@ namespace ecs {
 	 * @param <Sys> o^System̎
 	 */
 	template<typename Sys>
-	void Coordinator::RegisterSystem(const SystemDesc& _desc)
+	void Coordinator::RegisterSystem(const SystemDesc& _desc, const SystemAccess& _access)
 	{
-		system_manager_->RegisterSystem<Sys>(_desc);
+		system_manager_->RegisterSystem<Sys>(_desc, _access);
+	}
+
+	/**
+	 * @brief Componenť^XgSignature
+	 * @param <...Coms> Component̎
+	 * @return Signature
+	 */
+	template<typename ...Coms>
+	Signature Coordinator::MakeSignature()
+	{
+		Signature sig;
+		(sig.set(component_manager_->GetComponentType<Coms>()), ...);
+		return sig;
 	}
 
 
@@ -115,6 +115,18 @@ namespace ecs {
 		return result;
 	}
 
+	/**
+	 * @brief ǗĂz̃oCg
+	 * @return oCg
+	 */
+	std::size_t EntityManager::GetByteSize() const
+	{
+		return versions_.size() * sizeof(uint32_t)
+			+ free_index_.size() * sizeof(uint32_t)
+			+ alive_.size() * sizeof(uint8_t)
+			+ signatures_.size() * sizeof(Signature);
+	}
+
 	/**
 	 * @brief EntitySignatureݒ
 	 * @param _entity ΏۂEntity
@@ -33,6 +33,9 @@ namespace ecs {
 
 		std::vector<Entity> GetAllEntities();	// o^ĂSĂEntity擾
 		std::size_t RegisterEntityCount() const { return versions_.size(); }	// o^ĂEntity̐擾
+		std::size_t GetByteSize() const;	// ǗĂz̃oCgiXibvVbg̑傫̕񍐗pj
+
+		// memo: g͑SĒlȂ̂ŁARs[ł̂܂܃XibvVbg / Ɏg
 
 	private:
 		void EnsureCapacityForIndex(uint32_t _index);	// w肵Index̂߂ɕKvȗeʂmۂ
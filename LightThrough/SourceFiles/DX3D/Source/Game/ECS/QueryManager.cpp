@@ -0,0 +1,77 @@
+/**
+ * @file QueryManager.cpp
+ * @brief LbVꂽNGǗNX
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/ECS/QueryManager.h>
+#include <Game/ECS/EntityManager.h>
+
+namespace ecs {
+	/**
+	 * @brief NG̎擾i΍쐬j
+	 *	쐬Entity𑖍Ĉꗗ𖄂߂
+	 *	ɓSystemUpdateĂ΂ĂȂ悤AT烍bN
+	 * @param _signature NGSignature
+	 * @param _entityManager Entity̎擾
+	 * @return NG
+	 */
+	const Query& QueryManager::GetOrCreate(const Signature& _signature, EntityManager& _entityManager)
+	{
+		std::lock_guard lock(mutex_);
+		auto it = queries_.find(_signature);
+		if (it != queries_.end()) {
+			return *it->second;
+		}
+
+		auto query = std::make_unique<Query>(_signature);
+		for (auto& e : _entityManager.GetAllEntities()) {
+			query->EntitySignatureChanged(e, _entityManager.GetSignature(e));
+		}
+
+		Query* ptr = query.get();
+		queries_.emplace(_signature, std::move(query));
+		query_list_.push_back(ptr);
+		return *ptr;
+	}
+
+	/**
+	 * @brief EntitySignatureςɌĂяo
+	 * @param _e ΏۂEntity
+	 * @param _signature ύXSignature
+	 */
+	void QueryManager::EntitySignatureChanged(Entity _e, const Signature& _signature)
+	{
+		for (auto* query : query_list_) {
+			query->EntitySignatureChanged(_e, _signature);
+		}
+	}
+
+	/**
+	 * @brief SNG蒼
+	 * @param _entities LȑSEntity(Entity̏)
+	 * @param _entityManager Signature̎QƐ
+	 */
+	void QueryManager::Rebuild(const std::vector<Entity>& _entities, const EntityManager& _entityManager)
+	{
+		for (auto* query : query_list_) {
+			query->Clear();
+			for (auto e : _entities) {
+				query->EntitySignatureChanged(e, _entityManager.GetSignature(e));
+			}
+		}
+	}
+
+	/**
+	 * @brief EntityjꂽɌĂяo
+	 * @param _e jꂽEntity
+	 */
+	void QueryManager::EntityDestroyed(Entity _e)
+	{
+		for (auto* query : query_list_) {
+			query->EntityDestroyed(_e);
+		}
+	}
+}
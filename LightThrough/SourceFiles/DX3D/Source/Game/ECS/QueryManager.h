@@ -0,0 +1,48 @@
+#pragma once
+/**
+ * @file QueryManager.h
+ * @brief LbVꂽNGǗNX
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <Game/ECS/Entity.h>
+#include <Game/ECS/ECSUtils.h>
+#include <Game/ECS/Query.h>
+
+namespace ecs {
+	// ---------- O錾 ---------- //
+	class EntityManager;
+
+	/**
+	 * @brief NG}l[W
+	 *
+	 * SignatureƂɃNGAEntitySignature̕ωSNGɓ`B
+	 * NG͔jȂ̂ŁA擾QƂ͕ێĂ悢B
+	 * System͕ɓ̂ŁAGetOrCreate̓bNB
+	 * Signature̕ω̒ʒmSystem̎s̊O(\ύX̔f)łNȂ̂ŁAbNȂB
+	 */
+	class QueryManager final {
+	public:
+		const Query& GetOrCreate(const Signature& _signature, EntityManager& _entityManager);	// NG̎擾i΍쐬j
+
+		void EntitySignatureChanged(Entity _e, const Signature& _signature);	// EntitySignatureςɌĂяo
+		void EntityDestroyed(Entity _e);	// EntityjꂽɌĂяo
+		/**
+		 * @brief SNG蒼([hۂƍւp)
+		 * @param _entities LȑSEntity(Entity̏)
+		 * @param _entityManager Signature̎QƐ
+		 */
+		void Rebuild(const std::vector<Entity>& _entities, const EntityManager& _entityManager);
+
+	private:
+		std::unordered_map<Signature, std::unique_ptr<Query>> queries_{};	// Signature -> NG
+		std::vector<Query*> query_list_{};	// ʒmp
+		std::mutex mutex_{};	// GetOrCreatep(ɓSystemĂ΂)
+	};
+}
@@ -10,6 +10,7 @@
 #include <Game/ECS/Entity.h>
 #include <Game/ECS/ECSUtils.h>
 #include <Game/ECS/ISystem.h>
+#include <Game/ECS/EntityManager.h>
 
 
 namespace ecs {
@@ -31,9 +32,21 @@ namespace ecs {
 	//! @brief SẴVXeXV
 	void SystemManager::UpdateAllSystems(float _dt)
 	{
-		for(auto system : systems_in_order_) {
-			system->Update(_dt);
+		if (schedule_dirty_) {
+			scheduler_.Build(systems_in_order_, access_in_order_);
+			schedule_dirty_ = false;
 		}
+		scheduler_.Run(SystemScheduler::Phase::Update, _dt);
+	}
+
+	//! @brief SẴVXeŒXV
+	void SystemManager::FixedUpdateAllSystems(float _fixedDt)
+	{
+		if (schedule_dirty_) {
+			scheduler_.Build(systems_in_order_, access_in_order_);
+			schedule_dirty_ = false;
+		}
+		scheduler_.Run(SystemScheduler::Phase::FixedUpdate, _fixedDt);
 	}
 
 	//! @brief o^ꂽSystemׂčăANeBu
@@ -62,6 +75,26 @@ namespace ecs {
 		}
 	}
 
+	/**
+	 * @brief SSystem̏Ώۂ蒼
+	 * @param _entities LȑSEntity(Entity̏)
+	 * @param _entityManager Signature̎QƐ
+	 */
+	void SystemManager::RebuildEntities(const std::vector<Entity>& _entities, const EntityManager& _entityManager)
+	{
+		for (auto const& pair : systems_) {
+			auto const& sysSig = signature_[pair.first];
+			auto& entities = pair.second->entities_;
+			entities.clear();
+			for (auto e : _entities) {
+				const auto sig = _entityManager.GetSignature(e);
+				if ((sig & sysSig) == sysSig) {
+					entities.insert(entities.end(), e);	// Entity̏ɗ̂Ŗɑ
+				}
+			}
+		}
+	}
+
 	//! GeBeBjꂽƂ̏
 	void SystemManager::EntityDestroyed(Entity _e)
 	{
@@ -13,21 +13,25 @@
 #include <cassert>
 #include <DX3D/Core/Common.h>
 #include <Game/ECS/ECSUtils.h>
+#include <Game/ECS/SystemAccess.h>
+#include <Game/ECS/SystemScheduler.h>
 namespace ecs {
 	// ---------- O錾 ---------- //
 	class Coordinator;
 	class ISystem;
+	class EntityManager;
 	struct Entity;
 
 	/**
 	 * @brief VXe}l[W
 	 *
 	 * VXe̓o^AǗVXeɕKvȃR|[lg̊ǗB
+	 * XVSystemSchedulerɔCAANZX錾ȂSystem͕ɓB
 	 */
 	class SystemManager final{
 	public:
 		template<typename T>
-		std::shared_ptr<T> RegisterSystem(const SystemDesc& _desc);
+		std::shared_ptr<T> RegisterSystem(const SystemDesc& _desc, const SystemAccess& _access);
 		template<typename T> 
 		void SetSignature(Signature _signature);	// VXeSignatureݒ
 		template<typename T>
@@ -36,18 +40,31 @@ namespace ecs {
 		const std::vector<std::shared_ptr<ISystem>>& GetAllSystemsInOrder() const;
 
 		void UpdateAllSystems(float _dt);	// SẴVXeXV
+		void FixedUpdateAllSystems(float _fixedDt);	// SẴVXeŒXV
+
+		SystemScheduler& GetScheduler() { return scheduler_; }
 
 		void ReactivateAllSystems(); // o^ꂽSystemׂčăANeBu
 
 
 		void EntitySignatureChanged(Entity _e, Signature _eSignature);	// EntitySignatureςɌĂяo
 		void EntityDestroyed(Entity _e);	// EntityjꂽɌĂяo
+		/**
+		 * @brief SSystem̏Ώۂ蒼([hۂƍւp)
+		 * @param _entities LȑSEntity(Entity̏)
+		 * @param _entityManager Signature̎QƐ
+		 */
+		void RebuildEntities(const std::vector<Entity>& _entities, const EntityManager& _entityManager);
 
 
 	private:
 		std::unordered_map<std::type_index, Signature> signature_;
 		std::unordered_map<std::type_index, std::shared_ptr<ISystem>> systems_;
 		std::vector<std::shared_ptr<ISystem>> systems_in_order_; // XV
+		std::vector<SystemAccess> access_in_order_;	// systems_in_order_Ɠ̃ANZX錾
+
+		SystemScheduler scheduler_{};	// s̃XPW[
+		bool schedule_dirty_ = true;	// ˑOt̍蒼Kv
 	};
 }
 
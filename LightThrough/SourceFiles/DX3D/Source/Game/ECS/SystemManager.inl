@@ -15,7 +15,7 @@
 
 namespace ecs {
 	template<typename Sys>
-	std::shared_ptr<Sys> SystemManager::RegisterSystem(const SystemDesc& _desc)
+	std::shared_ptr<Sys> SystemManager::RegisterSystem(const SystemDesc& _desc, const SystemAccess& _access)
 	{
 		std::type_index type = typeid(Sys);
 		assert(systems_.find(type) == systems_.end());
@@ -23,6 +23,8 @@ namespace ecs {
 		auto system = std::make_shared<Sys>(_desc);
 		systems_[type] = system;
 		systems_in_order_.push_back(system);
+		access_in_order_.push_back(_access);
+		schedule_dirty_ = true;
 		return system;
 	}
 
@@ -38,8 +40,9 @@ namespace ecs {
 	template<typename Sys>
 	std::shared_ptr<Sys> SystemManager::GetSystem()
 	{
-		std::type_index type = typeid(Sys);
-		assert(systems_.find(type) != systems_.end());
-		return std::static_pointer_cast<Sys>(systems_[type]);
+		// memo: sɂĂ΂̂ŁAoperator[]ł͂Ȃfindœǂ
+		auto it = systems_.find(typeid(Sys));
+		assert(it != systems_.end());
+		return std::static_pointer_cast<Sys>(it->second);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,224 @@
+/**
+ * @file SystemScheduler.cpp
+ * @brief System̈ˑOtgŕɎsXPW[
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <Game/ECS/SystemScheduler.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <typeinfo>
+#include <DX3D/Core/JobSystem.h>
+#include <DX3D/Core/Profiler.h>
+#include <Game/ECS/ISystem.h>
+#include <Game/ECS/CommandBuffer.h>
+
+namespace ecs {
+	/**
+	 * @brief ˑOt̍\z
+	 *	o^őOɂāAANZXSystemӂ𒣂
+	 * @param _systems o^System
+	 * @param _access SystemƂ̃ANZX錾
+	 */
+	void SystemScheduler::Build(const std::vector<std::shared_ptr<ISystem>>& _systems, const std::vector<SystemAccess>& _access)
+	{
+		assert(_systems.size() == _access.size());
+
+		nodes_.clear();
+		nodes_.resize(_systems.size());
+		edge_count_ = 0;
+
+		for (uint32_t j = 0; j < nodes_.size(); ++j) {
+			nodes_[j].system = _systems[j].get();
+			// "class ecs::XxxSystem" -> "ecs::XxxSystem"(type_info͂̕ƐĂ)
+			const char* name = typeid(*nodes_[j].system).name();
+			if (std::strncmp(name, "class ", 6) == 0) { name += 6; }
+			nodes_[j].name = name;
+			for (uint32_t i = 0; i < j; ++i) {
+				if (!_access[i].ConflictsWith(_access[j])) { continue; }
+				nodes_[i].successors.push_back(j);
+				nodes_[j].predecessors.push_back(i);
+				++edge_count_;
+			}
+		}
+		remaining_ = std::make_unique<std::atomic<uint32_t>[]>(nodes_.size());
+	}
+
+	/**
+	 * @brief s
+	 * @param _phase stF[Y
+	 * @param _dt f^^C
+	 */
+	void SystemScheduler::Run(Phase _phase, float _dt)
+	{
+		current_phase_ = _phase;
+		current_dt_ = _dt;
+		frame_start_ = std::chrono::steady_clock::now();
+
+		if (!parallel_ || !job_system_ || job_system_->GetWorkerCount() == 0 || nodes_.size() < 2) {
+			RunSerial();
+		}
+		else {
+			RunParallel();
+		}
+
+		const double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame_start_).count();
+		ComputeStats(_phase, wallMs);
+
+		// [J[ŋNO̓CXbhœ
+		if (error_) {
+			auto error = error_;
+			error_ = nullptr;
+			std::rethrow_exception(error);
+		}
+	}
+
+	//! @brief ߂SystemƂ̎s
+	float SystemScheduler::GetLastSystemMs(size_t _index, Phase _phase) const
+	{
+		const auto p = static_cast<size_t>(_phase);
+		return static_cast<float>(nodes_[_index].endMs[p] - nodes_[_index].startMs[p]);
+	}
+
+	//! @brief ߂̍ŒoHɊ܂܂邩
+	bool SystemScheduler::IsOnCriticalPath(size_t _index, Phase _phase) const
+	{
+		return nodes_[_index].critical[static_cast<size_t>(_phase)];
+	}
+
+	/**
+	 * @brief o^ɂ̂܂܎s
+	 */
+	void SystemScheduler::RunSerial()
+	{
+		for (uint32_t i = 0; i < nodes_.size(); ++i) {
+			Execute(i);
+		}
+	}
+
+	/**
+	 * @brief ˑ̂JobSystemŎs
+	 *	CXbhWait̒Ŏ`
+	 */
+	void SystemScheduler::RunParallel()
+	{
+		for (uint32_t i = 0; i < nodes_.size(); ++i) {
+			remaining_[i].store(static_cast<uint32_t>(nodes_[i].predecessors.size()), std::memory_order_relaxed);
+		}
+
+		dx3d::JobCounter counter;
+		counter_ = &counter;
+		for (uint32_t i = 0; i < nodes_.size(); ++i) {
+			if (nodes_[i].predecessors.empty()) {
+				Submit(i);
+			}
+		}
+		job_system_->Wait(counter);
+		counter_ = nullptr;
+	}
+
+	/**
+	 * @brief WuƂĐς
+	 *	I㑱̈ˑ炵A0ɂȂ̂ςށB
+	 *	㑱ςł玩̃JE^炷̂ŁArWait邱Ƃ͂Ȃ
+	 * @param _index m[hIndex
+	 */
+	void SystemScheduler::Submit(uint32_t _index)
+	{
+		job_system_->Run([this, _index]() {
+			Execute(_index);
+			for (auto next : nodes_[_index].successors) {
+				if (remaining_[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					Submit(next);
+				}
+			}
+			}, counter_);
+	}
+
+	/**
+	 * @brief SystemsĎԂL^
+	 * @param _index m[hIndex
+	 */
+	void SystemScheduler::Execute(uint32_t _index)
+	{
+		auto& node = nodes_[_index];
+		const auto p = static_cast<size_t>(current_phase_);
+
+		// Requestn̋L^System̓o^ŕׂ悤
+		// (Wait̒ŕʂSystem`Ƃ̂ŁAO̒lɖ߂)
+		const uint32_t prevSystem = CommandBuffer::GetCurrentSystem();
+		CommandBuffer::SetCurrentSystem(_index + 1);
+		const auto start = std::chrono::steady_clock::now();
+		try {
+			dx3d::ProfileScope scope(node.name);
+			if (current_phase_ == Phase::FixedUpdate) {
+				node.system->FixedUpdate(current_dt_);
+			}
+			else {
+				node.system->Update(current_dt_);
+			}
+		}
+		catch (...) {
+			std::lock_guard lock(error_mutex_);
+			if (!error_) { error_ = std::current_exception(); }
+		}
+		const auto end = std::chrono::steady_clock::now();
+		CommandBuffer::SetCurrentSystem(prevSystem);
+
+		node.startMs[p] = std::chrono::duration<double, std::milli>(start - frame_start_).count();
+		node.endMs[p] = std::chrono::duration<double, std::milli>(end - frame_start_).count();
+	}
+
+	/**
+	 * @brief sʂ̏Wv
+	 *	ŒoH͓o^(=g|WJ)ɁuÕm[h̍Œ + ̎ԁvςݏグċ߂
+	 * @param _phase WvtF[Y
+	 * @param _wallMs ۂɂ
+	 */
+	void SystemScheduler::ComputeStats(Phase _phase, double _wallMs)
+	{
+		const auto p = static_cast<size_t>(_phase);
+		auto& stats = stats_[p];
+
+		std::vector<double> finish(nodes_.size(), 0.0);
+		std::vector<int32_t> prev(nodes_.size(), -1);
+		double work = 0.0;
+		double longest = 0.0;
+		int32_t last = -1;
+
+		for (uint32_t i = 0; i < nodes_.size(); ++i) {
+			auto& node = nodes_[i];
+			const double duration = node.endMs[p] - node.startMs[p];
+			work += duration;
+
+			double before = 0.0;
+			for (auto pred : node.predecessors) {
+				if (finish[pred] > before) {
+					before = finish[pred];
+					prev[i] = static_cast<int32_t>(pred);
+				}
+			}
+			finish[i] = before + duration;
+			node.critical[p] = false;
+			if (finish[i] > longest) {
+				longest = finish[i];
+				last = static_cast<int32_t>(i);
+			}
+		}
+
+		// ŒoHɈt
+		for (int32_t i = last; i >= 0; i = prev[i]) {
+			nodes_[i].critical[p] = true;
+		}
+
+		stats.wallMs = static_cast<float>(_wallMs);
+		stats.workMs = static_cast<float>(work);
+		stats.criticalPathMs = static_cast<float>(longest);
+		stats.systemCount = static_cast<uint32_t>(nodes_.size());
+		stats.edgeCount = edge_count_;
+		stats.workerCount = (parallel_ && job_system_) ? job_system_->GetWorkerCount() : 0;
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+/**
+ * @file SystemScheduler.h
+ * @brief System̈ˑOtgŕɎsXPW[
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <exception>
+#include <chrono>
+#include <Game/ECS/SystemAccess.h>
+
+namespace dx3d {
+	class JobSystem;
+	class JobCounter;
+}
+
+namespace ecs {
+	// ---------- O錾 ---------- //
+	class ISystem;
+
+	/**
+	 * @brief 1񕪂̎s
+	 */
+	struct SchedulerStats {
+		float wallMs = 0.0f;			// ۂɂ
+		float workMs = 0.0f;			// SSystem̎sԂ̍v
+		float criticalPathMs = 0.0f;	// ˑOt̍ŒoH(葬͂ȂȂ)
+		uint32_t systemCount = 0;
+		uint32_t edgeCount = 0;
+		uint32_t workerCount = 0;		// CXbh܂܂Ȃ[J[
+	};
+
+	/**
+	 * @brief SystemXPW[
+	 *
+	 * o^ƃANZX錾̋DAGg݁AˑSystemJobSystem̃[J[ŎsB
+	 * JobSystemԂ͓o^ɂ̂܂܎sB
+	 * ˑ̕ӂ́uo^őOɂASystemv炾̂ŁA̓m̏Ԃ͓o^̂܂܁B
+	 */
+	class SystemScheduler final {
+	public:
+		/**
+		 * @brief stF[Y
+		 */
+		enum class Phase : uint8_t {
+			Update,
+			FixedUpdate,
+		};
+
+		SystemScheduler() = default;
+
+		SystemScheduler(const SystemScheduler&) = delete;
+		SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+		void SetJobSystem(dx3d::JobSystem* _jobSystem) { job_system_ = _jobSystem; }	// sɎgJobSystem
+
+		void Build(const std::vector<std::shared_ptr<ISystem>>& _systems, const std::vector<SystemAccess>& _access);	// ˑOt̍\z
+		void Run(Phase _phase, float _dt);	// s
+
+		void SetParallel(bool _parallel) { parallel_ = _parallel; }
+		bool IsParallel() const { return parallel_; }
+
+		const SchedulerStats& GetStats(Phase _phase) const { return stats_[static_cast<size_t>(_phase)]; }
+		float GetLastSystemMs(size_t _index, Phase _phase) const;	// ߂SystemƂ̎s
+		bool IsOnCriticalPath(size_t _index, Phase _phase) const;	// ߂̍ŒoHɊ܂܂邩
+		size_t GetSystemCount() const { return nodes_.size(); }
+		ISystem* GetSystem(size_t _index) const { return nodes_[_index].system; }
+		const char* GetSystemName(size_t _index) const { return nodes_[_index].name; }	// ^(Profiler̋ԖƓ)
+
+	private:
+		/**
+		 * @brief Ot̃m[h(System)
+		 */
+		struct Node {
+			ISystem* system = nullptr;
+			const char* name = nullptr;	// vt@C̋Ԗ(^)
+			std::vector<uint32_t> predecessors{};
+			std::vector<uint32_t> successors{};
+			double startMs[2]{};			// tF[YƂ̊Jn(t[Jn)
+			double endMs[2]{};				// tF[YƂ̏I(t[Jn)
+			bool critical[2]{};				// ߂̍ŒoHɊ܂܂邩
+		};
+
+		void RunSerial();		// o^ɂ̂܂܎s(tF[Y / dtRunŊog)
+		void RunParallel();
+		void Execute(uint32_t _index);	// SystemsĎԂL^
+		void Submit(uint32_t _index);	// WuƂĐςށiI㑱ςށj
+		void ComputeStats(Phase _phase, double _wallMs);
+
+	private:
+		std::vector<Node> nodes_{};
+		uint32_t edge_count_ = 0;
+		bool parallel_ = true;
+		SchedulerStats stats_[2]{};
+
+		// s̏
+		Phase current_phase_ = Phase::Update;
+		float current_dt_ = 0.0f;
+		std::chrono::steady_clock::time_point frame_start_{};
+		std::unique_ptr<std::atomic<uint32_t>[]> remaining_{};	// m[hƂ̎cˑ
+		dx3d::JobCounter* counter_ = nullptr;	// s̃t[̃JE^
+		std::exception_ptr error_{};
+		std::mutex error_mutex_{};
+
+		dx3d::JobSystem* job_system_ = nullptr;
+	};
+}
@@ -0,0 +1,46 @@
+#pragma once
+/**
+ * @file WorldSnapshot.h
+ * @brief ECS[h̃XibvVbg
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <array>
+#include <memory>
+#include <Game/ECS/ECSUtils.h>
+#include <Game/ECS/EntityManager.h>
+#include <Game/ECS/ComponentArray.h>
+
+namespace ecs {
+	/**
+	 * @brief [h̃XibvVbg
+	 *
+	 * EntityManager̒gƁAComponentTypeƂComponentXg̃Rs[B
+	 * System̏ΏۂƃNG͖߂Signature蒼̂ŎȂB
+	 */
+	struct WorldSnapshot {
+		EntityManager entities{};
+		std::array<std::unique_ptr<IComponentSnapshot>, MAX_COMPONENTS> components{};
+		uint32_t entityCount = 0;		// LEntity̐
+		std::size_t byteSize = 0;		// ۑz̃oCgiq[v͐Ȃj
+		float captureMs = 0.0f;			// ۑɂ
+		float lastRestoreMs = 0.0f;		// ߂Ŗ߂̂ɂ
+	};
+
+	/**
+	 * @brief XibvVbg̏(fobO\p)
+	 */
+	struct WorldSnapshotInfo {
+		std::string name{};
+		uint32_t entityCount = 0;
+		uint32_t componentCount = 0;	// SނComponent̐̍v
+		std::size_t byteSize = 0;
+		float captureMs = 0.0f;
+		float lastRestoreMs = 0.0f;
+	};
+}
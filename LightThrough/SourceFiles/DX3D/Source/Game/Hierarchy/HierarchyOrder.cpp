@@ -0,0 +1,80 @@
+/**
+ * @file HierarchyOrder.cpp
+ * @brief eqKw[ɕׂ
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <algorithm>
+#include <Game/Hierarchy/HierarchyOrder.h>
+
+namespace dx3d {
+	/**
+	 * @brief e̔ԍ[ɕׂ
+	 *	e̘AȂ𖾎IȃX^bNňxoA[Ƃɐĕׂ(v\[g)
+	 * @param _parentOf m[hƂ̐e̔ԍ(-1: [g)
+	 */
+	void HierarchyOrder::Build(std::span<const int32_t> _parentOf)
+	{
+		const uint32_t count = static_cast<uint32_t>(_parentOf.size());
+		parent_of_.assign(_parentOf.begin(), _parentOf.end());
+		cut_nodes_.clear();
+
+		// [(-1: vZ, -2: vZ)
+		depth_.assign(count, -1);
+		max_depth_ = -1;
+		for (uint32_t i = 0; i < count; ++i) {
+			if (depth_[i] >= 0) { continue; }
+
+			// [Ăc悩[g܂œo
+			chain_.clear();
+			int32_t base = -1;
+			uint32_t cur = i;
+			while (true) {
+				if (depth_[cur] >= 0) {
+					base = depth_[cur];
+					break;
+				}
+				if (depth_[cur] == -2) {
+					// TCNBŌɐς񂾃m[h̐e؂
+					cut_nodes_.push_back(chain_.back());
+					parent_of_[chain_.back()] = -1;
+					break;
+				}
+				depth_[cur] = -2;
+				chain_.push_back(cur);
+				if (parent_of_[cur] < 0 || static_cast<uint32_t>(parent_of_[cur]) >= count) {
+					parent_of_[cur] = -1;
+					break;
+				}
+				cur = static_cast<uint32_t>(parent_of_[cur]);
+			}
+			// ォ珇ɐ[߂
+			for (auto it = chain_.rbegin(); it != chain_.rend(); ++it) {
+				depth_[*it] = ++base;
+			}
+			max_depth_ = (std::max)(max_depth_, base);
+		}
+
+		// [Ƃɐĕׂ
+		offsets_.assign(static_cast<size_t>(max_depth_) + 2, 0);
+		for (uint32_t i = 0; i < count; ++i) {
+			++offsets_[depth_[i] + 1];
+		}
+		for (size_t d = 1; d < offsets_.size(); ++d) {
+			offsets_[d] += offsets_[d - 1];
+		}
+		position_.resize(count);
+		order_.resize(count);
+		parents_.resize(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			const uint32_t pos = offsets_[depth_[i]]++;
+			position_[i] = static_cast<int32_t>(pos);
+			order_[pos] = i;
+		}
+		for (uint32_t i = 0; i < count; ++i) {
+			parents_[position_[i]] = (parent_of_[i] < 0) ? -1 : position_[parent_of_[i]];
+		}
+	}
+}
@@ -0,0 +1,52 @@
+/**
+ * @file HeadlessInputSystem.cpp
+ * @brief ͂ǗNX(wbhXspBOS͓̓͂ǂ܂Ȃ)
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- // 
+#include <Game/InputSystem/InputSystem.h>
+
+namespace input
+{
+	/**
+	 * @brief 
+	 *	EBhÊœ͖͂̂܂(Is`͑SfalseAړʂ0)
+	 */
+	void InputSystem::Init(void* _hwnd)
+	{
+		hwnd_ = _hwnd;
+		mouse_mode_ = MouseMode::Disabled;
+		ApplyModeState();
+	}
+
+	void InputSystem::Update() {}
+
+	void InputSystem::OnRawInput(intptr_t _lParam) {}
+
+	void InputSystem::MouseLock(bool _lock)
+	{
+		mouse_locked_ = _lock;
+		if (!mouse_locked_) {
+			mouse_delta_ = {};
+		}
+	}
+
+	void InputSystem::ReleaseToDesktop()
+	{
+		SetRelativeMouseMode(false);
+		SetInputEnabled(false);
+		SetFocus(false);
+		MouseLock(false);
+	}
+
+	void InputSystem::UpdateCursorClip() {}
+
+	void InputSystem::ReRegisterRawMouse(bool _gameplay)
+	{
+		raw_mouse_registered_ = false;
+	}
+
+	void InputSystem::UpdateMouseButtons() {}
+}
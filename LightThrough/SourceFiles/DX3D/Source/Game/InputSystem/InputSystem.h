@@ -7,11 +7,20 @@
  */
 
 // ---------- CN[h ---------- // 
-#include <Windows.h>
+#include <cstdint>
+#include <vector>
 #include <unordered_set>
 #include <DX3D/Math/Point.h>
 
 namespace input {
+	/**
+	 * @brief L[R[h(Win32̉zL[R[hƓlBp'A''0'̂܂܎g)
+	 */
+	namespace Key {
+		constexpr int Return = 0x0D;
+		constexpr int Space = 0x20;
+	}
+
 	enum class MouseMode {
 		Camera,
 		Cursor,
@@ -34,13 +43,14 @@ namespace input {
 	 * ƂƃIuU[o[p^[œ͂̂L[ʒm`A
 	 * ECSƂ̐ealāAĂL[̏Ԃ₢킹`ɕύXB
 	 * ꉞcĂ
+	 * OSɐG鏈Win32/Win32InputSystem.cppAwbhXsł Headless/HeadlessInputSystem.cpp (͂͏ɖ)
 	 */
 	class InputSystem
 	{
 	public:
 		static InputSystem& Get();
 
-		void Init(HWND _hwnd);
+		void Init(void* _hwnd);
 		void Update();
 
 		bool IsMouseLocked() const;		// }EXbNĂ邩
@@ -56,7 +66,7 @@ namespace input {
 		float GetWheelDelta() const;
 
 		// RawInput
-		void OnRawInput(LPARAM _lParam);
+		void OnRawInput(intptr_t _lParam);
 		void EnableRawMouse(bool _enable);
 		bool IsRawMouseEnabled() const;
 
@@ -120,7 +130,7 @@ namespace input {
 
 		MouseMode mouse_mode_ = MouseMode::Camera;	// }EX[h
 
-		HWND hwnd_{};	// EBhEnh
+		void* hwnd_{};	// EBhEnh(HWND)
 	};
 }
 
@@ -0,0 +1,226 @@
+/**
+ * @file Win32InputSystem.cpp
+ * @brief ͂ǗNX(Win32APIɐG镔)
+ * @author Arima Keita
+ * @date 2025-07-30
+ */
+
+ // ---------- CN[h ---------- // 
+#include <cstring>
+#include <Game/InputSystem/InputSystem.h>
+#include <Windows.h>
+#include <hidusage.h>
+
+namespace
+{
+	// }EX{^Ă邩
+	bool GetMouseButtonDown(input::MouseButton _btn)
+	{
+		int vk = 0;
+		switch (_btn) {
+		case input::MouseButton::Left: vk = VK_LBUTTON; break;
+		case input::MouseButton::Right: vk = VK_RBUTTON; break;
+		case input::MouseButton::Middle: vk = VK_MBUTTON; break;
+		default: return false;
+		}
+
+		return (::GetAsyncKeyState(vk) & 0x8000) != 0;
+	}
+}
+
+namespace input
+{
+	/**
+	 * @brief 
+	 * @param _hwnd EBhEnh
+	 */
+	void InputSystem::Init(void* _hwnd)
+	{
+		hwnd_ = _hwnd;
+
+		mouse_mode_ = MouseMode::Camera;
+		ApplyModeState();
+	}
+
+	void InputSystem::Update()
+	{
+		if (!focused_ || !input_enabled_) {
+			mouse_delta_ = {};
+
+			::memset(mouse_buttons_, 0, sizeof(mouse_buttons_));
+			::memset(old_mouse_buttons_, 0, sizeof(old_mouse_buttons_));
+			return;
+		}
+
+		// ---------- L[{[h ---------- //
+		::memcpy(old_keys_state_, keys_state_, sizeof(keys_state_));
+		::GetKeyboardState(keys_state_);
+
+		// ---------- }EX ---------- //
+		// }EX{^
+			UpdateMouseButtons();
+		// }EXړ
+		if (use_raw_mouse_) {
+			ClearFrameMouse();
+		}
+
+		if (mouse_mode_ == MouseMode::Cursor) {
+			
+		}
+
+	}
+
+
+	void InputSystem::OnRawInput(intptr_t _lParam)
+	{
+		if (!input_enabled_ || !use_raw_mouse_) { return; }
+
+		UINT size = 0;
+		if (::GetRawInputData(reinterpret_cast<HRAWINPUT>(_lParam), RID_INPUT, nullptr, &size, sizeof(RAWINPUTHEADER)) != 0 || size == 0) { return; }	// TCY擾s
+
+		raw_buffer_.resize(size);
+		if (::GetRawInputData(reinterpret_cast<HRAWINPUT>(_lParam), RID_INPUT, raw_buffer_.data(), &size, sizeof(RAWINPUTHEADER)) != size) { return; }	// f[^擾s
+
+		auto* raw = reinterpret_cast<RAWINPUT*>(raw_buffer_.data());
+		if (raw->header.dwType != RIM_TYPEMOUSE) { return; }	// }EX͂łȂΖ
+
+		const auto& mouse = raw->data.mouse;
+		//  or 
+		if (!(mouse.usFlags & MOUSE_MOVE_ABSOLUTE)) {
+			raw_mouse_accum_.x += static_cast<float>(mouse.lLastX);
+			raw_mouse_accum_.y += static_cast<float>(mouse.lLastY);
+		}
+		else {
+			// [ToDo] ȂB
+			// ΍WfoCX(^ubgȂ)
+		}
+
+		// zC[
+		if (mouse.usButtonFlags & RI_MOUSE_WHEEL) {
+			short wheel = static_cast<short>(mouse.usButtonData);
+			wheel_delta_ += static_cast<float>(wheel) / static_cast<float>(WHEEL_DELTA);
+		}
+	}
+
+	/**
+	 * @brief }EXŒ胁\bh
+	 * @param _lock Œ肷邩Ȃ
+	 *
+	 * 	[ToDo] }EXJ[\̌Œ肷AȂACxg`ɂA
+	 *	WinProcSetFocusŏAKillFocusŖ߂AƁA
+	 *	Q[j[ʂł}EXĂ܂̂ŁAlB
+	 */
+	void InputSystem::MouseLock(bool _lock)
+	{
+		if (_lock == mouse_locked_) return;
+		mouse_locked_ = _lock;
+
+		if (mouse_locked_)
+		{
+			::ShowCursor(FALSE);
+			UpdateCursorClip();
+		}
+		// J[\\
+		else {
+			mouse_delta_ = {};
+			::ShowCursor(TRUE);
+			::ClipCursor(NULL);
+		}
+	}
+
+	void InputSystem::ReleaseToDesktop()
+	{
+		SetRelativeMouseMode(false);
+		SetInputEnabled(false);
+		SetFocus(false);
+		MouseLock(false);
+		::ClipCursor(nullptr);
+		::ShowCursor(TRUE);
+	}
+
+	void InputSystem::UpdateCursorClip()
+	{
+		if (!hwnd_) { return; }
+		if (!focused_ || !input_enabled_) {
+			::ClipCursor(nullptr);
+			return;
+		}
+
+		// NCAg̈
+		RECT rect{};
+		::GetClientRect(static_cast<HWND>(hwnd_), &rect);
+
+		switch (mouse_mode_)
+		{
+		case MouseMode::Camera:
+		{
+			// ʒɃNbv
+			POINT center = {
+				(rect.right - rect.left) * 0.5f,
+				(rect.bottom - rect.top) * 0.5f
+			};
+			::ClientToScreen(static_cast<HWND>(hwnd_), &center);
+
+			// 1pxŒ
+			RECT clip{ center.x, center.y, center.x + 1, center.y + 1 };
+			::ClipCursor(&clip);
+			break;
+		}
+		case MouseMode::Cursor:
+		{
+			// NCAg̈ɃNbv
+			POINT tl{ rect.left, rect.top };
+			POINT br{ rect.right, rect.bottom };
+			::ClientToScreen(static_cast<HWND>(hwnd_), &tl);
+			::ClientToScreen(static_cast<HWND>(hwnd_), &br);
+			RECT clip{ tl.x, tl.y, br.x, br.y };
+			::ClipCursor(&clip);
+			break;
+		}
+		}
+	}
+
+	/**
+	 * @brief RawInput̓o^
+	 */
+	void InputSystem::ReRegisterRawMouse(bool _gameplay)
+	{
+		// ̓o^폜(Kvǂ͂킩Ȃ؂ւł悤ɂȂ̂)
+		if (raw_mouse_registered_) {
+			RAWINPUTDEVICE remove{};
+			remove.usUsagePage = HID_USAGE_PAGE_GENERIC;
+			remove.usUsage = HID_USAGE_GENERIC_MOUSE;
+			remove.dwFlags = RIDEV_REMOVE;
+			remove.hwndTarget = nullptr;
+			::RegisterRawInputDevices(&remove, 1, sizeof(remove));
+			raw_mouse_registered_ = false;
+		}
+
+		if (!use_raw_mouse_) { return; }
+
+		RAWINPUTDEVICE rid{};
+		rid.usUsagePage = HID_USAGE_PAGE_GENERIC;
+		rid.usUsage = HID_USAGE_GENERIC_MOUSE;
+		rid.hwndTarget = static_cast<HWND>(hwnd_);
+		rid.dwFlags = _gameplay ? (RIDEV_NOLEGACY | RIDEV_CAPTUREMOUSE) : 0;
+
+		if (::RegisterRawInputDevices(&rid, 1, sizeof(rid))) {
+			raw_mouse_registered_ = true;
+		}
+		else {
+			use_raw_mouse_ = false;
+		}
+
+	}
+
+	//! @brief }EX{^ԍXV
+	void InputSystem::UpdateMouseButtons()
+	{
+		// ۑ
+		::memcpy(old_mouse_buttons_, mouse_buttons_, sizeof(mouse_buttons_));
+		// XV
+		for(size_t i = 0; i< static_cast<size_t>(MouseButton::Max); ++i) {
+			mouse_buttons_[i] = GetMouseButtonDown(static_cast<MouseButton>(i));
+		}
+	}
+}
@@ -7,6 +7,8 @@
 
  // ---------- CN[h ---------- // 
 #include <limits>
+#include <algorithm>
+#include <optional>
 #include <fstream>
 #include <sstream>
 #include <cassert>
@@ -30,6 +32,7 @@
 #include <Game/Components/Core/ObjectRoot.h>
 #include <Game/Components/Core/ObjectChild.h>
 #include <Game/Components/GamePlay/LightPlaceRequest.h>
+#include <Game/Systems/Collisions/ColliderSyncSystem.h>
 
 #include <Game/ECS/ECSUtils.h>
 #include <Game/GameLogUtils.h>
@@ -202,7 +205,36 @@ namespace {
 		}
 
 		ImGui::Checkbox("IsTrigger", &c.isTrigger);
-		ImGui::Checkbox("IsStatic", &c.isStatic);
+		if (ImGui::Checkbox("IsStatic", &c.isStatic)) {
+			c.shapeDirty = true;
+		}
+	}
+
+	//! @brief ÓIBVHɊւl(ÓIǂ / p / `)
+	struct StaticColliderState {
+		bool isStatic = false;
+		float pose[10]{};	// ʒu, ](NH[^jI), XP[
+		bool shapeDirty = false;
+
+		bool operator==(const StaticColliderState&) const = default;
+	};
+
+	//! @brief ÓIBVHɊւlo(ColliderΖ)
+	std::optional<StaticColliderState> GetStaticColliderState(ecs::Coordinator& _ecs, ecs::Entity _e)
+	{
+		if (!_ecs.HasComponent<ecs::Collider>(_e) || !_ecs.HasComponent<ecs::Transform>(_e)) { return std::nullopt; }
+		const auto col = _ecs.GetComponent<ecs::Collider>(_e);
+		const auto tf = _ecs.GetComponent<ecs::Transform>(_e);
+		StaticColliderState state;
+		state.isStatic = col->isStatic || (_ecs.HasComponent<ecs::Rigidbody>(_e) && _ecs.GetComponent<ecs::Rigidbody>(_e)->isStatic);
+		const float pose[10] = {
+			tf->position.x, tf->position.y, tf->position.z,
+			tf->rotationQuat.x, tf->rotationQuat.y, tf->rotationQuat.z, tf->rotationQuat.w,
+			tf->scale.x, tf->scale.y, tf->scale.z,
+		};
+		std::copy(std::begin(pose), std::end(pose), std::begin(state.pose));
+		state.shapeDirty = col->shapeDirty;
+		return state;
 	}
 
 } // namespace anonymous
@@ -263,13 +295,26 @@ namespace scene {
 		// VSceneANeBu
 		if (!SetActiveScene(_newScene, _unloadPrev)) { return false; }
 
+		// [hpɓǂݍݒۑ
+		CaptureSnapshot(GetBaselineName(_newScene));
+
 		return true;
 	}
 
 	//! @brief ANeBuSceneData[h
 	bool SceneManager::ReloadActiveScene()
 	{
+		if (!active_scene_) {
+			GameLogError("[SceneManager] ANeBuȃV[݂ȂB");
+			return false;
+		}
 		const auto id = *active_scene_;
+
+		// ǂݍݒ̃XibvVbg΁A֖߂ōς
+		if (snapshots_.contains(GetBaselineName(id)) && RestoreSnapshot(GetBaselineName(id))) {
+			return true;
+		}
+
 		// A[h
 		if (!UnloadScene(id)) {
 			GameLogFError("[SceneManager] V[̃A[hɎs: {}", id);
@@ -287,9 +332,73 @@ namespace scene {
 			system->OnSceneLoaded();
 		}
 
+		// ̃[hpɓǂݍݒۑ
+		CaptureSnapshot(GetBaselineName(id));
+
 		return true;
 	}
 
+	//! @brief ANeBuȃV[̃XibvVbgۑ
+	bool SceneManager::CaptureSnapshot(const std::string& _name)
+	{
+		if (!active_scene_) {
+			GameLogError("[SceneManager] ANeBuȃV[݂ȂB");
+			return false;
+		}
+		auto it = scenes_.find(*active_scene_);
+		if (it == scenes_.end()) { return false; }
+
+		if (!ecs_.CaptureSnapshot(_name)) { return false; }
+		snapshots_[_name] = SceneSnapshot{
+			.scene = it->first,
+			.entities = it->second.entities_,
+			.persistentEntities = persistent_entities_,
+		};
+		return true;
+	}
+
+	//! @brief XibvVbgɖ߂
+	bool SceneManager::RestoreSnapshot(const std::string& _name)
+	{
+		auto snapshot = snapshots_.find(_name);
+		if (snapshot == snapshots_.end()) {
+			GameLogFError("[SceneManager] XibvVbg݂Ȃ: {}", _name);
+			return false;
+		}
+		// ʂ̃V[Entityꗗɂ͖߂Ȃ
+		if (!active_scene_ || *active_scene_ != snapshot->second.scene) {
+			GameLogFError("[SceneManager] XibvVbg '{}' ̓ANeBuȃV[̂̂ł͂Ȃ", _name);
+			return false;
+		}
+		auto scene = scenes_.find(snapshot->second.scene);
+		if (scene == scenes_.end()) { return false; }
+
+		if (!ecs_.RestoreSnapshot(_name)) { return false; }
+		// jʒmňꗗ܂߂āAۑ̈ꗗɖ߂
+		scene->second.entities_ = snapshot->second.entities;
+		persistent_entities_ = snapshot->second.persistentEntities;
+
+		// VXeɃV[[hʒm
+		for (auto& system : ecs_.GetAllSystems()) {
+			system->OnSceneLoaded();
+		}
+		return true;
+	}
+
+	//! @brief V[̃XibvVbgSĔj
+	void SceneManager::DeleteSnapshots(const SceneData::Id& _id)
+	{
+		for (auto it = snapshots_.begin(); it != snapshots_.end();) {
+			if (it->second.scene == _id) {
+				ecs_.DeleteSnapshot(it->first);
+				it = snapshots_.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
 
 	//! @brief ANeBuSceneDataۑ
 	bool SceneManager::SaveActiveScene()
@@ -339,6 +448,7 @@ namespace scene {
 		}
 
 		scenes_.erase(it);	// V[̍폜
+		DeleteSnapshots(_id);	// Entity͂̂Ŗ߂Ȃ
 
 		//// [ToDo] A[h㏈
 		//if (OnAfterSceneUnLoad) {
@@ -485,6 +595,36 @@ namespace scene {
 				ImGui::PopID();
 			}
 		}
+		// XibvVbg
+		if (ImGui::CollapsingHeader("Snapshots")) {
+			ImGui::InputText("Name", debug_snapshot_name_, sizeof(debug_snapshot_name_));
+			if (ImGui::Button("Capture") && debug_snapshot_name_[0] != '\0') {
+				CaptureSnapshot(debug_snapshot_name_);
+			}
+			std::optional<std::string> restoreName;
+			std::optional<std::string> deleteName;
+			for (const auto& info : ecs_.GetSnapshotInfos()) {
+				ImGui::PushID(info.name.c_str());
+				ImGui::Separator();
+				ImGui::Text("%s", info.name.c_str());
+				ImGui::Text("Entity: %u / Component: %u", info.entityCount, info.componentCount);
+				ImGui::Text("Size: %.1f KB", static_cast<double>(info.byteSize) / 1024.0);
+				ImGui::Text("Capture: %.3f ms / Restore: %.3f ms", info.captureMs, info.lastRestoreMs);
+				if (ImGui::Button("Restore")) { restoreName = info.name; }
+				ImGui::SameLine();
+				if (ImGui::Button("Delete")) { deleteName = info.name; }
+				ImGui::PopID();
+			}
+			// ꗗ̑IĂ甽f
+			if (restoreName && RestoreSnapshot(*restoreName)) {
+				ecs_.ReactivateAllSystems();
+				debug_selected_entity_.reset();
+			}
+			if (deleteName) {
+				ecs_.DeleteSnapshot(*deleteName);
+				snapshots_.erase(*deleteName);
+			}
+		}
 
 		ImGui::EndChild();
 		ImGui::SameLine();
@@ -629,7 +769,15 @@ namespace scene {
 					ImGui::PushID(compName);
 					if (ImGui::CollapsingHeader(compName)) {
 						auto& compRef = *compPtr;
+						const auto staticBefore = GetStaticColliderState(ecs_, e);
 						DrawReflectedComponentFields(compRef, baseSpeed);
+						// ÓIȕ(ɂȂ / )AÓIBVH蒼
+						const auto staticAfter = GetStaticColliderState(ecs_, e);
+						if (staticBefore && staticAfter && staticBefore != staticAfter && (staticBefore->isStatic || staticAfter->isStatic)) {
+							if (auto colliderSync = ecs_.GetSystem<ecs::ColliderSyncSystem>()) {
+								colliderSync->RequestStaticRebuild();
+							}
+						}
 						// R|[lg폜{^
 						if (ImGui::Button("Remove Component")) {
 							removeComponentType = ecs_.GetComponentType<CompT>();
@@ -79,10 +79,26 @@ namespace scene {
 
 		/**
 		 * @brief ANeBuȃV[[h
+		 *	ǂݍݒ̃XibvVbg΂֖߂BΔjăt@Cǂݒ
 		 * @return : TrueAs: False
 		 */
 		bool ReloadActiveScene();
 
+		/**
+		 * @brief ANeBuȃV[̃XibvVbgۑ
+		 *	ECS̃[hƁAV[Entityꗗ / iEntityꗗꏏɕۑ
+		 * @param _name XibvVbg(O͏㏑)
+		 * @return : TrueAs: False
+		 */
+		bool CaptureSnapshot(const std::string& _name);
+		/**
+		 * @brief XibvVbgɖ߂
+		 *	ۑƓV[ANeBuȎ߂B߂̓VXeɃV[[hʒm
+		 * @param _name XibvVbg
+		 * @return : TrueAs: False
+		 */
+		bool RestoreSnapshot(const std::string& _name);
+
 		/**
 		 * @brief SceneDataANeBuɂ
 		 * @param _id		: V[ID
@@ -141,12 +157,27 @@ namespace scene {
 		 */
 		SceneData::Id GenerateId(const std::string& _base);
 
+		//! @brief ǂݍݒ̃XibvVbg
+		static std::string GetBaselineName(const SceneData::Id& _id) { return _id + "@baseline"; }
+		//! @brief V[̃XibvVbgSĔj
+		void DeleteSnapshots(const SceneData::Id& _id);
+
+		/**
+		 * @brief ECS̃[hƈꏏɕۑV[̏
+		 */
+		struct SceneSnapshot {
+			SceneData::Id scene{};
+			std::vector<ecs::Entity> entities{};
+			std::unordered_set<ecs::Entity> persistentEntities{};
+		};
+
 	private:
 		ecs::Coordinator& ecs_;
 		std::unordered_map<SceneData::Id, SceneData> scenes_{};		// V[ꗗ
 		std::optional<SceneData::Id> active_scene_{};				// ANeBuȃV[ID
 		std::unordered_set<ecs::Entity> persistent_entities_{};		// iEntityꗗ
 		std::unique_ptr<ecs_serial::SceneSerializer> serializer_{};	// V[VACU[
+		std::unordered_map<std::string, SceneSnapshot> snapshots_{};	// XibvVbg -> V[̏
 
 
 
@@ -155,5 +186,6 @@ namespace scene {
 		void DebugCurrentScene();
 	private:
 		std::optional<ecs::Entity> debug_selected_entity_{};
+		char debug_snapshot_name_[64] = "Checkpoint";	// ۑXibvVbg
 	};
 }
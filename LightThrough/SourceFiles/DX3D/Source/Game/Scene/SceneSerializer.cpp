@@ -6,8 +6,19 @@
  */
 
  // ---------- CN[h ---------- // 
+#include <cassert>
 #include <fstream>
 #include <filesystem>
+#include <chrono>
+#include <map>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <DirectXMath.h>
 #include <nlohmann/json.hpp>
 
@@ -15,6 +26,7 @@
 #include <Game/ECS/Entity.h>
 
 #include <Game/Serialization/ComponentReflection.h>
+#include <Game/Serialization/ComponentBinary.h>
 
 #include <Game/Scene/SceneSerializer.h>
 #include <Game/Scene/SceneManager.h>
@@ -27,6 +39,9 @@
 #include <Debug/Debug.h>
 
 constexpr std::string_view SCENE_FILE_DIR = "Assets/Scenes/";
+constexpr std::string_view COOKED_SCENE_EXT = ".cooked";
+constexpr uint32_t COOKED_SCENE_MAGIC = 0x4253544C;	// "LTSB"
+constexpr uint32_t COOKED_SCENE_VERSION = 1;
 
 
 
@@ -47,6 +62,130 @@ namespace {
 		}
 		return s;
 	}
+
+	/**
+	 * @brief NbNς݃V[̃wb_[
+	 *
+	 * t@C̕:
+	 *	CookedSceneHeader, sceneId(u32 + ), sceneName()
+	 *	ubN * blockCount:
+	 *		(16ɑ) CookedBlockHeader, O, (4ɑ) Entity̔ԍ u32[count], (16ɑ) f[^
+	 */
+	struct CookedSceneHeader {
+		uint32_t magic = COOKED_SCENE_MAGIC;
+		uint32_t version = COOKED_SCENE_VERSION;
+		uint64_t sourceSize = 0;	// JSOÑTCY
+		int64_t sourceTime = 0;		// JSON̍XV
+		uint32_t entityCount = 0;
+		uint32_t blockCount = 0;
+	};
+
+	/**
+	 * @brief R|[lgޕ̃ubÑwb_[
+	 */
+	struct CookedBlockHeader {
+		uint64_t layoutHash = 0;	// ComponentRegistry::Entry::layoutHash
+		uint64_t dataSize = 0;		// f[^̃oCg
+		uint32_t count = 0;			// R|[lg̐
+		uint32_t nameLength = 0;	// R|[lg̒
+	};
+
+	/**
+	 * @brief JSON̏Ԃ擾
+	 * @return 擾ł: true
+	 */
+	bool GetSourceStamp(const std::string& _path, uint64_t& _size, int64_t& _time)
+	{
+		std::error_code ec;
+		_size = static_cast<uint64_t>(std::filesystem::file_size(_path, ec));
+		if (ec) { return false; }
+		_time = static_cast<int64_t>(std::filesystem::last_write_time(_path, ec).time_since_epoch().count());
+		return !ec;
+	}
+
+	void WriteString(ecs_serial::BinaryWriter& _w, const std::string& _str)
+	{
+		_w.WritePod(static_cast<uint32_t>(_str.size()));
+		_w.Write(_str.data(), _str.size());
+	}
+
+	std::string ReadString(ecs_serial::BinaryReader& _r)
+	{
+		const uint32_t length = _r.ReadPod<uint32_t>();
+		const auto* p = reinterpret_cast<const char*>(_r.Skip(length));
+		return std::string(p, length);
+	}
+
+	double ElapsedMs(std::chrono::steady_clock::time_point _start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+	}
+
+	/**
+	 * @brief ǂݎpŃɊ蓖Ăt@C
+	 *	ǂݍݒgBRs[Ƀy[W璼ړǂ
+	 */
+	class MappedFile {
+	public:
+#ifdef _WIN32
+		explicit MappedFile(const std::string& _path)
+		{
+			file_ = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (file_ == INVALID_HANDLE_VALUE) { return; }
+
+			LARGE_INTEGER size{};
+			if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) { return; }
+
+			mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping_) { return; }
+
+			view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+			if (view_) { size_ = static_cast<std::size_t>(size.QuadPart); }
+		}
+		~MappedFile()
+		{
+			if (view_) { UnmapViewOfFile(view_); }
+			if (mapping_) { CloseHandle(mapping_); }
+			if (file_ != INVALID_HANDLE_VALUE) { CloseHandle(file_); }
+		}
+#else
+		explicit MappedFile(const std::string& _path)
+		{
+			file_ = open(_path.c_str(), O_RDONLY);
+			if (file_ < 0) { return; }
+
+			struct stat st {};
+			if (fstat(file_, &st) != 0 || st.st_size == 0) { return; }
+
+			void* view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, file_, 0);
+			if (view == MAP_FAILED) { return; }
+			madvise(view, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+			view_ = view;
+			size_ = static_cast<std::size_t>(st.st_size);
+		}
+		~MappedFile()
+		{
+			if (view_) { munmap(view_, size_); }
+			if (file_ >= 0) { close(file_); }
+		}
+#endif
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool IsOpen() const { return view_ != nullptr; }
+		const uint8_t* Data() const { return static_cast<const uint8_t*>(view_); }
+		std::size_t Size() const { return size_; }
+
+	private:
+#ifdef _WIN32
+		HANDLE file_ = INVALID_HANDLE_VALUE;
+		HANDLE mapping_ = nullptr;
+#else
+		int file_ = -1;
+#endif
+		void* view_ = nullptr;
+		std::size_t size_ = 0;
+	};
 } // anonymous
 
 
@@ -86,15 +225,21 @@ namespace ecs_serial {
 		}
 
 		// o
-		std::ofstream ofs(path);
-		if (!ofs.is_open()) {
-			DebugLogError("[SceneSerializer] t@CJ܂ł: '{}'", path);
-			return false;
+		{
+			std::ofstream ofs(path);
+			if (!ofs.is_open()) {
+				DebugLogError("[SceneSerializer] t@CJ܂ł: '{}'", path);
+				return false;
+			}
+			ofs << jScene.dump(4);	// Cfg
+			if (!ofs) { return false; }
 		}
-		ofs << jScene.dump(4);	// Cfg
+
+		// Ă(XV܂Ă)NbN
+		CookScene(jScene, _scene.name_);
 
 		DebugLogInfo("[SceneSerializer] SerializeScene done");
-		return static_cast<bool>(ofs);
+		return true;
 	}
 
 	/**
@@ -104,6 +249,17 @@ namespace ecs_serial {
 	 */
 	scene::SceneData SceneSerializer::DeserializeScene(const std::string& _name)
 	{
+		const auto start = std::chrono::steady_clock::now();
+
+		// NbNς݂΂炩
+		{
+			scene::SceneData cooked;
+			if (TryDeserializeCookedScene(_name, cooked)) {
+				DebugLogInfo("[SceneSerializer] DeserializeScene(cooked) done: '{}' entities = {} {:.3f}ms", _name, cooked.entities_.size(), ElapsedMs(start));
+				return cooked;
+			}
+		}
+
 		const auto path = GetSceneFilePath(_name);
 		DebugLogInfo("[SceneSerializer] DeserializeScene: open '{}'", path);
 		// t@CJ
@@ -149,10 +305,214 @@ namespace ecs_serial {
 			scene.entities_.push_back(e);
 		}
 
-		DebugLogInfo("[SceneSerializer] DeserializeScene done");
+		DebugLogInfo("[SceneSerializer] DeserializeScene(json) done: '{}' entities = {} {:.3f}ms", _name, scene.entities_.size(), ElapsedMs(start));
+
+		// ̓NbNς݂g
+		CookScene(jScene, _name);
 		return scene;
 	}
 
+	/**
+	 * @brief V[JSONNbNς݂̃oCio
+	 *	R|[lg̎ނƂɁAĂEntity̔ԍƃf[^܂Ƃ߂
+	 * @param _jScene V[JSON
+	 * @param _name V[
+	 * @return : true, s: false
+	 */
+	bool SceneSerializer::CookScene(const json& _jScene, const std::string& _name)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const auto cookedPath = GetCookedSceneFilePath(_name);
+
+		CookedSceneHeader header{};
+		if (!GetSourceStamp(GetSceneFilePath(_name), header.sourceSize, header.sourceTime)) {
+			DebugLogWarning("[SceneSerializer] NbNJSON܂: '{}'", _name);
+			return false;
+		}
+
+		// R|[lg -> (Entity̔ԍ, JSON) OɂĂƖ񓯂тɂȂ
+		struct BlockSource {
+			std::vector<uint32_t> entities{};
+			std::vector<const json*> components{};
+		};
+		std::map<std::string, BlockSource> blocks;
+
+		auto& registry = ComponentRegistry::Get();
+		const auto& arr = _jScene.at("entities");
+		header.entityCount = static_cast<uint32_t>(arr.size());
+		for (uint32_t i = 0; i < header.entityCount; ++i) {
+			const auto& jEntity = arr[i];
+			if (!jEntity.contains("components") || !jEntity["components"].is_object()) { continue; }
+			for (auto it = jEntity["components"].begin(); it != jEntity["components"].end(); ++it) {
+				// o^̂̂JSONǂ񂾎Ɠ΂
+				if (!registry.Contains(it.key())) { continue; }
+				auto& block = blocks[it.key()];
+				block.entities.push_back(i);
+				block.components.push_back(&it.value());
+			}
+		}
+		header.blockCount = static_cast<uint32_t>(blocks.size());
+
+		BinaryWriter w;
+		try {
+			w.WritePod(header);
+			WriteString(w, _jScene.at("sceneId").get<std::string>());
+			WriteString(w, _jScene.at("sceneName").get<std::string>());
+
+			for (const auto& [name, block] : blocks) {
+				const auto* entry = registry.Find(name);
+
+				w.Align(BINARY_BLOCK_ALIGN);
+				const std::size_t headerOffset = w.GetSize();
+				CookedBlockHeader blockHeader{};
+				blockHeader.layoutHash = entry->layoutHash;
+				blockHeader.count = static_cast<uint32_t>(block.entities.size());
+				blockHeader.nameLength = static_cast<uint32_t>(name.size());
+				w.WritePod(blockHeader);
+				w.Write(name.data(), name.size());
+				w.Align(sizeof(uint32_t));
+				w.Write(block.entities.data(), block.entities.size() * sizeof(uint32_t));
+				w.Align(BINARY_BLOCK_ALIGN);
+
+				const std::size_t dataOffset = w.GetSize();
+				entry->cook(block.components, w);
+				blockHeader.dataSize = w.GetSize() - dataOffset;
+				w.Patch(headerOffset, blockHeader);
+			}
+		}
+		catch (const std::exception& _ex) {
+			DebugLogWarning("[SceneSerializer] NbNɎs: '{}' {}", _name, _ex.what());
+			return false;
+		}
+
+		std::ofstream ofs(cookedPath, std::ios::binary | std::ios::trunc);
+		if (!ofs.is_open()) {
+			DebugLogWarning("[SceneSerializer] t@CJ܂ł: '{}'", cookedPath);
+			return false;
+		}
+		const auto& buffer = w.GetBuffer();
+		ofs.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+		DebugLogInfo("[SceneSerializer] CookScene done: '{}' blocks = {} {}bytes {:.3f}ms", cookedPath, header.blockCount, buffer.size(), ElapsedMs(start));
+		return static_cast<bool>(ofs);
+	}
+
+	/**
+	 * @brief NbNς݂̃oCiǂݍ
+	 *	Ƀwb_[ƃubÑTCYSm߂ĂEntitŷŁAfalse͉̎ĂȂ
+	 * @param _name V[
+	 * @param _out ǂݍ񂾃V[
+	 * @return ǂݍ߂: true, JSONǂޕKv: false
+	 */
+	bool SceneSerializer::TryDeserializeCookedScene(const std::string& _name, scene::SceneData& _out)
+	{
+		const auto cookedPath = GetCookedSceneFilePath(_name);
+		const auto start = std::chrono::steady_clock::now();
+
+		// Ɋ蓖ĂāÂ܂ܓǂ
+		const MappedFile file(cookedPath);
+		if (!file.IsOpen()) { return false; }
+
+		/**
+		 * @brief ؍ς݂̃ubN
+		 */
+		struct CookedBlock {
+			const ComponentRegistry::Entry* entry = nullptr;
+			const uint32_t* entities = nullptr;	// t@Cw
+			uint32_t count = 0;
+			const uint8_t* data = nullptr;
+			std::size_t dataSize = 0;
+		};
+		std::vector<CookedBlock> blocks;
+		CookedSceneHeader header{};
+		auto& registry = ComponentRegistry::Get();
+
+		try {
+			BinaryReader r(file.Data(), file.Size());
+			header = r.ReadPod<CookedSceneHeader>();
+			if (header.magic != COOKED_SCENE_MAGIC || header.version != COOKED_SCENE_VERSION) {
+				DebugLogInfo("[SceneSerializer] NbNς݂̃o[WႤ̂ō蒼: '{}'", cookedPath);
+				return false;
+			}
+
+			// JSONĂgȂ
+			uint64_t sourceSize = 0;
+			int64_t sourceTime = 0;
+			if (GetSourceStamp(GetSceneFilePath(_name), sourceSize, sourceTime) &&
+				(sourceSize != header.sourceSize || sourceTime != header.sourceTime)) {
+				DebugLogInfo("[SceneSerializer] JSONXVĂ̂ō蒼: '{}'", cookedPath);
+				return false;
+			}
+
+			_out.id_ = ReadString(r);
+			_out.name_ = ReadString(r);
+
+			blocks.resize(header.blockCount);
+			for (auto& block : blocks) {
+				r.Align(BINARY_BLOCK_ALIGN);
+				const auto blockHeader = r.ReadPod<CookedBlockHeader>();
+				const std::string name(reinterpret_cast<const char*>(r.Skip(blockHeader.nameLength)), blockHeader.nameLength);
+
+				block.entry = registry.Find(name);
+				if (!block.entry || block.entry->layoutHash != blockHeader.layoutHash) {
+					DebugLogInfo("[SceneSerializer] '{}' ̕тςĂ̂ō蒼: '{}'", name, cookedPath);
+					return false;
+				}
+
+				r.Align(sizeof(uint32_t));
+				block.count = blockHeader.count;
+				block.entities = reinterpret_cast<const uint32_t*>(r.Skip(static_cast<std::size_t>(block.count) * sizeof(uint32_t)));
+				for (uint32_t i = 0; i < block.count; ++i) {
+					if (block.entities[i] >= header.entityCount) { throw std::runtime_error("Entity̔ԍ͈͊O"); }
+				}
+
+				r.Align(BINARY_BLOCK_ALIGN);
+				block.dataSize = static_cast<std::size_t>(blockHeader.dataSize);
+				block.data = r.Skip(block.dataSize);
+
+				// f[^̑傫Ŋm߂(EntityɎsƁA肩̃V[c)
+				BinaryReader blockReader(block.data, block.dataSize);
+				if (!block.entry->validateBlock(block.count, blockReader)) {
+					throw std::runtime_error("ubÑTCYȂ: " + name);
+				}
+			}
+		}
+		catch (const std::exception& _ex) {
+			DebugLogWarning("[SceneSerializer] NbNς݂Ă̂ō蒼: '{}' {}", cookedPath, _ex.what());
+			return false;
+		}
+
+		const double validateMs = ElapsedMs(start);
+
+		// Entity̐(JSONƓ)
+		auto phase = std::chrono::steady_clock::now();
+		_out.entities_.resize(header.entityCount);
+		for (auto& e : _out.entities_) {
+			e = ecs_.CreateEntity();
+		}
+		const double createMs = ElapsedMs(phase);
+
+		// ubNƂɂ܂Ƃ߂Ēǉ
+		phase = std::chrono::steady_clock::now();
+		std::vector<ecs::Entity> targets;
+		for (const auto& block : blocks) {
+			targets.resize(block.count);
+			for (uint32_t i = 0; i < block.count; ++i) {
+				targets[i] = _out.entities_[block.entities[i]];
+			}
+
+			// ؍ς݂Ȃ̂ŁAł͎sȂ
+			BinaryReader r(block.data, block.dataSize);
+			block.entry->loadBlock(ecs_, targets.data(), block.count, r);
+			assert(r.GetOffset() == block.dataSize);
+		}
+		const double insertMs = ElapsedMs(phase);
+
+		DebugLogInfo("[SceneSerializer] cooked '{}' {}bytes blocks = {} entities = {}: map+validate {:.3f}ms, create {:.3f}ms, insert {:.3f}ms",
+			cookedPath, file.Size(), header.blockCount, header.entityCount, validateMs, createMs, insertMs);
+		return true;
+	}
+
 	/**
 	 * @brief EntityJSON
 	 *
@@ -215,4 +575,14 @@ namespace ecs_serial {
 		auto path = std::string(SCENE_FILE_DIR) + _name + ".json";
 		return path;
 	}
+
+	/**
+	 * @brief V[NbNς݂̃t@C̃pX擾
+	 * @param	_name	V[
+	 * @return NbNς݂̃t@C̃pX
+	 */
+	std::string SceneSerializer::GetCookedSceneFilePath(const std::string& _name)
+	{
+		return std::string(SCENE_FILE_DIR) + _name + std::string(COOKED_SCENE_EXT);
+	}
 } // scene
\ No newline at end of file
@@ -19,6 +19,10 @@ namespace ecs_serial {
 	class SceneManager;
 	/**
 	 * @brief V[̃[h/Z[usNX
+	 *
+	 * ҏŴJSONŁAǂݍ݂ɂJSONoCi(NbNς)D悵ĎgB
+	 * NbNς݂̓R|[lg̎ނƂ̃ubNɂȂĂāAt@Cxɓǂł̂܂ܒǉB
+	 * JSON̕V / ^̕тςJSONǂݍō蒼B
 	 */
 	class SceneSerializer{
 	public:
@@ -27,11 +31,29 @@ namespace ecs_serial {
 		bool SerializeScene(const scene::SceneData& _scene);
 		scene::SceneData DeserializeScene(const std::string& _path);
 
+		/**
+		 * @brief V[JSONNbNς݂̃oCio
+		 * @param _jScene V[JSON
+		 * @param _name V[
+		 * @return : true, s: false
+		 */
+		bool CookScene(const nlohmann::json& _jScene, const std::string& _name);
+
 	private:
 		nlohmann::json SerializeEntity(ecs::Coordinator& _ecs, ecs::Entity _e);
 		ecs::Entity DeserializeEntity(const nlohmann::json& _j);
 
+		/**
+		 * @brief NbNς݂̃oCiǂݍ
+		 *	 / Â / ^ȂEntityOfalseԂ
+		 * @param _name V[
+		 * @param _out ǂݍ񂾃V[
+		 * @return ǂݍ߂: true, JSONǂޕKv: false
+		 */
+		bool TryDeserializeCookedScene(const std::string& _name, scene::SceneData& _out);
+
 		std::string GetSceneFilePath(const std::string& _name);
+		std::string GetCookedSceneFilePath(const std::string& _name);
 
 	private:
 		ecs::Coordinator& ecs_;
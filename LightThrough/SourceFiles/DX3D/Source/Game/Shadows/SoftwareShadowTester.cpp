@@ -0,0 +1,476 @@
+/**
+ * @file SoftwareShadowTester.cpp
+ * @brief CPUŉes(CS_ShadowTest.hlslCPU)
+ * @author Arima Keita
+ * @date 2026-10-15
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <algorithm>
+#include <Game/Shadows/SoftwareShadowTester.h>
+#include <DX3D/Core/JobSystem.h>
+
+namespace dx3d {
+	namespace shadow {
+		namespace {
+			constexpr float NORMAL_BIAS = 0.5f;			// CS_ShadowTest.hlslnormalBias
+			constexpr float ZERO_W_EPSILON = 1e-6f;		// CS_ShadowTest.hlslw̔
+			constexpr float GUARD_BAND = 2.0f;			// x / y ̓r[|[ĝ̔{̊ONbv
+			constexpr int64_t SUBPIXEL_SCALE = 256;		// 16.8Œ菬_
+			constexpr int32_t BAND_ROWS = 64;			// 񉻂т̍
+			constexpr uint32_t POINT_GRAIN_SIZE = 256;
+			constexpr int MAX_CLIP_VERTICES = 16;
+
+			// Nbv(outcodẽrbg)
+			enum ClipPlane : uint8_t {
+				CLIP_NEAR = 1 << 0,		// z < 0
+				CLIP_FAR = 1 << 1,		// z > w
+				CLIP_LEFT = 1 << 2,		// x < -G * w
+				CLIP_RIGHT = 1 << 3,	// x > G * w
+				CLIP_BOTTOM = 1 << 4,	// y < -G * w
+				CLIP_TOP = 1 << 5,		// y > G * w
+				CLIP_W = 1 << 6,		// w <= 0 (XN[֒ڕϊłȂ)
+			};
+			constexpr int CLIP_PLANE_COUNT = 6;
+
+			struct ClipVertex {
+				float v[4];
+			};
+			struct ScreenVertex {
+				float x, y, z;
+			};
+
+			//! @brief ʂ܂ł̕t(0ȏオ)
+			float PlaneDistance(const float* _v, int _plane)
+			{
+				switch (_plane) {
+				case 0: return _v[2];
+				case 1: return _v[3] - _v[2];
+				case 2: return _v[0] + GUARD_BAND * _v[3];
+				case 3: return GUARD_BAND * _v[3] - _v[0];
+				case 4: return _v[1] + GUARD_BAND * _v[3];
+				default: return GUARD_BAND * _v[3] - _v[1];
+				}
+			}
+
+			uint8_t ComputeOutcode(const float* _v)
+			{
+				uint8_t code = 0;
+				for (int p = 0; p < CLIP_PLANE_COUNT; ++p) {
+					if (PlaneDistance(_v, p) < 0.0f) { code |= static_cast<uint8_t>(1u << p); }
+				}
+				if (_v[3] <= 0.0f) { code |= CLIP_W; }
+				return code;
+			}
+
+			//! @brief mul(float4(_p, 1), _m) (sxNg x sDs)
+			void TransformPoint(const float* _p, const float* _m, float* _out)
+			{
+				for (int j = 0; j < 4; ++j) {
+					_out[j] = _p[0] * _m[j] + _p[1] * _m[4 + j] + _p[2] * _m[8 + j] + _m[12 + j];
+				}
+			}
+
+			//! @brief NbvW -> r[|[g(TopLeft 0, [x 0 ~ 1)
+			ScreenVertex ToScreen(const float* _clip, float _width, float _height)
+			{
+				const float invW = 1.0f / _clip[3];
+				return {
+					(_clip[0] * invW + 1.0f) * 0.5f * _width,
+					(1.0f - _clip[1] * invW) * 0.5f * _height,
+					_clip[2] * invW
+				};
+			}
+
+			int64_t FloorDiv(int64_t _a, int64_t _b)
+			{
+				const int64_t q = _a / _b;
+				return (_a % _b != 0 && (_a < 0) != (_b < 0)) ? q - 1 : q;
+			}
+
+			int64_t Snap(float _v)
+			{
+				return static_cast<int64_t>(std::nearbyint(_v * static_cast<float>(SUBPIXEL_SCALE)));
+			}
+
+			/**
+			 * @brief D3D11̐[xoCAX(_̐[xobt@)
+			 *	Bias = DepthBias * 2^(exponent(max z) - 23) + SlopeScaledDepthBias * MaxDepthSlope
+			 */
+			float ComputeDepthBias(const ShadowRasterDesc& _desc, float _maxZ, float _maxSlope)
+			{
+				float bias = _desc.slopeScaledDepthBias * _maxSlope;
+				if (_maxZ > 0.0f) {
+					bias += static_cast<float>(_desc.depthBias) * std::ldexp(1.0f, std::ilogb(_maxZ) - 23);
+				}
+				if (_desc.depthBiasClamp > 0.0f) { bias = (std::min)(bias, _desc.depthBiasClamp); }
+				else if (_desc.depthBiasClamp < 0.0f) { bias = (std::max)(bias, _desc.depthBiasClamp); }
+				return bias;
+			}
+
+			/**
+			 * @brief Op`[x摜ɕ`
+			 *	ʂƖʐ0͕`Ȃ
+			 * @param _depth [x摜(͈ [_x0, _x1) x _imageY0 ~ )
+			 * @param _y0 / _y1 `Ă悢s͈̔
+			 */
+			void DrawTriangle(const ScreenVertex& _v0, const ScreenVertex& _v1, const ScreenVertex& _v2, const ShadowRasterDesc& _desc,
+				float* _depth, int32_t _x0, int32_t _x1, int32_t _imageY0, int32_t _y0, int32_t _y1)
+			{
+				int64_t x[3] = { Snap(_v0.x), Snap(_v1.x), Snap(_v2.x) };
+				int64_t y[3] = { Snap(_v0.y), Snap(_v1.y), Snap(_v2.y) };
+				float z[3] = { _v0.z, _v1.z, _v2.z };
+
+				// YȂ̂ŊOςȂ玞vB\vȂтւāA\𐳂ɂ낦
+				if (_desc.frontCounterClockwise) {
+					std::swap(x[1], x[2]);
+					std::swap(y[1], y[2]);
+					std::swap(z[1], z[2]);
+				}
+				const int64_t area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+				if (area <= 0) { return; }	// ʂƖʐ0
+
+				// sNZS(px + 0.5)肤͈
+				constexpr int64_t HALF = SUBPIXEL_SCALE / 2;
+				const int64_t minX = (std::min)({ x[0], x[1], x[2] });
+				const int64_t maxX = (std::max)({ x[0], x[1], x[2] });
+				const int64_t minY = (std::min)({ y[0], y[1], y[2] });
+				const int64_t maxY = (std::max)({ y[0], y[1], y[2] });
+				const int32_t pxMin = static_cast<int32_t>((std::max)(FloorDiv(minX - HALF + SUBPIXEL_SCALE - 1, SUBPIXEL_SCALE), static_cast<int64_t>(_x0)));
+				const int32_t pxMax = static_cast<int32_t>((std::min)(FloorDiv(maxX - HALF, SUBPIXEL_SCALE), static_cast<int64_t>(_x1 - 1)));
+				const int32_t pyMin = static_cast<int32_t>((std::max)(FloorDiv(minY - HALF + SUBPIXEL_SCALE - 1, SUBPIXEL_SCALE), static_cast<int64_t>(_y0)));
+				const int32_t pyMax = static_cast<int32_t>((std::min)(FloorDiv(maxY - HALF, SUBPIXEL_SCALE), static_cast<int64_t>(_y1 - 1)));
+				if (pxMin > pxMax || pyMin > pyMax) { return; }
+
+				// [x̕(Xibv̍Wŋ߂)
+				constexpr float INV_SCALE = 1.0f / SUBPIXEL_SCALE;
+				const float sx[3] = { x[0] * INV_SCALE, x[1] * INV_SCALE, x[2] * INV_SCALE };
+				const float sy[3] = { y[0] * INV_SCALE, y[1] * INV_SCALE, y[2] * INV_SCALE };
+				const float x10 = sx[1] - sx[0], y10 = sy[1] - sy[0], z10 = z[1] - z[0];
+				const float x20 = sx[2] - sx[0], y20 = sy[2] - sy[0], z20 = z[2] - z[0];
+				const float det = x10 * y20 - x20 * y10;
+				const float dzdx = (z10 * y20 - z20 * y10) / det;
+				const float dzdy = (x10 * z20 - x20 * z10) / det;
+
+				const float maxZ = (std::max)({ z[0], z[1], z[2] });
+				const float bias = ComputeDepthBias(_desc, maxZ, (std::max)(std::fabs(dzdx), std::fabs(dzdy)));
+
+				// ӊ֐ E(p) = (b - a) x (p - a)Bニ[ŁA / ̕ӂ̏ɂsNZ܂߂
+				int64_t rowE[3]{};
+				int64_t stepX[3]{};
+				int64_t stepY[3]{};
+				const int64_t px0 = pxMin * SUBPIXEL_SCALE + HALF;
+				const int64_t py0 = pyMin * SUBPIXEL_SCALE + HALF;
+				for (int i = 0; i < 3; ++i) {
+					const int a = (i + 1) % 3;
+					const int b = (i + 2) % 3;
+					const int64_t dx = x[b] - x[a];
+					const int64_t dy = y[b] - y[a];
+					const bool topLeft = (dy < 0) || (dy == 0 && dx > 0);
+					rowE[i] = dx * (py0 - y[a]) - dy * (px0 - x[a]) - (topLeft ? 0 : 1);
+					stepX[i] = -dy * SUBPIXEL_SCALE;
+					stepY[i] = dx * SUBPIXEL_SCALE;
+				}
+
+				const int32_t pitch = _x1 - _x0;
+				for (int32_t py = pyMin; py <= pyMax; ++py) {
+					int64_t e0 = rowE[0], e1 = rowE[1], e2 = rowE[2];
+					float* row = _depth + static_cast<size_t>(py - _imageY0) * pitch;
+					const float cy = (py + 0.5f) - sy[0];
+					for (int32_t px = pxMin; px <= pxMax; ++px) {
+						if ((e0 | e1 | e2) >= 0) {
+							const float cx = (px + 0.5f) - sx[0];
+							float depth = z[0] + dzdx * cx + dzdy * cy + bias;
+							depth = (std::min)((std::max)(depth, 0.0f), 1.0f);	// r[|[g̐[x͈
+							float& stored = row[px - _x0];
+							if (depth <= stored) { stored = depth; }	// D3D11_COMPARISON_LESS_EQUAL
+						}
+						e0 += stepX[0]; e1 += stepX[1]; e2 += stepX[2];
+					}
+					rowE[0] += stepY[0]; rowE[1] += stepY[1]; rowE[2] += stepY[2];
+				}
+			}
+
+			/**
+			 * @brief NbvW̑p`ʂŐ؂(Sutherland-Hodgman)
+			 * @return ؂̒_
+			 */
+			int ClipPolygon(ClipVertex* _poly, int _count, uint8_t _planes)
+			{
+				ClipVertex tmp[MAX_CLIP_VERTICES];
+				for (int p = 0; p < CLIP_PLANE_COUNT && _count > 0; ++p) {
+					if ((_planes & (1u << p)) == 0) { continue; }
+
+					int outCount = 0;
+					for (int i = 0; i < _count; ++i) {
+						const ClipVertex& cur = _poly[i];
+						const ClipVertex& next = _poly[(i + 1) % _count];
+						const float dc = PlaneDistance(cur.v, p);
+						const float dn = PlaneDistance(next.v, p);
+						if (dc >= 0.0f) { tmp[outCount++] = cur; }
+						if ((dc >= 0.0f) != (dn >= 0.0f)) {
+							const float t = dc / (dc - dn);
+							ClipVertex& v = tmp[outCount++];
+							for (int k = 0; k < 4; ++k) {
+								v.v[k] = cur.v[k] + (next.v[k] - cur.v[k]) * t;
+							}
+						}
+					}
+					std::copy(tmp, tmp + outCount, _poly);
+					_count = outCount;
+				}
+				return _count;
+			}
+		}
+
+		//! @brief _Cg̋ԂɓeAVhE}bvOɌ܂锻s
+		ShadowProjection ProjectShadowTestPoint(const ShadowLightParams& _light, const float* _point, uint32_t _width, uint32_t _height)
+		{
+			ShadowProjection out{};
+
+			// Cgʒu|Cgւ̃xNgƋ
+			const float toPoint[3] = {
+				_point[0] - _light.lightPos[0],
+				_point[1] - _light.lightPos[1],
+				_point[2] - _light.lightPos[2]
+			};
+			const float dist = std::sqrt(toPoint[0] * toPoint[0] + toPoint[1] * toPoint[1] + toPoint[2] * toPoint[2]);
+			// Cg֏ItZbg
+			const float invLen = 1.0f / dist;
+			const float biasedP[3] = {
+				_point[0] + (-toPoint[0] * invLen) * NORMAL_BIAS,
+				_point[1] + (-toPoint[1] * invLen) * NORMAL_BIAS,
+				_point[2] + (-toPoint[2] * invLen) * NORMAL_BIAS
+			};
+
+			// NbvWɕϊ
+			float clip[4];
+			TransformPoint(biasedP, _light.lightViewProj, clip);
+			if (std::fabs(clip[3]) < ZERO_W_EPSILON) {
+				out.flag = ShadowTestFlag::ZeroW;
+				return out;
+			}
+			// UVWϊ
+			const float u = (clip[0] / clip[3]) * 0.5f + 0.5f;
+			const float v = (clip[1] / clip[3]) * -0.5f + 0.5f;
+			const float z = clip[2] / clip[3];
+
+			if (u < 0.0f || u > 1.0f || v < 0.0f || v > 1.0f) {
+				out.flag = ShadowTestFlag::OutUV;
+				return out;
+			}
+			if (z < 0.0f || z > 1.0f) {
+				out.flag = ShadowTestFlag::OutZ;
+				return out;
+			}
+			if (dist > _light.lightRange) {
+				out.flag = ShadowTestFlag::OutRange;
+				return out;
+			}
+			const float cosAngle =
+				(toPoint[0] / dist) * _light.lightDir[0] +
+				(toPoint[1] / dist) * _light.lightDir[1] +
+				(toPoint[2] / dist) * _light.lightDir[2];
+			if (cosAngle < _light.cosOuterAngle) {
+				out.flag = ShadowTestFlag::OutSideCone;
+				return out;
+			}
+
+			// |CgTvÕeNZ(u == 1̓{[_[)
+			out.needsSample = true;
+			out.depth = z;
+			const float tu = std::floor(u * static_cast<float>(_width));
+			const float tv = std::floor(v * static_cast<float>(_height));
+			// NaN(_ƃCgdȂĂ)̓{[_[̊OƂĈ
+			out.texelX = (tu >= 0.0f && tu < static_cast<float>(_width)) ? static_cast<int32_t>(tu) : -1;
+			out.texelY = (tv >= 0.0f && tv < static_cast<float>(_height)) ? static_cast<int32_t>(tv) : -1;
+			return out;
+		}
+
+		//! @brief e̎s
+		void SoftwareShadowTester::Execute(const std::vector<ShadowLightParams>& _lights, const std::vector<ShadowCaster>& _casters,
+			const float* _points, uint32_t _pointCount, JobSystem* _jobSystem, std::vector<ShadowTestFlag>& _outFlags)
+		{
+			const uint32_t lightCount = static_cast<uint32_t>(_lights.size());
+			_outFlags.assign(static_cast<size_t>(lightCount) * _pointCount, ShadowTestFlag::Lit);
+			last_rasterized_texels_ = 0;
+			if (lightCount == 0 || _pointCount == 0) { return; }
+
+			auto parallelFor = [_jobSystem](uint32_t _count, uint32_t _grain, auto&& _func) {
+				if (_jobSystem) { _jobSystem->ParallelFor(0, _count, _grain, _func); }
+				else { _func(0u, _count); }
+			};
+
+			lights_.resize(lightCount);
+			projections_.resize(static_cast<size_t>(lightCount) * _pointCount);
+
+			// 1. eƒ_ϊ(Cg)
+			parallelFor(lightCount, 1, [&](uint32_t _begin, uint32_t _end) {
+				for (uint32_t l = _begin; l < _end; ++l) {
+					PrepareLight(l, _lights, _casters, _points, _pointCount);
+				}
+				});
+
+			// 2. X^CY(Cg x т)
+			tasks_.clear();
+			for (uint32_t l = 0; l < lightCount; ++l) {
+				const LightWork& work = lights_[l];
+				for (int32_t y = work.y0; y < work.y1; y += BAND_ROWS) {
+					tasks_.push_back({ l, y, (std::min)(y + BAND_ROWS, work.y1) });
+				}
+				last_rasterized_texels_ += static_cast<uint64_t>(work.x1 - work.x0) * static_cast<uint64_t>(work.y1 - work.y0);
+			}
+			parallelFor(static_cast<uint32_t>(tasks_.size()), 1, [&](uint32_t _begin, uint32_t _end) {
+				for (uint32_t t = _begin; t < _end; ++t) {
+					RasterizeBand(tasks_[t], _casters);
+				}
+				});
+
+			// 3. [x̔r(_)
+			parallelFor(_pointCount, POINT_GRAIN_SIZE, [&](uint32_t _begin, uint32_t _end) {
+				for (uint32_t i = _begin; i < _end; ++i) {
+					for (uint32_t l = 0; l < lightCount; ++l) {
+						const size_t index = static_cast<size_t>(l) * _pointCount + i;
+						const ShadowProjection& proj = projections_[index];
+						if (!proj.needsSample) {
+							_outFlags[index] = proj.flag;
+							continue;
+						}
+						// SampleCmpLevelZero(POINT, LESS_EQUAL, {[_[1.0)
+						const LightWork& work = lights_[l];
+						float stored = 1.0f;
+						if (proj.texelX >= 0 && proj.texelY >= 0) {
+							stored = work.depth[static_cast<size_t>(proj.texelY - work.y0) * (work.x1 - work.x0) + (proj.texelX - work.x0)];
+						}
+						_outFlags[index] = (proj.depth <= stored) ? ShadowTestFlag::Lit : ShadowTestFlag::Shadow;
+					}
+				}
+				});
+		}
+
+		/**
+		 * @brief Cg̏
+		 *	_𓊉eĐ[x摜KvȔ͈͂߁A͈̔͂Ό`̒_NbvWɕϊ
+		 */
+		void SoftwareShadowTester::PrepareLight(uint32_t _light, const std::vector<ShadowLightParams>& _lights, const std::vector<ShadowCaster>& _casters,
+			const float* _points, uint32_t _pointCount)
+		{
+			const ShadowLightParams& light = _lights[_light];
+			LightWork& work = lights_[_light];
+
+			// _̓eƁArɎgeNZ͈̔
+			int32_t x0 = INT32_MAX, y0 = INT32_MAX, x1 = INT32_MIN, y1 = INT32_MIN;
+			for (uint32_t i = 0; i < _pointCount; ++i) {
+				ShadowProjection& proj = projections_[static_cast<size_t>(_light) * _pointCount + i];
+				proj = ProjectShadowTestPoint(light, _points + static_cast<size_t>(i) * 3, desc_.width, desc_.height);
+				if (!proj.needsSample || proj.texelX < 0 || proj.texelY < 0) { continue; }
+				x0 = (std::min)(x0, proj.texelX);
+				y0 = (std::min)(y0, proj.texelY);
+				x1 = (std::max)(x1, proj.texelX + 1);
+				y1 = (std::max)(y1, proj.texelY + 1);
+			}
+			if (x1 <= x0) {
+				work.x0 = work.y0 = work.x1 = work.y1 = 0;
+				return;
+			}
+			work.x0 = x0; work.y0 = y0; work.x1 = x1; work.y1 = y1;
+			work.depth.assign(static_cast<size_t>(x1 - x0) * (y1 - y0), 1.0f);	// NAl
+
+			// _̕ϊ(VS_ShadowƓ[h -> Cg̏Ɋ|)
+			uint32_t vertexCount = 0;
+			work.vertexOffsets.resize(_casters.size());
+			for (size_t c = 0; c < _casters.size(); ++c) {
+				work.vertexOffsets[c] = vertexCount;
+				vertexCount += _casters[c].vertexCount;
+			}
+			work.clip.resize(static_cast<size_t>(vertexCount) * 4);
+			work.screen.resize(static_cast<size_t>(vertexCount) * 3);
+			work.outcodes.resize(vertexCount);
+
+			const float width = static_cast<float>(desc_.width);
+			const float height = static_cast<float>(desc_.height);
+			for (size_t c = 0; c < _casters.size(); ++c) {
+				const ShadowCaster& caster = _casters[c];
+				const uint32_t base = work.vertexOffsets[c];
+				for (uint32_t v = 0; v < caster.vertexCount; ++v) {
+					float wp[4];
+					TransformPoint(caster.positions + static_cast<size_t>(v) * 3, caster.world, wp);
+					float* clip = &work.clip[static_cast<size_t>(base + v) * 4];
+					for (int j = 0; j < 4; ++j) {
+						clip[j] = wp[0] * light.lightViewProj[j] + wp[1] * light.lightViewProj[4 + j] + wp[2] * light.lightViewProj[8 + j] + wp[3] * light.lightViewProj[12 + j];
+					}
+					const uint8_t code = ComputeOutcode(clip);
+					work.outcodes[base + v] = code;
+					if (code == 0) {
+						const ScreenVertex s = ToScreen(clip, width, height);
+						float* screen = &work.screen[static_cast<size_t>(base + v) * 3];
+						screen[0] = s.x; screen[1] = s.y; screen[2] = s.z;
+					}
+				}
+			}
+		}
+
+		//! @brief ш̃X^CY
+		void SoftwareShadowTester::RasterizeBand(const BandTask& _task, const std::vector<ShadowCaster>& _casters)
+		{
+			LightWork& work = lights_[_task.light];
+			float* depth = work.depth.data();
+			const float width = static_cast<float>(desc_.width);
+			const float height = static_cast<float>(desc_.height);
+			// т̊Oɂ邩(sNZSȂƂmȕ1sNZ]T)
+			const float bandX0 = static_cast<float>(work.x0) - 1.0f;
+			const float bandX1 = static_cast<float>(work.x1) + 1.0f;
+			const float bandY0 = static_cast<float>(_task.y0) - 1.0f;
+			const float bandY1 = static_cast<float>(_task.y1) + 1.0f;
+
+			for (size_t c = 0; c < _casters.size(); ++c) {
+				const ShadowCaster& caster = _casters[c];
+				const uint32_t base = work.vertexOffsets[c];
+
+				for (uint32_t i = 0; i + 2 < caster.indexCount; i += 3) {
+					const uint32_t idx[3] = { caster.indices[i], caster.indices[i + 1], caster.indices[i + 2] };
+					if (idx[0] >= caster.vertexCount || idx[1] >= caster.vertexCount || idx[2] >= caster.vertexCount) { continue; }
+
+					const uint8_t oc[3] = { work.outcodes[base + idx[0]], work.outcodes[base + idx[1]], work.outcodes[base + idx[2]] };
+					// S_ʂ̊O
+					if ((oc[0] & oc[1] & oc[2] & ~CLIP_W) != 0) { continue; }
+
+					// Nbvsv
+					if ((oc[0] | oc[1] | oc[2]) == 0) {
+						ScreenVertex s[3];
+						for (int k = 0; k < 3; ++k) {
+							const float* p = &work.screen[static_cast<size_t>(base + idx[k]) * 3];
+							s[k] = { p[0], p[1], p[2] };
+						}
+						if ((std::max)({ s[0].x, s[1].x, s[2].x }) < bandX0 || (std::min)({ s[0].x, s[1].x, s[2].x }) > bandX1 ||
+							(std::max)({ s[0].y, s[1].y, s[2].y }) < bandY0 || (std::min)({ s[0].y, s[1].y, s[2].y }) > bandY1) {
+							continue;
+						}
+						DrawTriangle(s[0], s[1], s[2], desc_, depth, work.x0, work.x1, work.y0, _task.y0, _task.y1);
+						continue;
+					}
+
+					// NbvĐ`ɕ
+					ClipVertex poly[MAX_CLIP_VERTICES];
+					for (int k = 0; k < 3; ++k) {
+						std::copy_n(&work.clip[static_cast<size_t>(base + idx[k]) * 4], 4, poly[k].v);
+					}
+					const int count = ClipPolygon(poly, 3, static_cast<uint8_t>((oc[0] | oc[1] | oc[2]) & ~CLIP_W));
+					if (count < 3) { continue; }
+
+					ScreenVertex s[MAX_CLIP_VERTICES];
+					bool valid = true;
+					for (int k = 0; k < count; ++k) {
+						if (poly[k].v[3] <= 0.0f) { valid = false; break; }
+						s[k] = ToScreen(poly[k].v, width, height);
+					}
+					if (!valid) { continue; }
+					for (int k = 1; k + 1 < count; ++k) {
+						DrawTriangle(s[0], s[k], s[k + 1], desc_, depth, work.x0, work.x1, work.y0, _task.y0, _task.y1);
+					}
+				}
+			}
+		}
+	}
+}
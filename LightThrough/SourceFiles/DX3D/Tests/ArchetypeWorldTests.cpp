@@ -0,0 +1,254 @@
+/**
+ * @file ArchetypeWorldTests.cpp
+ * @brief ArchetypeWorld(`ÑXg[W)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <Game/ECS/ArchetypeWorld.h>
+#include <Game/ECS/ComponentArray.h>
+#include "TestFramework.h"
+
+namespace {
+	// eXgpComponent(Transform / Rigidbody / Collider炢̑傫)
+	struct Position { float x = 0.0f, y = 0.0f, z = 0.0f; };
+	struct Velocity { float x = 0.0f, y = 0.0f, z = 0.0f; };
+	struct Bounds { float min[3]{}; float max[3]{}; };
+
+	/**
+	 * @brief Ă鐔𐔂Component([u / j̘R)
+	 */
+	struct Tracked {
+		static inline int alive = 0;
+		std::string name{};
+
+		Tracked() { ++alive; }
+		explicit Tracked(std::string _name) : name(std::move(_name)) { ++alive; }
+		Tracked(const Tracked& _other) : name(_other.name) { ++alive; }
+		Tracked(Tracked&& _other) noexcept : name(std::move(_other.name)) { ++alive; }
+		~Tracked() { --alive; }
+	};
+
+	constexpr ecs::ComponentType POSITION = 0;
+	constexpr ecs::ComponentType VELOCITY = 1;
+	constexpr ecs::ComponentType BOUNDS = 2;
+	constexpr ecs::ComponentType TRACKED = 3;
+
+	ecs::Entity MakeEntity(uint32_t _index, uint32_t _version = 1)
+	{
+		return ecs::Entity(ecs::CreateEntity(_index, _version));
+	}
+
+	void RegisterTypes(ecs::ArchetypeWorld& _world)
+	{
+		_world.RegisterComponentType(POSITION, ecs::ComponentTypeInfo::Make<Position>());
+		_world.RegisterComponentType(VELOCITY, ecs::ComponentTypeInfo::Make<Velocity>());
+		_world.RegisterComponentType(BOUNDS, ecs::ComponentTypeInfo::Make<Bounds>());
+		_world.RegisterComponentType(TRACKED, ecs::ComponentTypeInfo::Make<Tracked>());
+	}
+
+	template<typename Com>
+	Com& Get(ecs::ArchetypeWorld& _world, ecs::Entity _e, ecs::ComponentType _type)
+	{
+		return *static_cast<Com*>(_world.GetComponent(_e, _type));
+	}
+}
+
+TEST_CASE(ArchetypeWorld, AddMovesBetweenArchetypesAndKeepsValues)
+{
+	ecs::ArchetypeWorld world;
+	RegisterTypes(world);
+
+	const auto e = MakeEntity(5);
+	const Position p{ 1.0f, 2.0f, 3.0f };
+	const Velocity v{ 4.0f, 5.0f, 6.0f };
+	world.AddComponent(e, POSITION, &p);
+	CHECK(world.GetArchetypeCount() == 1);
+	world.AddComponent(e, VELOCITY, &v);
+	CHECK(world.GetArchetypeCount() == 2);
+
+	CHECK(world.HasComponent(e, POSITION));
+	CHECK(world.HasComponent(e, VELOCITY));
+	CHECK(!world.HasComponent(e, BOUNDS));
+	CHECK(Get<Position>(world, e, POSITION).y == 2.0f);
+	CHECK(Get<Velocity>(world, e, VELOCITY).z == 6.0f);
+
+	// 폜Ō̃A[L^Cv֖߂(ӂ̃LbVŐV͍Ȃ)
+	world.RemoveComponent(e, VELOCITY);
+	CHECK(world.GetArchetypeCount() == 2);
+	CHECK(!world.HasComponent(e, VELOCITY));
+	CHECK(Get<Position>(world, e, POSITION).x == 1.0f);
+
+	// ŌComponentƍsƖȂ
+	world.RemoveComponent(e, POSITION);
+	CHECK(!world.HasComponent(e, POSITION));
+}
+
+TEST_CASE(ArchetypeWorld, MoveFillsHoleWithLastRow)
+{
+	ecs::ArchetypeWorld world;
+	RegisterTypes(world);
+
+	// A[L^CvɕׂĂA擪ʂ̃A[L^Cvֈڂ
+	std::vector<ecs::Entity> entities;
+	for (uint32_t i = 0; i < 8; ++i) {
+		entities.push_back(MakeEntity(i));
+		const Position p{ static_cast<float>(i), 0.0f, 0.0f };
+		world.AddComponent(entities.back(), POSITION, &p);
+	}
+	const Velocity v{ 9.0f, 0.0f, 0.0f };
+	world.AddComponent(entities[0], VELOCITY, &v);
+	world.AddComponent(entities[3], VELOCITY, &v);
+
+	// ߂œs܂߂āAS̒lwĂ
+	for (uint32_t i = 0; i < 8; ++i) {
+		CHECK(Get<Position>(world, entities[i], POSITION).x == static_cast<float>(i));
+		CHECK(world.HasComponent(entities[i], VELOCITY) == (i == 0 || i == 3));
+	}
+
+	world.EntityDestroyed(entities[7]);
+	world.RemoveComponent(entities[0], VELOCITY);
+	for (uint32_t i = 0; i < 7; ++i) {
+		CHECK(Get<Position>(world, entities[i], POSITION).x == static_cast<float>(i));
+	}
+	CHECK(!world.HasComponent(entities[7], POSITION));
+}
+
+TEST_CASE(ArchetypeWorld, ManyEntitiesAcrossChunks)
+{
+	ecs::ArchetypeWorld world;
+	RegisterTypes(world);
+
+	// 1`Nɓ肫ȂāAʂ̃A[L^Cvֈڂ
+	const uint32_t count = 5000;
+	for (uint32_t i = 0; i < count; ++i) {
+		const Position p{ static_cast<float>(i), 0.0f, 0.0f };
+		world.AddComponent(MakeEntity(i), POSITION, &p);
+	}
+	for (uint32_t i = 0; i < count; i += 2) {
+		const Velocity v{ static_cast<float>(i) * 2.0f, 0.0f, 0.0f };
+		world.AddComponent(MakeEntity(i), VELOCITY, &v);
+	}
+
+	uint32_t both = 0;
+	bool valuesMatch = true;
+	world.ForEach<Position, Velocity>({ POSITION, VELOCITY }, [&](ecs::Entity _e, Position& _p, Velocity& _v) {
+		++both;
+		valuesMatch = valuesMatch && (_e.Index() % 2 == 0) && (_v.x == _p.x * 2.0f) && (_p.x == static_cast<float>(_e.Index()));
+	});
+	CHECK(both == count / 2);
+	CHECK(valuesMatch);
+
+	uint32_t all = 0;
+	world.ForEach<Position>({ POSITION }, [&](ecs::Entity, Position&) { ++all; });
+	CHECK(all == count);
+}
+
+TEST_CASE(ArchetypeWorld, StaleVersionIsNotFound)
+{
+	ecs::ArchetypeWorld world;
+	RegisterTypes(world);
+
+	const Position p{};
+	const auto oldEntity = MakeEntity(2, 1);
+	world.AddComponent(oldEntity, POSITION, &p);
+	world.EntityDestroyed(oldEntity);
+
+	// IndexʂVersionŎg
+	const auto newEntity = MakeEntity(2, 2);
+	world.AddComponent(newEntity, VELOCITY, &p);
+	CHECK(!world.HasComponent(oldEntity, VELOCITY));
+	CHECK(!world.HasComponent(newEntity, POSITION));
+	CHECK(world.HasComponent(newEntity, VELOCITY));
+}
+
+TEST_CASE(ArchetypeWorld, NonTrivialComponentsAreMovedAndDestroyed)
+{
+	Tracked::alive = 0;
+	{
+		ecs::ArchetypeWorld world;
+		RegisterTypes(world);
+
+		const Tracked name("long enough to leave the small string buffer");
+		const Position p{};
+		for (uint32_t i = 0; i < 100; ++i) {
+			world.AddComponent(MakeEntity(i), TRACKED, &name);
+		}
+		CHECK(Tracked::alive == 101);
+
+		// A[L^CvԂ̈ړƌ߂Œgc
+		for (uint32_t i = 0; i < 100; i += 3) {
+			world.AddComponent(MakeEntity(i), POSITION, &p);
+		}
+		for (uint32_t i = 0; i < 100; i += 5) {
+			world.EntityDestroyed(MakeEntity(i));
+		}
+		CHECK(Tracked::alive == 1 + 80);
+		for (uint32_t i = 1; i < 100; ++i) {
+			if (i % 5 == 0) { continue; }
+			CHECK(Get<Tracked>(world, MakeEntity(i), TRACKED).name == name.name);
+		}
+	}
+	// [hjS
+	CHECK(Tracked::alive == 0);
+}
+
+BENCH_CASE(ArchetypeWorld, IterationVsComponentArray)
+{
+	// Position + Velocity + BoundsEntity𑖍čXV(1Entityns)
+	// ComponentArrayłCoordinator::ForEachSparseSetƓAEntitÿꗗ^ƂGet
+	const int repeat = 20;
+	for (uint32_t count : { 10000u, 100000u, 1000000u }) {
+		std::vector<ecs::Entity> entities(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			entities[i] = MakeEntity(i);
+		}
+
+		ecs::ComponentArray<Position> positions;
+		ecs::ComponentArray<Velocity> velocities;
+		ecs::ComponentArray<Bounds> bounds;
+		ecs::ArchetypeWorld world;
+		RegisterTypes(world);
+		for (uint32_t i = 0; i < count; ++i) {
+			const Position p{ static_cast<float>(i), 0.0f, 0.0f };
+			const Velocity v{ 1.0f, 2.0f, 3.0f };
+			const Bounds b{};
+			// ǉ鏇Ԃ^ƂɕςāAȔz̕т炷(ۂ̃V[Ɠ)
+			positions.Insert(entities[i], p);
+			velocities.Insert(entities[count - 1 - i], v);
+			bounds.Insert(entities[static_cast<uint32_t>((static_cast<uint64_t>(i) * 7919u) % count)], b);
+			world.AddComponent(entities[i], POSITION, &p);
+			world.AddComponent(entities[i], VELOCITY, &v);
+			world.AddComponent(entities[i], BOUNDS, &b);
+		}
+
+		auto update = [](Position& _p, const Velocity& _v, Bounds& _b) {
+			_p.x += _v.x * 0.016f;
+			_p.y += _v.y * 0.016f;
+			_p.z += _v.z * 0.016f;
+			_b.min[0] = _p.x - 0.5f;
+			_b.max[0] = _p.x + 0.5f;
+		};
+
+		const double sparseMs = test::MeasureMs(repeat, [&]() {
+			for (auto e : entities) {
+				update(positions.Get(e), velocities.Get(e), bounds.Get(e));
+			}
+		});
+		const double archetypeMs = test::MeasureMs(repeat, [&]() {
+			world.ForEach<Position, Velocity, Bounds>({ POSITION, VELOCITY, BOUNDS },
+				[&](ecs::Entity, Position& _p, Velocity& _v, Bounds& _b) { update(_p, _v, _b); });
+		});
+		test::DoNotOptimize(positions.Get(entities[0]));
+		test::DoNotOptimize(Get<Position>(world, entities[0], POSITION));
+
+		const double perEntity = 1.0e6 / static_cast<double>(count);	// ms -> ns/entity
+		std::printf("    %8u entities | ComponentArray x3 %6.2f ns | archetype chunks %6.2f ns | x%.1f\n",
+			count, sparseMs * perEntity, archetypeMs * perEntity, sparseMs / archetypeMs);
+	}
+}
@@ -0,0 +1,354 @@
+/**
+ * @file BoxContactTests.cpp
+ * @brief m̐ڐG_̐(ʂ̃NbsO)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <Game/Collisions/BoxContact.h>
+#include <Game/Collisions/NarrowPhaseBatch.h>
+#include "TestFramework.h"
+
+using dx3d::collision::ContactBox;
+using dx3d::collision::ContactPointInput;
+using dx3d::collision::GenerateBoxContacts;
+using dx3d::collision::ReduceContactPoints;
+using dx3d::collision::MAX_MANIFOLD_POINTS;
+
+namespace {
+	constexpr float PI = 3.14159265f;
+	constexpr float EPS = 1.0e-4f;
+
+	//! @brief SAT̎̔ԍ(IntersectOBBƓ:  * 2 + ])
+	constexpr uint32_t FaceA(uint32_t _axis) { return _axis * 2; }
+	constexpr uint32_t FaceB(uint32_t _axis) { return (3 + _axis) * 2; }
+	constexpr uint32_t Edge(uint32_t _edgeA, uint32_t _edgeB) { return (6 + _edgeA * 3 + _edgeB) * 2; }
+
+	ContactBox MakeBox(float _x, float _y, float _z, float _hx, float _hy, float _hz)
+	{
+		ContactBox box{};
+		box.center[0] = _x; box.center[1] = _y; box.center[2] = _z;
+		box.half[0] = _hx; box.half[1] = _hy; box.half[2] = _hz;
+		return box;
+	}
+
+	//! @brief _axis(0: x, 1: y, 2: z)ɉ
+	void Rotate(ContactBox& _box, int _axis, float _radian)
+	{
+		const float c = std::cos(_radian), s = std::sin(_radian);
+		const int u = (_axis + 1) % 3;
+		const int v = (_axis + 2) % 3;
+		for (auto& a : _box.axis) {
+			const float pu = a[u], pv = a[v];
+			a[u] = c * pu - s * pv;
+			a[v] = s * pu + c * pv;
+		}
+	}
+
+	//! @brief _̒(̌덷͋)ɂ邩
+	bool InsideBox(const ContactBox& _box, const float* _p, float _margin)
+	{
+		for (int k = 0; k < 3; ++k) {
+			float d = 0.0f;
+			for (int c = 0; c < 3; ++c) { d += (_p[c] - _box.center[c]) * _box.axis[k][c]; }
+			if (std::fabs(d) > _box.half[k] + _margin) { return false; }
+		}
+		return true;
+	}
+
+	bool HasPointNear(const ContactPointInput* _points, uint32_t _count, float _x, float _y, float _z)
+	{
+		for (uint32_t i = 0; i < _count; ++i) {
+			const float* p = _points[i].position;
+			if (std::fabs(p[0] - _x) < 1.0e-3f && std::fabs(p[1] - _y) < 1.0e-3f && std::fabs(p[2] - _z) < 1.0e-3f) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	const float UP[3] = { 0.0f, 1.0f, 0.0f };
+}
+
+TEST_CASE(BoxContact, BoxRestingOnFloorGivesFourCorners)
+{
+	// (A)̏ʂɁA0.1߂荞񂾗(B)
+	const ContactBox floor = MakeBox(0, 0, 0, 5, 0.5f, 5);
+	const ContactBox box = MakeBox(1, 0.9f, -2, 0.5f, 0.5f, 0.5f);
+
+	ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+	const uint32_t count = GenerateBoxContacts(floor, box, UP, 0.1f, FaceA(1), points);
+	CHECK(count == 4);
+	for (float x : { 0.5f, 1.5f }) {
+		for (float z : { -2.5f, -1.5f }) {
+			// ڐG_͓̖ʂ̒
+			CHECK(HasPointNear(points, count, x, 0.45f, z));
+		}
+	}
+	for (uint32_t i = 0; i < count; ++i) {
+		CHECK_NEAR(points[i].penetration, 0.1f, EPS);
+	}
+}
+
+TEST_CASE(BoxContact, RotatedBoxOnFloorKeepsRotatedCorners)
+{
+	const ContactBox floor = MakeBox(0, 0, 0, 5, 0.5f, 5);
+	ContactBox box = MakeBox(0, 0.95f, 0, 0.5f, 0.5f, 0.5f);
+	Rotate(box, 1, PI / 4.0f);
+
+	ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+	const uint32_t count = GenerateBoxContacts(floor, box, UP, 0.05f, FaceA(1), points);
+	CHECK(count == 4);
+	const float r = 0.5f * std::sqrt(2.0f);
+	CHECK(HasPointNear(points, count, r, 0.475f, 0));
+	CHECK(HasPointNear(points, count, -r, 0.475f, 0));
+	CHECK(HasPointNear(points, count, 0, 0.475f, r));
+	CHECK(HasPointNear(points, count, 0, 0.475f, -r));
+}
+
+TEST_CASE(BoxContact, ReferenceFaceOnB)
+{
+	// 傫Ȕ(B)Ȕ(A)̏ɏBʂB̉
+	const ContactBox box = MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f);
+	const ContactBox plate = MakeBox(0, 0.7f, 0, 4, 0.25f, 4);
+
+	ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+	const uint32_t count = GenerateBoxContacts(box, plate, UP, 0.05f, FaceB(1) + 1, points);
+	CHECK(count == 4);
+	for (float x : { -0.5f, 0.5f }) {
+		for (float z : { -0.5f, 0.5f }) {
+			CHECK(HasPointNear(points, count, x, 0.475f, z));
+		}
+	}
+}
+
+TEST_CASE(BoxContact, PartialFaceOverlapIsClipped)
+{
+	// 傫̔x0.7炵ďd˂ -> dȂlp`(x: 0.2 ` 0.5)̎l
+	const ContactBox lower = MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f);
+	const ContactBox upper = MakeBox(0.7f, 0.98f, 0, 0.5f, 0.5f, 0.5f);
+
+	ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+	const uint32_t count = GenerateBoxContacts(lower, upper, UP, 0.02f, FaceA(1), points);
+	CHECK(count == 4);
+	for (float x : { 0.2f, 0.5f }) {
+		for (float z : { -0.5f, 0.5f }) {
+			CHECK(HasPointNear(points, count, x, 0.49f, z));
+		}
+	}
+}
+
+TEST_CASE(BoxContact, TiltedBoxTouchesWithOneEdge)
+{
+	// zɌX́A̕ӂ̓_艺ɏo
+	const ContactBox floor = MakeBox(0, 0, 0, 5, 0.5f, 5);
+	ContactBox box = MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f);
+	Rotate(box, 2, 10.0f * PI / 180.0f);
+	// ԒႢpy = 0.45(߂荞0.05)ɂȂ悤ɒu
+	const float lowest = 0.5f * (std::cos(10.0f * PI / 180.0f) + std::sin(10.0f * PI / 180.0f));
+	box.center[1] = 0.45f + lowest;
+
+	ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+	const uint32_t count = GenerateBoxContacts(floor, box, UP, 0.05f, FaceA(1), points);
+	CHECK(count == 2);
+	for (uint32_t i = 0; i < count; ++i) {
+		CHECK_NEAR(points[i].penetration, 0.05f, EPS);
+		CHECK_NEAR(points[i].position[1], 0.475f, EPS);
+	}
+	CHECK(points[0].featureId != points[1].featureId);
+}
+
+TEST_CASE(BoxContact, EdgeEdgeGivesOnePoint)
+{
+	// z45x񂵂(A)̏̕ӂƁAx45x񂵂(B)̉̕ӂ
+	const float r = 0.5f * std::sqrt(2.0f);
+	ContactBox a = MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f);
+	ContactBox b = MakeBox(0, 2.0f * r - 0.06f, 0, 0.5f, 0.5f, 0.5f);
+	Rotate(a, 2, PI / 4.0f);
+	Rotate(b, 0, PI / 4.0f);
+
+	ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+	const uint32_t count = GenerateBoxContacts(a, b, UP, 0.06f, Edge(2, 0), points);
+	CHECK(count == 1);
+	CHECK(HasPointNear(points, count, 0, r - 0.03f, 0));
+	CHECK_NEAR(points[0].penetration, 0.06f, EPS);
+}
+
+TEST_CASE(BoxContact, MaxPointsIsRespected)
+{
+	const ContactBox floor = MakeBox(0, 0, 0, 5, 0.5f, 5);
+	ContactBox box = MakeBox(0, 0.95f, 0, 0.5f, 0.5f, 0.5f);
+	Rotate(box, 1, 0.3f);
+
+	for (uint32_t maxPoints = 1; maxPoints <= MAX_MANIFOLD_POINTS; ++maxPoints) {
+		ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+		CHECK(GenerateBoxContacts(floor, box, UP, 0.05f, FaceA(1), points, maxPoints) == maxPoints);
+	}
+}
+
+TEST_CASE(BoxContact, ReduceKeepsDeepestAndWidestPoints)
+{
+	// p`̔_(_0Ԑ[) -> l_Ɍ炷ƈԐ[_ƁAL̑傫_c
+	ContactPointInput points[8]{};
+	for (uint32_t i = 0; i < 8; ++i) {
+		const float angle = static_cast<float>(i) * PI / 4.0f;
+		points[i].position[0] = std::cos(angle);
+		points[i].position[2] = std::sin(angle);
+		points[i].penetration = (i == 0) ? 0.2f : 0.1f;
+		points[i].featureId = i;
+	}
+
+	const uint32_t count = ReduceContactPoints(points, 8, UP, 4);
+	CHECK(count == 4);
+	CHECK(points[0].featureId == 0);
+	CHECK(points[1].featureId == 4);	// Ԑ[_̔Α
+
+	// clp`̖ʐ(p`̖ʐς̔ȏ͎cĂ)
+	float area = 0.0f;
+	uint32_t order[4] = { 0, 1, 2, 3 };
+	std::sort(order, order + 4, [&](uint32_t _a, uint32_t _b) {
+		return std::atan2(points[_a].position[2], points[_a].position[0]) < std::atan2(points[_b].position[2], points[_b].position[0]);
+	});
+	for (uint32_t i = 0; i < 4; ++i) {
+		const float* p = points[order[i]].position;
+		const float* q = points[order[(i + 1) % 4]].position;
+		area += p[0] * q[2] - q[0] * p[2];
+	}
+	CHECK(std::fabs(area) * 0.5f >= 1.99f);	// `(ʐ2)ɂȂ
+
+	CHECK(ReduceContactPoints(points, 3, UP, 4) == 3);	// ȉȂ炻̂܂
+}
+
+TEST_CASE(BoxContact, FeatureIdsAreStableUnderSmallMotion)
+{
+	// ĂڐG_ɂ͓ԍt(EH[X^[gp)
+	const ContactBox floor = MakeBox(0, 0, 0, 5, 0.5f, 5);
+	ContactBox box = MakeBox(0, 0.95f, 0, 0.5f, 0.5f, 0.5f);
+	Rotate(box, 1, 0.2f);
+
+	ContactPointInput before[MAX_MANIFOLD_POINTS]{};
+	const uint32_t countBefore = GenerateBoxContacts(floor, box, UP, 0.05f, FaceA(1), before);
+	box.center[0] += 0.01f;
+	box.center[1] -= 0.005f;
+	ContactPointInput after[MAX_MANIFOLD_POINTS]{};
+	const uint32_t countAfter = GenerateBoxContacts(floor, box, UP, 0.055f, FaceA(1), after);
+
+	CHECK(countBefore == countAfter);
+	for (uint32_t i = 0; i < countBefore; ++i) {
+		bool found = false;
+		for (uint32_t j = 0; j < countAfter; ++j) {
+			found = found || (before[i].featureId == after[j].featureId);
+		}
+		CHECK(found);
+	}
+}
+
+TEST_CASE(BoxContact, RandomPairsFromSAT)
+{
+	// SAT(NarrowPhaseBatch)̌ʂڐG_́A̔̋߂ɂA߂荞݂͐
+	std::mt19937 rng(11);
+	std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+	dx3d::collision::NarrowPhaseBatch batch;
+	std::vector<std::pair<ContactBox, ContactBox>> pairs;
+
+	batch.Begin();
+	for (int i = 0; i < 2000; ++i) {
+		ContactBox a = MakeBox(0, 0, 0, 0.3f + 0.7f * std::fabs(u(rng)), 0.3f + 0.7f * std::fabs(u(rng)), 0.3f + 0.7f * std::fabs(u(rng)));
+		ContactBox b = MakeBox(u(rng), u(rng), u(rng), 0.3f + 0.7f * std::fabs(u(rng)), 0.3f + 0.7f * std::fabs(u(rng)), 0.3f + 0.7f * std::fabs(u(rng)));
+		Rotate(a, 0, u(rng) * PI); Rotate(a, 1, u(rng) * PI);
+		Rotate(b, 1, u(rng) * PI); Rotate(b, 2, u(rng) * PI);
+		pairs.emplace_back(a, b);
+		batch.AddBoxBox(a, b);
+	}
+	batch.Run();
+
+	uint32_t hits = 0;
+	uint32_t total = 0;
+	uint32_t bad = 0;
+	for (uint32_t i = 0; i < pairs.size(); ++i) {
+		const auto& r = batch.GetResult(i);
+		if (!r.hit) { continue; }
+		++hits;
+		ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+		const uint32_t count = GenerateBoxContacts(pairs[i].first, pairs[i].second, r.normal, r.penetration, r.feature, points);
+		total += count;
+		for (uint32_t k = 0; k < count; ++k) {
+			const float margin = r.penetration + 1.0e-3f;
+			const bool ok = points[k].penetration >= 0.0f
+				&& points[k].penetration <= r.penetration + 1.0e-3f
+				&& InsideBox(pairs[i].first, points[k].position, margin)
+				&& InsideBox(pairs[i].second, points[k].position, margin);
+			bad += ok ? 0u : 1u;
+		}
+	}
+	std::printf("    %u hits, %.2f points per hit, %u bad points\n", hits, static_cast<double>(total) / (std::max)(hits, 1u), bad);
+	CHECK(hits > 500);
+	CHECK(bad == 0);
+}
+
+BENCH_CASE(BoxContact, GeneratePerPair)
+{
+	// ʓm(ςݏd)AXʁAӓmA_(SAT݂̑O͕)1yA̎
+	struct Case {
+		const char* name;
+		ContactBox a, b;
+		float normal[3];
+		float penetration;
+		uint32_t feature;
+	};
+	std::vector<Case> cases;
+	{
+		Case c{ "face-face (stack)", MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f), MakeBox(0.1f, 0.98f, 0.05f, 0.5f, 0.5f, 0.5f), { 0, 1, 0 }, 0.02f, FaceA(1) };
+		Rotate(c.b, 1, 0.2f);
+		cases.push_back(c);
+	}
+	{
+		Case c{ "face-face (tilted)", MakeBox(0, 0, 0, 5, 0.5f, 5), MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f), { 0, 1, 0 }, 0.05f, FaceA(1) };
+		Rotate(c.b, 2, 10.0f * PI / 180.0f);
+		c.b.center[1] = 0.45f + 0.5f * (std::cos(10.0f * PI / 180.0f) + std::sin(10.0f * PI / 180.0f));
+		cases.push_back(c);
+	}
+	{
+		const float r = 0.5f * std::sqrt(2.0f);
+		Case c{ "edge-edge", MakeBox(0, 0, 0, 0.5f, 0.5f, 0.5f), MakeBox(0, 2.0f * r - 0.06f, 0, 0.5f, 0.5f, 0.5f), { 0, 1, 0 }, 0.06f, Edge(2, 0) };
+		Rotate(c.a, 2, PI / 4.0f);
+		Rotate(c.b, 0, PI / 4.0f);
+		cases.push_back(c);
+	}
+
+	constexpr int REPEAT = 1000000;
+	for (const auto& c : cases) {
+		ContactPointInput points[MAX_MANIFOLD_POINTS]{};
+		uint32_t sum = 0;
+		const double ms = test::MeasureMs(1, [&]() {
+			for (int i = 0; i < REPEAT; ++i) {
+				sum += GenerateBoxContacts(c.a, c.b, c.normal, c.penetration, c.feature, points);
+				test::DoNotOptimize(points);
+			}
+		});
+		std::printf("    %-20s %7.1f ns / pair (%u points)\n", c.name, ms * 1.0e6 / REPEAT, sum / REPEAT);
+	}
+
+	// 8_4_Ɍ炷
+	ContactPointInput octagon[8]{};
+	for (uint32_t i = 0; i < 8; ++i) {
+		octagon[i].position[0] = std::cos(static_cast<float>(i) * PI / 4.0f);
+		octagon[i].position[2] = std::sin(static_cast<float>(i) * PI / 4.0f);
+		octagon[i].penetration = 0.1f + 0.01f * static_cast<float>(i);
+	}
+	const double reduceMs = test::MeasureMs(1, [&]() {
+		for (int i = 0; i < REPEAT; ++i) {
+			ContactPointInput work[8];
+			std::copy(octagon, octagon + 8, work);
+			test::DoNotOptimize(ReduceContactPoints(work, 8, UP, 4));
+		}
+	});
+	std::printf("    %-20s %7.1f ns / call\n", "reduce 8 -> 4", reduceMs * 1.0e6 / REPEAT);
+}
@@ -0,0 +1,277 @@
+/**
+ * @file BroadPhaseTests.cpp
+ * @brief DynamicAABBTree / StaticBVH̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <Game/Collisions/DynamicAABBTree.h>
+#include <Game/Collisions/BruteForceBroadPhase.h>
+#include <Game/Collisions/StaticBVH.h>
+#include "TestFramework.h"
+
+using dx3d::collision::AABB;
+using dx3d::collision::BroadPhasePair;
+using dx3d::collision::BruteForceBroadPhase;
+using dx3d::collision::IBroadPhase;
+using dx3d::collision::DynamicAABBTree;
+using dx3d::collision::ProxyId;
+using dx3d::collision::StaticBVH;
+using dx3d::collision::StaticBVHItem;
+
+namespace {
+	/**
+	 * @brief KȔ
+	 * @param _extent S΂܂͈
+	 * @param _flat yׂ(x̂悤ȕzu)
+	 */
+	AABB RandomBox(std::mt19937& _rng, float _extent, float _flat, float _minHalf, float _maxHalf)
+	{
+		std::uniform_real_distribution<float> pos(-_extent, _extent);
+		std::uniform_real_distribution<float> half(_minHalf, _maxHalf);
+		const float center[3] = { pos(_rng), pos(_rng) * _flat, pos(_rng) };
+		AABB box{};
+		for (int k = 0; k < 3; ++k) {
+			const float h = half(_rng);
+			box.min[k] = center[k] - h;
+			box.max[k] = center[k] + h;
+		}
+		return box;
+	}
+
+	std::vector<StaticBVHItem> MakeLevel(std::mt19937& _rng, uint32_t _count)
+	{
+		std::vector<StaticBVHItem> items(_count);
+		for (uint32_t i = 0; i < _count; ++i) {
+			items[i].aabb = RandomBox(_rng, 200.0f, 0.1f, 0.5f, 4.0f);
+			items[i].userData = i;
+		}
+		return items;
+	}
+
+	//! @brief ŏdȂ镨̔ԍ()
+	std::vector<uint64_t> BruteForceQuery(const std::vector<StaticBVHItem>& _items, const AABB& _query)
+	{
+		std::vector<uint64_t> out;
+		for (const auto& item : _items) {
+			if (item.aabb.Overlaps(_query)) { out.push_back(item.userData); }
+		}
+		return out;
+	}
+
+	std::vector<uint64_t> BVHQuery(const StaticBVH& _bvh, const AABB& _query)
+	{
+		std::vector<uint64_t> out;
+		_bvh.Query(_query, [&](const StaticBVHItem& _item) { out.push_back(_item.userData); return true; });
+		std::sort(out.begin(), out.end());
+		return out;
+	}
+}
+
+TEST_CASE(BroadPhase, DynamicTreePairsMatchFatOverlaps)
+{
+	// 쐬 / ړ / 폜JԂĂAyÄꗗfat AABBm̑ƈv
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+	DynamicAABBTree tree;
+	std::vector<ProxyId> live;
+	std::vector<AABB> tight;	// ProxyIdň
+	std::vector<BroadPhasePair> added, removed, tracked;
+
+	for (int step = 0; step < 60; ++step) {
+		for (int n = 0; n < 20; ++n) {
+			const float r = u01(rng);
+			if (r < 0.3f || live.size() < 10) {
+				const AABB box = RandomBox(rng, 20.0f, 1.0f, 0.2f, 1.5f);
+				const ProxyId id = tree.CreateProxy(box, static_cast<uint64_t>(step * 100 + n));
+				if (tight.size() <= static_cast<size_t>(id)) { tight.resize(id + 1); }
+				tight[id] = box;
+				live.push_back(id);
+			}
+			else if (r < 0.4f) {
+				const size_t k = rng() % live.size();
+				tree.DestroyProxy(live[k]);
+				live.erase(live.begin() + k);
+			}
+			else {
+				// (fat AABBɎ܂鎞Ɣяo̗)
+				const ProxyId id = live[rng() % live.size()];
+				const float move = (u01(rng) - 0.5f) * 2.0f;
+				AABB box = tight[id];
+				for (int k = 0; k < 3; ++k) { box.min[k] += move; box.max[k] += move; }
+				tight[id] = box;
+				tree.MoveProxy(id, box);
+			}
+		}
+
+		tree.UpdatePairs(added, removed);
+		CHECK(tree.Validate());
+
+		// ςݏd˂ƍ̈ꗗv
+		std::vector<BroadPhasePair> next;
+		std::sort(removed.begin(), removed.end());
+		std::set_difference(tracked.begin(), tracked.end(), removed.begin(), removed.end(), std::back_inserter(next));
+		next.insert(next.end(), added.begin(), added.end());
+		std::sort(next.begin(), next.end());
+		tracked.swap(next);
+		CHECK(tracked == tree.GetPairs());
+
+		// 
+		std::vector<BroadPhasePair> expected;
+		std::vector<ProxyId> sorted = live;
+		std::sort(sorted.begin(), sorted.end());
+		bool tightCovered = true;
+		for (size_t i = 0; i < sorted.size(); ++i) {
+			for (size_t j = i + 1; j < sorted.size(); ++j) {
+				const ProxyId a = sorted[i], b = sorted[j];
+				if (tree.GetFatAABB(a).Overlaps(tree.GetFatAABB(b))) {
+					expected.push_back(BroadPhasePair{ a, b, tree.GetUserData(a), tree.GetUserData(b) });
+				}
+				else if (tight[a].Overlaps(tight[b])) {
+					tightCovered = false;	// {ɏdȂĂ̂fat AABBdȂȂ
+				}
+			}
+		}
+		CHECK(tree.GetPairs() == expected);
+		CHECK(tightCovered);
+		CHECK(tree.GetProxyCount() == live.size());
+	}
+}
+
+TEST_CASE(BroadPhase, StaticBVHQueryMatchesBruteForce)
+{
+	std::mt19937 rng(17);
+	for (uint32_t count : { 0u, 1u, 3u, 5u, 100u, 5000u }) {
+		const auto items = MakeLevel(rng, count);
+		StaticBVH bvh;
+		bvh.Build(items);
+		CHECK(bvh.Validate());
+		CHECK(bvh.GetItemCount() == count);
+		CHECK(bvh.GetDepth() <= StaticBVH::MAX_DEPTH);
+
+		bool same = true;
+		for (int q = 0; q < 300; ++q) {
+			const AABB query = RandomBox(rng, 200.0f, 0.1f, 0.5f, 8.0f);
+			same = same && (BVHQuery(bvh, query) == BruteForceQuery(items, query));
+		}
+		CHECK(same);
+	}
+}
+
+TEST_CASE(BroadPhase, StaticBVHDegenerateAndEarlyExit)
+{
+	// Sꏊ(dSŕȂ)łꂸASԂ
+	std::vector<StaticBVHItem> same(1000);
+	for (uint32_t i = 0; i < same.size(); ++i) {
+		for (int k = 0; k < 3; ++k) { same[i].aabb.min[k] = -1.0f; same[i].aabb.max[k] = 1.0f; }
+		same[i].userData = i;
+	}
+	StaticBVH bvh;
+	bvh.Build(same);
+	CHECK(bvh.Validate());
+	CHECK(bvh.GetDepth() <= StaticBVH::MAX_DEPTH);
+	AABB query{};
+	CHECK(BVHQuery(bvh, query).size() == same.size());
+
+	// falseԂƂŎ~܂
+	uint32_t visited = 0;
+	bvh.Query(query, [&](const StaticBVHItem&) { ++visited; return visited < 10; });
+	CHECK(visited == 10);
+
+	bvh.Clear();
+	CHECK(bvh.GetItemCount() == 0);
+	CHECK(BVHQuery(bvh, query).empty());
+}
+
+BENCH_CASE(BroadPhase, StaticBVHVsDynamicTree)
+{
+	// ÓIȃx SAHňꊇō / IȖ؂ɈA2000̖₢킹
+	// uȎSׂ郋[v(all-pairs)₢킹ő
+	std::mt19937 rng(1);
+	for (uint32_t count : { 1000u, 10000u, 100000u }) {
+		const auto items = MakeLevel(rng, count);
+		std::vector<AABB> queries(2000);
+		for (auto& q : queries) { q = RandomBox(rng, 200.0f, 0.1f, 0.5f, 0.5f); }
+
+		StaticBVH bvh;
+		const double bvhBuild = test::MeasureMs(3, [&]() { bvh.Build(items); });
+		double treeBuild = 0.0;
+		DynamicAABBTree tree;
+		for (int r = 0; r < 3; ++r) {
+			DynamicAABBTree fresh;
+			treeBuild += test::MeasureMs(1, [&]() {
+				for (const auto& item : items) { fresh.CreateProxy(item.aabb, item.userData); }
+			}) / 3.0;
+			if (r == 2) { tree = std::move(fresh); }
+		}
+
+		uint64_t hits = 0;
+		const double bvhQuery = test::MeasureMs(10, [&]() {
+			for (const auto& q : queries) { bvh.Query(q, [&](const StaticBVHItem&) { ++hits; return true; }); }
+		});
+		const double treeQuery = test::MeasureMs(10, [&]() {
+			for (const auto& q : queries) { tree.Query(q, [&](ProxyId) { ++hits; return true; }); }
+		});
+		const double allPairsQuery = test::MeasureMs(1, [&]() {
+			for (const auto& q : queries) {
+				for (const auto& item : items) { hits += item.aabb.Overlaps(q) ? 1u : 0u; }
+			}
+		});
+		test::DoNotOptimize(hits);
+		std::printf("    %6u items | build: BVH %7.2f ms, tree %7.2f ms | 2000 queries: BVH %6.3f ms, tree %6.3f ms, all-pairs %8.3f ms | depth %u\n",
+			count, bvhBuild, treeBuild, bvhQuery, treeQuery, allPairsQuery, bvh.GetDepth());
+	}
+}
+
+BENCH_CASE(BroadPhase, DynamicTreeVsAllPairs)
+{
+	// ̃yAXV: XebvSUpdatePairs(1Xebv)
+	// BruteForceBroadPhase͒uȎSyÃ[vƓ
+	const int steps = 20;
+	for (uint32_t count : { 500u, 2000u, 8000u }) {
+		std::mt19937 rng(7);
+		std::uniform_real_distribution<float> vel(-0.05f, 0.05f);
+		// ̖xۂ悤ɁAɍ킹Ĕ͈͂L
+		const float extent = 10.0f * std::cbrt(static_cast<float>(count) / 500.0f);
+		std::vector<AABB> boxes(count);
+		std::vector<float> velocity(count * 3);
+		for (uint32_t i = 0; i < count; ++i) {
+			boxes[i] = RandomBox(rng, extent, 1.0f, 0.3f, 0.6f);
+			for (int k = 0; k < 3; ++k) { velocity[i * 3 + k] = vel(rng); }
+		}
+
+		auto run = [&](IBroadPhase& _broadPhase, std::size_t& _pairs) {
+			std::vector<AABB> moving = boxes;
+			std::vector<ProxyId> ids(count);
+			for (uint32_t i = 0; i < count; ++i) { ids[i] = _broadPhase.CreateProxy(moving[i], i); }
+			std::vector<BroadPhasePair> added, removed;
+			_broadPhase.UpdatePairs(added, removed);
+			return test::MeasureMs(steps, [&]() {
+				for (uint32_t i = 0; i < count; ++i) {
+					for (int k = 0; k < 3; ++k) {
+						moving[i].min[k] += velocity[i * 3 + k];
+						moving[i].max[k] += velocity[i * 3 + k];
+					}
+					_broadPhase.MoveProxy(ids[i], moving[i]);
+				}
+				_broadPhase.UpdatePairs(added, removed);
+				_pairs = _broadPhase.GetPairs().size();
+			});
+		};
+
+		std::size_t treePairs = 0, allPairs = 0;
+		DynamicAABBTree tree;
+		BruteForceBroadPhase bruteForce;
+		const double treeMs = run(tree, treePairs);
+		const double allPairsMs = run(bruteForce, allPairs);
+		std::printf("    %5u bodies | DynamicAABBTree %8.3f ms (%6zu fat pairs) | all-pairs %8.3f ms (%6zu pairs) | x%.1f\n",
+			count, treeMs, treePairs, allPairsMs, allPairs, allPairsMs / treeMs);
+	}
+}
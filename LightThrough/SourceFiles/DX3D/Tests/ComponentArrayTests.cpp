@@ -0,0 +1,346 @@
+/**
+ * @file ComponentArrayTests.cpp
+ * @brief ComponentArray(y[WSparse Set)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include <unordered_map>
+#include <cstring>
+#include <memory>
+#include <Game/ECS/ComponentArray.h>
+#include <Game/ECS/CommandBuffer.h>
+#include "TestFramework.h"
+
+namespace {
+	/**
+	 * @brief eXgpComponent(Transform炢̑傫)
+	 */
+	struct TestComponent {
+		float position[3]{};
+		float rotation[4]{};
+		float scale[3]{};
+	};
+
+	ecs::Entity MakeEntity(uint32_t _index, uint32_t _version = 1)
+	{
+		return ecs::Entity(ecs::CreateEntity(_index, _version));
+	}
+
+	TestComponent MakeComponent(uint32_t _value)
+	{
+		TestComponent c{};
+		c.position[0] = static_cast<float>(_value);
+		return c;
+	}
+
+	/**
+	 * @brief rp: uOunordered_mapł̍
+	 *	Insert / Get / Has / Remove̒g͌̎Ɠ
+	 */
+	class MapComponentArray {
+	public:
+		void Insert(ecs::Entity _e, const TestComponent& _component)
+		{
+			entity_to_index_[_e] = components_.size();
+			entity_IDs_.push_back(_e);
+			components_.push_back(_component);
+		}
+
+		TestComponent& Get(ecs::Entity _e) { return components_[entity_to_index_[_e]]; }
+		bool Has(ecs::Entity _e) const { return entity_to_index_.find(_e) != entity_to_index_.end(); }
+
+		void Remove(ecs::Entity _e)
+		{
+			auto it = entity_to_index_.find(_e);
+			if (it == entity_to_index_.end()) { return; }
+
+			const size_t index = entity_to_index_[_e];
+			const size_t lastIndex = components_.size() - 1;
+			if (index != lastIndex) {
+				components_[index] = components_[lastIndex];
+				entity_IDs_[index] = entity_IDs_[lastIndex];
+				entity_to_index_[entity_IDs_[index]] = index;
+			}
+			components_.pop_back();
+			entity_IDs_.pop_back();
+			entity_to_index_.erase(_e);
+		}
+
+	private:
+		std::vector<TestComponent> components_{};
+		std::vector<ecs::Entity> entity_IDs_{};
+		std::unordered_map<ecs::Entity, size_t> entity_to_index_{};
+	};
+
+	/**
+	 * @brief ̍ ǉ  _Get  Has  폜 v
+	 */
+	template<typename Array>
+	void RunArrayBench(const char* _label, const std::vector<ecs::Entity>& _entities, const std::vector<uint32_t>& _order)
+	{
+		const int repeat = (_entities.size() <= 1000) ? 200 : ((_entities.size() <= 100000) ? 5 : 1);
+
+		double insertMs = 0.0;
+		double getMs = 0.0;
+		double hasMs = 0.0;
+		double removeMs = 0.0;
+		for (int r = 0; r < repeat; ++r) {
+			Array array;
+			insertMs += test::MeasureMs(1, [&]() {
+				for (uint32_t i = 0; i < _entities.size(); ++i) {
+					array.Insert(_entities[i], MakeComponent(i));
+				}
+			});
+
+			float sum = 0.0f;
+			getMs += test::MeasureMs(1, [&]() {
+				for (uint32_t i : _order) {
+					sum += array.Get(_entities[i]).position[0];
+				}
+			});
+			test::DoNotOptimize(sum);
+
+			uint32_t found = 0;
+			hasMs += test::MeasureMs(1, [&]() {
+				for (uint32_t i : _order) {
+					found += array.Has(_entities[i]) ? 1u : 0u;
+				}
+			});
+			test::DoNotOptimize(found);
+
+			removeMs += test::MeasureMs(1, [&]() {
+				for (uint32_t k = 0; k < _order.size(); k += 2) {
+					array.Remove(_entities[_order[k]]);
+				}
+			});
+		}
+
+		const double perEntity = 1.0e6 / static_cast<double>(_entities.size() * repeat);	// ms -> ns/entity
+		std::printf("    %-13s %8zu entities | insert %6.2f ns | get %6.2f ns | has %6.2f ns | remove(half) %6.2f ns\n",
+			_label, _entities.size(),
+			insertMs * perEntity, getMs * perEntity, hasMs * perEntity, removeMs * perEntity * 2.0);
+	}
+}
+
+TEST_CASE(ComponentArray, InsertGetHas)
+{
+	ecs::ComponentArray<TestComponent> array;
+	for (uint32_t i = 0; i < 100; ++i) {
+		array.Insert(MakeEntity(i), MakeComponent(i));
+	}
+	for (uint32_t i = 0; i < 100; ++i) {
+		CHECK(array.Has(MakeEntity(i)));
+		CHECK(array.Get(MakeEntity(i)).position[0] == static_cast<float>(i));
+	}
+	CHECK(!array.Has(MakeEntity(100)));
+}
+
+TEST_CASE(ComponentArray, RemoveKeepsOtherSlots)
+{
+	ecs::ComponentArray<TestComponent> array;
+	for (uint32_t i = 0; i < 10; ++i) {
+		array.Insert(MakeEntity(i), MakeComponent(i));
+	}
+
+	// 擪 / r / ŌĂAc͎̒l
+	array.Remove(MakeEntity(0));
+	array.Remove(MakeEntity(5));
+	array.Remove(MakeEntity(9));
+	for (uint32_t i = 0; i < 10; ++i) {
+		const bool removed = (i == 0 || i == 5 || i == 9);
+		CHECK(array.Has(MakeEntity(i)) == !removed);
+		if (!removed) {
+			CHECK(array.Get(MakeEntity(i)).position[0] == static_cast<float>(i));
+		}
+	}
+
+	// ɂ܂
+	array.Insert(MakeEntity(5), MakeComponent(50));
+	CHECK(array.Get(MakeEntity(5)).position[0] == 50.0f);
+}
+
+TEST_CASE(ComponentArray, StaleVersionIsNotFound)
+{
+	ecs::ComponentArray<TestComponent> array;
+	array.Insert(MakeEntity(7, 1), MakeComponent(7));
+
+	// IndexVersionႢ͕ʂEntity
+	CHECK(array.Has(MakeEntity(7, 1)));
+	CHECK(!array.Has(MakeEntity(7, 2)));
+
+	array.EntityDestroyed(MakeEntity(7, 2));	// ĂȂ̂ŉȂ
+	CHECK(array.Has(MakeEntity(7, 1)));
+
+	array.EntityDestroyed(MakeEntity(7, 1));
+	CHECK(!array.Has(MakeEntity(7, 1)));
+	array.Insert(MakeEntity(7, 2), MakeComponent(70));
+	CHECK(!array.Has(MakeEntity(7, 1)));
+	CHECK(array.Get(MakeEntity(7, 2)).position[0] == 70.0f);
+}
+
+TEST_CASE(ComponentArray, SparsePagesAcrossRange)
+{
+	// y[W̋ڂƁAԂ󂢂Index
+	const uint32_t indices[] = {
+		0, ecs::SPARSE_PAGE_SIZE - 1, ecs::SPARSE_PAGE_SIZE, ecs::SPARSE_PAGE_SIZE * 37 + 5, ecs::INDEX_MASK - 1,
+	};
+
+	ecs::ComponentArray<TestComponent> array;
+	for (uint32_t index : indices) {
+		array.Insert(MakeEntity(index), MakeComponent(index & 0xFFFF));
+	}
+	for (uint32_t index : indices) {
+		CHECK(array.Has(MakeEntity(index)));
+		CHECK(array.Get(MakeEntity(index)).position[0] == static_cast<float>(index & 0xFFFF));
+	}
+	// mۂĂȂy[W͎ĂȂ
+	CHECK(!array.Has(MakeEntity(ecs::SPARSE_PAGE_SIZE * 2)));
+	CHECK(!array.Has(MakeEntity(ecs::SPARSE_PAGE_SIZE * 37 + 6)));
+}
+
+TEST_CASE(ComponentArray, SnapshotRestore)
+{
+	ecs::ComponentArray<TestComponent> array;
+	for (uint32_t i = 0; i < 20; ++i) {
+		array.Insert(MakeEntity(i), MakeComponent(i));
+	}
+	const auto snapshot = array.CaptureSnapshot();
+	CHECK(snapshot->GetCount() == 20);
+
+	for (uint32_t i = 0; i < 20; i += 2) {
+		array.Remove(MakeEntity(i));
+	}
+	array.Insert(MakeEntity(100), MakeComponent(100));
+	array.Get(MakeEntity(1)).position[0] = -1.0f;
+
+	array.RestoreSnapshot(*snapshot);
+	for (uint32_t i = 0; i < 20; ++i) {
+		CHECK(array.Has(MakeEntity(i)));
+		CHECK(array.Get(MakeEntity(i)).position[0] == static_cast<float>(i));
+	}
+	CHECK(!array.Has(MakeEntity(100)));
+}
+
+TEST_CASE(ComponentArray, RandomOperationsMatchMap)
+{
+	// KȒǉ / 폜JԂāAunordered_mapłƓɂȂ邩
+	std::mt19937 rng(1234);
+	ecs::ComponentArray<TestComponent> array;
+	std::unordered_map<uint32_t, uint32_t> expected;
+	for (int step = 0; step < 20000; ++step) {
+		const uint32_t index = rng() % 5000;
+		const ecs::Entity e = MakeEntity(index);
+		if (expected.count(index)) {
+			CHECK(array.Get(e).position[0] == static_cast<float>(expected[index]));
+			array.Remove(e);
+			expected.erase(index);
+		}
+		else {
+			const uint32_t value = rng() % 1000;
+			array.Insert(e, MakeComponent(value));
+			expected[index] = value;
+		}
+	}
+	for (uint32_t index = 0; index < 5000; ++index) {
+		CHECK(array.Has(MakeEntity(index)) == (expected.count(index) != 0));
+	}
+}
+
+TEST_CASE(ComponentArray, AddRawBlockMatchesInsert)
+{
+	// єтEntityɁAɓĂ镪̌납܂Ƃ߂Ēǉ
+	ecs::ComponentArray<TestComponent> array;
+	array.Insert(MakeEntity(7), MakeComponent(7));
+
+	std::vector<ecs::Entity> entities;
+	std::vector<TestComponent> block;
+	for (uint32_t index = 0; index < 20000; index += 3) {
+		if (index == 7) { continue; }
+		entities.push_back(MakeEntity(index, 2));
+		block.push_back(MakeComponent(index));
+	}
+	array.AddRawBlock(entities.data(), block.data(), static_cast<uint32_t>(entities.size()));
+
+	CHECK(array.Get(MakeEntity(7)).position[0] == 7.0f);
+	for (std::size_t i = 0; i < entities.size(); ++i) {
+		CHECK(array.Has(entities[i]));
+		CHECK(array.Get(entities[i]).position[0] == block[i].position[0]);
+	}
+	CHECK(!array.Has(MakeEntity(1, 2)));
+	CHECK(!array.Has(MakeEntity(3, 1)));
+
+	// ǉʂɏ
+	array.Remove(entities.front());
+	CHECK(!array.Has(entities.front()));
+	CHECK(array.Get(entities.back()).position[0] == block.back().position[0]);
+}
+
+BENCH_CASE(ComponentArray, SparseSetVsUnorderedMap)
+{
+	// 1k / 100k / 1M EntityŁAuOunordered_mapłƔׂ(1Entityns)
+	for (uint32_t count : { 1000u, 100000u, 1000000u }) {
+		std::vector<ecs::Entity> entities(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			entities[i] = MakeEntity(i);
+		}
+		std::vector<uint32_t> order(count);
+		std::iota(order.begin(), order.end(), 0u);
+		std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+		RunArrayBench<ecs::ComponentArray<TestComponent>>("sparse-set", entities, order);
+		RunArrayBench<MapComponentArray>("unordered_map", entities, order);
+	}
+}
+
+BENCH_CASE(ComponentArray, CookedBlockLoad)
+{
+	// NbNς݃ubN̓ǂݍ: 1R}hɐςŔf(ȑO)  ܂Ƃ߂Ēǉ() ̔r
+	const int repeat = 5;
+	for (uint32_t count : { 100000u, 1000000u }) {
+		std::vector<ecs::Entity> entities(count);
+		std::vector<TestComponent> block(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			entities[i] = MakeEntity(i);
+			block[i] = MakeComponent(i);
+		}
+		const auto* data = reinterpret_cast<const uint8_t*>(block.data());
+
+		double deferredMs = 0.0;
+		double blockMs = 0.0;
+		for (int n = 0; n < repeat; ++n) {
+			ecs::ComponentArray<TestComponent> deferred;
+			std::vector<std::unique_ptr<ecs::CommandBuffer>> buffers;
+			buffers.push_back(std::make_unique<ecs::CommandBuffer>());
+			std::vector<const ecs::Command*> merged;
+			deferredMs += test::MeasureMs(1, [&]() {
+				TestComponent obj;
+				for (uint32_t i = 0; i < count; ++i) {
+					std::memcpy(&obj, data + sizeof(TestComponent) * i, sizeof(TestComponent));
+					buffers[0]->AddComponent(ecs::CommandKey{}, entities[i], 0, obj);
+				}
+				ecs::CommandBuffer::Merge(buffers, merged);
+				for (const auto* command : merged) {
+					deferred.AddRaw(command->e, command->payload);
+				}
+				buffers[0]->Clear();
+			});
+			test::DoNotOptimize(deferred.Get(entities.back()));
+
+			ecs::ComponentArray<TestComponent> bulk;
+			blockMs += test::MeasureMs(1, [&]() {
+				bulk.AddRawBlock(entities.data(), data, count);
+			});
+			test::DoNotOptimize(bulk.Get(entities.back()));
+		}
+
+		std::printf("    %8u entities | per-entity commands %8.3f ms | AddRawBlock %8.3f ms | x%.1f\n",
+			count, deferredMs / repeat, blockMs / repeat, deferredMs / blockMs);
+	}
+}
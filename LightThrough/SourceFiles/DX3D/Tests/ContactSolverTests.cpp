@@ -0,0 +1,255 @@
+/**
+ * @file ContactSolverTests.cpp
+ * @brief ڐG}jtH[h̃LbVƒCpX@̃\o[̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+#include <Game/Collisions/ContactManifold.h>
+#include <Game/Collisions/ContactSolver.h>
+#include "TestFramework.h"
+
+using dx3d::collision::ContactManifoldCache;
+using dx3d::collision::ContactPointInput;
+using dx3d::collision::ContactSolver;
+using dx3d::collision::ContactSolverSettings;
+using dx3d::collision::SolverBody;
+using dx3d::collision::MAX_MANIFOLD_POINTS;
+
+namespace {
+	constexpr float GRAVITY = -9.8f;
+	constexpr float DT = 1.0f / 60.0f;
+	const float UP[3] = { 0.0f, 1.0f, 0.0f };
+
+	ContactPointInput MakePoint(float _x, float _y, float _z, float _penetration, uint32_t _featureId)
+	{
+		ContactPointInput p{};
+		p.position[0] = _x; p.position[1] = _y; p.position[2] = _z;
+		p.penetration = _penetration;
+		p.featureId = _featureId;
+		return p;
+	}
+
+	//! @brief ̒ʂ4(̔ԍ0 ~ 3)
+	void MakeCorners(float _y, float _penetration, ContactPointInput* _out)
+	{
+		const float corners[4][2] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+		for (uint32_t i = 0; i < 4; ++i) {
+			_out[i] = MakePoint(corners[i][0], _y, corners[i][1], _penetration, i);
+		}
+	}
+
+	/**
+	 * @brief 1̔cɐς񂾂̏(î݁B\o[Ɠ]͈Ȃ)
+	 *	[0]͒n(y = 0ʁAȂ)A[1 ~]B̒S y = i - 0.5 n߂
+	 */
+	struct BoxStack {
+		std::vector<SolverBody> bodies{};
+		std::vector<float> heights{};	// ̒S̍([0]͒nʂ̏)
+		ContactManifoldCache cache{};
+		ContactSolver solver{};
+
+		explicit BoxStack(uint32_t _boxes)
+			: bodies(_boxes + 1), heights(_boxes + 1)
+		{
+			for (uint32_t i = 1; i <= _boxes; ++i) {
+				bodies[i].invMass = 1.0f;
+				heights[i] = static_cast<float>(i) - 0.5f;
+			}
+		}
+
+		//! @brief [_i][_i + 1]̊ђ(Ȃ痣Ă)
+		float Penetration(uint32_t _i) const
+		{
+			const float top = (_i == 0) ? heights[0] : heights[_i] + 0.5f;
+			return top - (heights[_i + 1] - 0.5f);
+		}
+
+		//! @brief 1Xebvi߂(ϕ  ڐG    ђʂ߂)
+		void Step(const ContactSolverSettings& _settings)
+		{
+			for (uint32_t i = 1; i < bodies.size(); ++i) {
+				bodies[i].velocity[1] += GRAVITY * DT;
+				heights[i] += bodies[i].velocity[1] * DT;
+			}
+
+			cache.BeginStep();
+			for (uint32_t i = 0; i + 1 < bodies.size(); ++i) {
+				const float penetration = Penetration(i);
+				if (penetration < 0.0f) { continue; }
+				ContactPointInput points[MAX_MANIFOLD_POINTS];
+				MakeCorners(heights[i + 1] - 0.5f, penetration, points);
+				auto& m = cache.Update(i, i + 1, UP, points, 4);
+				m.bodyA = i;
+				m.bodyB = i + 1;
+			}
+			cache.EndStep();
+
+			solver.Solve(bodies, cache.GetManifolds(), DT, _settings);
+			for (uint32_t i = 1; i < bodies.size(); ++i) {
+				heights[i] += bodies[i].positionCorrection[1];
+			}
+		}
+
+		//! @brief Ԑ[ђ
+		float MaxPenetration() const
+		{
+			float maxPenetration = 0.0f;
+			for (uint32_t i = 0; i + 1 < bodies.size(); ++i) {
+				maxPenetration = (std::max)(maxPenetration, Penetration(i));
+			}
+			return maxPenetration;
+		}
+
+		//! @brief ԏ̔̒ݍ(ς񂾍̂)
+		float TopSink() const
+		{
+			return static_cast<float>(bodies.size() - 1) - 0.5f - heights.back();
+		}
+	};
+}
+
+TEST_CASE(ContactSolver, ManifoldKeyIsOrderIndependent)
+{
+	CHECK(ContactManifoldCache::MakeKey(3, 7) == ContactManifoldCache::MakeKey(7, 3));
+	CHECK(ContactManifoldCache::MakeKey(3, 7) != ContactManifoldCache::MakeKey(3, 8));
+	CHECK(ContactManifoldCache::MakeKey(0, 1) != ContactManifoldCache::MakeKey(1, 1));
+}
+
+TEST_CASE(ContactSolver, WarmStartMatchesFeatureIds)
+{
+	ContactManifoldCache cache;
+	ContactPointInput points[MAX_MANIFOLD_POINTS];
+	MakeCorners(0.0f, 0.02f, points);
+
+	cache.BeginStep();
+	auto& first = cache.Update(1, 2, UP, points, 4);
+	CHECK(first.pointCount == 4);
+	CHECK(cache.GetMatchedPointCount() == 0);
+	// \o[߂ݐσCpX̑(̔ԍƂɈႤl)
+	for (uint32_t i = 0; i < first.pointCount; ++i) {
+		first.points[i].normalImpulse = 1.0f + static_cast<float>(first.points[i].featureId);
+		first.points[i].tangentImpulse[0] = 0.1f * static_cast<float>(first.points[i].featureId);
+	}
+	cache.EndStep();
+
+	// ̃Xebv: тςA1ē7
+	ContactPointInput next[MAX_MANIFOLD_POINTS] = { points[3], points[0], MakePoint(0, 0, 0, 0.01f, 7), points[2] };
+	cache.BeginStep();
+	const auto& second = cache.Update(1, 2, UP, next, 4);
+	CHECK(cache.GetPointCount() == 4);
+	CHECK(cache.GetMatchedPointCount() == 3);
+	for (uint32_t i = 0; i < second.pointCount; ++i) {
+		const auto& p = second.points[i];
+		CHECK(p.featureId == next[i].featureId);
+		if (p.featureId == 7) {
+			CHECK_NEAR(p.normalImpulse, 0.0f, 0.0f);
+			CHECK_NEAR(p.tangentImpulse[0], 0.0f, 0.0f);
+			continue;
+		}
+		CHECK_NEAR(p.normalImpulse, 1.0f + static_cast<float>(p.featureId), 0.0f);
+		CHECK_NEAR(p.tangentImpulse[0], 0.1f * static_cast<float>(p.featureId), 1.0e-6f);
+	}
+	cache.EndStep();
+
+	// @傫ςڐG͕ʕƂĈpȂ
+	const float tilted[3] = { 0.0f, 0.8f, 0.6f };
+	cache.BeginStep();
+	cache.Update(1, 2, tilted, next, 4);
+	CHECK(cache.GetMatchedPointCount() == 0);
+	cache.EndStep();
+
+	// tɂȂڐGpȂ(L[͓Ȃ̂Ń}jtH[h͈̂܂)
+	cache.BeginStep();
+	cache.Update(2, 1, tilted, next, 4);
+	CHECK(cache.GetMatchedPointCount() == 0);
+	cache.EndStep();
+	CHECK(cache.GetManifolds().size() == 1);
+
+	// GȂyAEndStepŎ̂Ă
+	cache.BeginStep();
+	cache.Update(3, 4, UP, points, 4);
+	cache.EndStep();
+	CHECK(cache.GetManifolds().size() == 1);
+	CHECK(cache.Find(ContactManifoldCache::MakeKey(1, 2)) == nullptr);
+	CHECK(cache.Find(ContactManifoldCache::MakeKey(4, 3)) != nullptr);
+}
+
+TEST_CASE(ContactSolver, RestingBoxStopsAndKeepsImpulse)
+{
+	// nʂ̏̔: d͈񕪂̑x~߁AݐσCpX m * g * dt ڐG_ŕ
+	BoxStack stack(1);
+	ContactSolverSettings settings{};
+	for (int step = 0; step < 60; ++step) {
+		stack.Step(settings);
+	}
+	CHECK(stack.cache.GetManifolds().size() == 1);
+	CHECK_NEAR(stack.bodies[1].velocity[1], 0.0f, 1.0e-4f);
+	CHECK(stack.MaxPenetration() <= settings.slop + 1.0e-3f);
+
+	const auto& m = stack.cache.GetManifolds().front();
+	float impulse = 0.0f;
+	for (uint32_t i = 0; i < m.pointCount; ++i) {
+		impulse += m.points[i].normalImpulse;
+	}
+	CHECK_NEAR(impulse, -GRAVITY * DT, 1.0e-4f);
+	CHECK(stack.cache.GetMatchedPointCount() == 4);
+
+	// pCpXōŏނ荇Ă̂ŁAĂقƂǕςȂ
+	CHECK(stack.solver.GetLastStats().lastImpulseDelta < 1.0e-4f);
+}
+
+TEST_CASE(ContactSolver, WarmStartSettlesStackWithFewIterations)
+{
+	// ȂłAEH[X^[gȂς񂾔ݍ܂Ȃ
+	ContactSolverSettings warm{};
+	warm.iterations = 2;
+	ContactSolverSettings cold = warm;
+	cold.warmStart = false;
+
+	BoxStack warmStack(10);
+	BoxStack coldStack(10);
+	for (int step = 0; step < 180; ++step) {
+		warmStack.Step(warm);
+		coldStack.Step(cold);
+	}
+	CHECK(warmStack.cache.GetManifolds().size() == 10);
+	CHECK(warmStack.MaxPenetration() <= warm.slop + 1.0e-3f);
+	CHECK(warmStack.MaxPenetration() < coldStack.MaxPenetration());
+	CHECK(warmStack.TopSink() < coldStack.TopSink());
+}
+
+BENCH_CASE(ContactSolver, BoxStackIterations)
+{
+	// ς񂾔(10 / 30i)3b񂵂́A񐔂Ƃ̊ђʂ̎c(EH[X^[g / Ȃ)
+	constexpr int STEPS = 180;
+	for (uint32_t boxes : { 10u, 30u }) {
+		std::printf("    %u boxes\n", boxes);
+		for (uint32_t iterations : { 1u, 2u, 4u, 8u, 16u }) {
+			float penetration[2]{};
+			float sink[2]{};
+			double ms[2]{};
+			for (int warm = 0; warm < 2; ++warm) {
+				ContactSolverSettings settings{};
+				settings.iterations = iterations;
+				settings.warmStart = (warm == 1);
+				BoxStack stack(boxes);
+				ms[warm] = test::MeasureMs(1, [&]() {
+					for (int step = 0; step < STEPS; ++step) {
+						stack.Step(settings);
+					}
+				}) / STEPS;
+				penetration[warm] = stack.MaxPenetration();
+				sink[warm] = stack.TopSink();
+			}
+			std::printf("    %2u iterations: cold max pen %.4f / top sink %.4f (%.4f ms / step)   warm max pen %.4f / top sink %.4f (%.4f ms / step)\n",
+				iterations, penetration[0], sink[0], ms[0], penetration[1], sink[1], ms[1]);
+		}
+	}
+}
@@ -0,0 +1,203 @@
+/**
+ * @file DebugLogTests.cpp
+ * @brief 񓯊̃fobOO(debug::Debug)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ *
+ *	̃eXgStubDebug.hĝŁA{pXœǂ(DEBUG`ărh)
+ */
+
+ // ---------- CN[h ---------- //
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../Debug/Debug.h"
+#include "TestFramework.h"
+
+namespace {
+	const char* LOG_PATH = "DebugLog/DebugLog.txt";
+
+	std::vector<std::string> ReadLogLines()
+	{
+		std::ifstream ifs(LOG_PATH);
+		std::vector<std::string> lines;
+		for (std::string line; std::getline(ifs, line);) {
+			lines.push_back(std::move(line));
+		}
+		return lines;
+	}
+
+	/**
+	 * @brief uÕO(1sƂɃbNă^CX^vAt@C֏flush)
+	 *	R\[OutputDebugStringAWindowsɂ̂ŏȂ(ۂ̈ȑȌy)
+	 */
+	class SyncLogger {
+	public:
+		explicit SyncLogger(const char* _path) : file_(_path, std::ios::out | std::ios::trunc) {}
+
+		template<typename... Args>
+		void Log(const std::string& _format, Args&&... _args)
+		{
+			const std::string message = std::vformat(_format, std::make_format_args(_args...));
+			const std::string line = GetTimestamp() + " [INFO] " + message;
+			std::scoped_lock lock(mutex_);
+			file_ << line << std::endl;
+			file_.flush();
+		}
+
+	private:
+		static std::string GetTimestamp()
+		{
+			const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+			std::tm timeInfo{};
+#ifdef _WIN32
+			localtime_s(&timeInfo, &now);
+#else
+			localtime_r(&now, &timeInfo);
+#endif
+			std::stringstream ss;
+			ss << std::put_time(&timeInfo, "%Y-%m-%d %X");
+			return ss.str();
+		}
+
+		std::ofstream file_;
+		std::mutex mutex_;
+	};
+
+	/**
+	 * @brief _threads{̃Xbh_calls񂸂ĂŁA1񂠂nsԂ(XbhƂ̎Ԃ̕)
+	 * @param _batch 0ȊOȂA_batch񂲂Ƃɏx(x񂾎Ԃ͐ȂBoǂx̕px)
+	 */
+	template<typename Func>
+	double MeasureCallNs(uint32_t _threads, uint32_t _calls, uint32_t _batch, Func&& _func)
+	{
+		std::vector<double> elapsed(_threads, 0.0);
+		std::vector<std::thread> threads;
+		for (uint32_t t = 0; t < _threads; ++t) {
+			threads.emplace_back([&, t]() {
+				const uint32_t batch = (_batch == 0) ? _calls : _batch;
+				for (uint32_t begin = 0; begin < _calls; begin += batch) {
+					const uint32_t end = (std::min)(begin + batch, _calls);
+					const auto start = std::chrono::steady_clock::now();
+					for (uint32_t i = begin; i < end; ++i) {
+						_func(t, i);
+					}
+					elapsed[t] += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+					if (_batch != 0) {
+						std::this_thread::sleep_for(std::chrono::milliseconds(2));
+					}
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+		double total = 0.0;
+		for (double ns : elapsed) {
+			total += ns;
+		}
+		return total / (static_cast<double>(_threads) * _calls);
+	}
+}
+
+TEST_CASE(DebugLog, LinesFromAllThreadsReachTheFileInOrder)
+{
+	debug::Debug::Init(false);
+	const uint32_t threadCount = 4;
+	const uint32_t lineCount = 500;	// O(1024)Ɏ܂鐔Ȃ̂Ŏ̂ĂȂ
+	std::vector<std::thread> threads;
+	for (uint32_t t = 0; t < threadCount; ++t) {
+		threads.emplace_back([t]() {
+			for (uint32_t i = 0; i < lineCount; ++i) {
+				DebugLogInfo("thread {} line {} name {}", t, i, std::string("entity"));
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	debug::Debug::Shutdown();
+
+	// XbhƂɐς񂾏Ԃ̂܂ܑSoĂ
+	std::vector<int64_t> last(threadCount, -1);
+	uint32_t found = 0;
+	bool ordered = true;
+	for (const auto& line : ReadLogLines()) {
+		unsigned int t = 0;
+		unsigned int i = 0;
+		const auto pos = line.find("[INFO] thread ");
+		if (pos == std::string::npos) { continue; }
+		if (std::sscanf(line.c_str() + pos, "[INFO] thread %u line %u name entity", &t, &i) != 2 || t >= threadCount) { continue; }
+		ordered = ordered && static_cast<int64_t>(i) == last[t] + 1;
+		last[t] = i;
+		++found;
+	}
+	CHECK(found == threadCount * lineCount);
+	CHECK(ordered);
+}
+
+TEST_CASE(DebugLog, LevelThresholdAndFlush)
+{
+	debug::Debug::Init(false);
+	debug::Debug::SetLevel(debug::Debug::LogLevel::LOG_WARNING);
+	DebugLogInfo("hidden {}", 1);
+	DebugLogWarning("shown {}", 2);
+	DebugLogError("error {:.1f}", 3.0f);
+	debug::Debug::SetLevel(debug::Debug::LogLevel::LOG_INFO);
+
+	// FlushŏoXbh҂Ƀt@C܂ŏo
+	debug::Debug::Flush();
+	bool hidden = false;
+	bool shown = false;
+	bool error = false;
+	for (const auto& line : ReadLogLines()) {
+		hidden = hidden || line.find("hidden 1") != std::string::npos;
+		shown = shown || line.find("[WARNING] shown 2") != std::string::npos;
+		error = error || line.find("[ERROR] error 3.0") != std::string::npos;
+	}
+	debug::Debug::Shutdown();
+	CHECK(!hidden);
+	CHECK(shown);
+	CHECK(error);
+}
+
+BENCH_CASE(DebugLog, ContendedCallLatency)
+{
+	// 1̌Ăяoɂ鎞(Ă񂾃XbhB1EntityƂ̃OƓ炢̈)
+	// ȑO: bN + ^CX^v + ` + t@C֏flush Ă񂾃Xbhōs
+	// : XbhƂ̃OփRs[邾(`Əo͏oXbh)
+	// paced: 256񂲂Ƃ2msx(oǂ̂Ŏ̂ĂȂ) / burst: x܂Ă(ӂꂽ͎̂Ă)
+	const uint32_t calls = 20000;
+	const std::string name = "PlayerSpotLight";
+	for (uint32_t batch : { 256u, 0u }) {
+		for (uint32_t threadCount : { 1u, 2u, 4u, 8u }) {
+			double syncNs = 0.0;
+			{
+				SyncLogger logger("DebugLog/SyncLog.txt");
+				syncNs = MeasureCallNs(threadCount, calls, batch, [&](uint32_t _t, uint32_t _i) {
+					logger.Log("[SceneSerializer] entity {} thread {} pos {:.3f} name {}", _i, _t, 1.5f * static_cast<float>(_i), name);
+				});
+			}
+
+			debug::Debug::Init(false);
+			const uint64_t droppedBefore = debug::Debug::GetDroppedCount();
+			const double asyncNs = MeasureCallNs(threadCount, calls, batch, [&](uint32_t _t, uint32_t _i) {
+				DebugLogInfo("[SceneSerializer] entity {} thread {} pos {:.3f} name {}", _i, _t, 1.5f * static_cast<float>(_i), name);
+			});
+			const uint64_t dropped = debug::Debug::GetDroppedCount() - droppedBefore;
+			debug::Debug::Shutdown();
+
+			std::printf("    %-6s %u threads x %u calls | before %8.1f ns/call | async %7.1f ns/call | x%6.1f | dropped %6llu\n",
+				batch ? "paced" : "burst", threadCount, calls, syncNs, asyncNs, syncNs / asyncNs, static_cast<unsigned long long>(dropped));
+		}
+	}
+}
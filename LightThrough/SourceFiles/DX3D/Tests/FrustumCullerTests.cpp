@@ -0,0 +1,648 @@
+/**
+ * @file FrustumCullerTests.cpp
+ * @brief FrustumCuller̕ʂ̎oASSE / 1̔ł̈vACgƂ̉e𗎂Ƃ`̑ĨeXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <Game/Culling/FrustumCuller.h>
+#include "TestFramework.h"
+
+using dx3d::culling::ConeBounds;
+using dx3d::culling::ExtractFrustumPlanes;
+using dx3d::culling::FrustumCuller;
+using dx3d::culling::FrustumPlanes;
+
+namespace {
+	constexpr float PI = 3.14159265f;
+
+	//! @brief sxNg4x4(XMFLOAT4X4Ɠ)
+	struct Matrix {
+		float m[16]{};
+	};
+
+	Matrix Multiply(const Matrix& _a, const Matrix& _b)
+	{
+		Matrix r{};
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				float sum = 0.0f;
+				for (int k = 0; k < 4; ++k) { sum += _a.m[i * 4 + k] * _b.m[k * 4 + j]; }
+				r.m[i * 4 + j] = sum;
+			}
+		}
+		return r;
+	}
+
+	/**
+	 * @brief eXgp̃J(Cg)
+	 *	view͍sxNg(world * view)Baxis̍sJ̉E /  / O
+	 */
+	struct TestView {
+		Matrix view{};
+		float axis[3][3]{};	// E, , O([h)
+		float eye[3]{};
+	};
+
+	TestView MakeView(float _yaw, float _pitch, const float* _eye)
+	{
+		TestView tv{};
+		const float cy = std::cos(_yaw), sy = std::sin(_yaw);
+		const float cp = std::cos(_pitch), sp = std::sin(_pitch);
+		const float right[3] = { cy, 0.0f, -sy };
+		const float up[3] = { sy * sp, cp, cy * sp };
+		const float forward[3] = { sy * cp, -sp, cy * cp };
+		for (int c = 0; c < 3; ++c) {
+			tv.axis[0][c] = right[c];
+			tv.axis[1][c] = up[c];
+			tv.axis[2][c] = forward[c];
+			tv.eye[c] = _eye[c];
+		}
+
+		float* m = tv.view.m;
+		for (int r = 0; r < 3; ++r) {
+			for (int c = 0; c < 3; ++c) { m[r * 4 + c] = tv.axis[c][r]; }
+		}
+		for (int c = 0; c < 3; ++c) {
+			m[12 + c] = -(_eye[0] * tv.axis[c][0] + _eye[1] * tv.axis[c][1] + _eye[2] * tv.axis[c][2]);
+		}
+		m[15] = 1.0f;
+		return tv;
+	}
+
+	//! @brief XMMatrixPerspectiveFovLHƓ([x0`1)
+	Matrix MakePerspective(float _fovY, float _aspect, float _near, float _far)
+	{
+		Matrix p{};
+		const float yScale = 1.0f / std::tan(_fovY * 0.5f);
+		p.m[0] = yScale / _aspect;
+		p.m[5] = yScale;
+		p.m[10] = _far / (_far - _near);
+		p.m[11] = 1.0f;
+		p.m[14] = -_near * _far / (_far - _near);
+		return p;
+	}
+
+	//! @brief XMMatrixOrthographicLHƓ([x0`1)
+	Matrix MakeOrthographic(float _width, float _height, float _near, float _far)
+	{
+		Matrix p{};
+		p.m[0] = 2.0f / _width;
+		p.m[5] = 2.0f / _height;
+		p.m[10] = 1.0f / (_far - _near);
+		p.m[14] = -_near / (_far - _near);
+		p.m[15] = 1.0f;
+		return p;
+	}
+
+	//! @brief r[̍W(E, , O)烏[h
+	void ViewToWorld(const TestView& _tv, const float* _v, float* _out)
+	{
+		for (int c = 0; c < 3; ++c) {
+			_out[c] = _tv.eye[c] + _v[0] * _tv.axis[0][c] + _v[1] * _tv.axis[1][c] + _v[2] * _tv.axis[2][c];
+		}
+	}
+
+	float PlaneDistance(const float* _plane, const float* _p)
+	{
+		return _plane[0] * _p[0] + _plane[1] * _p[1] + _plane[2] * _p[2] + _plane[3];
+	}
+
+	/**
+	 * @brief NbvWœ_̒(-w <= x, y <= w, 0 <= z <= w)
+	 * @return ԋ߂E܂ł̗]T(ȂO)BwŊl
+	 */
+	float ClipMargin(const Matrix& _viewProj, const float* _p)
+	{
+		float clip[4]{};
+		for (int c = 0; c < 4; ++c) {
+			clip[c] = _p[0] * _viewProj.m[c] + _p[1] * _viewProj.m[4 + c] + _p[2] * _viewProj.m[8 + c] + _viewProj.m[12 + c];
+		}
+		const float w = clip[3];
+		if (w <= 0.0f) { return -1.0f; }
+		const float margins[6] = { w + clip[0], w - clip[0], w + clip[1], w - clip[1], clip[2], w - clip[2] };
+		return *std::min_element(margins, margins + 6) / w;
+	}
+
+	//! @brief _ȉ] / g / ړ̃[hs
+	Matrix RandomWorld(std::mt19937& _rng, const float* _position)
+	{
+		std::uniform_real_distribution<float> angle(-PI, PI);
+		std::uniform_real_distribution<float> scale(0.3f, 3.0f);
+		const float ax = angle(_rng), ay = angle(_rng), az = angle(_rng);
+		const float sx = scale(_rng), sy = scale(_rng), sz = scale(_rng);
+
+		Matrix rx{}, ry{}, rz{};
+		rx.m[0] = 1.0f; rx.m[5] = std::cos(ax); rx.m[6] = std::sin(ax); rx.m[9] = -std::sin(ax); rx.m[10] = std::cos(ax); rx.m[15] = 1.0f;
+		ry.m[0] = std::cos(ay); ry.m[2] = -std::sin(ay); ry.m[5] = 1.0f; ry.m[8] = std::sin(ay); ry.m[10] = std::cos(ay); ry.m[15] = 1.0f;
+		rz.m[0] = std::cos(az); rz.m[1] = std::sin(az); rz.m[4] = -std::sin(az); rz.m[5] = std::cos(az); rz.m[10] = 1.0f; rz.m[15] = 1.0f;
+		Matrix s{};
+		s.m[0] = sx; s.m[5] = sy; s.m[10] = sz; s.m[15] = 1.0f;
+
+		Matrix w = Multiply(Multiply(s, rx), Multiply(ry, rz));
+		w.m[12] = _position[0];
+		w.m[13] = _position[1];
+		w.m[14] = _position[2];
+		return w;
+	}
+
+	//! @brief ςތ`([JAABBƊOڋ)
+	struct Shape {
+		float center[3]{};
+		float extents[3]{};
+		float radius = 0.0f;
+		Matrix world{};
+		bool unbounded = false;
+	};
+
+	/**
+	 * @brief r[̑Oɂ΂܂`
+	 * @param _spread ̊Oɂ͂ݏo(1: 傤ǎ̕)
+	 */
+	std::vector<Shape> MakeShapes(std::mt19937& _rng, const TestView& _tv, uint32_t _count, float _depth, float _spread)
+	{
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+		std::vector<Shape> shapes(_count);
+		for (auto& s : shapes) {
+			const float z = -0.1f * _depth + u01(_rng) * 1.2f * _depth;
+			const float half = (std::max)(std::abs(z), 1.0f) * _spread;
+			const float view[3] = { (u01(_rng) * 2.0f - 1.0f) * half, (u01(_rng) * 2.0f - 1.0f) * half, z };
+			float position[3]{};
+			ViewToWorld(_tv, view, position);
+
+			for (int c = 0; c < 3; ++c) {
+				s.center[c] = (u01(_rng) - 0.5f) * 0.5f;
+				s.extents[c] = 0.1f + u01(_rng) * 1.5f;
+			}
+			s.radius = std::sqrt(s.extents[0] * s.extents[0] + s.extents[1] * s.extents[1] + s.extents[2] * s.extents[2]);
+			s.world = RandomWorld(_rng, position);
+			s.unbounded = u01(_rng) < 0.02f;
+		}
+		return shapes;
+	}
+
+	void AddShapes(FrustumCuller& _culler, const std::vector<Shape>& _shapes)
+	{
+		_culler.Begin(_shapes.size());
+		for (const auto& s : _shapes) {
+			if (s.unbounded) {
+				_culler.AddUnbounded();
+			}
+			else {
+				_culler.Add(s.center, s.extents, s.radius, s.world.m);
+			}
+		}
+	}
+
+	//! @brief X|bgCg̉~(r[̑O)
+	ConeBounds MakeCone(const TestView& _tv, float _halfAngle, float _range)
+	{
+		ConeBounds cone{};
+		for (int c = 0; c < 3; ++c) {
+			cone.apex[c] = _tv.eye[c];
+			cone.direction[c] = _tv.axis[2][c];
+		}
+		cone.cosHalfAngle = std::cos(_halfAngle);
+		cone.sinHalfAngle = std::sin(_halfAngle);
+		cone.range = _range;
+		return cone;
+	}
+
+	//! @brief `̃[J̓_[h
+	void TransformPoint(const Matrix& _world, const float* _p, float* _out)
+	{
+		for (int c = 0; c < 3; ++c) {
+			_out[c] = _p[0] * _world.m[c] + _p[1] * _world.m[4 + c] + _p[2] * _world.m[8 + c] + _world.m[12 + c];
+		}
+	}
+
+	//! @brief _~̒(_̋rangeȓ)
+	bool InsideCone(const ConeBounds& _cone, const float* _p)
+	{
+		const float v[3] = { _p[0] - _cone.apex[0], _p[1] - _cone.apex[1], _p[2] - _cone.apex[2] };
+		const float len = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+		const float along = v[0] * _cone.direction[0] + v[1] * _cone.direction[1] + v[2] * _cone.direction[2];
+		return along <= _cone.range && along >= len * _cone.cosHalfAngle;
+	}
+
+	/**
+	 * @brief `̒̓_ŁA(Ɖ~)̏\ɂ镨΁Ǎ`͌ĂȂƂȂ
+	 * @return 肱ڂ
+	 */
+	uint32_t CountMissed(const FrustumCuller& _culler, const std::vector<Shape>& _shapes, const Matrix& _viewProj, const ConeBounds* _cone)
+	{
+		uint32_t missed = 0;
+		for (uint32_t i = 0; i < _shapes.size(); ++i) {
+			const auto& s = _shapes[i];
+			if (s.unbounded) {
+				missed += _culler.IsVisible(i) ? 0 : 1;
+				continue;
+			}
+			// S8̊p
+			bool inside = false;
+			for (int corner = 0; corner < 9 && !inside; ++corner) {
+				float local[3]{};
+				for (int c = 0; c < 3; ++c) {
+					const float sign = (corner == 8) ? 0.0f : (((corner >> c) & 1) ? 1.0f : -1.0f);
+					local[c] = s.center[c] + sign * s.extents[c] * 0.99f;
+				}
+				float p[3]{};
+				TransformPoint(s.world, local, p);
+				inside = ClipMargin(_viewProj, p) > 1.0e-3f && (!_cone || InsideCone(*_cone, p));
+			}
+			if (inside && !_culler.IsVisible(i)) { ++missed; }
+		}
+		return missed;
+	}
+
+	/**
+	 * @brief Oڋƕ(~̒ / _̌)̊Oɂ̂Ɏc
+	 *	OڋFrustumCuller::AddƓAԑ傫̊g嗦|
+	 */
+	uint32_t CountKeptOutside(const FrustumCuller& _culler, const std::vector<Shape>& _shapes, const FrustumPlanes& _frustum, const ConeBounds* _cone)
+	{
+		constexpr float EPS = 1.0e-2f;
+		uint32_t kept = 0;
+		for (uint32_t i = 0; i < _shapes.size(); ++i) {
+			const auto& s = _shapes[i];
+			if (s.unbounded || !_culler.IsVisible(i)) { continue; }
+			float center[3]{};
+			TransformPoint(s.world, s.center, center);
+			float maxScaleSq = 0.0f;
+			for (int r = 0; r < 3; ++r) {
+				const float* row = &s.world.m[r * 4];
+				maxScaleSq = (std::max)(maxScaleSq, row[0] * row[0] + row[1] * row[1] + row[2] * row[2]);
+			}
+			const float radius = s.radius * std::sqrt(maxScaleSq);
+
+			bool outside = false;
+			for (const auto& plane : _frustum.planes) { outside |= PlaneDistance(plane, center) < -radius - EPS; }
+			if (_cone) {
+				const float v[3] = { center[0] - _cone->apex[0], center[1] - _cone->apex[1], center[2] - _cone->apex[2] };
+				const float along = v[0] * _cone->direction[0] + v[1] * _cone->direction[1] + v[2] * _cone->direction[2];
+				outside |= along < -radius - EPS || along > _cone->range + radius + EPS;
+			}
+			kept += outside ? 1 : 0;
+		}
+		return kept;
+	}
+
+	/**
+	 * @brief e𗎂ƂCg
+	 *	ShadowCasterSystem::CollectLights / BuildLightViewProjƓ
+	 *	X|bg: fovY = 2 * acos(outerCos)Ac1A = rangeA~t
+	 *	s: 40 x 40̔ŉ1000
+	 */
+	struct ShadowLight {
+		Matrix viewProj{};
+		FrustumPlanes frustum{};
+		ConeBounds cone{};
+		bool hasCone = false;
+	};
+
+	std::vector<ShadowLight> MakeShadowLights(std::mt19937& _rng, uint32_t _spotCount, uint32_t _directionalCount)
+	{
+		constexpr float NEAR_Z = 0.0045f;
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+		std::vector<ShadowLight> lights;
+		for (uint32_t i = 0; i < _spotCount + _directionalCount; ++i) {
+			ShadowLight light{};
+			const bool spot = i < _spotCount;
+			const float eye[3] = { u01(_rng) * 60.0f - 30.0f, spot ? 6.0f + u01(_rng) * 8.0f : 40.0f, u01(_rng) * 60.0f - 30.0f };
+			const TestView tv = MakeView(u01(_rng) * 2.0f * PI, 0.5f + u01(_rng) * 0.9f, eye);
+			if (spot) {
+				const float halfAngle = (15.0f + u01(_rng) * 45.0f) * PI / 180.0f;
+				const float range = 8.0f + u01(_rng) * 22.0f;
+				light.viewProj = Multiply(tv.view, MakePerspective(halfAngle * 2.0f, 1.0f, NEAR_Z, range));
+				light.cone = MakeCone(tv, halfAngle, range);
+				light.hasCone = true;
+			}
+			else {
+				light.viewProj = Multiply(tv.view, MakeOrthographic(40.0f, 40.0f, NEAR_Z, 1000.0f));
+			}
+			light.frustum = ExtractFrustumPlanes(light.viewProj.m);
+			lights.push_back(light);
+		}
+		return lights;
+	}
+
+	//! @brief nʂ̏ɕׂe𗎂Ƃ`(80 x 80͈̔)
+	std::vector<Shape> MakeCasters(std::mt19937& _rng, uint32_t _count)
+	{
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+		std::vector<Shape> shapes(_count);
+		for (auto& s : shapes) {
+			const float position[3] = { u01(_rng) * 80.0f - 40.0f, u01(_rng) * 8.0f, u01(_rng) * 80.0f - 40.0f };
+			for (int c = 0; c < 3; ++c) {
+				s.extents[c] = 0.2f + u01(_rng) * 1.3f;
+			}
+			s.radius = std::sqrt(s.extents[0] * s.extents[0] + s.extents[1] * s.extents[1] + s.extents[2] * s.extents[2]);
+			s.world = RandomWorld(_rng, position);
+		}
+		return shapes;
+	}
+}
+
+TEST_CASE(FrustumCuller, ExtractPlanesPerspective)
+{
+	// ʂ͐KĂāAB / ̕ʂ̋̓J̑Őƈv
+	const float eye[3] = { 3.0f, 2.0f, -5.0f };
+	const TestView tv = MakeView(0.6f, 0.3f, eye);
+	const float nearZ = 0.5f, farZ = 40.0f;
+	const Matrix viewProj = Multiply(tv.view, MakePerspective(60.0f * PI / 180.0f, 16.0f / 9.0f, nearZ, farZ));
+	const FrustumPlanes frustum = ExtractFrustumPlanes(viewProj.m);
+
+	for (const auto& p : frustum.planes) {
+		CHECK_NEAR(p[0] * p[0] + p[1] * p[1] + p[2] * p[2], 1.0, 1.0e-5);
+	}
+	for (float d : { 1.0f, 10.0f, 30.0f }) {
+		const float view[3] = { 0.0f, 0.0f, d };
+		float p[3]{};
+		ViewToWorld(tv, view, p);
+		CHECK_NEAR(PlaneDistance(frustum.planes[4], p), d - nearZ, 1.0e-3);
+		CHECK_NEAR(PlaneDistance(frustum.planes[5], p), farZ - d, 1.0e-3);
+	}
+
+	// _ȓ_ŁASʂ̓ == NbvWŒ
+	std::mt19937 rng(11);
+	std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+	uint32_t checked = 0, mismatched = 0;
+	for (int i = 0; i < 20000; ++i) {
+		const float z = (u(rng) * 0.6f + 0.5f) * farZ;
+		const float view[3] = { u(rng) * 1.5f * z, u(rng) * 1.0f * z, z };
+		float p[3]{};
+		ViewToWorld(tv, view, p);
+		const float margin = ClipMargin(viewProj, p);
+		if (std::abs(margin) < 1.0e-3f) { continue; }	// E肬͊ۂ߂ŗĥŌȂ
+		bool inside = true;
+		for (const auto& plane : frustum.planes) { inside &= PlaneDistance(plane, p) >= 0.0f; }
+		mismatched += (inside != (margin > 0.0f)) ? 1 : 0;
+		++checked;
+	}
+	CHECK(checked > 10000);
+	CHECK(mismatched == 0);
+}
+
+TEST_CASE(FrustumCuller, ExtractPlanesOrthographic)
+{
+	// ˉe(s)͔Ȃ̂ŁAeʂ͔̖̋ʂ܂ł̋̂
+	const float eye[3] = { -2.0f, 10.0f, 1.0f };
+	const TestView tv = MakeView(-1.1f, 0.9f, eye);
+	const float width = 20.0f, height = 12.0f, nearZ = 1.0f, farZ = 50.0f;
+	const FrustumPlanes frustum = ExtractFrustumPlanes(Multiply(tv.view, MakeOrthographic(width, height, nearZ, farZ)).m);
+
+	std::mt19937 rng(12);
+	std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+	for (int i = 0; i < 1000; ++i) {
+		const float view[3] = { u(rng) * width, u(rng) * height, u(rng) * farZ * 1.5f };
+		float p[3]{};
+		ViewToWorld(tv, view, p);
+		const float expected[6] = {
+			view[0] + width * 0.5f, width * 0.5f - view[0],
+			view[1] + height * 0.5f, height * 0.5f - view[1],
+			view[2] - nearZ, farZ - view[2] };
+		for (int plane = 0; plane < 6; ++plane) {
+			CHECK_NEAR(PlaneDistance(frustum.planes[plane], p), expected[plane], 2.0e-3);
+		}
+	}
+}
+
+TEST_CASE(FrustumCuller, SimdMatchesScalar)
+{
+	// ` / ŁASSEł1̔ł̌ʂc炸v
+	std::mt19937 rng(13);
+	std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+	FrustumCuller simd;
+	FrustumCuller scalar;
+	scalar.SetSimdEnabled(false);
+
+	uint64_t total = 0, visible = 0, mismatched = 0;
+	for (int round = 0; round < 60; ++round) {
+		const float eye[3] = { u01(rng) * 20.0f - 10.0f, u01(rng) * 10.0f, u01(rng) * 20.0f - 10.0f };
+		const TestView tv = MakeView(u01(rng) * 2.0f * PI, (u01(rng) - 0.5f) * PI * 0.8f, eye);
+		const bool ortho = (round % 3) == 0;
+		const float farZ = 20.0f + u01(rng) * 40.0f;
+		const Matrix proj = ortho
+			? MakeOrthographic(10.0f + u01(rng) * 30.0f, 10.0f + u01(rng) * 30.0f, 0.5f, farZ)
+			: MakePerspective((20.0f + u01(rng) * 100.0f) * PI / 180.0f, 0.5f + u01(rng) * 2.0f, 0.1f, farZ);
+		const FrustumPlanes frustum = ExtractFrustumPlanes(Multiply(tv.view, proj).m);
+
+		// 4̔{łȂ
+		const uint32_t count = 1 + static_cast<uint32_t>(u01(rng) * 3000.0f);
+		const auto shapes = MakeShapes(rng, tv, count, farZ, ortho ? 0.6f : 1.2f);
+		AddShapes(simd, shapes);
+		AddShapes(scalar, shapes);
+
+		ConeBounds cone{};
+		const bool useCone = !ortho && (round % 2) == 0;
+		if (useCone) { cone = MakeCone(tv, (10.0f + u01(rng) * 70.0f) * PI / 180.0f, farZ); }
+
+		// ς񂾂܂܉xł
+		for (int repeat = 0; repeat < 2; ++repeat) {
+			simd.Cull(frustum, useCone ? &cone : nullptr);
+			scalar.Cull(frustum, useCone ? &cone : nullptr);
+			CHECK(simd.GetCount() == count);
+			CHECK(simd.GetVisibleCount() == scalar.GetVisibleCount());
+			CHECK(simd.GetVisibleCount() + simd.GetCulledCount() == count);
+		}
+		for (uint32_t i = 0; i < count; ++i) {
+			mismatched += (simd.IsVisible(i) != scalar.IsVisible(i)) ? 1 : 0;
+			if (shapes[i].unbounded) { CHECK(simd.IsVisible(i) && scalar.IsVisible(i)); }
+		}
+		total += count;
+		visible += simd.GetVisibleCount();
+	}
+	std::printf("    %llu shapes, %llu visible\n", static_cast<unsigned long long>(total), static_cast<unsigned long long>(visible));
+	CHECK(mismatched == 0);
+	// S / SO邾̃eXgɂȂĂȂ
+	CHECK(visible > total / 10 && visible < total * 9 / 10);
+}
+
+TEST_CASE(FrustumCuller, NoFalseNegatives)
+{
+	// `̒̓_(Ɖ~)̒ɂ΁ASSEłł1̔łłOȂ
+	std::mt19937 rng(14);
+	std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+	for (bool useSimd : { true, false }) {
+		FrustumCuller culler;
+		culler.SetSimdEnabled(useSimd);
+		uint32_t missed = 0;
+		uint64_t culled = 0;
+		for (int round = 0; round < 30; ++round) {
+			const float eye[3] = { 0.0f, 5.0f, 0.0f };
+			const TestView tv = MakeView(u01(rng) * 2.0f * PI, (u01(rng) - 0.5f) * PI * 0.8f, eye);
+			const bool ortho = (round % 2) == 0;
+			const float farZ = 30.0f;
+			const Matrix viewProj = Multiply(tv.view, ortho
+				? MakeOrthographic(25.0f, 15.0f, 0.5f, farZ)
+				: MakePerspective(70.0f * PI / 180.0f, 1.5f, 0.1f, farZ));
+			const auto shapes = MakeShapes(rng, tv, 2000, farZ, 1.5f);
+			AddShapes(culler, shapes);
+
+			culler.Cull(ExtractFrustumPlanes(viewProj.m));
+			missed += CountMissed(culler, shapes, viewProj, nullptr);
+			culled += culler.GetCulledCount();
+
+			if (!ortho) {
+				const ConeBounds cone = MakeCone(tv, 25.0f * PI / 180.0f, farZ);
+				culler.Cull(ExtractFrustumPlanes(viewProj.m), &cone);
+				missed += CountMissed(culler, shapes, viewProj, &cone);
+				culled += culler.GetCulledCount();
+			}
+		}
+		CHECK(missed == 0);
+		CHECK(culled > 0);
+	}
+}
+
+TEST_CASE(FrustumCuller, ClearlyOutsideIsCulled)
+{
+	// OڋƎ̊Oɂ镨͊O( /  / )
+	const float eye[3] = { 0.0f, 0.0f, 0.0f };
+	const TestView tv = MakeView(0.0f, 0.0f, eye);
+	const FrustumPlanes frustum = ExtractFrustumPlanes(Multiply(tv.view, MakePerspective(60.0f * PI / 180.0f, 1.0f, 0.1f, 20.0f)).m);
+	const float center[3] = { 0.0f, 0.0f, 0.0f };
+	const float extents[3] = { 0.5f, 0.5f, 0.5f };
+	const float radius = 0.8660254f;
+
+	for (bool useSimd : { true, false }) {
+		FrustumCuller culler;
+		culler.SetSimdEnabled(useSimd);
+		culler.Begin();
+		const float positions[][3] = {
+			{ 0.0f, 0.0f, 5.0f },	// 
+			{ 0.0f, 0.0f, -3.0f },	// 
+			{ 0.0f, 0.0f, 25.0f },	// 
+			{ 15.0f, 0.0f, 5.0f },	// E
+			{ 0.0f, -15.0f, 5.0f },	// 
+			{ 0.0f, 0.0f, 20.3f },	// ̕ʂ܂
+		};
+		for (const auto& pos : positions) {
+			Matrix world{};
+			world.m[0] = world.m[5] = world.m[10] = world.m[15] = 1.0f;
+			world.m[12] = pos[0]; world.m[13] = pos[1]; world.m[14] = pos[2];
+			culler.Add(center, extents, radius, world.m);
+		}
+		culler.AddUnbounded();
+		culler.Cull(frustum);
+		CHECK(culler.IsVisible(0));
+		CHECK(!culler.IsVisible(1));
+		CHECK(!culler.IsVisible(2));
+		CHECK(!culler.IsVisible(3));
+		CHECK(!culler.IsVisible(4));
+		CHECK(culler.IsVisible(5));
+		CHECK(culler.IsVisible(6));
+		CHECK(culler.GetVisibleCount() == 3);
+	}
+}
+
+TEST_CASE(FrustumCuller, ShadowLightVolumes)
+{
+	// X|bgCg( + ~)ƕs(ˉe̔)Ƃɉe𗎂Ƃ`I
+	//   - Cg͈̔͂ɓĂ`͊OȂ / OڋƊOɂ`͎cȂ
+	//   - SSEł1̔ł͈v
+	//   - ~͎̊p̕(䂾̎葝Ȃ)
+	std::mt19937 rng(16);
+	const auto casters = MakeCasters(rng, 3000);
+	const auto lights = MakeShadowLights(rng, 12, 4);
+
+	FrustumCuller simd;
+	FrustumCuller scalar;
+	scalar.SetSimdEnabled(false);
+	AddShapes(simd, casters);
+	AddShapes(scalar, casters);
+
+	uint64_t spotDrawn = 0, spotPlanesOnly = 0, directionalDrawn = 0, mismatched = 0;
+	uint32_t missed = 0, keptOutside = 0;
+	for (const auto& light : lights) {
+		const ConeBounds* cone = light.hasCone ? &light.cone : nullptr;
+		simd.Cull(light.frustum, cone);
+		scalar.Cull(light.frustum, cone);
+		for (uint32_t i = 0; i < simd.GetCount(); ++i) {
+			mismatched += (simd.IsVisible(i) != scalar.IsVisible(i)) ? 1 : 0;
+		}
+		missed += CountMissed(simd, casters, light.viewProj, cone);
+		keptOutside += CountKeptOutside(simd, casters, light.frustum, cone);
+		CHECK(simd.GetVisibleCount() > 0);
+		CHECK(simd.GetVisibleCount() < simd.GetCount());
+
+		if (light.hasCone) {
+			const uint32_t withCone = simd.GetVisibleCount();
+			simd.Cull(light.frustum);
+			CHECK(withCone <= simd.GetVisibleCount());
+			spotDrawn += withCone;
+			spotPlanesOnly += simd.GetVisibleCount();
+		}
+		else {
+			directionalDrawn += simd.GetVisibleCount();
+		}
+	}
+	std::printf("    %zu casters x %zu lights: spot %llu (planes only %llu), directional %llu\n", casters.size(), lights.size(),
+		static_cast<unsigned long long>(spotDrawn), static_cast<unsigned long long>(spotPlanesOnly),
+		static_cast<unsigned long long>(directionalDrawn));
+	CHECK(mismatched == 0);
+	CHECK(missed == 0);
+	CHECK(keptOutside == 0);
+	CHECK(spotDrawn < spotPlanesOnly);
+}
+
+BENCH_CASE(FrustumCuller, ShadowCasters16Lights)
+{
+	// 16Cg(X|bg12 + s4)ŁASCgɑS`ƔׂĂǂꂾ邩 / ɂ鎞(1t[)
+	std::mt19937 rng(17);
+	const auto lights = MakeShadowLights(rng, 12, 4);
+	for (uint32_t count : { 1000u, 4000u, 16000u }) {
+		const auto casters = MakeCasters(rng, count);
+		FrustumCuller culler;
+		for (bool useSimd : { true, false }) {
+			culler.SetSimdEnabled(useSimd);
+			uint64_t drawn = 0;
+			const double ms = test::MeasureMs(10, [&]() {
+				AddShapes(culler, casters);
+				drawn = 0;
+				for (const auto& light : lights) {
+					culler.Cull(light.frustum, light.hasCone ? &light.cone : nullptr);
+					drawn += culler.GetVisibleCount();
+				}
+			});
+			std::printf("    %5u casters x %zu lights | %-6s %7.3f ms | drawn %7llu / %7llu (%5.1f%%)\n",
+				count, lights.size(), useSimd ? "SSE" : "scalar", ms,
+				static_cast<unsigned long long>(drawn), static_cast<unsigned long long>(count * lights.size()),
+				100.0 * drawn / (count * lights.size()));
+		}
+	}
+}
+
+BENCH_CASE(FrustumCuller, HundredThousandInstances)
+{
+	// 10ςŁA䂾 / ~tŔ肷(1񂠂)
+	std::mt19937 rng(15);
+	const float eye[3] = { 0.0f, 5.0f, 0.0f };
+	const TestView tv = MakeView(0.4f, 0.2f, eye);
+	const float farZ = 100.0f;
+	const FrustumPlanes frustum = ExtractFrustumPlanes(Multiply(tv.view, MakePerspective(60.0f * PI / 180.0f, 16.0f / 9.0f, 0.1f, farZ)).m);
+	const ConeBounds cone = MakeCone(tv, 25.0f * PI / 180.0f, farZ);
+
+	for (uint32_t count : { 10000u, 100000u }) {
+		const auto shapes = MakeShapes(rng, tv, count, farZ, 1.5f);
+		FrustumCuller culler;
+		const double addMs = test::MeasureMs(5, [&]() { AddShapes(culler, shapes); });
+
+		for (bool useSimd : { true, false }) {
+			culler.SetSimdEnabled(useSimd);
+			const double planeMs = test::MeasureMs(20, [&]() { culler.Cull(frustum); });
+			const uint32_t planeVisible = culler.GetVisibleCount();
+			const double coneMs = test::MeasureMs(20, [&]() { culler.Cull(frustum, &cone); });
+			std::printf("    %6u instances | add %7.3f ms | %-6s planes %7.3f ms (%6u visible, %6.1f M/s) | planes+cone %7.3f ms (%6u visible)\n",
+				count, addMs, useSimd ? "SSE" : "scalar", planeMs, planeVisible, count / planeMs / 1000.0,
+				coneMs, culler.GetVisibleCount());
+		}
+	}
+}
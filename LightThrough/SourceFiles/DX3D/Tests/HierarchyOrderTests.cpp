@@ -0,0 +1,344 @@
+/**
+ * @file HierarchyOrderTests.cpp
+ * @brief HierarchyOrder(TransformSystem̐[̕)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include <Game/Hierarchy/HierarchyOrder.h>
+#include "TestFramework.h"
+
+using dx3d::HierarchyOrder;
+
+namespace {
+	/**
+	 * @brief sxNg4x4s(TransformSystemXMMATRIX̑)
+	 */
+	struct Mat4 {
+		float m[4][4]{};
+	};
+
+	Mat4 Multiply(const Mat4& _a, const Mat4& _b)
+	{
+		Mat4 r{};
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				r.m[i][j] = _a.m[i][0] * _b.m[0][j] + _a.m[i][1] * _b.m[1][j] + _a.m[i][2] * _b.m[2][j] + _a.m[i][3] * _b.m[3][j];
+			}
+		}
+		return r;
+	}
+
+	/**
+	 * @brief eXgpTransform([J̒lƁAvZ[hs)
+	 */
+	struct Node {
+		float position[3]{};
+		float scale = 1.0f;
+		bool dirty = true;
+		Mat4 world{};
+	};
+
+	Mat4 LocalMatrix(const Node& _node)
+	{
+		Mat4 local{};
+		local.m[0][0] = local.m[1][1] = local.m[2][2] = _node.scale;
+		local.m[3][0] = _node.position[0];
+		local.m[3][1] = _node.position[1];
+		local.m[3][2] = _node.position[2];
+		local.m[3][3] = 1.0f;
+		return local;
+	}
+
+	/**
+	 * @brief Kw̌`
+	 */
+	enum class Shape {
+		Deep,	// 1000i̍
+		Wide,	// 100̃[g̒ɎcS
+		Random,	// Õm[hKɐeɂ
+	};
+
+	const char* ToString(Shape _shape)
+	{
+		switch (_shape) {
+		case Shape::Deep: return "deep";
+		case Shape::Wide: return "wide";
+		default: return "random";
+		}
+	}
+
+	/**
+	 * @brief e̔ԍ̔z
+	 *	ԍ̓VbtāAeq̔ԍɂȂ鎖悤ɂ(Entity̏ŕׂƓ)
+	 */
+	std::vector<int32_t> MakeHierarchy(Shape _shape, uint32_t _count, uint32_t _seed)
+	{
+		std::mt19937 rng(_seed);
+		std::vector<int32_t> parentOfBuilt(_count, -1);
+		for (uint32_t i = 0; i < _count; ++i) {
+			switch (_shape) {
+			case Shape::Deep:
+				parentOfBuilt[i] = (i % 1000 == 0) ? -1 : static_cast<int32_t>(i - 1);
+				break;
+			case Shape::Wide:
+				parentOfBuilt[i] = (i < 100) ? -1 : static_cast<int32_t>(rng() % 100);
+				break;
+			case Shape::Random:
+				parentOfBuilt[i] = (i == 0 || rng() % 50 == 0) ? -1 : static_cast<int32_t>(rng() % i);
+				break;
+			}
+		}
+
+		std::vector<uint32_t> shuffled(_count);
+		std::iota(shuffled.begin(), shuffled.end(), 0u);
+		std::shuffle(shuffled.begin(), shuffled.end(), rng);
+		std::vector<int32_t> parentOf(_count, -1);
+		for (uint32_t i = 0; i < _count; ++i) {
+			const int32_t p = parentOfBuilt[i];
+			parentOf[shuffled[i]] = (p < 0) ? -1 : static_cast<int32_t>(shuffled[p]);
+		}
+		return parentOf;
+	}
+
+	std::vector<Node> MakeNodes(uint32_t _count)
+	{
+		std::vector<Node> nodes(_count);
+		for (uint32_t i = 0; i < _count; ++i) {
+			nodes[i].position[0] = static_cast<float>(i % 7) * 0.5f;
+			nodes[i].position[1] = 1.0f;
+			nodes[i].position[2] = static_cast<float>(i % 3) * -0.25f;
+			nodes[i].scale = (i % 5 == 0) ? 1.001f : 1.0f;
+		}
+		return nodes;
+	}
+
+	/**
+	 * @brief [ɈxȂ߂ă[hsvZ(TransformSystem::UpdateWorldMatricesƓ)
+	 * @return vZ
+	 */
+	uint32_t UpdateLinear(const HierarchyOrder& _order, std::vector<Node>& _nodes, std::vector<uint8_t>& _changed, bool _all)
+	{
+		const auto order = _order.GetOrder();
+		const auto parents = _order.GetParents();
+		const uint32_t count = _order.GetCount();
+		_changed.assign(count, 0);
+		uint32_t updated = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			Node& node = _nodes[order[i]];
+			const int32_t parent = parents[i];
+			const bool hasParent = parent >= 0;
+			// eςĂȂΑǑʂ̂܂
+			if (!_all && !node.dirty && !(hasParent && _changed[parent])) { continue; }
+
+			const Mat4 local = LocalMatrix(node);
+			node.world = hasParent ? Multiply(local, _nodes[order[parent]].world) : local;
+			node.dirty = false;
+			_changed[i] = 1;
+			++updated;
+		}
+		return updated;
+	}
+
+	/**
+	 * @brief uO̍XV(t[nbVZbgƍċAŐeɌvZ)
+	 *	em[h͕ύXĂvZĂ
+	 */
+	uint32_t UpdateRecursive(const std::vector<int32_t>& _parentOf, std::vector<Node>& _nodes)
+	{
+		std::unordered_set<uint32_t> visited;
+		std::unordered_set<uint32_t> visiting;
+		uint32_t updated = 0;
+
+		std::function<void(uint32_t)> updateWorld = [&](uint32_t _i) {
+			if (visited.count(_i)) { return; }
+			if (visiting.count(_i)) { return; }
+			visiting.insert(_i);
+
+			Node& node = _nodes[_i];
+			const int32_t parent = _parentOf[_i];
+			if (parent >= 0) {
+				updateWorld(static_cast<uint32_t>(parent));
+			}
+			if (node.dirty || parent >= 0) {
+				const Mat4 local = LocalMatrix(node);
+				node.world = (parent >= 0) ? Multiply(local, _nodes[parent].world) : local;
+				node.dirty = false;
+				++updated;
+			}
+
+			visiting.erase(_i);
+			visited.insert(_i);
+		};
+		for (uint32_t i = 0; i < static_cast<uint32_t>(_nodes.size()); ++i) {
+			updateWorld(i);
+		}
+		return updated;
+	}
+
+	bool SameWorld(const std::vector<Node>& _a, const std::vector<Node>& _b)
+	{
+		for (size_t i = 0; i < _a.size(); ++i) {
+			for (int r = 0; r < 4; ++r) {
+				for (int c = 0; c < 4; ++c) {
+					if (_a[i].world.m[r][c] != _b[i].world.m[r][c]) { return false; }
+				}
+			}
+		}
+		return true;
+	}
+}
+
+TEST_CASE(HierarchyOrder, ParentsComeBeforeChildren)
+{
+	HierarchyOrder order;
+	for (Shape shape : { Shape::Deep, Shape::Wide, Shape::Random }) {
+		const auto parentOf = MakeHierarchy(shape, 5000, 11);
+		order.Build(parentOf);
+		CHECK(order.GetCount() == 5000);
+		CHECK(order.GetCutNodes().empty());
+
+		// S̃m[h񂸂oāAëʒu͎OŁA̐ewĂ
+		std::vector<uint8_t> seen(5000, 0);
+		bool parentsMatch = true;
+		for (uint32_t i = 0; i < order.GetCount(); ++i) {
+			const uint32_t node = order.GetOrder()[i];
+			const int32_t parent = order.GetParents()[i];
+			++seen[node];
+			if (parent < 0) {
+				parentsMatch = parentsMatch && parentOf[node] < 0;
+			}
+			else {
+				parentsMatch = parentsMatch && static_cast<uint32_t>(parent) < i
+					&& static_cast<int32_t>(order.GetOrder()[parent]) == parentOf[node];
+			}
+		}
+		CHECK(parentsMatch);
+		CHECK(std::all_of(seen.begin(), seen.end(), [](uint8_t _n) { return _n == 1; }));
+	}
+	CHECK(order.GetMaxDepth() >= 1);
+}
+
+TEST_CASE(HierarchyOrder, SameDepthKeepsIndexOrder)
+{
+	// 0  3  1, 2  4, 5̓[g
+	const std::vector<int32_t> parentOf = { -1, 3, -1, 0, 2, -1 };
+	HierarchyOrder order;
+	order.Build(parentOf);
+
+	const std::vector<uint32_t> expected = { 0, 2, 5, 3, 4, 1 };
+	CHECK(std::equal(expected.begin(), expected.end(), order.GetOrder().begin(), order.GetOrder().end()));
+	CHECK(order.GetMaxDepth() == 2);
+	CHECK(order.GetParents()[3] == 0);	// 3̐e0
+	CHECK(order.GetParents()[4] == 1);	// 4̐e2
+	CHECK(order.GetParents()[5] == 3);	// 1̐e3
+}
+
+TEST_CASE(HierarchyOrder, CycleIsCutAndTreatedAsRoot)
+{
+	// 0  1  2  0 ̃TCNƁAɂԂ牺3
+	const std::vector<int32_t> parentOf = { 1, 2, 0, 2 };
+	HierarchyOrder order;
+	order.Build(parentOf);
+
+	CHECK(order.GetCount() == 4);
+	CHECK(order.GetCutNodes().size() == 1);
+	// ؂m[h[gɂȂAc͐eɕ
+	uint32_t roots = 0;
+	bool parentsFirst = true;
+	for (uint32_t i = 0; i < order.GetCount(); ++i) {
+		const int32_t parent = order.GetParents()[i];
+		if (parent < 0) {
+			++roots;
+			parentsFirst = parentsFirst && order.GetOrder()[i] == order.GetCutNodes()[0];
+		}
+		else {
+			parentsFirst = parentsFirst && static_cast<uint32_t>(parent) < i;
+		}
+	}
+	CHECK(roots == 1);
+	CHECK(parentsFirst);
+
+	// g񂵂ĂǑʂcȂ
+	order.Build(std::vector<int32_t>{ -1, 0 });
+	CHECK(order.GetCount() == 2);
+	CHECK(order.GetCutNodes().empty());
+	CHECK(order.GetParents()[1] == 0);
+}
+
+TEST_CASE(HierarchyOrder, LinearUpdateMatchesRecursive)
+{
+	HierarchyOrder order;
+	std::vector<uint8_t> changed;
+	for (Shape shape : { Shape::Deep, Shape::Wide, Shape::Random }) {
+		const auto parentOf = MakeHierarchy(shape, 3000, 7);
+		order.Build(parentOf);
+		auto linear = MakeNodes(3000);
+		auto recursive = MakeNodes(3000);
+		CHECK(UpdateLinear(order, linear, changed, true) == 3000);
+		UpdateRecursive(parentOf, recursive);
+		CHECK(SameWorld(linear, recursive));
+
+		// ꕔƁÃm[hƎqvZēʂɂȂ
+		for (uint32_t i = 0; i < 3000; i += 97) {
+			linear[i].position[1] += 2.0f;
+			linear[i].dirty = true;
+			recursive[i].position[1] += 2.0f;
+			recursive[i].dirty = true;
+		}
+		const uint32_t updated = UpdateLinear(order, linear, changed, false);
+		UpdateRecursive(parentOf, recursive);
+		CHECK(updated >= 3000 / 97);
+		CHECK(SameWorld(linear, recursive));
+
+		// ςĂȂΉvZȂ
+		CHECK(UpdateLinear(order, linear, changed, false) == 0);
+	}
+}
+
+BENCH_CASE(HierarchyOrder, DeepAndWideHierarchies)
+{
+	// ג / 1%𓮂̍XV / SvZ̍XV(1t[ms)
+	// uuOv͖t[nbVZbgƍċAŐeɌvZAem[hSvZ
+	const int repeat = 10;
+	HierarchyOrder order;
+	std::vector<uint8_t> changed;
+	for (uint32_t count : { 10000u, 100000u }) {
+		for (Shape shape : { Shape::Deep, Shape::Wide, Shape::Random }) {
+			const auto parentOf = MakeHierarchy(shape, count, 3);
+			auto nodes = MakeNodes(count);
+			auto markDirty = [&nodes, count]() {
+				for (uint32_t i = 0; i < count; i += 100) {
+					nodes[i].dirty = true;
+				}
+			};
+
+			const double rebuildMs = test::MeasureMs(repeat, [&]() { order.Build(parentOf); });
+			UpdateLinear(order, nodes, changed, true);
+
+			uint32_t updated = 0;
+			const double dirtyMs = test::MeasureMs(repeat, [&]() {
+				markDirty();
+				updated = UpdateLinear(order, nodes, changed, false);
+			});
+			const double fullMs = test::MeasureMs(repeat, [&]() { UpdateLinear(order, nodes, changed, true); });
+			const double oldMs = test::MeasureMs(repeat, [&]() {
+				markDirty();
+				UpdateRecursive(parentOf, nodes);
+			});
+			test::DoNotOptimize(nodes.back().world);
+
+			std::printf("    %6u nodes %-6s (depth %4d) | rebuild %6.2f ms | 1%% dirty %6.2f ms (%6u updated) | all %6.2f ms | before %7.2f ms | x%.1f\n",
+				count, ToString(shape), order.GetMaxDepth(), rebuildMs, dirtyMs, updated, fullMs, oldMs, oldMs / dirtyMs);
+		}
+	}
+}
@@ -0,0 +1,252 @@
+/**
+ * @file InstanceRingTests.cpp
+ * @brief CX^Xobt@̃O(InstanceRingAllocator / InstanceBufferRing)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ *
+ *	InstanceBufferRingNull̕`obNGhœ(obt@CPŨ)
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <DX3D/Graphics/Buffers/InstanceRingAllocator.h>
+#include <DX3D/Graphics/Buffers/InstanceBufferRing.h>
+#include <DX3D/Graphics/NullGraphicsBackend.h>
+#include "TestFramework.h"
+
+namespace {
+	using dx3d::InstanceRingAllocator;
+
+	// eXgp̃CX^Xf[^([hs + F炢̑傫)
+	struct Instance {
+		float world[16]{};
+		float color[4]{};
+	};
+
+	constexpr uint32_t FRAMES = InstanceRingAllocator::FRAMES_IN_FLIGHT;
+	constexpr uint64_t STRIDE = sizeof(Instance);
+}
+
+TEST_CASE(InstanceRing, GrowsByDoublingAndNeverShrinks)
+{
+	InstanceRingAllocator ring;
+
+	// ŏ͏ĂŒ̑傫ō
+	auto frame = ring.BeginFrame(100);
+	CHECK(frame.slot == 0);
+	CHECK(frame.recreate);
+	CHECK(frame.capacity == InstanceRingAllocator::MIN_CAPACITY);
+
+	// Ȃ2{L΂
+	frame = ring.BeginFrame(InstanceRingAllocator::MIN_CAPACITY * 3);
+	CHECK(frame.slot == 1);
+	CHECK(frame.recreate);
+	CHECK(frame.capacity == InstanceRingAllocator::MIN_CAPACITY * 4);
+
+	// 0oCg̃t[łŏ͍
+	frame = ring.BeginFrame(0);
+	CHECK(frame.slot == 2);
+	CHECK(frame.recreate);
+	CHECK(frame.capacity == InstanceRingAllocator::MIN_CAPACITY);
+
+	// XbgƂɐL΂̂ŁÃXbg̑傫͕ςȂ
+	frame = ring.BeginFrame(InstanceRingAllocator::MIN_CAPACITY + 1);
+	CHECK(frame.slot == 0);
+	CHECK(frame.recreate);
+	CHECK(frame.capacity == InstanceRingAllocator::MIN_CAPACITY * 2);
+	CHECK(ring.GetCapacity(1) == InstanceRingAllocator::MIN_CAPACITY * 4);
+	CHECK(ring.GetCapacity(2) == InstanceRingAllocator::MIN_CAPACITY);
+
+	// ȂȂĂk߂Ȃ
+	frame = ring.BeginFrame(10);
+	CHECK(frame.slot == 1);
+	CHECK(!frame.recreate);
+	CHECK(frame.capacity == InstanceRingAllocator::MIN_CAPACITY * 4);
+	CHECK(ring.GetGrowCount() == 4);
+}
+
+TEST_CASE(InstanceRing, GrowthStopsAfterOneLapOfSlots)
+{
+	// ʂ΁AXbg͍蒼Ȃ
+	InstanceRingAllocator ring;
+	const uint64_t required = 5000 * STRIDE;
+	for (uint32_t i = 0; i < FRAMES; ++i) {
+		CHECK(ring.BeginFrame(required).recreate);
+	}
+	CHECK(ring.GetGrowCount() == FRAMES);
+	for (uint32_t i = 0; i < 100; ++i) {
+		CHECK(!ring.BeginFrame(required - (i % 7) * STRIDE).recreate);
+	}
+	CHECK(ring.GetGrowCount() == FRAMES);
+
+	// ́A܂蒼
+	for (uint32_t i = 0; i < FRAMES * 4; ++i) {
+		ring.BeginFrame(required * 3);
+	}
+	CHECK(ring.GetGrowCount() == FRAMES * 2);
+}
+
+TEST_CASE(InstanceRing, HighWaterMarkAndAlignment)
+{
+	InstanceRingAllocator ring;
+	ring.BeginFrame(1000);
+
+	// 擪𒸓_̑傫ɑāAO؂o
+	CHECK(ring.Allocate(10, 16) == 0);
+	CHECK(ring.Allocate(40, 16) == 16);
+	CHECK(ring.Allocate(8, 1) == 56);
+	CHECK(ring.Allocate(STRIDE, STRIDE) == STRIDE);
+	CHECK(ring.GetUsedBytes() == STRIDE * 2);
+	CHECK(ring.GetHighWaterMark() == STRIDE * 2);
+
+	// Ȃ͐؂oAʒui߂Ȃ
+	CHECK(ring.Allocate(InstanceRingAllocator::MIN_CAPACITY, 1) == InstanceRingAllocator::INVALID_OFFSET);
+	CHECK(ring.GetUsedBytes() == STRIDE * 2);
+	const uint64_t rest = InstanceRingAllocator::MIN_CAPACITY - STRIDE * 2;
+	CHECK(ring.Allocate(rest, 1) == STRIDE * 2);
+	CHECK(ring.Allocate(1, 1) == InstanceRingAllocator::INVALID_OFFSET);
+	CHECK(ring.GetHighWaterMark() == InstanceRingAllocator::MIN_CAPACITY);
+
+	// őgpʂ͎̃t[łȂ
+	ring.BeginFrame(100);
+	CHECK(ring.GetUsedBytes() == 0);
+	ring.Allocate(100, 1);
+	CHECK(ring.GetHighWaterMark() == InstanceRingAllocator::MIN_CAPACITY);
+}
+
+TEST_CASE(InstanceRing, SlotsWrapAndReuseFromTheFront)
+{
+	InstanceRingAllocator ring;
+	for (uint32_t frame = 0; frame < FRAMES * 3; ++frame) {
+		const auto begin = ring.BeginFrame(STRIDE * 64);
+		CHECK(begin.slot == frame % FRAMES);
+		CHECK(ring.GetSlot() == frame % FRAMES);
+		CHECK(ring.GetUsedBytes() == 0);
+
+		// t[ƂɑOg
+		CHECK(ring.Allocate(STRIDE * 10, STRIDE) == 0);
+		CHECK(ring.Allocate(STRIDE * 20, STRIDE) == STRIDE * 10);
+		CHECK(ring.GetUsedBytes() == STRIDE * 30);
+	}
+	CHECK(ring.GetHighWaterMark() == STRIDE * 30);
+}
+
+TEST_CASE(InstanceRing, BufferRingWritesBatchesAndReusesBuffers)
+{
+	dx3d::NullGraphicsBackend backend;
+	{
+		dx3d::InstanceBufferRing ring(backend, dx3d::GraphicsQueue::Deferred, static_cast<uint32_t>(STRIDE), "Test");
+		std::vector<Instance> batchA(100);
+		std::vector<Instance> batchB(50);
+		for (size_t i = 0; i < batchA.size(); ++i) { batchA[i].color[0] = static_cast<float>(i); }
+		for (size_t i = 0; i < batchB.size(); ++i) { batchB[i].color[1] = static_cast<float>(i); }
+
+		for (uint32_t frame = 0; frame < FRAMES * 4; ++frame) {
+			backend.BeginFrame();
+			CHECK(ring.Begin(static_cast<uint32_t>(batchA.size() + batchB.size())));
+			CHECK(!ring.Begin(1));	// Map͊JȂ
+
+			// ob`Ƃ̊JnCX^X́AÕob`̑
+			CHECK(ring.Write(batchA.data(), static_cast<uint32_t>(batchA.size())) == 0);
+			CHECK(ring.Write(batchB.data(), static_cast<uint32_t>(batchB.size())) == batchA.size());
+			ring.End();
+			CHECK(ring.Write(batchA.data(), 1) == dx3d::InstanceBufferRing::INVALID_INSTANCE);	// End͏Ȃ
+			backend.EndFrame();
+
+			const auto& stats = backend.GetLastFrameStats();
+			CHECK(stats.uploads == 1);
+			CHECK(stats.uploadBytes == (batchA.size() + batchB.size()) * STRIDE);
+			// ̂̓Xbg܂
+			CHECK(stats.buffersCreated == (frame < FRAMES ? 1u : 0u));
+		}
+		CHECK(backend.GetStats().buffersCreated == FRAMES);
+
+		// Ȃob`͎̂ĂāÃob`͏
+		CHECK(ring.Begin(1));
+		std::vector<Instance> huge(InstanceRingAllocator::MIN_CAPACITY / STRIDE + 1);
+		CHECK(ring.Write(huge.data(), static_cast<uint32_t>(huge.size())) == dx3d::InstanceBufferRing::INVALID_INSTANCE);
+		CHECK(ring.Write(batchA.data(), 1) == 0);
+		ring.End();
+	}
+
+	// jŃobt@Ԃ̂ŁAɍ镨͓ԍg
+	const auto id = backend.CreateDynamicVertexBuffer(64, 16);
+	CHECK(id.IsValid() && id.index < FRAMES);
+	backend.ReleaseBuffer(id);
+}
+
+TEST_CASE(InstanceRing, BufferRingWritesTheInstanceData)
+{
+	// MapDiscardŊJɁAob`̒ĝ܂ܕ
+	dx3d::NullGraphicsBackend backend;
+	dx3d::InstanceBufferRing ring(backend, dx3d::GraphicsQueue::Immediate, static_cast<uint32_t>(STRIDE), "Data");
+	std::vector<Instance> batch(8);
+	for (size_t i = 0; i < batch.size(); ++i) { batch[i].world[15] = static_cast<float>(i + 1); }
+
+	CHECK(ring.Begin(16));
+	ring.Write(batch.data(), 3);
+	const uint32_t start = ring.Write(batch.data() + 3, 5);
+	ring.End();
+	CHECK(start == 3);
+
+	const auto* mapped = static_cast<const Instance*>(backend.MapDiscard({ 0 }, dx3d::GraphicsQueue::Immediate));
+	CHECK(mapped != nullptr);
+	bool same = true;
+	for (size_t i = 0; i < batch.size(); ++i) {
+		same = same && std::memcmp(&mapped[i], &batch[i], sizeof(Instance)) == 0;
+	}
+	CHECK(same);
+	backend.Unmap({ 0 }, dx3d::GraphicsQueue::Immediate, 0);
+}
+
+BENCH_CASE(InstanceRing, RingVsPerFrameBuffer)
+{
+	// 1t[̃CX^Xĕ(1t[ms)
+	// ȑO: ob`܂Ƃ߂z֏W߂ĂAt[傫҂̃obt@ďAgÎĂ
+	// : Xbg̃obt@MapāAob`Ƃɒڏ(Xbg͍Ȃ)
+	// Null̃obNGhȂ̂Ńobt@̍쐬CPŨmۂ(D3D11ł͂ɃhCo̍쐬)
+	const int repeat = 60;
+	const uint32_t batchCount = 32;
+	for (uint32_t count : { 1000u, 10000u, 100000u }) {
+		std::vector<std::vector<Instance>> batches(batchCount, std::vector<Instance>(count / batchCount));
+		const uint32_t total = (count / batchCount) * batchCount;
+
+		dx3d::NullGraphicsBackend oldBackend;
+		std::vector<Instance> gather;
+		const double oldMs = test::MeasureMs(repeat, [&]() {
+			oldBackend.BeginFrame();
+			gather.clear();
+			for (const auto& batch : batches) {
+				gather.insert(gather.end(), batch.begin(), batch.end());
+			}
+			const auto id = oldBackend.CreateDynamicVertexBuffer(static_cast<uint32_t>(gather.size() * STRIDE), static_cast<uint32_t>(STRIDE));
+			void* data = oldBackend.MapDiscard(id, dx3d::GraphicsQueue::Deferred);
+			std::memcpy(data, gather.data(), gather.size() * STRIDE);
+			oldBackend.Unmap(id, dx3d::GraphicsQueue::Deferred, gather.size() * STRIDE);
+			oldBackend.ReleaseBuffer(id);
+			oldBackend.EndFrame();
+		});
+
+		dx3d::NullGraphicsBackend ringBackend;
+		dx3d::InstanceBufferRing ring(ringBackend, dx3d::GraphicsQueue::Deferred, static_cast<uint32_t>(STRIDE), "Bench");
+		uint32_t lastStart = 0;
+		const double ringMs = test::MeasureMs(repeat, [&]() {
+			ringBackend.BeginFrame();
+			ring.Begin(total);
+			for (const auto& batch : batches) {
+				lastStart = ring.Write(batch.data(), static_cast<uint32_t>(batch.size()));
+			}
+			ring.End();
+			ringBackend.EndFrame();
+		});
+		test::DoNotOptimize(lastStart);
+
+		std::printf("    %6u instances | per-frame buffer %7.3f ms (%llu created) | ring %7.3f ms (%llu created, %llu KB high-water) | x%.1f\n",
+			total, oldMs, static_cast<unsigned long long>(oldBackend.GetStats().buffersCreated),
+			ringMs, static_cast<unsigned long long>(ringBackend.GetStats().buffersCreated),
+			static_cast<unsigned long long>(ring.GetAllocator().GetHighWaterMark() / 1024), oldMs / ringMs);
+	}
+}
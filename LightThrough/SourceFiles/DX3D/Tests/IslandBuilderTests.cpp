@@ -0,0 +1,183 @@
+/**
+ * @file IslandBuilderTests.cpp
+ * @brief ̍\z(IslandBuilder)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <Game/Collisions/IslandBuilder.h>
+#include "TestFramework.h"
+
+using dx3d::collision::IslandBuilder;
+
+namespace {
+	//! @brief rp: fȃOtTœ̔ԍU(̔ԍ͈ԏ̂̏)
+	std::vector<uint32_t> ReferenceIslands(uint32_t _count, const std::vector<std::pair<uint32_t, uint32_t>>& _pairs)
+	{
+		std::vector<std::vector<uint32_t>> links(_count);
+		for (const auto& [a, b] : _pairs) {
+			links[a].push_back(b);
+			links[b].push_back(a);
+		}
+		constexpr uint32_t NONE = UINT32_MAX;
+		std::vector<uint32_t> island(_count, NONE);
+		uint32_t next = 0;
+		std::vector<uint32_t> stack;
+		for (uint32_t i = 0; i < _count; ++i) {
+			if (island[i] != NONE) { continue; }
+			island[i] = next;
+			stack.push_back(i);
+			while (!stack.empty()) {
+				const uint32_t body = stack.back();
+				stack.pop_back();
+				for (uint32_t other : links[body]) {
+					if (island[other] != NONE) { continue; }
+					island[other] = next;
+					stack.push_back(other);
+				}
+			}
+			++next;
+		}
+		return island;
+	}
+
+	//! @brief _ȃyA(_count̂̕_pairs{)
+	std::vector<std::pair<uint32_t, uint32_t>> RandomPairs(uint32_t _count, uint32_t _pairs, uint32_t _seed)
+	{
+		std::mt19937 rng(_seed);
+		std::uniform_int_distribution<uint32_t> body(0, _count - 1);
+		std::vector<std::pair<uint32_t, uint32_t>> pairs(_pairs);
+		for (auto& p : pairs) {
+			p = { body(rng), body(rng) };
+		}
+		return pairs;
+	}
+}
+
+TEST_CASE(IslandBuilder, SingletonsBeforeUnion)
+{
+	IslandBuilder builder;
+	builder.Reset(5);
+	builder.Build();
+	CHECK(builder.GetBodyCount() == 5);
+	CHECK(builder.GetIslandCount() == 5);
+	for (uint32_t i = 0; i < 5; ++i) {
+		CHECK(builder.Find(i) == i);
+		CHECK(builder.GetIslandOf(i) == i);
+		const auto island = builder.GetIsland(i);
+		CHECK(island.size() == 1);
+		CHECK(!island.empty() && island[0] == i);
+	}
+
+	// ̂ĂĂׂ
+	builder.Reset(0);
+	builder.Build();
+	CHECK(builder.GetIslandCount() == 0);
+}
+
+TEST_CASE(IslandBuilder, UnionFindAndGetIsland)
+{
+	// {0, 3, 5}, {1, 4}, {2}, {6, 7} (7 - 6 ̋tƁAyǍJԂ܂߂)
+	IslandBuilder builder;
+	builder.Reset(8);
+	builder.Union(3, 5);
+	builder.Union(0, 5);
+	builder.Union(4, 1);
+	builder.Union(7, 6);
+	builder.Union(6, 7);
+	builder.Union(5, 3);
+
+	CHECK(builder.Find(0) == builder.Find(3));
+	CHECK(builder.Find(3) == builder.Find(5));
+	CHECK(builder.Find(1) == builder.Find(4));
+	CHECK(builder.Find(6) == builder.Find(7));
+	CHECK(builder.Find(0) != builder.Find(1));
+	CHECK(builder.Find(2) == 2);
+
+	builder.Build();
+	CHECK(builder.GetIslandCount() == 4);
+
+	// ̔ԍ͈ԏ̂̏A͔̒ԍ̏
+	const std::vector<std::vector<uint32_t>> expected = { { 0, 3, 5 }, { 1, 4 }, { 2 }, { 6, 7 } };
+	for (uint32_t i = 0; i < builder.GetIslandCount(); ++i) {
+		const auto island = builder.GetIsland(i);
+		CHECK((std::vector<uint32_t>(island.begin(), island.end()) == expected[i]));
+		for (uint32_t body : island) {
+			CHECK(builder.GetIslandOf(body) == i);
+		}
+	}
+
+	// ResetőÔȂ͎cȂ(mۂ͎g)
+	builder.Reset(4);
+	builder.Union(2, 3);
+	builder.Build();
+	CHECK(builder.GetIslandCount() == 3);
+	CHECK(builder.GetIslandOf(0) == 0);
+	CHECK(builder.GetIslandOf(3) == 2);
+}
+
+TEST_CASE(IslandBuilder, MatchesGraphSearch)
+{
+	// _ȂȂŁAfȃOtTƓɂȂ
+	for (uint32_t pairCount : { 100u, 500u, 1500u }) {
+		const uint32_t count = 1000;
+		const auto pairs = RandomPairs(count, pairCount, pairCount);
+		const auto expected = ReferenceIslands(count, pairs);
+
+		IslandBuilder builder;
+		builder.Reset(count);
+		for (const auto& [a, b] : pairs) {
+			builder.Union(a, b);
+		}
+		builder.Build();
+
+		CHECK(builder.GetIslandCount() == *std::max_element(expected.begin(), expected.end()) + 1);
+		uint32_t wrong = 0;
+		uint32_t total = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			wrong += (builder.GetIslandOf(i) == expected[i]) ? 0u : 1u;
+		}
+		for (uint32_t i = 0; i < builder.GetIslandCount(); ++i) {
+			const auto island = builder.GetIsland(i);
+			total += static_cast<uint32_t>(island.size());
+			wrong += std::is_sorted(island.begin(), island.end()) ? 0u : 1u;
+		}
+		CHECK(wrong == 0);
+		CHECK(total == count);
+	}
+}
+
+BENCH_CASE(IslandBuilder, UnionAndBuild)
+{
+	// ς񂾔̗(דm̐ڐG)ƁA_ȐڐGŁAReset  Union  Build1񂠂̎
+	const int repeat = 20;
+	for (uint32_t count : { 1000u, 10000u, 100000u }) {
+		// 10i̗
+		std::vector<std::pair<uint32_t, uint32_t>> stacks;
+		for (uint32_t i = 0; i + 1 < count; ++i) {
+			if ((i + 1) % 10 != 0) { stacks.emplace_back(i, i + 1); }
+		}
+		const auto random = RandomPairs(count, count, 7);
+
+		const std::vector<std::pair<uint32_t, uint32_t>>* cases[] = { &stacks, &random };
+		for (const auto* pairs : cases) {
+			IslandBuilder builder;
+			const double ms = test::MeasureMs(repeat, [&]() {
+				builder.Reset(count);
+				for (const auto& [a, b] : *pairs) {
+					builder.Union(a, b);
+				}
+				builder.Build();
+			});
+			test::DoNotOptimize(builder.GetIslandCount());
+			std::printf("    %6u bodies / %6zu pairs (%s): %8.3f ms, %6u islands\n",
+				count, pairs->size(), (pairs == &stacks) ? "stacks" : "random", ms, builder.GetIslandCount());
+		}
+	}
+}
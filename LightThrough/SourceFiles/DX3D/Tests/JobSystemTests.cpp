@@ -0,0 +1,242 @@
+/**
+ * @file JobSystemTests.cpp
+ * @brief JobSystem̃XgXeXgƃXP[Õx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <DX3D/Core/JobSystem.h>
+#include "TestFramework.h"
+
+namespace {
+	constexpr uint32_t STRESS_WORKERS = 4;	// RAȂĂ荇N悤ɑ߂ɍ
+
+	//! @brief vZ̏d(XP[Ovp)
+	float HeavyWork(uint32_t _i)
+	{
+		float x = static_cast<float>(_i) * 0.001f;
+		for (int k = 0; k < 64; ++k) {
+			x = std::sin(x) * 0.5f + std::cos(x * 1.3f);
+		}
+		return x;
+	}
+}
+
+TEST_CASE(JobSystem, RunManyJobsWithCounter)
+{
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	for (int round = 0; round < 50; ++round) {
+		std::atomic<uint32_t> sum{ 0 };
+		dx3d::JobCounter counter;
+		for (uint32_t i = 1; i <= 2000; ++i) {
+			jobs.Run([&sum, i]() { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+		}
+		jobs.Wait(counter);
+		CHECK(counter.IsDone());
+		CHECK(sum.load() == 2000u * 2001u / 2u);
+	}
+}
+
+TEST_CASE(JobSystem, NestedJobsAreStolen)
+{
+	// [J[̒ς񂾃Wu(̃L[ɓ)̃[J[ɓ܂đSI
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	std::atomic<uint32_t> leafCount{ 0 };
+	std::vector<std::atomic<uint32_t>> byThread(jobs.GetThreadCount());
+
+	dx3d::JobCounter outer;
+	for (uint32_t i = 0; i < 64; ++i) {
+		jobs.Run([&]() {
+			dx3d::JobCounter inner;
+			for (uint32_t k = 0; k < 64; ++k) {
+				jobs.Run([&]() {
+					leafCount.fetch_add(1, std::memory_order_relaxed);
+					byThread[dx3d::JobSystem::GetCurrentThreadIndex()].fetch_add(1, std::memory_order_relaxed);
+				}, &inner);
+			}
+			jobs.Wait(inner);
+		}, &outer);
+	}
+	jobs.Wait(outer);
+	CHECK(leafCount.load() == 64u * 64u);
+
+	uint32_t total = 0;
+	for (const auto& n : byThread) { total += n.load(); }
+	CHECK(total == 64u * 64u);
+}
+
+TEST_CASE(JobSystem, ParallelForCoversEveryIndexOnce)
+{
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	const uint32_t ranges[][2] = { { 0, 0 }, { 0, 1 }, { 5, 70 }, { 0, 1000 }, { 17, 100003 } };
+	const uint32_t grains[] = { 0, 1, 7, 64, 5000 };
+
+	for (const auto& range : ranges) {
+		for (uint32_t grain : grains) {
+			std::vector<std::atomic<uint32_t>> hits(range[1]);
+			jobs.ParallelFor(range[0], range[1], grain, [&](uint32_t _b, uint32_t _e) {
+				CHECK(_b < _e);
+				for (uint32_t i = _b; i < _e; ++i) {
+					hits[i].fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+
+			bool ok = true;
+			for (uint32_t i = 0; i < range[1]; ++i) {
+				ok = ok && (hits[i].load() == ((i >= range[0]) ? 1u : 0u));
+			}
+			CHECK(ok);
+		}
+	}
+}
+
+TEST_CASE(JobSystem, NestedParallelFor)
+{
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	constexpr uint32_t OUTER = 64;
+	constexpr uint32_t INNER = 4096;
+	std::vector<uint64_t> rowSums(OUTER, 0);
+
+	jobs.ParallelFor(0, OUTER, 1, [&](uint32_t _b, uint32_t _e) {
+		for (uint32_t row = _b; row < _e; ++row) {
+			std::atomic<uint64_t> sum{ 0 };
+			jobs.ParallelFor(0, INNER, 256, [&](uint32_t _ib, uint32_t _ie) {
+				uint64_t local = 0;
+				for (uint32_t i = _ib; i < _ie; ++i) { local += i; }
+				sum.fetch_add(local, std::memory_order_relaxed);
+			});
+			rowSums[row] = sum.load();
+		}
+	});
+
+	const uint64_t expected = uint64_t(INNER) * (INNER - 1) / 2;
+	CHECK(std::all_of(rowSums.begin(), rowSums.end(), [&](uint64_t _s) { return _s == expected; }));
+}
+
+TEST_CASE(JobSystem, ExternalThreadsSubmitConcurrently)
+{
+	// [J[ȊÕXbhɋL̃L[֐ςő҂
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	std::atomic<uint32_t> total{ 0 };
+	std::vector<std::thread> producers;
+	for (uint32_t t = 0; t < 4; ++t) {
+		producers.emplace_back([&]() {
+			for (int round = 0; round < 20; ++round) {
+				dx3d::JobCounter counter;
+				for (uint32_t i = 0; i < 100; ++i) {
+					jobs.Run([&total]() { total.fetch_add(1, std::memory_order_relaxed); }, &counter);
+				}
+				jobs.Wait(counter);
+			}
+		});
+	}
+	for (auto& p : producers) { p.join(); }
+	CHECK(total.load() == 4u * 20u * 100u);
+}
+
+TEST_CASE(JobSystem, ThrowingJobIsRethrownByWait)
+{
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	for (int round = 0; round < 100; ++round) {
+		std::atomic<uint32_t> ran{ 0 };
+		dx3d::JobCounter counter;
+		for (uint32_t i = 0; i < 100; ++i) {
+			jobs.Run([&ran, i]() {
+				ran.fetch_add(1, std::memory_order_relaxed);
+				if (i % 25 == 3) { throw std::runtime_error("job failed"); }
+			}, &counter);
+		}
+
+		bool caught = false;
+		try { jobs.Wait(counter); }
+		catch (const std::runtime_error&) { caught = true; }
+		CHECK(caught);
+		CHECK(counter.IsDone());
+		CHECK(ran.load() == 100u);	// WuȊOSsĂ
+
+		// aO͈x
+		bool caughtAgain = false;
+		try { jobs.Wait(counter); }
+		catch (...) { caughtAgain = true; }
+		CHECK(!caughtAgain);
+	}
+}
+
+TEST_CASE(JobSystem, ParallelForRethrowsAfterAllChunks)
+{
+	// ڂ̋(Ă񂾃Xbh)ĂAς񂾋ԂSIĂ߂
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	for (int round = 0; round < 200; ++round) {
+		std::atomic<uint32_t> finished{ 0 };
+		bool caught = false;
+		try {
+			jobs.ParallelFor(0, 64 * 32, 64, [&](uint32_t _b, uint32_t) {
+				if (_b == 0 || (round % 2 == 0 && _b == 64 * 5)) { throw std::runtime_error("chunk failed"); }
+				std::this_thread::yield();
+				finished.fetch_add(1, std::memory_order_relaxed);
+			});
+		}
+		catch (const std::runtime_error&) { caught = true; }
+		CHECK(caught);
+
+		const uint32_t expected = (round % 2 == 0) ? 30u : 31u;
+		CHECK(finished.load() == expected);
+	}
+}
+
+TEST_CASE(JobSystem, CreateAndDestroyRepeatedly)
+{
+	for (int round = 0; round < 50; ++round) {
+		dx3d::JobSystem jobs(STRESS_WORKERS);
+		std::atomic<uint32_t> count{ 0 };
+		jobs.ParallelFor(0, 10000, 100, [&](uint32_t _b, uint32_t _e) { count.fetch_add(_e - _b); });
+		CHECK(count.load() == 10000u);
+	}
+}
+
+BENCH_CASE(JobSystem, ParallelForScaling)
+{
+	// 1Xbh([J[ = ̂܂܎s)RA܂ł̑x
+	constexpr uint32_t COUNT = 1u << 18;
+	std::vector<float> out(COUNT);
+	const auto kernel = [&](uint32_t _b, uint32_t _e) {
+		for (uint32_t i = _b; i < _e; ++i) { out[i] = HeavyWork(i); }
+	};
+
+	const uint32_t hw = (std::max)(std::thread::hardware_concurrency(), 1u);
+	std::printf("    hardware_concurrency = %u, %u elements\n", hw, COUNT);
+
+	const double serialMs = test::MeasureMs(5, [&]() { kernel(0, COUNT); });
+	std::printf("    threads %2u: %8.2f ms (x%.2f)\n", 1u, serialMs, 1.0);
+
+	for (uint32_t threads = 2; threads <= hw; ++threads) {
+		dx3d::JobSystem jobs(threads - 1);
+		const double ms = test::MeasureMs(5, [&]() { jobs.ParallelFor(0, COUNT, 0, kernel); });
+		std::printf("    threads %2u: %8.2f ms (x%.2f)\n", threads, ms, serialMs / ms);
+	}
+	test::DoNotOptimize(out[COUNT / 2]);
+}
+
+BENCH_CASE(JobSystem, JobOverhead)
+{
+	// ̃Wuςő҂̃RXg(1Wu)
+	constexpr uint32_t JOBS = 100000;
+	dx3d::JobSystem jobs(STRESS_WORKERS);
+	const double ms = test::MeasureMs(5, [&]() {
+		dx3d::JobCounter counter;
+		for (uint32_t i = 0; i < JOBS; ++i) {
+			jobs.Run([]() {}, &counter);
+		}
+		jobs.Wait(counter);
+	});
+	std::printf("    %u empty jobs: %.2f ms (%.1f ns / job)\n", JOBS, ms, ms * 1.0e6 / JOBS);
+}
@@ -0,0 +1,313 @@
+/**
+ * @file LightClusterTests.cpp
+ * @brief LightClusterBuilder̎肱ڂ̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <DX3D/Core/JobSystem.h>
+#include <Game/Culling/LightClusterBuilder.h>
+#include "TestFramework.h"
+
+using dx3d::culling::ClusterCamera;
+using dx3d::culling::ClusterGridDesc;
+using dx3d::culling::ClusterLight;
+using dx3d::culling::ClusterLightShape;
+using dx3d::culling::LightClusterBuilder;
+
+namespace {
+	constexpr float PI = 3.14159265f;
+
+	/**
+	 * @brief eXgp̃J(] + ړ)
+	 *	view͍sxNg(world * view)Brotation̍sJ̎
+	 */
+	struct TestCamera {
+		ClusterCamera camera{};
+		float rotation[3][3]{};	// [h -> r[̉](row: [h̎)
+		float eye[3]{};
+	};
+
+	TestCamera MakeCamera(float _yaw, float _pitch, const float* _eye)
+	{
+		TestCamera tc{};
+		const float cy = std::cos(_yaw), sy = std::sin(_yaw);
+		const float cp = std::cos(_pitch), sp = std::sin(_pitch);
+		// J̉E /  / O([h)
+		const float right[3] = { cy, 0.0f, -sy };
+		const float up[3] = { sy * sp, cp, cy * sp };
+		const float forward[3] = { sy * cp, -sp, cy * cp };
+		for (int r = 0; r < 3; ++r) {
+			tc.rotation[r][0] = right[r];
+			tc.rotation[r][1] = up[r];
+			tc.rotation[r][2] = forward[r];
+			tc.eye[r] = _eye[r];
+		}
+
+		float* m = tc.camera.view;
+		for (int r = 0; r < 3; ++r) {
+			for (int c = 0; c < 3; ++c) { m[r * 4 + c] = tc.rotation[r][c]; }
+			m[r * 4 + 3] = 0.0f;
+		}
+		for (int c = 0; c < 3; ++c) {
+			m[12 + c] = -(_eye[0] * tc.rotation[0][c] + _eye[1] * tc.rotation[1][c] + _eye[2] * tc.rotation[2][c]);
+		}
+		m[15] = 1.0f;
+
+		const float fovY = 60.0f * PI / 180.0f;
+		const float aspect = 16.0f / 9.0f;
+		tc.camera.projScaleY = 1.0f / std::tan(fovY * 0.5f);
+		tc.camera.projScaleX = tc.camera.projScaleY / aspect;
+		tc.camera.nearZ = 0.05f;
+		tc.camera.farZ = 100.0f;
+		return tc;
+	}
+
+	void WorldToView(const TestCamera& _tc, const float* _w, float* _out)
+	{
+		const float d[3] = { _w[0] - _tc.eye[0], _w[1] - _tc.eye[1], _w[2] - _tc.eye[2] };
+		for (int c = 0; c < 3; ++c) {
+			_out[c] = d[0] * _tc.rotation[0][c] + d[1] * _tc.rotation[1][c] + d[2] * _tc.rotation[2][c];
+		}
+	}
+
+	//! @brief _Cg͈̔͂ɓĂ邩(VF[_[̔Ɠ)
+	bool IsLit(const ClusterLight& _light, const float* _p)
+	{
+		if (_light.shape == ClusterLightShape::Global) { return true; }
+		const float d[3] = { _p[0] - _light.position[0], _p[1] - _light.position[1], _p[2] - _light.position[2] };
+		const float dist = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+		if (dist > _light.range) { return false; }
+		if (_light.shape == ClusterLightShape::Point || dist <= 0.0f) { return true; }
+		const float cosAngle = (d[0] * _light.direction[0] + d[1] * _light.direction[1] + d[2] * _light.direction[2]) / dist;
+		return cosAngle >= _light.cosOuter;
+	}
+
+	void RandomUnit(std::mt19937& _rng, float* _out)
+	{
+		std::normal_distribution<float> n(0.0f, 1.0f);
+		float len = 0.0f;
+		do {
+			for (int c = 0; c < 3; ++c) { _out[c] = n(_rng); }
+			len = std::sqrt(_out[0] * _out[0] + _out[1] * _out[1] + _out[2] * _out[2]);
+		} while (len < 1.0e-4f);
+		for (int c = 0; c < 3; ++c) { _out[c] /= len; }
+	}
+
+	/**
+	 * @brief J̑OɃCg΂܂
+	 * @param _spotRatio Spot̊
+	 */
+	std::vector<ClusterLight> MakeLights(std::mt19937& _rng, const TestCamera& _tc, uint32_t _count, float _spotRatio)
+	{
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+		std::vector<ClusterLight> lights(_count);
+		for (auto& light : lights) {
+			// ̒ƏO(J̌܂)
+			const float z = -5.0f + u01(_rng) * 70.0f;
+			const float x = (u01(_rng) * 2.4f - 1.2f) * std::abs(z) / _tc.camera.projScaleX;
+			const float y = (u01(_rng) * 2.4f - 1.2f) * std::abs(z) / _tc.camera.projScaleY;
+			const float view[3] = { x, y, z };
+			for (int c = 0; c < 3; ++c) {
+				light.position[c] = _tc.eye[c] + view[0] * _tc.rotation[c][0] + view[1] * _tc.rotation[c][1] + view[2] * _tc.rotation[c][2];
+			}
+			light.range = 0.5f + u01(_rng) * 12.0f;
+			if (u01(_rng) < _spotRatio) {
+				light.shape = ClusterLightShape::Spot;
+				RandomUnit(_rng, light.direction);
+				// 甼߂܂
+				light.cosOuter = std::cos((5.0f + u01(_rng) * 80.0f) * PI / 180.0f);
+			}
+			else {
+				light.shape = ClusterLightShape::Point;
+			}
+		}
+		return lights;
+	}
+
+	//! @brief NX^̊蓖ĂɃCgĂ邩
+	bool ClusterHasLight(const LightClusterBuilder& _builder, uint32_t _cluster, uint32_t _light)
+	{
+		const auto& ranges = _builder.GetClusterRanges();
+		const auto& indices = _builder.GetLightIndices();
+		const uint32_t begin = ranges[_cluster * 2 + 0];
+		const uint32_t end = begin + ranges[_cluster * 2 + 1];
+		return std::find(indices.begin() + begin, indices.begin() + end, _light) != indices.begin() + end;
+	}
+
+	/**
+	 * @brief Ƃ炳_̃NX^ɃCgKĂ邩ׂ
+	 *	_̓Cg͈̔͂̒(ɋE̋߂)IсA̒ɂ镨g
+	 * @return ׂ_̐
+	 */
+	uint32_t CheckCoverage(std::mt19937& _rng, const TestCamera& _tc, const LightClusterBuilder& _builder,
+		const std::vector<ClusterLight>& _lights, uint32_t _samplesPerLight, uint32_t& _outMissed)
+	{
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+		uint32_t checked = 0;
+		for (uint32_t li = 0; li < _lights.size(); ++li) {
+			const auto& light = _lights[li];
+			for (uint32_t s = 0; s < _samplesPerLight; ++s) {
+				float dir[3];
+				RandomUnit(_rng, dir);
+				// ͋Ê
+				const float t = (s % 2 == 0) ? (0.98f + 0.02f * u01(_rng)) : u01(_rng);
+				float world[3];
+				for (int c = 0; c < 3; ++c) { world[c] = light.position[c] + dir[c] * light.range * t; }
+				if (!IsLit(light, world)) { continue; }
+
+				float view[3];
+				WorldToView(_tc, world, view);
+				const float z = view[2];
+				if (z < _tc.camera.nearZ || z > _tc.camera.farZ) { continue; }
+				if (std::abs(view[0] * _tc.camera.projScaleX / z) > 1.0f || std::abs(view[1] * _tc.camera.projScaleY / z) > 1.0f) { continue; }
+
+				++checked;
+				if (!ClusterHasLight(_builder, _builder.FindCluster(view), li)) { ++_outMissed; }
+			}
+		}
+		return checked;
+	}
+}
+
+TEST_CASE(LightCluster, PointAndSpotCoverageIsConservative)
+{
+	std::mt19937 rng(2026);
+	const float eyes[][3] = { { 0, 0, 0 }, { 3, 2, -10 }, { -20, 5, 40 } };
+	const float angles[][2] = { { 0.0f, 0.0f }, { 0.7f, 0.2f }, { -2.5f, -0.6f } };
+
+	uint32_t checked = 0;
+	uint32_t missed = 0;
+	for (int i = 0; i < 3; ++i) {
+		const TestCamera tc = MakeCamera(angles[i][0], angles[i][1], eyes[i]);
+		const auto lights = MakeLights(rng, tc, 96, 0.5f);
+
+		LightClusterBuilder builder;
+		builder.Build(tc.camera, lights, nullptr);
+		checked += CheckCoverage(rng, tc, builder, lights, 400, missed);
+	}
+	std::printf("    %u lit points checked, %u missed\n", checked, missed);
+	CHECK(checked > 10000);
+	CHECK(missed == 0);
+}
+
+TEST_CASE(LightCluster, CoverageWithCoarseAndFineGrids)
+{
+	std::mt19937 rng(7);
+	const float eye[3] = { 0, 1, -3 };
+	const TestCamera tc = MakeCamera(0.3f, 0.1f, eye);
+	const auto lights = MakeLights(rng, tc, 64, 0.7f);
+
+	const ClusterGridDesc grids[] = {
+		{ 1, 1, 1, 1.0f },
+		{ 4, 3, 8, 0.5f },
+		{ 32, 18, 48, 2.0f },
+		{ 16, 9, 24, 1000.0f },	// ͈͊OnearSliceDepth͎Œ
+	};
+	for (const auto& grid : grids) {
+		LightClusterBuilder builder(grid);
+		builder.Build(tc.camera, lights, nullptr);
+		uint32_t missed = 0;
+		CHECK(CheckCoverage(rng, tc, builder, lights, 200, missed) > 1000);
+		CHECK(missed == 0);
+	}
+}
+
+TEST_CASE(LightCluster, GlobalLightsInEveryCluster)
+{
+	const float eye[3] = { 0, 0, 0 };
+	const TestCamera tc = MakeCamera(0.0f, 0.0f, eye);
+	std::vector<ClusterLight> lights(3);
+	lights[1].shape = ClusterLightShape::Point;
+	lights[1].range = 0.0f;	// ǂɂ͂Ȃ
+	lights[1].position[2] = 10.0f;
+
+	LightClusterBuilder builder;
+	builder.Build(tc.camera, lights, nullptr);
+	for (uint32_t c = 0; c < builder.GetClusterCount(); ++c) {
+		CHECK(builder.GetClusterRanges()[c * 2 + 1] == 2);
+		CHECK(ClusterHasLight(builder, c, 0));
+		CHECK(!ClusterHasLight(builder, c, 1));
+		CHECK(ClusterHasLight(builder, c, 2));
+	}
+}
+
+TEST_CASE(LightCluster, SmallLightStaysLocal)
+{
+	// ȓ_͎̂̃NX^ɂȂ(ێIȂ)
+	const float eye[3] = { 0, 0, 0 };
+	const TestCamera tc = MakeCamera(0.0f, 0.0f, eye);
+	std::vector<ClusterLight> lights(1);
+	lights[0].shape = ClusterLightShape::Point;
+	lights[0].position[2] = 20.0f;
+	lights[0].range = 0.5f;
+
+	LightClusterBuilder builder;
+	builder.Build(tc.camera, lights, nullptr);
+	const uint32_t assigned = static_cast<uint32_t>(builder.GetLightIndices().size());
+	std::printf("    assigned to %u / %u clusters\n", assigned, builder.GetClusterCount());
+	CHECK(assigned >= 1);
+	CHECK(assigned <= 16);
+
+	const float center[3] = { 0.0f, 0.0f, 20.0f };
+	CHECK(ClusterHasLight(builder, builder.FindCluster(center), 0));
+}
+
+TEST_CASE(LightCluster, ParallelMatchesSerial)
+{
+	std::mt19937 rng(99);
+	const float eye[3] = { 1, 2, 3 };
+	const TestCamera tc = MakeCamera(1.0f, -0.3f, eye);
+	const auto lights = MakeLights(rng, tc, 256, 0.5f);
+
+	LightClusterBuilder serial;
+	serial.Build(tc.camera, lights, nullptr);
+
+	dx3d::JobSystem jobs(4);
+	LightClusterBuilder parallel;
+	for (int round = 0; round < 10; ++round) {
+		parallel.Build(tc.camera, lights, &jobs);
+		CHECK(parallel.GetClusterRanges() == serial.GetClusterRanges());
+		CHECK(parallel.GetLightIndices() == serial.GetLightIndices());
+		CHECK(parallel.GetMaxLightsPerCluster() == serial.GetMaxLightsPerCluster());
+	}
+
+	// ͈͂͌ԂȂł
+	const auto& ranges = serial.GetClusterRanges();
+	uint32_t next = 0;
+	bool packed = true;
+	for (uint32_t c = 0; c < serial.GetClusterCount(); ++c) {
+		packed = packed && (ranges[c * 2 + 0] == next);
+		next += ranges[c * 2 + 1];
+	}
+	CHECK(packed);
+	CHECK(next == serial.GetLightIndices().size());
+}
+
+BENCH_CASE(LightCluster, BuildWith64To1024Lights)
+{
+	std::mt19937 rng(5);
+	const float eye[3] = { 0, 2, -5 };
+	const TestCamera tc = MakeCamera(0.2f, 0.1f, eye);
+	const uint32_t threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+	dx3d::JobSystem jobs((threads > 1) ? threads - 1 : 1);
+	std::printf("    grid 16x9x24, %u threads (JobSystem workers: %u)\n", threads, jobs.GetWorkerCount());
+
+	for (uint32_t count : { 64u, 128u, 256u, 512u, 1024u }) {
+		const auto lights = MakeLights(rng, tc, count, 0.5f);
+		LightClusterBuilder builder;
+		const double serialMs = test::MeasureMs(20, [&]() { builder.Build(tc.camera, lights, nullptr); });
+		const double parallelMs = test::MeasureMs(20, [&]() { builder.Build(tc.camera, lights, &jobs); });
+		const double average = static_cast<double>(builder.GetLightIndices().size()) / builder.GetClusterCount();
+		std::printf("    %4u lights: serial %6.3f ms | JobSystem %6.3f ms | avg %5.1f / max %4u lights per cluster\n",
+			count, serialMs, parallelMs, average, builder.GetMaxLightsPerCluster());
+	}
+}
@@ -0,0 +1,179 @@
+/**
+ * @file NarrowPhaseBatchTests.cpp
+ * @brief ܂Ƃ߂Ĕ肷i[tF[Y(NarrowPhaseBatch)ƈ̔(IntersectOBB)̔r
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <Game/Collisions/CollisionUtils.h>
+#include <Game/Collisions/NarrowPhaseBatch.h>
+#include "TestFramework.h"
+
+using dx3d::collision::WorldOBB;
+using dx3d::collision::NarrowPhaseBatch;
+using dx3d::collision::NarrowPhaseResult;
+using dx3d::collision::IntersectOBB;
+using dx3d::collision::ToContactBox;
+
+namespace {
+	constexpr float PI = 3.14159265f;
+
+	/**
+	 * @brief _Ȕ
+	 *	_aligned: ]Ȃ(ӓmׂ̎yA)
+	 */
+	WorldOBB RandomBox(std::mt19937& _rng, float _range, bool _aligned)
+	{
+		std::uniform_real_distribution<float> pos(-_range, _range);
+		std::uniform_real_distribution<float> size(0.1f, 1.0f);
+		std::uniform_real_distribution<float> angle(-PI, PI);
+
+		WorldOBB box{};
+		box.center = { pos(_rng), pos(_rng), pos(_rng) };
+		box.half = { size(_rng), size(_rng), size(_rng) };
+		if (_aligned) { return box; }
+
+		// 3ꂼ̉]
+		const float yaw = angle(_rng), pitch = angle(_rng), roll = angle(_rng);
+		const auto rot = DirectX::XMMatrixRotationRollPitchYaw(pitch, yaw, roll);
+		for (int i = 0; i < 3; ++i) {
+			DirectX::XMStoreFloat3(&box.axis[i], DirectX::XMVector3Normalize(rot.r[i]));
+		}
+		return box;
+	}
+
+	//! @brief _ȃyA(4g1g͓)
+	std::vector<std::pair<WorldOBB, WorldOBB>> MakePairs(uint32_t _count, float _range, uint32_t _seed)
+	{
+		std::mt19937 rng(_seed);
+		std::vector<std::pair<WorldOBB, WorldOBB>> pairs;
+		pairs.reserve(_count);
+		for (uint32_t i = 0; i < _count; ++i) {
+			const bool aligned = (i % 4) == 0;
+			pairs.emplace_back(RandomBox(rng, _range, aligned), RandomBox(rng, _range, aligned));
+		}
+		return pairs;
+	}
+
+	bool SameBits(float _a, float _b) { return std::memcmp(&_a, &_b, sizeof(float)) == 0; }
+}
+
+TEST_CASE(NarrowPhase, BatchMatchesScalarIntersectOBB)
+{
+	// SIMDł܂Ƃ߂ʂ́AIntersectOBBƃrbgPʂňv([̕Ŋ؂Ȃς)
+	for (uint32_t count : { 1u, 7u, 4099u }) {
+		const auto pairs = MakePairs(count, 1.5f, 3 + count);
+		NarrowPhaseBatch batch;
+		batch.Begin();
+		for (const auto& [a, b] : pairs) {
+			batch.AddBoxBox(ToContactBox(a), ToContactBox(b));
+		}
+		batch.Run();
+		CHECK(batch.GetCount() == count);
+
+		uint32_t hits = 0;
+		uint32_t mismatches = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			const NarrowPhaseResult& r = batch.GetResult(i);
+			const auto expected = IntersectOBB(pairs[i].first, pairs[i].second);
+			if (r.hit != expected.has_value()) {
+				++mismatches;
+				continue;
+			}
+			if (!r.hit) { continue; }
+			++hits;
+			const bool same = r.feature == expected->feature
+				&& SameBits(r.penetration, expected->penetration)
+				&& SameBits(r.normal[0], expected->normal.x)
+				&& SameBits(r.normal[1], expected->normal.y)
+				&& SameBits(r.normal[2], expected->normal.z)
+				&& SameBits(r.contactPoint[0], expected->contactPoint.x)
+				&& SameBits(r.contactPoint[1], expected->contactPoint.y)
+				&& SameBits(r.contactPoint[2], expected->contactPoint.z);
+			mismatches += same ? 0u : 1u;
+		}
+		CHECK(mismatches == 0);
+		if (count > 1000) {
+			//  / O̗\ɍĂ
+			CHECK(hits > count / 5);
+			CHECK(hits < count * 4 / 5);
+		}
+	}
+}
+
+TEST_CASE(NarrowPhase, ReusesBatchAcrossSteps)
+{
+	// ςݒĂǑʂcȂ
+	const auto many = MakePairs(100, 1.5f, 5);
+	const auto few = MakePairs(3, 1.5f, 6);
+	NarrowPhaseBatch batch;
+	batch.Begin();
+	for (const auto& [a, b] : many) {
+		batch.AddBoxBox(ToContactBox(a), ToContactBox(b));
+	}
+	batch.Run();
+
+	batch.Begin();
+	for (const auto& [a, b] : few) {
+		batch.AddBoxBox(ToContactBox(a), ToContactBox(b));
+	}
+	batch.Run();
+	CHECK(batch.GetCount() == 3);
+	for (uint32_t i = 0; i < 3; ++i) {
+		const auto expected = IntersectOBB(few[i].first, few[i].second);
+		CHECK(batch.GetResult(i).hit == expected.has_value());
+		if (expected) {
+			CHECK(batch.GetResult(i).feature == expected->feature);
+			CHECK_NEAR(batch.GetResult(i).penetration, expected->penetration, 0.0f);
+		}
+	}
+}
+
+BENCH_CASE(NarrowPhase, BatchedVsScalarPairs)
+{
+	// -̃yA / ܂Ƃ߂Ĕ肵1b̃yA
+	// ̔͊O鎲Ŕ̂ŁAW(قƂǓ) / U΂(1/4炢)̗
+	const int repeat = 10;
+	std::printf("    lane width %u\n", NarrowPhaseBatch::GetLaneWidth());
+	for (float range : { 0.5f, 1.5f }) {
+		for (uint32_t count : { 1000u, 10000u, 100000u }) {
+			const auto pairs = MakePairs(count, range, 42);
+
+			uint32_t scalarHits = 0;
+			const double scalarMs = test::MeasureMs(repeat, [&]() {
+				scalarHits = 0;
+				for (const auto& [a, b] : pairs) {
+					const auto r = IntersectOBB(a, b);
+					scalarHits += r ? 1u : 0u;
+					test::DoNotOptimize(r);
+				}
+			});
+
+			// ςޏ(WorldOBB -> SoA)܂߂
+			NarrowPhaseBatch batch;
+			uint32_t batchHits = 0;
+			const double batchMs = test::MeasureMs(repeat, [&]() {
+				batch.Begin();
+				for (const auto& [a, b] : pairs) {
+					batch.AddBoxBox(ToContactBox(a), ToContactBox(b));
+				}
+				batch.Run();
+				batchHits = 0;
+				for (uint32_t i = 0; i < batch.GetCount(); ++i) {
+					batchHits += batch.GetResult(i).hit ? 1u : 0u;
+				}
+			});
+
+			std::printf("    range %.1f %6u pairs (%6u hits): scalar %7.2f Mpairs/s / batched %7.2f Mpairs/s (x%.2f)%s\n",
+				range, count, batchHits, count / scalarMs * 1.0e-3, count / batchMs * 1.0e-3, scalarMs / batchMs,
+				(scalarHits == batchHits) ? "" : " MISMATCH");
+		}
+	}
+}
@@ -0,0 +1,307 @@
+/**
+ * @file RenderQueueTests.cpp
+ * @brief RenderQueue(64bit̕`L[̊\[g)̕яƂ܂Ƃߕ̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <DX3D/Graphics/RenderQueue.h>
+#include "TestFramework.h"
+
+using dx3d::BlendMode;
+using dx3d::PipelineKey;
+using dx3d::RenderQueue;
+
+namespace {
+	//! @brief `Ŏg炢̃pCvC(Alpha)
+	PipelineKey MakePipeline(dx3d::PixelShaderKind _ps, BlendMode _blend)
+	{
+		PipelineKey key(dx3d::VertexShaderKind::Instanced, _ps, dx3d::PipelineFlags::Instancing);
+		key.SetBlend(_blend);
+		return key;
+	}
+
+	struct Item {
+		uint64_t key = 0;
+		uint32_t payload = 0;
+	};
+
+	//! @brief _ȃL[(pass /  / pCvC / bV / [x)
+	std::vector<Item> MakeItems(std::mt19937& _rng, uint32_t _count, uint32_t _meshCount, float _transparentRatio)
+	{
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+		const PipelineKey pipelines[] = {
+			MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Opaque),
+			MakePipeline(dx3d::PixelShaderKind::Color, BlendMode::Opaque),
+			MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Alpha),
+			MakePipeline(dx3d::PixelShaderKind::Color, BlendMode::Add),
+		};
+		std::vector<Item> items(_count);
+		for (uint32_t i = 0; i < _count; ++i) {
+			const bool transparent = u01(_rng) < _transparentRatio;
+			const PipelineKey pipeline = pipelines[(transparent ? 2 : 0) + (_rng() & 1)];
+			const uint32_t pass = (_rng() % 8 == 0) ? 1 : 0;
+			items[i].key = RenderQueue::MakeKey(pass, pipeline, _rng() % _meshCount, transparent, u01(_rng));
+			items[i].payload = i;
+		}
+		return items;
+	}
+}
+
+TEST_CASE(RenderQueue, KeyFieldsRoundTrip)
+{
+	const PipelineKey opaque = MakePipeline(dx3d::PixelShaderKind::Color, BlendMode::Opaque);
+	const PipelineKey alpha = MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Alpha);
+
+	const uint64_t a = RenderQueue::MakeKey(3, opaque, 1234, false, 0.25f);
+	CHECK(RenderQueue::GetPass(a) == 3);
+	CHECK(!RenderQueue::IsTransparent(a));
+	CHECK(RenderQueue::GetPipelineKey(a) == opaque);
+	CHECK(RenderQueue::GetMeshId(a) == 1234);
+
+	const uint64_t b = RenderQueue::MakeKey(15, alpha, RenderQueue::MAX_MESH_ID, true, 0.9f);
+	CHECK(RenderQueue::GetPass(b) == 15);
+	CHECK(RenderQueue::IsTransparent(b));
+	CHECK(RenderQueue::GetPipelineKey(b) == alpha);
+	CHECK(RenderQueue::GetMeshId(b) == RenderQueue::MAX_MESH_ID);
+
+	// ͈͊ÕbVԍ / [x͋l߂
+	const uint64_t c = RenderQueue::MakeKey(0, opaque, RenderQueue::MAX_MESH_ID + 100, false, 2.0f);
+	CHECK(RenderQueue::GetMeshId(c) == RenderQueue::MAX_MESH_ID);
+	CHECK(c == RenderQueue::MakeKey(0, opaque, RenderQueue::MAX_MESH_ID, false, 1.0f));
+	CHECK(RenderQueue::MakeKey(0, opaque, 7, false, -1.0f) == RenderQueue::MakeKey(0, opaque, 7, false, 0.0f));
+}
+
+TEST_CASE(RenderQueue, KeyOrdering)
+{
+	// pass  s  ̏Bs̓pCvC  bV  OA͉
+	const PipelineKey p0 = MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Opaque);
+	const PipelineKey p1 = MakePipeline(dx3d::PixelShaderKind::Color, BlendMode::Opaque);
+	const PipelineKey alpha = MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Alpha);
+	CHECK(p0.value < p1.value);
+
+	const uint64_t expected[] = {
+		RenderQueue::MakeKey(0, p0, 2, false, 0.1f),
+		RenderQueue::MakeKey(0, p0, 2, false, 0.8f),
+		RenderQueue::MakeKey(0, p0, 5, false, 0.0f),	// OłbV
+		RenderQueue::MakeKey(0, p1, 0, false, 0.0f),	// pCvC
+		RenderQueue::MakeKey(0, alpha, 9, true, 0.9f),	// ͕šŉ
+		RenderQueue::MakeKey(0, alpha, 1, true, 0.5f),
+		RenderQueue::MakeKey(0, alpha, 3, true, 0.5f),	// [xȂpCvC  bV
+		RenderQueue::MakeKey(0, alpha, 0, true, 0.1f),
+		RenderQueue::MakeKey(1, p0, 0, false, 0.0f),	// passԏ
+	};
+	for (size_t i = 0; i + 1 < std::size(expected); ++i) {
+		CHECK(expected[i] < expected[i + 1]);
+	}
+
+	// tɐςłג
+	RenderQueue queue;
+	for (size_t i = std::size(expected); i-- > 0;) {
+		queue.Add(expected[i], static_cast<uint32_t>(i));
+	}
+	queue.Sort();
+	const auto& payloads = queue.GetPayloads();
+	CHECK(payloads.size() == std::size(expected));
+	for (uint32_t i = 0; i < payloads.size(); ++i) {
+		CHECK(payloads[i] == i);
+	}
+}
+
+TEST_CASE(RenderQueue, SortMatchesStableSort)
+{
+	// \[ǧʂ́AL[std::stable_sortƓ(L[͐ς񂾏̂܂)
+	std::mt19937 rng(18);
+	RenderQueue queue;
+	for (uint32_t count : { 1u, 2u, 7u, 100u, 5000u, 40000u }) {
+		for (float transparentRatio : { 0.0f, 0.3f, 1.0f }) {
+			auto items = MakeItems(rng, count, 64, transparentRatio);
+			// L[
+			for (uint32_t i = 1; i < count; i += 5) { items[i].key = items[i - 1].key; }
+
+			queue.Clear();
+			queue.Reserve(count);
+			for (const auto& item : items) { queue.Add(item.key, item.payload); }
+			queue.Sort();
+
+			std::stable_sort(items.begin(), items.end(), [](const Item& _a, const Item& _b) { return _a.key < _b.key; });
+			const auto& payloads = queue.GetPayloads();
+			CHECK(queue.GetCount() == count);
+			CHECK(payloads.size() == count);
+			uint32_t mismatched = 0;
+			for (uint32_t i = 0; i < count && i < payloads.size(); ++i) {
+				mismatched += (payloads[i] != items[i].payload) ? 1 : 0;
+			}
+			CHECK(mismatched == 0);
+		}
+	}
+}
+
+TEST_CASE(RenderQueue, MergesAdjacentBatches)
+{
+	// s͐[xႤ̕`ɂ܂Ƃ߂B͉̏ԂȂ̂ŁAׂ荇Ԃ܂Ƃ߂
+	const PipelineKey opaque = MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Opaque);
+	const PipelineKey alpha = MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Alpha);
+
+	RenderQueue queue;
+	uint32_t payload = 0;
+	// s: bV03AbV12([x͂΂΂)
+	for (float depth : { 0.7f, 0.1f, 0.4f }) { queue.Add(RenderQueue::MakeKey(0, opaque, 0, false, depth), payload++); }
+	for (float depth : { 0.9f, 0.2f }) { queue.Add(RenderQueue::MakeKey(0, opaque, 1, false, depth), payload++); }
+	// :  bV0, 0, 1, 0
+	queue.Add(RenderQueue::MakeKey(0, alpha, 0, true, 0.9f), payload++);
+	queue.Add(RenderQueue::MakeKey(0, alpha, 0, true, 0.8f), payload++);
+	queue.Add(RenderQueue::MakeKey(0, alpha, 1, true, 0.5f), payload++);
+	queue.Add(RenderQueue::MakeKey(0, alpha, 0, true, 0.2f), payload++);
+	queue.Sort();
+
+	const auto& draws = queue.GetDraws();
+	CHECK(draws.size() == 5);
+	if (draws.size() == 5) {
+		const uint32_t counts[] = { 3, 2, 2, 1, 1 };
+		const uint32_t meshes[] = { 0, 1, 0, 1, 0 };
+		uint32_t first = 0;
+		for (size_t i = 0; i < draws.size(); ++i) {
+			CHECK(draws[i].first == first);
+			CHECK(draws[i].count == counts[i]);
+			CHECK(RenderQueue::GetMeshId(draws[i].key) == meshes[i]);
+			first += draws[i].count;
+		}
+		// ܂Ƃ߂O
+		const auto& payloads = queue.GetPayloads();
+		CHECK(payloads[0] == 1 && payloads[1] == 2 && payloads[2] == 0);
+	}
+
+	// ܂Ƃ߂`͑S̃CX^X񂸂(_)
+	std::mt19937 rng(19);
+	const auto items = MakeItems(rng, 20000, 32, 0.25f);
+	queue.Clear();
+	for (const auto& item : items) { queue.Add(item.key, item.payload); }
+	queue.Sort();
+	uint32_t covered = 0, badKey = 0, opaqueDraws = 0;
+	for (const auto& d : queue.GetDraws()) {
+		CHECK(d.first == covered);
+		covered += d.count;
+		for (uint32_t i = d.first; i < d.first + d.count; ++i) {
+			const uint64_t key = items[queue.GetPayloads()[i]].key;
+			badKey += (RenderQueue::GetMeshId(key) != RenderQueue::GetMeshId(d.key) ||
+				RenderQueue::GetPipelineKey(key) != RenderQueue::GetPipelineKey(d.key) ||
+				RenderQueue::GetPass(key) != RenderQueue::GetPass(d.key)) ? 1 : 0;
+		}
+		opaqueDraws += RenderQueue::IsTransparent(d.key) ? 0 : 1;
+	}
+	CHECK(covered == items.size());
+	CHECK(badKey == 0);
+	// spass x pCvC x bV̐܂Ō
+	CHECK(opaqueDraws <= 2 * 2 * 32);
+}
+
+TEST_CASE(RenderQueue, SkipsConstantDigitsAndReuses)
+{
+	// [xȂL[́Aʂׂ̌
+	const PipelineKey opaque = MakePipeline(dx3d::PixelShaderKind::Default, BlendMode::Opaque);
+	RenderQueue queue;
+	queue.Sort();
+	CHECK(queue.GetDraws().empty());
+	CHECK(queue.GetLastSortPasses() == 0);
+
+	for (uint32_t i = 0; i < 1000; ++i) {
+		queue.Add(RenderQueue::MakeKey(0, opaque, 3, false, (i % 97) / 97.0f), i);
+	}
+	queue.Sort();
+	CHECK(queue.GetLastSortPasses() <= 2);
+	CHECK(queue.GetDraws().size() == 1);
+	CHECK(queue.GetDraws()[0].count == 1000);
+
+	// ςݒƑǑʂ͎cȂ
+	queue.Clear();
+	CHECK(queue.GetCount() == 0);
+	CHECK(queue.GetPayloads().empty());
+	queue.Add(RenderQueue::MakeKey(0, opaque, 1, false, 0.0f), 42);
+	queue.Sort();
+	CHECK(queue.GetDraws().size() == 1);
+	CHECK(queue.GetPayloads().size() == 1 && queue.GetPayloads()[0] == 42);
+}
+
+BENCH_CASE(RenderQueue, RadixQueueVsHashMapBatches)
+{
+	// 1t[: ς  ׂ  CX^Xf[^`ɋl߂
+	//   queue: RenderQueueɐςŊ\[gApayload̏Ɉ̔z֋l߂
+	//   map:   ȑORenderSystem(unordered_mapŃbV + pCvCƂ̃ob`ɋl߁Aob`std::sort)
+	struct Instance {
+		float world[16]{};
+		float color[4]{};
+	};
+	struct OldKey {
+		uint32_t mesh = 0;
+		uint32_t pipeline = 0;
+		bool operator==(const OldKey& _o) const noexcept { return mesh == _o.mesh && pipeline == _o.pipeline; }
+	};
+	struct OldKeyHash {
+		size_t operator()(const OldKey& _k) const noexcept { return std::hash<uint32_t>()(_k.mesh) ^ (std::hash<uint32_t>()(_k.pipeline) << 1); }
+	};
+	struct OldBatch {
+		PipelineKey key{};
+		uint32_t mesh = 0;
+		float sortKey = 0.0f;
+		std::vector<Instance> instances{};
+	};
+
+	std::mt19937 rng(20);
+	for (uint32_t count : { 10000u, 30000u, 100000u }) {
+		const auto items = MakeItems(rng, count, 64, 0.2f);
+		std::vector<Instance> source(count);
+		for (uint32_t i = 0; i < count; ++i) { source[i].world[12] = static_cast<float>(i); }
+
+		RenderQueue queue;
+		std::vector<Instance> packed;
+		const double queueMs = test::MeasureMs(10, [&]() {
+			queue.Clear();
+			queue.Reserve(count);
+			for (const auto& item : items) { queue.Add(item.key, item.payload); }
+			queue.Sort();
+			packed.resize(count);
+			const auto& payloads = queue.GetPayloads();
+			for (uint32_t i = 0; i < count; ++i) { packed[i] = source[payloads[i]]; }
+			test::DoNotOptimize(packed);
+		});
+
+		size_t oldDraws = 0;
+		const double mapMs = test::MeasureMs(10, [&]() {
+			std::unordered_map<OldKey, size_t, OldKeyHash> map;
+			std::vector<OldBatch> opaque;
+			std::vector<OldBatch> transparent;
+			for (const auto& item : items) {
+				const bool isTransparent = RenderQueue::IsTransparent(item.key);
+				auto& target = isTransparent ? transparent : opaque;
+				const OldKey key{ RenderQueue::GetMeshId(item.key), RenderQueue::GetPipelineKey(item.key).value };
+				size_t batchIndex{};
+				if (auto it = map.find(key); it != map.end()) {
+					batchIndex = it->second;
+				}
+				else {
+					batchIndex = target.size();
+					map.emplace(key, batchIndex);
+					target.push_back(OldBatch{ .key = RenderQueue::GetPipelineKey(item.key), .mesh = key.mesh });
+				}
+				target[batchIndex].instances.emplace_back(source[item.payload]);
+				if (isTransparent) { target[batchIndex].sortKey = static_cast<float>(item.key & 0xffff); }
+			}
+			std::sort(opaque.begin(), opaque.end(), [](const auto& _a, const auto& _b) { return _a.key < _b.key; });
+			std::sort(transparent.begin(), transparent.end(), [](const auto& _a, const auto& _b) { return _a.sortKey > _b.sortKey; });
+			oldDraws = opaque.size() + transparent.size();
+			test::DoNotOptimize(opaque);
+		});
+
+		std::printf("    %6u instances | queue %7.3f ms (%5zu draws, %u radix passes) | unordered_map + std::sort %7.3f ms (%3zu draws) | x%.2f\n",
+			count, queueMs, queue.GetDraws().size(), queue.GetLastSortPasses(), mapMs, oldDraws, mapMs / queueMs);
+	}
+	// memo: ȑO̕@͔bVƂɈ̃ob`ɂ܂Ƃ߂̂ŕ`͏ȂȀԂ͎Ȃ
+}
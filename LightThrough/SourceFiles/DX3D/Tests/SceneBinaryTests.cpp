@@ -0,0 +1,447 @@
+/**
+ * @file SceneBinaryTests.cpp
+ * @brief NbNς݃V[̃ubN(ComponentBinary)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <Game/ECS/ComponentArray.h>
+#include <Game/ECS/CommandBuffer.h>
+#include <Game/Serialization/ComponentReflection.h>
+#include <Game/Serialization/ComponentBinary.h>
+#include "TestFramework.h"
+
+namespace scene_test {
+	// TestScene.jsonƓtB[hComponent({DirectXMathɈˑ̂őɎg)
+	struct Float3 { float x = 0.0f, y = 0.0f, z = 0.0f; };
+	struct Float4 { float x = 0.0f, y = 0.0f, z = 0.0f, w = 1.0f; };
+
+	struct Transform {
+		Float3 position{};
+		Float4 rotationQuat{};
+		Float3 scale{ 1.0f, 1.0f, 1.0f };
+	};
+	struct Name { std::string value{}; };
+	struct LightCommon {
+		Float3 color{ 1.0f, 1.0f, 1.0f };
+		float intensity = 1.0f;
+		bool enabled = true;	// ɃpfBO
+	};
+	struct SpotLight {
+		float range = 10.0f;
+		float innerCos = 0.9f;
+		float outerCos = 0.8f;
+	};
+	// tNVĂȂo(LbVȂ)
+	struct Cached {
+		float value = 0.0f;
+		float cache = 0.0f;
+	};
+	// tB[hŐ錾̏ԂႤ
+	struct OrderA { float a = 0.0f; int32_t b = 0; };
+	struct OrderB { int32_t b = 0; float a = 0.0f; };
+}
+
+ECS_REFLECT_BEGIN(scene_test::Transform)
+ECS_REFLECT_FIELD(position),
+ECS_REFLECT_FIELD(rotationQuat),
+ECS_REFLECT_FIELD(scale)
+ECS_REFLECT_END()
+
+ECS_REFLECT_BEGIN(scene_test::Name)
+ECS_REFLECT_FIELD(value)
+ECS_REFLECT_END()
+
+ECS_REFLECT_BEGIN(scene_test::LightCommon)
+ECS_REFLECT_FIELD(color),
+ECS_REFLECT_FIELD(intensity),
+ECS_REFLECT_FIELD(enabled)
+ECS_REFLECT_END()
+
+ECS_REFLECT_BEGIN(scene_test::SpotLight)
+ECS_REFLECT_FIELD(range),
+ECS_REFLECT_FIELD(innerCos),
+ECS_REFLECT_FIELD(outerCos)
+ECS_REFLECT_END()
+
+ECS_REFLECT_BEGIN(scene_test::Cached)
+ECS_REFLECT_FIELD(value)
+ECS_REFLECT_END()
+
+// OrderA / OrderB͓Oœo^āANbNƍƂŐ錾̏Ԃςꍇ
+template<> struct ecs_serial::TypeReflection<scene_test::OrderA> {
+	using This = scene_test::OrderA;
+	static constexpr std::string_view Name() { return "Order"; }
+	static constexpr auto Fields() {
+		return std::make_tuple(
+			ecs_serial::FieldInfo<This, float>{ "a", &This::a },
+			ecs_serial::FieldInfo<This, int32_t>{ "b", &This::b });
+	}
+};
+template<> struct ecs_serial::TypeReflection<scene_test::OrderB> {
+	using This = scene_test::OrderB;
+	static constexpr std::string_view Name() { return "Order"; }
+	static constexpr auto Fields() {
+		return std::make_tuple(
+			ecs_serial::FieldInfo<This, float>{ "a", &This::a },
+			ecs_serial::FieldInfo<This, int32_t>{ "b", &This::b });
+	}
+};
+
+namespace {
+	using namespace scene_test;
+	using ecs_serial::BinaryReader;
+	using ecs_serial::BinaryWriter;
+	using json = nlohmann::json;
+
+	ecs::Entity MakeEntity(uint32_t _index)
+	{
+		return ecs::Entity(ecs::CreateEntity(_index, 1));
+	}
+
+	/**
+	 * @brief ǂݍݐ(CoordinatorAddComponentBlockƓComponentArray֓)
+	 */
+	struct SceneStore {
+		std::tuple<
+			ecs::ComponentArray<Transform>,
+			ecs::ComponentArray<Name>,
+			ecs::ComponentArray<LightCommon>,
+			ecs::ComponentArray<SpotLight>> arrays{};
+
+		template<class T>
+		ecs::ComponentArray<T>& Array() { return std::get<ecs::ComponentArray<T>>(arrays); }
+
+		template<class T>
+		void AddComponentBlock(const ecs::Entity* _entities, const void* _data, uint32_t _count)
+		{
+			Array<T>().AddRawBlock(_entities, _data, _count);
+		}
+	};
+
+	/**
+	 * @brief Component̎ނƂ̓ǂݏ(ComponentRegistry::Entry̑)
+	 */
+	struct ComponentKind {
+		std::string key{};
+		std::function<void(const std::vector<const json*>&, BinaryWriter&)> cook{};
+		std::function<bool(uint32_t, BinaryReader&)> validateBlock{};
+		std::function<void(SceneStore&, const ecs::Entity*, uint32_t, BinaryReader&)> loadBlock{};
+		std::function<void(ecs::CommandBuffer&, ecs::Entity, const json&)> requestAdd{};	// JSONǂގ(RequestAddComponent)
+		std::function<void(SceneStore&, const ecs::Command&)> apply{};						// R}h̔f
+	};
+
+	template<class T>
+	ComponentKind MakeKind(std::string _key, ecs::ComponentType _type)
+	{
+		ComponentKind kind;
+		kind.key = std::move(_key);
+		kind.cook = [](const std::vector<const json*>& _src, BinaryWriter& _w) { ecs_serial::CookComponentBlock<T>(_src, _w); };
+		kind.validateBlock = [](uint32_t _count, BinaryReader& _r) { return ecs_serial::ValidateComponentBlock<T>(_count, _r); };
+		kind.loadBlock = [](SceneStore& _store, const ecs::Entity* _entities, uint32_t _count, BinaryReader& _r) {
+			ecs_serial::LoadComponentBlock<T>(_store, _entities, _count, _r);
+		};
+		kind.requestAdd = [_type](ecs::CommandBuffer& _buffer, ecs::Entity _e, const json& _j) {
+			_buffer.AddComponent(ecs::CommandKey{}, _e, _type, ecs_serial::Deserialize<T>(_j));
+		};
+		kind.apply = [](SceneStore& _store, const ecs::Command& _command) { _store.Array<T>().AddRaw(_command.e, _command.payload); };
+		return kind;
+	}
+
+	const std::vector<ComponentKind>& GetKinds()
+	{
+		static const std::vector<ComponentKind> kinds = {
+			MakeKind<Transform>("ecs::Transform", 0),
+			MakeKind<Name>("ecs::Name", 1),
+			MakeKind<LightCommon>("ecs::LightCommon", 2),
+			MakeKind<SpotLight>("ecs::SpotLight", 3),
+		};
+		return kinds;
+	}
+
+	/**
+	 * @brief NbNubN(SceneSerializer::CookSceneƓ܂Ƃߕ)
+	 */
+	struct CookedBlock {
+		const ComponentKind* kind = nullptr;
+		std::vector<uint32_t> entities{};
+		std::vector<uint8_t> data{};
+	};
+
+	std::vector<CookedBlock> CookScene(const json& _jScene)
+	{
+		std::vector<CookedBlock> blocks;
+		for (const auto& kind : GetKinds()) {
+			CookedBlock block;
+			block.kind = &kind;
+			std::vector<const json*> components;
+			const auto& arr = _jScene.at("entities");
+			for (uint32_t i = 0; i < static_cast<uint32_t>(arr.size()); ++i) {
+				const auto& jComponents = arr[i].at("components");
+				if (!jComponents.contains(kind.key)) { continue; }
+				block.entities.push_back(i);
+				components.push_back(&jComponents.at(kind.key));
+			}
+			BinaryWriter w;
+			kind.cook(components, w);
+			block.data = w.GetBuffer();
+			blocks.push_back(std::move(block));
+		}
+		return blocks;
+	}
+
+	//! @brief JSONǂ(1EntityR}hɐςŔfBSceneSerializer::DeserializeScene̗)
+	void LoadJson(const std::string& _text, SceneStore& _store)
+	{
+		const json jScene = json::parse(_text);
+		std::vector<std::unique_ptr<ecs::CommandBuffer>> buffers;
+		buffers.push_back(std::make_unique<ecs::CommandBuffer>());
+		const auto& arr = jScene.at("entities");
+		for (uint32_t i = 0; i < static_cast<uint32_t>(arr.size()); ++i) {
+			const auto& jComponents = arr[i].at("components");
+			for (const auto& kind : GetKinds()) {
+				if (jComponents.contains(kind.key)) {
+					kind.requestAdd(*buffers[0], MakeEntity(i), jComponents.at(kind.key));
+				}
+			}
+		}
+		std::vector<const ecs::Command*> merged;
+		ecs::CommandBuffer::Merge(buffers, merged);
+		for (const auto* command : merged) {
+			GetKinds()[command->component].apply(_store, *command);
+		}
+		buffers[0]->Clear();
+	}
+
+	/**
+	 * @brief NbNς݂ǂ(SceneSerializer::TryDeserializeCookedScene̗)
+	 *	SubNm߂ĂAubNƂɂ܂Ƃ߂Ēǉ
+	 * @return m߂Ēʂ: true(false͉̎ǉĂȂ)
+	 */
+	bool LoadCooked(const std::vector<CookedBlock>& _blocks, uint32_t _entityCount, SceneStore& _store)
+	{
+		for (const auto& block : _blocks) {
+			BinaryReader r(block.data.data(), block.data.size());
+			if (!block.kind->validateBlock(static_cast<uint32_t>(block.entities.size()), r)) { return false; }
+		}
+
+		std::vector<ecs::Entity> entities(_entityCount);
+		for (uint32_t i = 0; i < _entityCount; ++i) {
+			entities[i] = MakeEntity(i);
+		}
+		std::vector<ecs::Entity> targets;
+		for (const auto& block : _blocks) {
+			targets.resize(block.entities.size());
+			for (size_t i = 0; i < block.entities.size(); ++i) {
+				targets[i] = entities[block.entities[i]];
+			}
+			BinaryReader r(block.data.data(), block.data.size());
+			block.kind->loadBlock(_store, targets.data(), static_cast<uint32_t>(targets.size()), r);
+		}
+		return true;
+	}
+
+	//! @brief 擪_entityCountEntitŷATĂ鐔
+	template<class T>
+	uint32_t CountComponents(SceneStore& _store, uint32_t _entityCount)
+	{
+		uint32_t n = 0;
+		for (uint32_t i = 0; i < _entityCount; ++i) {
+			n += _store.Array<T>().Has(MakeEntity(i)) ? 1 : 0;
+		}
+		return n;
+	}
+
+	//! @brief TestScene.json(΋)
+	std::string ReadTestScene()
+	{
+		std::ifstream ifs(std::string(LIGHTTHROUGH_ASSET_DIR) + "/Scenes/TestScene.json");
+		std::stringstream ss;
+		ss << ifs.rdbuf();
+		return ss.str();
+	}
+
+	//! @brief V[Entity_countɂȂ܂ŌJԂV[
+	json RepeatScene(const json& _jScene, uint32_t _count)
+	{
+		json out = _jScene;
+		auto& arr = out["entities"];
+		arr = json::array();
+		const auto& src = _jScene.at("entities");
+		for (uint32_t i = 0; i < _count; ++i) {
+			json e = src[i % src.size()];
+			e["id"] = i;
+			arr.push_back(std::move(e));
+		}
+		return out;
+	}
+
+	//! @brief ȃV[(TestScene.json̑)
+	json MakeSyntheticScene()
+	{
+		json jScene;
+		jScene["sceneId"] = "synthetic";
+		jScene["sceneName"] = "synthetic";
+		jScene["entities"] = json::array();
+		for (int i = 0; i < 4; ++i) {
+			json e;
+			e["id"] = i;
+			e["components"]["ecs::Name"]["value"] = "Entity" + std::to_string(i);
+			e["components"]["ecs::Transform"]["position"] = { {"x", i * 1.5f}, {"y", 2.0f}, {"z", -1.0f} };
+			if (i % 2 == 0) {
+				e["components"]["ecs::LightCommon"] = { {"color", {{"x", 0.0f}, {"y", 0.5f}, {"z", 1.0f}}}, {"intensity", 100.0f}, {"enabled", i == 0} };
+				e["components"]["ecs::SpotLight"] = { {"range", 20.0f + i}, {"innerCos", 1.0f}, {"outerCos", 0.8f} };
+			}
+			jScene["entities"].push_back(std::move(e));
+		}
+		return jScene;
+	}
+
+	json GetReferenceScene()
+	{
+		const std::string text = ReadTestScene();
+		return text.empty() ? MakeSyntheticScene() : json::parse(text);
+	}
+}
+
+TEST_CASE(SceneBinary, RawBlockNeedsEveryByteReflected)
+{
+	// SoCgtNVtB[hŖ܂Ă^̂܂܃Rs[
+	CHECK(ecs_serial::is_raw_block_v<Transform>);
+	CHECK(ecs_serial::is_raw_block_v<SpotLight>);
+	CHECK(ecs_serial::is_raw_block_v<OrderA>);
+	CHECK(!ecs_serial::is_raw_block_v<Cached>);			// tNVĂȂo
+	CHECK(!ecs_serial::is_raw_block_v<LightCommon>);	// pfBO
+	CHECK(!ecs_serial::is_raw_block_v<Name>);			// trivially copyableł͂Ȃ
+	CHECK(ecs_serial::reflected_field_size_v<Cached> == sizeof(float));
+}
+
+TEST_CASE(SceneBinary, LayoutHashSeesDeclarationOrder)
+{
+	// OtB[hŁA錾̏ԂႦ΃nbVႤ(ÂNbN̂܂܃Rs[Ȃ)
+	CHECK(ecs_serial::ComputeLayoutHash<OrderA>() != ecs_serial::ComputeLayoutHash<OrderB>());
+	CHECK(ecs_serial::ComputeLayoutHash<OrderA>() == ecs_serial::ComputeLayoutHash<OrderA>());
+	CHECK(ecs_serial::ComputeLayoutHash<Transform>() != ecs_serial::ComputeLayoutHash<SpotLight>());
+}
+
+TEST_CASE(SceneBinary, ValidateRejectsWrongBlockSize)
+{
+	const json jScene = MakeSyntheticScene();
+	auto blocks = CookScene(jScene);
+	for (const auto& block : blocks) {
+		const uint32_t count = static_cast<uint32_t>(block.entities.size());
+		BinaryReader exact(block.data.data(), block.data.size());
+		CHECK(block.kind->validateBlock(count, exact));
+
+		// ]肪
+		std::vector<uint8_t> longer = block.data;
+		longer.resize(longer.size() + 4, 0);
+		BinaryReader tooLong(longer.data(), longer.size());
+		CHECK(!block.kind->validateBlock(count, tooLong));
+
+		// Ȃ(͈͊OǂƂėO)
+		bool threw = false;
+		try {
+			BinaryReader tooShort(block.data.data(), block.data.size() - 1);
+			block.kind->validateBlock(count, tooShort);
+		}
+		catch (const std::runtime_error&) {
+			threw = true;
+		}
+		CHECK(threw);
+	}
+
+	// łȂΉǉȂ
+	blocks.back().data.pop_back();
+	SceneStore store;
+	bool loaded = true;
+	try {
+		loaded = LoadCooked(blocks, 4, store);
+	}
+	catch (const std::runtime_error&) {
+		loaded = false;
+	}
+	CHECK(!loaded);
+	CHECK(CountComponents<Transform>(store, 4) == 0);
+	CHECK(CountComponents<Name>(store, 4) == 0);
+}
+
+TEST_CASE(SceneBinary, CookedLoadMatchesJsonLoad)
+{
+	const json jScene = GetReferenceScene();
+	const uint32_t count = static_cast<uint32_t>(jScene.at("entities").size());
+
+	SceneStore fromJson;
+	LoadJson(jScene.dump(), fromJson);
+	SceneStore fromCooked;
+	CHECK(LoadCooked(CookScene(jScene), count, fromCooked));
+
+	CHECK(CountComponents<Transform>(fromJson, count) == CountComponents<Transform>(fromCooked, count));
+	CHECK(CountComponents<Name>(fromJson, count) == CountComponents<Name>(fromCooked, count));
+	CHECK(CountComponents<LightCommon>(fromJson, count) == CountComponents<LightCommon>(fromCooked, count));
+	CHECK(CountComponents<SpotLight>(fromJson, count) == CountComponents<SpotLight>(fromCooked, count));
+	for (uint32_t i = 0; i < count; ++i) {
+		const auto e = MakeEntity(i);
+		CHECK(fromJson.Array<Name>().Get(e).value == fromCooked.Array<Name>().Get(e).value);
+		const auto& a = fromJson.Array<Transform>().Get(e);
+		const auto& b = fromCooked.Array<Transform>().Get(e);
+		CHECK(a.position.x == b.position.x && a.position.y == b.position.y && a.position.z == b.position.z);
+		CHECK(a.rotationQuat.w == b.rotationQuat.w && a.scale.y == b.scale.y);
+		if (fromJson.Array<LightCommon>().Has(e)) {
+			const auto& la = fromJson.Array<LightCommon>().Get(e);
+			const auto& lb = fromCooked.Array<LightCommon>().Get(e);
+			CHECK(la.enabled == lb.enabled && la.intensity == lb.intensity && la.color.z == lb.color.z);
+			CHECK(fromJson.Array<SpotLight>().Get(e).outerCos == fromCooked.Array<SpotLight>().Get(e).outerCos);
+		}
+	}
+}
+
+BENCH_CASE(SceneBinary, JsonVsCookedLoad)
+{
+	// TestScene.json(̂܂ / EntityJԂ100kɂ)̓ǂݍݎ
+	// JSON: p[X + Deserialize + 1EntityR}hɐςŔf
+	// NbNς: SubN̊mF + ubNƂɂ܂Ƃ߂Ēǉ(t@C̓ǂݍ݂͂ǂ܂܂Ȃ)
+	const json jTestScene = GetReferenceScene();
+	const uint32_t testSceneCount = static_cast<uint32_t>(jTestScene.at("entities").size());
+	std::printf("    %s\n", ReadTestScene().empty() ? "(TestScene.json not found: synthetic scene)" : "TestScene.json");
+
+	for (uint32_t count : { testSceneCount, 100000u }) {
+		const json jScene = (count == testSceneCount) ? jTestScene : RepeatScene(jTestScene, count);
+		const std::string text = jScene.dump();
+		const auto blocks = CookScene(jScene);
+		std::size_t cookedBytes = 0;
+		for (const auto& block : blocks) {
+			cookedBytes += block.data.size() + block.entities.size() * sizeof(uint32_t);
+		}
+
+		const int repeat = (count < 1000) ? 200 : 3;
+		double jsonMs = 0.0;
+		double cookedMs = 0.0;
+		for (int n = 0; n < repeat; ++n) {
+			SceneStore fromJson;
+			jsonMs += test::MeasureMs(1, [&]() { LoadJson(text, fromJson); });
+			test::DoNotOptimize(fromJson.Array<Transform>().Get(MakeEntity(count - 1)));
+
+			SceneStore fromCooked;
+			cookedMs += test::MeasureMs(1, [&]() { LoadCooked(blocks, count, fromCooked); });
+			test::DoNotOptimize(fromCooked.Array<Transform>().Get(MakeEntity(count - 1)));
+		}
+		jsonMs /= repeat;
+		cookedMs /= repeat;
+
+		std::printf("    %6u entities | json %8zu bytes %9.3f ms | cooked %8zu bytes %9.3f ms | x%.1f\n",
+			count, text.size(), jsonMs, cookedBytes, cookedMs, jsonMs / cookedMs);
+	}
+}
@@ -0,0 +1,351 @@
+/**
+ * @file ShadowTesterTests.cpp
+ * @brief SoftwareShadowTester(CPỦe)̃eXg
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <algorithm>
+#include <vector>
+#include <DX3D/Core/JobSystem.h>
+#include <Game/Shadows/SoftwareShadowTester.h>
+#include "TestFramework.h"
+
+using dx3d::shadow::ShadowCaster;
+using dx3d::shadow::ShadowLightParams;
+using dx3d::shadow::ShadowTestFlag;
+using dx3d::shadow::SoftwareShadowTester;
+
+namespace {
+	constexpr float PI = 3.14159265f;
+
+	// ---------- sD̍s(XMMATRIXƓсAsxNg x s) ---------- //
+	struct Matrix {
+		float m[16]{};
+	};
+
+	Matrix Multiply(const Matrix& _a, const Matrix& _b)
+	{
+		Matrix out{};
+		for (int r = 0; r < 4; ++r) {
+			for (int c = 0; c < 4; ++c) {
+				for (int k = 0; k < 4; ++k) { out.m[r * 4 + c] += _a.m[r * 4 + k] * _b.m[k * 4 + c]; }
+			}
+		}
+		return out;
+	}
+
+	void Normalize(float* _v)
+	{
+		const float len = std::sqrt(_v[0] * _v[0] + _v[1] * _v[1] + _v[2] * _v[2]);
+		for (int i = 0; i < 3; ++i) { _v[i] /= len; }
+	}
+
+	void Cross(const float* _a, const float* _b, float* _out)
+	{
+		_out[0] = _a[1] * _b[2] - _a[2] * _b[1];
+		_out[1] = _a[2] * _b[0] - _a[0] * _b[2];
+		_out[2] = _a[0] * _b[1] - _a[1] * _b[0];
+	}
+
+	//! @brief XMMatrixLookAtLHƓ
+	Matrix LookAtLH(const float* _eye, const float* _at, const float* _up)
+	{
+		float z[3] = { _at[0] - _eye[0], _at[1] - _eye[1], _at[2] - _eye[2] };
+		Normalize(z);
+		float x[3];
+		Cross(_up, z, x);
+		Normalize(x);
+		float y[3];
+		Cross(z, x, y);
+
+		Matrix out{};
+		for (int r = 0; r < 3; ++r) {
+			out.m[r * 4 + 0] = x[r];
+			out.m[r * 4 + 1] = y[r];
+			out.m[r * 4 + 2] = z[r];
+		}
+		out.m[12] = -(x[0] * _eye[0] + x[1] * _eye[1] + x[2] * _eye[2]);
+		out.m[13] = -(y[0] * _eye[0] + y[1] * _eye[1] + y[2] * _eye[2]);
+		out.m[14] = -(z[0] * _eye[0] + z[1] * _eye[1] + z[2] * _eye[2]);
+		out.m[15] = 1.0f;
+		return out;
+	}
+
+	//! @brief XMMatrixPerspectiveFovLHƓ
+	Matrix PerspectiveFovLH(float _fovY, float _aspect, float _near, float _far)
+	{
+		const float yScale = 1.0f / std::tan(_fovY * 0.5f);
+		const float range = _far / (_far - _near);
+		Matrix out{};
+		out.m[0] = yScale / _aspect;
+		out.m[5] = yScale;
+		out.m[10] = range;
+		out.m[11] = 1.0f;
+		out.m[14] = -range * _near;
+		return out;
+	}
+
+	//! @brief XMMatrixOrthographicLHƓ
+	Matrix OrthographicLH(float _width, float _height, float _near, float _far)
+	{
+		Matrix out{};
+		out.m[0] = 2.0f / _width;
+		out.m[5] = 2.0f / _height;
+		out.m[10] = 1.0f / (_far - _near);
+		out.m[14] = -_near / (_far - _near);
+		out.m[15] = 1.0f;
+		return out;
+	}
+
+	/**
+	 * @brief X|bgCg(LightDepthRenderSystemƓA~̊O̊pxFOVɂ)
+	 */
+	ShadowLightParams MakeSpotLight(const float* _pos, const float* _at, float _outerDeg, float _range)
+	{
+		float dir[3] = { _at[0] - _pos[0], _at[1] - _pos[1], _at[2] - _pos[2] };
+		Normalize(dir);
+		// ^ / ^YɂłȂ
+		const bool vertical = std::fabs(dir[1]) > 0.99f;
+		const float up[3] = { 0.0f, vertical ? 0.0f : 1.0f, vertical ? 1.0f : 0.0f };
+		const Matrix viewProj = Multiply(LookAtLH(_pos, _at, up),
+			PerspectiveFovLH(_outerDeg * 2.0f * PI / 180.0f, 1.0f, 0.5f, _range));
+
+		ShadowLightParams light{};
+		for (int i = 0; i < 16; ++i) { light.lightViewProj[i] = viewProj.m[i]; }
+		for (int i = 0; i < 3; ++i) {
+			light.lightPos[i] = _pos[i];
+			light.lightDir[i] = dir[i];
+		}
+		light.cosOuterAngle = std::cos(_outerDeg * 0.9f * PI / 180.0f);
+		light.cosInnerAngle = std::cos(_outerDeg * 0.7f * PI / 180.0f);
+		light.lightRange = _range;
+		return light;
+	}
+
+	//! @brief ォ猩낷s(~ / ̔͂Ȃ)
+	ShadowLightParams MakeDirectionalLight(float _extent)
+	{
+		const float pos[3] = { 3.0f, 60.0f, -4.0f };
+		const float at[3] = { 0.0f, 0.0f, 0.0f };
+		const float up[3] = { 0.0f, 0.0f, 1.0f };
+		const Matrix viewProj = Multiply(LookAtLH(pos, at, up), OrthographicLH(_extent * 2.0f, _extent * 2.0f, 1.0f, 120.0f));
+
+		ShadowLightParams light{};
+		for (int i = 0; i < 16; ++i) { light.lightViewProj[i] = viewProj.m[i]; }
+		for (int i = 0; i < 3; ++i) { light.lightPos[i] = pos[i]; }
+		return light;
+	}
+
+	/**
+	 * @brief ̌`(\ǂ̊ł`悤ɗʂ)
+	 */
+	struct BoxMesh {
+		std::vector<float> positions{};
+		std::vector<uint32_t> indices{};
+	};
+
+	const BoxMesh& GetUnitBox()
+	{
+		static const BoxMesh mesh = []() {
+			BoxMesh box{};
+			for (int i = 0; i < 8; ++i) {
+				box.positions.push_back((i & 1) ? 0.5f : -0.5f);
+				box.positions.push_back((i & 2) ? 0.5f : -0.5f);
+				box.positions.push_back((i & 4) ? 0.5f : -0.5f);
+			}
+			const uint32_t quads[6][4] = {
+				{ 0, 1, 3, 2 }, { 4, 6, 7, 5 }, { 0, 4, 5, 1 },
+				{ 2, 3, 7, 6 }, { 0, 2, 6, 4 }, { 1, 5, 7, 3 },
+			};
+			for (const auto& q : quads) {
+				const uint32_t tris[2][3] = { { q[0], q[1], q[2] }, { q[0], q[2], q[3] } };
+				for (const auto& t : tris) {
+					box.indices.insert(box.indices.end(), { t[0], t[1], t[2] });
+					box.indices.insert(box.indices.end(), { t[0], t[2], t[1] });
+				}
+			}
+			return box;
+		}();
+		return mesh;
+	}
+
+	//! @brief g + ](Y) + ړ̃[hs
+	Matrix MakeWorld(const float* _scale, float _yaw, const float* _pos)
+	{
+		const float c = std::cos(_yaw), s = std::sin(_yaw);
+		Matrix out{};
+		out.m[0] = c * _scale[0];	out.m[2] = -s * _scale[0];
+		out.m[5] = _scale[1];
+		out.m[8] = s * _scale[2];	out.m[10] = c * _scale[2];
+		out.m[12] = _pos[0];		out.m[13] = _pos[1];		out.m[14] = _pos[2];
+		out.m[15] = 1.0f;
+		return out;
+	}
+
+	/**
+	 * @brief QƃV[: ̏ɔ΂܂AƔ̂܂ɓ_u
+	 */
+	struct ReferenceScene {
+		std::vector<Matrix> worlds{};
+		std::vector<ShadowCaster> casters{};
+		std::vector<ShadowLightParams> lights{};
+		std::vector<float> points{};
+	};
+
+	ReferenceScene MakeScene(uint32_t _seed, uint32_t _boxCount, uint32_t _pointCount)
+	{
+		std::mt19937 rng(_seed);
+		std::uniform_real_distribution<float> pos(-20.0f, 20.0f);
+		std::uniform_real_distribution<float> size(0.5f, 3.0f);
+		std::uniform_real_distribution<float> angle(0.0f, 2.0f * PI);
+		std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+
+		ReferenceScene scene{};
+		// (e󂯂邾łȂƂɂ)
+		const float floorScale[3] = { 50.0f, 0.2f, 50.0f };
+		const float floorPos[3] = { 0.0f, -0.1f, 0.0f };
+		scene.worlds.push_back(MakeWorld(floorScale, 0.0f, floorPos));
+		for (uint32_t i = 0; i < _boxCount; ++i) {
+			const float s[3] = { size(rng), size(rng), size(rng) };
+			const float p[3] = { pos(rng), s[1] * 0.5f + u01(rng) * 4.0f, pos(rng) };
+			scene.worlds.push_back(MakeWorld(s, angle(rng), p));
+		}
+		const auto& box = GetUnitBox();
+		for (const auto& world : scene.worlds) {
+			scene.casters.push_back(ShadowCaster{
+				world.m, box.positions.data(), static_cast<uint32_t>(box.positions.size() / 3),
+				box.indices.data(), static_cast<uint32_t>(box.indices.size()) });
+		}
+
+		const float spotPos[3][3] = { { 0.0f, 18.0f, 0.0f }, { -15.0f, 10.0f, 12.0f }, { 14.0f, 6.0f, -9.0f } };
+		const float spotAt[3][3] = { { 0.5f, 0.0f, 0.2f }, { 0.0f, 0.0f, 0.0f }, { 5.0f, 0.0f, 2.0f } };
+		for (int i = 0; i < 3; ++i) {
+			scene.lights.push_back(MakeSpotLight(spotPos[i], spotAt[i], 40.0f, 40.0f));
+		}
+		scene.lights.push_back(MakeDirectionalLight(30.0f));
+
+		// ̏ƁA̍̋
+		for (uint32_t i = 0; i < _pointCount; ++i) {
+			scene.points.push_back(pos(rng) * 1.2f);
+			scene.points.push_back((i % 3 == 0) ? u01(rng) * 6.0f : 0.05f);
+			scene.points.push_back(pos(rng) * 1.2f);
+		}
+		return scene;
+	}
+
+	uint32_t CountFlag(const std::vector<ShadowTestFlag>& _flags, ShadowTestFlag _flag)
+	{
+		uint32_t count = 0;
+		for (auto f : _flags) { count += (f == _flag) ? 1u : 0u; }
+		return count;
+	}
+}
+
+TEST_CASE(ShadowTester, KnownClassifications)
+{
+	// ^Ƃ炷X|bgCgƁẢɕ
+	const float lightPos[3] = { 0.0f, 10.0f, 0.0f };
+	const float lightAt[3] = { 0.0f, 0.0f, 0.0f };
+	std::vector<ShadowLightParams> lights = { MakeSpotLight(lightPos, lightAt, 45.0f, 30.0f) };
+
+	const float scale[3] = { 2.0f, 1.0f, 2.0f };
+	const float boxPos[3] = { 0.0f, 3.5f, 0.0f };
+	const Matrix world = MakeWorld(scale, 0.0f, boxPos);
+	const auto& box = GetUnitBox();
+	std::vector<ShadowCaster> casters = { ShadowCaster{
+		world.m, box.positions.data(), static_cast<uint32_t>(box.positions.size() / 3),
+		box.indices.data(), static_cast<uint32_t>(box.indices.size()) } };
+
+	const float points[] = {
+		0.0f, 0.0f, 0.0f,		// ̐^
+		3.0f, 0.0f, 0.0f,		// e̊O(e͏ x = }1.67 ܂)
+		6.5f, 0.0f, 6.5f,		// ~(40.5x)̊OAUV̓
+		0.0f, 5.0f, 0.0f,		// 
+	};
+	SoftwareShadowTester tester;
+	std::vector<ShadowTestFlag> flags;
+	tester.Execute(lights, casters, points, 4, nullptr, flags);
+	CHECK(flags.size() == 4);
+	CHECK(flags[0] == ShadowTestFlag::Shadow);
+	CHECK(flags[1] == ShadowTestFlag::Lit);
+	CHECK(flags[2] == ShadowTestFlag::OutSideCone);
+	CHECK(flags[3] == ShadowTestFlag::Lit);
+}
+
+TEST_CASE(ShadowTester, ParallelMatchesSerialOnReferenceScenes)
+{
+	// ( / _)ł1rbgȂBxsĂ
+	dx3d::JobSystem jobSystem(3);
+	const uint32_t seeds[] = { 1u, 2u, 3u };
+	for (uint32_t seed : seeds) {
+		const auto scene = MakeScene(seed, 120, 20000);
+		const uint32_t pointCount = static_cast<uint32_t>(scene.points.size() / 3);
+
+		SoftwareShadowTester serialTester;
+		std::vector<ShadowTestFlag> serial;
+		serialTester.Execute(scene.lights, scene.casters, scene.points.data(), pointCount, nullptr, serial);
+
+		SoftwareShadowTester parallelTester;
+		std::vector<ShadowTestFlag> parallel;
+		for (int run = 0; run < 3; ++run) {
+			parallelTester.Execute(scene.lights, scene.casters, scene.points.data(), pointCount, &jobSystem, parallel);
+			CHECK(parallel == serial);
+		}
+		CHECK(parallelTester.GetLastRasterizedTexels() == serialTester.GetLastRasterizedTexels());
+
+		// QƃV[ƂĈӖ邩(e͈͊OoĂ)
+		CHECK(serial.size() == static_cast<std::size_t>(pointCount) * scene.lights.size());
+		CHECK(CountFlag(serial, ShadowTestFlag::Shadow) > pointCount / 50);
+		CHECK(CountFlag(serial, ShadowTestFlag::Lit) > pointCount / 50);
+		CHECK(CountFlag(serial, ShadowTestFlag::OutSideCone) + CountFlag(serial, ShadowTestFlag::OutUV) > 0);
+	}
+}
+
+TEST_CASE(ShadowTester, ReusedTesterMatchesFreshTester)
+{
+	// Ɨpobt@g񂵂ĂAÕV[̐[xcȂ
+	const auto big = MakeScene(11, 200, 5000);
+	const auto small = MakeScene(12, 10, 5000);
+	const uint32_t bigCount = static_cast<uint32_t>(big.points.size() / 3);
+	const uint32_t smallCount = static_cast<uint32_t>(small.points.size() / 3);
+
+	SoftwareShadowTester reused;
+	std::vector<ShadowTestFlag> flags;
+	reused.Execute(big.lights, big.casters, big.points.data(), bigCount, nullptr, flags);
+	reused.Execute(small.lights, small.casters, small.points.data(), smallCount, nullptr, flags);
+
+	SoftwareShadowTester fresh;
+	std::vector<ShadowTestFlag> expected;
+	fresh.Execute(small.lights, small.casters, small.points.data(), smallCount, nullptr, expected);
+	CHECK(flags == expected);
+}
+
+BENCH_CASE(ShadowTester, SerialVsParallel)
+{
+	// QƃV[(4Cg)𒼗JobSystemŔ肷(1񂠂)
+	const uint32_t workers = (std::max)(1u, std::thread::hardware_concurrency()) - 1;
+	dx3d::JobSystem jobSystem(workers);
+	for (uint32_t boxes : { 50u, 200u, 800u }) {
+		const auto scene = MakeScene(5, boxes, 20000);
+		const uint32_t pointCount = static_cast<uint32_t>(scene.points.size() / 3);
+
+		SoftwareShadowTester tester;
+		std::vector<ShadowTestFlag> flags;
+		const double serialMs = test::MeasureMs(3, [&]() {
+			tester.Execute(scene.lights, scene.casters, scene.points.data(), pointCount, nullptr, flags);
+		});
+		const double parallelMs = test::MeasureMs(3, [&]() {
+			tester.Execute(scene.lights, scene.casters, scene.points.data(), pointCount, &jobSystem, flags);
+		});
+		std::printf("    %4u casters, %u points x %zu lights | serial %8.3f ms | %u workers %8.3f ms | %llu texels\n",
+			boxes + 1, pointCount, scene.lights.size(), serialMs, workers, parallelMs,
+			static_cast<unsigned long long>(tester.GetLastRasterizedTexels()));
+	}
+}
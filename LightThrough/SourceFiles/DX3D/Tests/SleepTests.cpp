@@ -0,0 +1,291 @@
+/**
+ * @file SleepTests.cpp
+ * @brief ~܂̂𓇂Ɩ点鏈(CollisionResolveSystem::UpdateSleep)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <DX3D/Core/Logger.h>
+#include <DX3D/Core/JobSystem.h>
+#include <DX3D/Game/GameSystems.h>
+#include <DX3D/Graphics/NullGraphicsBackend.h>
+#include <DX3D/Graphics/Meshes/MeshRegistry.h>
+#include <Game/ECS/Coordinator.h>
+#include <Game/Scene/SceneManager.h>
+#include <Game/Systems/TransformSystem.h>
+#include <Game/Systems/Collisions/ColliderSyncSystem.h>
+#include <Game/Systems/Collisions/CollisionResolveSystem.h>
+#include <Game/Systems/Physics/ForceAccumulationSystem.h>
+#include <Game/Systems/Physics/IntegrationSystem.h>
+#include <Game/Systems/Physics/ClearForcesSystem.h>
+#include <Game/Systems/Gimmicks/ShadowCasterSystem.h>
+#include <Game/Systems/Gimmicks/ShadowTestSystem.h>
+#include <Game/Components/Core/Transform.h>
+#include <Game/Components/Physics/Collider.h>
+#include <Game/Components/Physics/Rigidbody.h>
+#include "TestFramework.h"
+
+using ecs::Entity;
+using ecs::Transform;
+using ecs::Collider;
+using ecs::Rigidbody;
+
+namespace {
+	constexpr float DT = 1.0f / 60.0f;
+
+	/**
+	 * @brief Systemo^[h(GameSystems.cppƓBeł̂蔲͐؂)
+	 *	(ÓIȔ)̏ɁA1̔cɐς񂾗ׂ
+	 */
+	struct PhysicsWorld {
+		dx3d::Logger logger{ dx3d::Logger::LogLevel::Error };
+		dx3d::NullGraphicsBackend backend{};
+		dx3d::MeshRegistry meshes{};
+		dx3d::JobSystem jobs{};
+		ecs::Coordinator ecs{ dx3d::BaseDesc{ logger } };
+		std::unique_ptr<scene::SceneManager> scenes{};
+		Entity floor{};
+		std::vector<Entity> boxes{};
+
+		PhysicsWorld()
+		{
+			ecs.Init();
+			ecs.SetJobSystem(&jobs);
+			scenes = std::make_unique<scene::SceneManager>(scene::SceneManagerDesc{ { logger }, ecs });
+			dx3d::RegisterGameComponents(ecs);
+
+			ecs::SystemDesc desc{ { logger }, ecs, *scenes, backend, meshes, jobs };
+			desc.shadowTestBackend = dx3d::ShadowTestBackend::Cpu;
+			ecs.RegisterSystem<ecs::ForceAccumulationSystem>(desc);
+			ecs.RegisterSystem<ecs::IntegrationSystem>(desc);
+			ecs.RegisterSystem<ecs::ColliderSyncSystem>(desc);
+			ecs.RegisterSystem<ecs::ShadowCasterSystem>(desc);
+			ecs.RegisterSystem<ecs::ShadowTestSystem>(desc);
+			ecs.RegisterSystem<ecs::CollisionResolveSystem>(desc);
+			ecs.RegisterSystem<ecs::ClearForcesSystem>(desc);
+			ecs.RegisterSystem<ecs::TransformSystem>(desc);
+			ecs.InitAllSystems();
+
+			// ̂őSe̒ɂȂBeł̂蔲͌Ȃ
+			Resolve().SetShadowCollisionEnabled(false);
+		}
+
+		/**
+		 * @brief (ʂ y = 0 ̐ÓIȔ)
+		 * @param _extent ̈
+		 */
+		void AddFloor(float _extent)
+		{
+			floor = ecs.CreateEntity();
+			Transform tf{};
+			tf.position = { 0.0f, -0.5f, 0.0f };
+			tf.scale = { _extent, 1.0f, _extent };
+			ecs.AddComponent(floor, tf);
+			Collider col{};
+			col.isStatic = true;
+			ecs.AddComponent(floor, col);
+		}
+
+		//! @brief 1̔
+		Entity AddBox(float _x, float _y, float _z, const Rigidbody& _rb)
+		{
+			const Entity e = ecs.CreateEntity();
+			Transform tf{};
+			tf.position = { _x, _y, _z };
+			ecs.AddComponent(e, tf);
+			ecs.AddComponent(e, Collider{});
+			ecs.AddComponent(e, _rb);
+			boxes.push_back(e);
+			return e;
+		}
+
+		/**
+		 * @brief Ɛς񂾔̗
+		 * @param _columns ̐(`ɕׂ)
+		 * @param _height ̒i
+		 */
+		void BuildStacks(uint32_t _columns, uint32_t _height)
+		{
+			const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(_columns))));
+			const float spacing = 2.0f;	// 񓯎m͐GȂ(񂲂Ƃɕʂ̓)
+			AddFloor(side * spacing + 4.0f);
+
+			Rigidbody rb{};
+			rb.friction = 0.5f;
+			for (uint32_t c = 0; c < _columns; ++c) {
+				const float x = (static_cast<float>(c % side) - 0.5f * side) * spacing;
+				const float z = (static_cast<float>(c / side) - 0.5f * side) * spacing;
+				for (uint32_t k = 0; k < _height; ++k) {
+					AddBox(x, 0.5f + static_cast<float>(k), z, rb);
+				}
+			}
+			ecs.FlushPending();
+		}
+
+		//! @brief 1t[(ŒXV1 + XV1)
+		void Step()
+		{
+			ecs.FixedUpdateAllSystems(DT);
+			ecs.UpdateAllSystems(DT);
+			ecs.FlushPending();
+		}
+
+		ecs::ColliderSyncSystem& ColliderSync() { return *ecs.GetSystem<ecs::ColliderSyncSystem>(); }
+		ecs::CollisionResolveSystem& Resolve() { return *ecs.GetSystem<ecs::CollisionResolveSystem>(); }
+
+		//! @brief ς񂾈ʒuǂꂾꂽ(ԑ傫l)
+		float MaxDrift(uint32_t _height)
+		{
+			float drift = 0.0f;
+			for (size_t i = 0; i < boxes.size(); ++i) {
+				const auto& p = ecs.GetComponent<Transform>(boxes[i])->position;
+				const float expectedY = 0.5f + static_cast<float>(i % _height);
+				drift = (std::max)(drift, std::fabs(p.y - expectedY));
+			}
+			return drift;
+		}
+	};
+}
+
+TEST_CASE(Sleep, SettledStacksFallAsleepAndWakeByIsland)
+{
+	// 4i̗16{B~܂SA{̈ԏƂ̗()N
+	constexpr uint32_t COLUMNS = 16;
+	constexpr uint32_t HEIGHT = 4;
+	PhysicsWorld world;
+	world.BuildStacks(COLUMNS, HEIGHT);
+
+	for (int frame = 0; frame < 180; ++frame) {
+		world.Step();
+	}
+	auto& resolve = world.Resolve();
+	CHECK(resolve.GetActiveBodyCount() == 0);
+	CHECK(resolve.GetSleepingBodyCount() == COLUMNS * HEIGHT);
+	CHECK(world.MaxDrift(HEIGHT) < 0.05f);
+
+	// ĂԂ͐ϕ`̓Ȃ̂ŁAt[񂵂ĂȂ
+	const auto before = world.ecs.GetComponent<Transform>(world.boxes.back())->position;
+	for (int frame = 0; frame < 30; ++frame) {
+		world.Step();
+	}
+	const auto after = world.ecs.GetComponent<Transform>(world.boxes.back())->position;
+	CHECK(before.x == after.x && before.y == after.y && before.z == after.z);
+	CHECK(resolve.GetActiveBodyCount() == 0);
+
+	// Ō̗̈ԏɉ(x^ƈ̂NÃXebvœƋN)
+	world.ecs.GetComponent<Rigidbody>(world.boxes.back())->linearVelocity.x = 1.0f;
+	world.Step();
+	world.Step();
+	CHECK(resolve.GetActiveBodyCount() == HEIGHT);
+	CHECK(resolve.GetSleepingBodyCount() == (COLUMNS - 1) * HEIGHT);
+	for (size_t i = 0; i + HEIGHT < world.boxes.size(); ++i) {
+		CHECK(world.ecs.GetComponent<Rigidbody>(world.boxes[i])->isSleeping);
+	}
+
+	// ܂~܂Ζ
+	for (int frame = 0; frame < 240; ++frame) {
+		world.Step();
+	}
+	CHECK(resolve.GetActiveBodyCount() == 0);
+}
+
+TEST_CASE(Sleep, StaticRebuildWaitsForBoundedSteps)
+{
+	// Transform𖈃XebvĂ([hs񂪔fOFixedUpdate)A
+	// ܂Xebv҂ŐÓIBVHA͏𔲂Ȃ
+	constexpr uint32_t HEIGHT = 4;
+	PhysicsWorld world;
+	world.BuildStacks(4, HEIGHT);
+
+	for (uint32_t frame = 0; frame < ecs::ColliderSyncSystem::MAX_STATIC_DEFER_STEPS; ++frame) {
+		world.ecs.GetComponent<Transform>(world.floor)->dirty = true;
+		world.Step();
+		CHECK(world.ColliderSync().GetStaticBVH().GetItemCount() == 0);
+	}
+	for (int frame = 0; frame < 120; ++frame) {
+		world.ecs.GetComponent<Transform>(world.floor)->dirty = true;
+		world.Step();
+	}
+	CHECK(world.ColliderSync().GetStaticBVH().GetItemCount() == 1);
+	CHECK(world.MaxDrift(HEIGHT) < 0.1f);
+
+	// ~܂΁A点(蒼ŋNȂ)
+	for (int frame = 0; frame < 120; ++frame) {
+		world.Step();
+	}
+	CHECK(world.Resolve().GetActiveBodyCount() == 0);
+}
+
+TEST_CASE(Sleep, ColliderFollowsPushOut)
+{
+	// ɖ܂oACollider̃[h`󂪉oTransformƈvĂ
+	// (̃XebvColliderSyncSystem҂ɁAfobO\Ȃǂǒ`)
+	// ϕœȂ悤ɏd͂ȂB\o[̈ʒu␳(I)ƁAʒủo(Ll}eBbN)̗
+	PhysicsWorld world;
+	world.AddFloor(10.0f);
+	Rigidbody dynamicRb{};
+	dynamicRb.useGravity = false;
+	Rigidbody kinematicRb = dynamicRb;
+	kinematicRb.isKinematic = true;
+	world.AddBox(-2.0f, 0.3f, 0.0f, dynamicRb);
+	world.AddBox(2.0f, 0.3f, 0.0f, kinematicRb);
+	world.ecs.FlushPending();
+	world.Step();	// ŏ̃Xebv̓[hs񂪂܂(`͎̂̃Xebv)
+
+	float maxError = 0.0f;
+	for (int frame = 0; frame < 30; ++frame) {
+		world.Step();
+		for (const Entity e : world.boxes) {
+			const auto p = world.ecs.GetComponent<Transform>(e)->GetWorldPosition();
+			const auto col = world.ecs.GetComponent<Collider>(e);
+			const auto& c = col->worldOBB.center;
+			const float aabbY = 0.5f * (col->worldAABB.min[1] + col->worldAABB.max[1]);
+			maxError = (std::max)({ maxError, std::fabs(c.x - p.x), std::fabs(c.y - p.y), std::fabs(c.z - p.z), std::fabs(aabbY - p.y) });
+		}
+	}
+	CHECK(maxError < 1.0e-5f);
+	for (const Entity e : world.boxes) {
+		CHECK(world.ecs.GetComponent<Transform>(e)->position.y > 0.45f);
+	}
+}
+
+BENCH_CASE(Sleep, SettledStacks)
+{
+	// 10iׂ̗(1k / 4k)܂ŁB0.5bƂ1t[̎ԂƁANĂ / Ă鐔
+	// 点ȂƔׁÃt[̎Ԃǂꂾ邩
+	constexpr uint32_t HEIGHT = 10;
+	constexpr int FRAMES = 240;
+	constexpr int WINDOW = 30;
+	using clock = std::chrono::high_resolution_clock;
+
+	for (uint32_t boxes : { 1000u, 4000u }) {
+		for (bool sleep : { true, false }) {
+			PhysicsWorld world;
+			world.BuildStacks(boxes / HEIGHT, HEIGHT);
+			world.Resolve().SetSleepEnabled(sleep);
+			std::printf("    %u boxes, sleep %s\n", boxes, sleep ? "on" : "off");
+
+			double windowMs = 0.0;
+			for (int frame = 1; frame <= FRAMES; ++frame) {
+				const auto start = clock::now();
+				world.Step();
+				windowMs += std::chrono::duration<double, std::milli>(clock::now() - start).count();
+				if (frame % WINDOW != 0) { continue; }
+
+				const auto& resolve = world.Resolve();
+				std::printf("      %.1f s: %7.3f ms / frame, active %5u, sleeping %5u, contacts %6zu\n",
+					frame * DT, windowMs / WINDOW, resolve.GetActiveBodyCount(), resolve.GetSleepingBodyCount(), resolve.GetContacts().size());
+				windowMs = 0.0;
+			}
+			std::printf("      max drift %.4f\n", world.MaxDrift(HEIGHT));
+		}
+	}
+}
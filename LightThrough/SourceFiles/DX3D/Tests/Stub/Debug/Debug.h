@@ -0,0 +1,16 @@
+#pragma once
+/**
+ * @file Debug.h
+ * @brief eXgpDebug.h
+ * @author Arima Keita
+ * @date 2026-10-16
+ *
+ *	{Windows.hɈˑ̂ŁAeXgł̓Ostderrɏo̕ɍւ
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdio>
+
+#define DebugLogInfo(fmt, ...) ((void)0)
+#define DebugLogWarning(fmt, ...) ((void)0)
+#define DebugLogError(fmt, ...) (std::fprintf(stderr, "[Error] %s\n", fmt))
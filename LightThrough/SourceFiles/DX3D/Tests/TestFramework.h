@@ -0,0 +1,90 @@
+#pragma once
+/**
+ * @file TestFramework.h
+ * @brief P̃eXg / x`}[Np̏Ȏdg
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdio>
+#include <chrono>
+#include <vector>
+
+namespace test {
+	using TestFunc = void(*)();
+
+	/**
+	 * @brief o^ꂽeXg
+	 */
+	struct TestCase {
+		const char* suite = "";
+		const char* name = "";
+		TestFunc func = nullptr;
+		bool bench = false;	// true: x`}[N(--bench̎s)
+	};
+
+	std::vector<TestCase>& GetRegistry();
+	void ReportFailure(const char* _expr, const char* _file, int _line);
+
+	/**
+	 * @brief ÓIŃeXgo^
+	 */
+	struct Registrar {
+		Registrar(const char* _suite, const char* _name, TestFunc _func, bool _bench) {
+			GetRegistry().push_back(TestCase{ _suite, _name, _func, _bench });
+		}
+	};
+
+	/**
+	 * @brief _repeatJԂāA񂠂̃~bԂ
+	 */
+	template<typename Func>
+	double MeasureMs(int _repeat, Func&& _func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < _repeat; ++i) {
+			_func();
+		}
+		const auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(end - start).count() / _repeat;
+	}
+
+	inline const void* volatile g_sink = nullptr;	// DoNotOptimizȅݐ
+
+	//! @brief œKŌvZȂ悤ɂ
+	template<typename T>
+	void DoNotOptimize(const T& _value)
+	{
+		g_sink = &_value;
+	}
+}
+
+#define TEST_DETAIL_CONCAT2(a, b) a##b
+#define TEST_DETAIL_CONCAT(a, b) TEST_DETAIL_CONCAT2(a, b)
+
+#define TEST_DETAIL_CASE(suite, name, bench) \
+	static void TEST_DETAIL_CONCAT(suite##_##name, _Test)(); \
+	static const test::Registrar TEST_DETAIL_CONCAT(suite##_##name, _Registrar)( \
+		#suite, #name, &TEST_DETAIL_CONCAT(suite##_##name, _Test), bench); \
+	static void TEST_DETAIL_CONCAT(suite##_##name, _Test)()
+
+// eXg
+#define TEST_CASE(suite, name) TEST_DETAIL_CASE(suite, name, false)
+// x`}[N(ʂstdoutɏo)
+#define BENCH_CASE(suite, name) TEST_DETAIL_CASE(suite, name, true)
+
+// sĂ
+#define CHECK(expr) \
+	do { if (!(expr)) { test::ReportFailure(#expr, __FILE__, __LINE__); } } while (0)
+
+// e덷t̔r
+#define CHECK_NEAR(a, b, eps) \
+	do { \
+		const double test_detail_a = static_cast<double>(a); \
+		const double test_detail_b = static_cast<double>(b); \
+		if (!(test_detail_a - test_detail_b <= (eps) && test_detail_b - test_detail_a <= (eps))) { \
+			std::printf("    %s = %g, %s = %g\n", #a, test_detail_a, #b, test_detail_b); \
+			test::ReportFailure("|" #a " - " #b "| <= " #eps, __FILE__, __LINE__); \
+		} \
+	} while (0)
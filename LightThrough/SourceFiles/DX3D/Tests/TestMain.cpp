@@ -0,0 +1,81 @@
+/**
+ * @file TestMain.cpp
+ * @brief eXg̎s
+ * @author Arima Keita
+ * @date 2026-10-16
+ *
+ *	LightThroughTests <Suite> [--bench]
+ *	SuiteȗƑSB--benchtƃeXgł͂Ȃx`}[Ns
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include "TestFramework.h"
+
+namespace {
+	int g_failures = 0;	// s̃eXgŎsCHECK̐
+}
+
+namespace test {
+	//! @brief o^ꂽeXg̈ꗗ
+	std::vector<TestCase>& GetRegistry()
+	{
+		static std::vector<TestCase> registry{};
+		return registry;
+	}
+
+	/**
+	 * @brief CHECK̎sL^
+	 * @param _expr s
+	 * @param _file t@C
+	 * @param _line s
+	 */
+	void ReportFailure(const char* _expr, const char* _file, int _line)
+	{
+		++g_failures;
+		std::printf("    FAILED: %s (%s:%d)\n", _expr, _file, _line);
+	}
+}
+
+int main(int _argc, char** _argv)
+{
+	const char* suite = nullptr;
+	bool bench = false;
+	for (int i = 1; i < _argc; ++i) {
+		if (std::strcmp(_argv[i], "--bench") == 0) { bench = true; }
+		else { suite = _argv[i]; }
+	}
+
+	int run = 0;
+	int failed = 0;
+	for (const auto& tc : test::GetRegistry()) {
+		if (tc.bench != bench) { continue; }
+		if (suite && std::strcmp(tc.suite, suite) != 0) { continue; }
+
+		std::printf("[ RUN  ] %s.%s\n", tc.suite, tc.name);
+		std::fflush(stdout);
+		g_failures = 0;
+		try {
+			tc.func();
+		}
+		catch (const std::exception& e) {
+			test::ReportFailure(e.what(), tc.name, 0);
+		}
+		catch (...) {
+			test::ReportFailure("unknown exception", tc.name, 0);
+		}
+		++run;
+		if (g_failures != 0) { ++failed; }
+		std::printf("[ %s ] %s.%s\n", (g_failures == 0) ? " OK " : "FAIL", tc.suite, tc.name);
+	}
+
+	// sȂXC[g̊ԈႢȂ̂Ŏsɂ
+	if (run == 0) {
+		std::printf("no tests matched (suite: %s, bench: %d)\n", suite ? suite : "*", bench ? 1 : 0);
+		return 1;
+	}
+	std::printf("%d run, %d failed\n", run, failed);
+	return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,274 @@
+/**
+ * @file WorldSnapshotTests.cpp
+ * @brief Coordinator̃XibvVbg(CaptureSnapshot / RestoreSnapshot)̃eXgƃx`}[N
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <DX3D/Core/Logger.h>
+#include <DX3D/Core/JobSystem.h>
+#include <DX3D/Graphics/NullGraphicsBackend.h>
+#include <DX3D/Graphics/Meshes/MeshRegistry.h>
+#include <Game/ECS/Coordinator.h>
+#include <Game/ECS/ISystem.h>
+#include <Game/Scene/SceneManager.h>
+#include <Game/Components/Core/Name.h>
+#include <Game/Components/Core/Transform.h>
+#include <Game/Components/Physics/Rigidbody.h>
+#include "TestFramework.h"
+
+using ecs::Entity;
+using ecs::Name;
+using ecs::Transform;
+using ecs::Rigidbody;
+
+namespace {
+	/**
+	 * @brief eXgpSystem(<Transform>, <Rigidbody>EntityΏ)
+	 */
+	class MovingSystem final : public ecs::ISystem {
+	public:
+		explicit MovingSystem(const ecs::SystemDesc& _desc) : ISystem(_desc) {}
+
+		void Init() override
+		{
+			ecs::Signature signature = ecs_.MakeSignature<Transform, Rigidbody>();
+			ecs_.SetSystemSignature<MovingSystem>(signature);
+		}
+	};
+
+	/**
+	 * @brief CoordinatorƁASystem̐ɗv镨ꎮ
+	 *	Component̓o^MovingSystem̓o^܂ōς܂
+	 */
+	struct TestWorld {
+		dx3d::Logger logger{ dx3d::Logger::LogLevel::Error };
+		dx3d::NullGraphicsBackend backend{};
+		dx3d::MeshRegistry meshes{};
+		dx3d::JobSystem jobs{ 1 };
+		ecs::Coordinator ecs{ dx3d::BaseDesc{ logger } };
+		std::unique_ptr<scene::SceneManager> scenes{};
+		std::vector<Entity> destroyed{};	// j̒ʒm󂯂Entity
+
+		TestWorld()
+		{
+			ecs.Init();
+			scenes = std::make_unique<scene::SceneManager>(scene::SceneManagerDesc{ { logger }, ecs });
+			ecs.RegisterComponent<Transform>();
+			ecs.RegisterComponent<Rigidbody>();
+			ecs.RegisterComponent<Name>();
+			ecs.SetOnEntityDestroyedCallback([this](Entity _e) { destroyed.push_back(_e); });
+
+			ecs::SystemDesc desc{ { logger }, ecs, *scenes, backend, meshes, jobs };
+			ecs.RegisterSystem<MovingSystem>(desc);
+			ecs.InitAllSystems();
+		}
+
+		/**
+		 * @brief Entity
+		 * @param _x Transform̈ʒux / Rigidbody̑xx
+		 * @param _moving Rigidbodyt邩
+		 */
+		Entity Spawn(float _x, bool _moving)
+		{
+			const Entity e = ecs.CreateEntity();
+			Transform transform{};
+			transform.position = { _x, 0.0f, 0.0f };
+			ecs.AddComponent(e, transform);
+			if (_moving) {
+				Rigidbody rb{};
+				rb.linearVelocity = { _x, 0.0f, 0.0f };
+				ecs.AddComponent(e, rb);
+			}
+			ecs.AddComponent(e, Name{ "e" + std::to_string(e.Index()) });
+			return e;
+		}
+
+		const std::set<Entity>& SystemEntities() { return ecs.GetSystem<MovingSystem>()->entities_; }
+	};
+
+	//! @brief NG̒g(Entity̏)
+	std::vector<Entity> QueryEntities(const ecs::Query& _query)
+	{
+		return std::vector<Entity>(_query.begin(), _query.end());
+	}
+}
+
+TEST_CASE(WorldSnapshot, RestoresEntityVersions)
+{
+	TestWorld world;
+	std::vector<Entity> entities;
+	for (int i = 0; i < 8; ++i) {
+		entities.push_back(world.Spawn(static_cast<float>(i), true));
+	}
+	CHECK(world.ecs.CaptureSnapshot("start"));
+	CHECK(world.ecs.HasSnapshot("start"));
+
+	// jēIndexg(Versioni)
+	world.ecs.DestroyEntity(entities[2]);
+	world.ecs.DestroyEntity(entities[5]);
+	const Entity reused = world.ecs.CreateEntity();
+	CHECK(reused.Index() == entities[2].Index() || reused.Index() == entities[5].Index());
+	CHECK(!world.ecs.IsValidEntity(entities[2]));
+	CHECK(world.ecs.IsValidEntity(reused));
+	world.destroyed.clear();
+
+	CHECK(world.ecs.RestoreSnapshot("start"));
+
+	// ̃nh͑SLAۑɍnh͖
+	for (auto e : entities) {
+		CHECK(world.ecs.IsValidEntity(e));
+	}
+	CHECK(!world.ecs.IsValidEntity(reused));
+	CHECK(world.ecs.GetAllEntities().size() == entities.size());
+
+	// XibvVbgɖEntity͔jƂĒʒm(炠Entity͒ʒmȂ)
+	CHECK(world.destroyed.size() == 1);
+	CHECK(!world.destroyed.empty() && world.destroyed.front() == reused);
+
+	// ߂ɍEntitýA߂EntityƂ͏dȂȂ
+	const Entity again = world.ecs.CreateEntity();
+	CHECK(world.ecs.IsValidEntity(again));
+	CHECK(std::find(entities.begin(), entities.end(), again) == entities.end());
+
+	CHECK(!world.ecs.RestoreSnapshot("missing"));
+}
+
+TEST_CASE(WorldSnapshot, RestoresSignaturesAndValues)
+{
+	TestWorld world;
+	const Entity a = world.Spawn(1.0f, true);
+	const Entity b = world.Spawn(2.0f, false);
+	const Entity c = world.Spawn(3.0f, true);
+	CHECK(world.ecs.CaptureSnapshot("start"));
+
+	// l̏AComponent̒ǉ / 폜
+	world.ecs.GetComponent<Transform>(a)->position.x = 100.0f;
+	world.ecs.GetComponent<Name>(a)->value = "changed";
+	world.ecs.AddComponent(b, Rigidbody{});
+	world.ecs.RemoveComponent<Rigidbody>(c);
+	world.ecs.RemoveComponent<Name>(c);
+
+	CHECK(world.ecs.RestoreSnapshot("start"));
+
+	CHECK(world.ecs.HasComponent<Rigidbody>(a));
+	CHECK(!world.ecs.HasComponent<Rigidbody>(b));
+	CHECK(world.ecs.HasComponent<Rigidbody>(c));
+	CHECK(world.ecs.HasComponent<Name>(c));
+	CHECK_NEAR(world.ecs.GetComponent<Transform>(a)->position.x, 1.0f, 0.0f);
+	CHECK(world.ecs.GetComponent<Name>(a)->value == "e" + std::to_string(a.Index()));
+	CHECK_NEAR(world.ecs.GetComponent<Rigidbody>(c)->linearVelocity.x, 3.0f, 0.0f);
+
+	// Signature߂Ă̂ŁA߂̒ǉ / 폜
+	world.ecs.RemoveComponent<Rigidbody>(a);
+	CHECK(!world.ecs.HasComponent<Rigidbody>(a));
+	CHECK(world.ecs.HasComponent<Transform>(a));
+}
+
+TEST_CASE(WorldSnapshot, RebuildsQueriesAndSystems)
+{
+	TestWorld world;
+	const Entity a = world.Spawn(1.0f, true);
+	const Entity b = world.Spawn(2.0f, false);
+	const Entity c = world.Spawn(3.0f, true);
+	const auto& moving = world.ecs.GetQuery<Transform, Rigidbody>();
+	const auto& named = world.ecs.GetQuery<Name>();
+	const auto expectedMoving = QueryEntities(moving);
+	const auto expectedNamed = QueryEntities(named);
+	CHECK((expectedMoving == std::vector<Entity>{ a, c }));
+	CHECK(world.SystemEntities() == (std::set<Entity>{ a, c }));
+	CHECK(world.ecs.CaptureSnapshot("start"));
+
+	// NGSystem̏Ώۂ
+	world.ecs.RemoveComponent<Rigidbody>(a);
+	world.ecs.AddComponent(b, Rigidbody{});
+	world.ecs.DestroyEntity(c);
+	const Entity d = world.Spawn(4.0f, true);
+	CHECK(world.SystemEntities() == (std::set<Entity>{ b, d }));
+
+	CHECK(world.ecs.RestoreSnapshot("start"));
+
+	// QƂ͂̂܂܁Ag蒼Ă
+	CHECK(QueryEntities(moving) == expectedMoving);
+	CHECK(QueryEntities(named) == expectedNamed);
+	CHECK(world.SystemEntities() == (std::set<Entity>{ a, c }));
+	CHECK(QueryEntities(world.ecs.GetQuery<Transform, Rigidbody>()) == expectedMoving);
+
+	// ߂̕ύXNGɍŔf
+	world.ecs.RemoveComponent<Rigidbody>(c);
+	CHECK((QueryEntities(moving) == std::vector<Entity>{ a }));
+	CHECK(world.SystemEntities() == (std::set<Entity>{ a }));
+}
+
+TEST_CASE(WorldSnapshot, CallsRestoreHook)
+{
+	TestWorld world;
+	const Entity a = world.Spawn(1.0f, true);
+	const Entity b = world.Spawn(2.0f, false);
+	const Entity c = world.Spawn(3.0f, true);
+
+	// LbV̒l(dirty)߂ɗĒ
+	std::vector<Entity> hooked;
+	world.ecs.SetSnapshotRestoreHook<Transform>([&](Entity _e, Transform& _t) {
+		hooked.push_back(_e);
+		_t.dirty = true;
+	});
+	for (auto e : { a, b, c }) {
+		world.ecs.GetComponent<Transform>(e)->dirty = false;
+	}
+	CHECK(world.ecs.CaptureSnapshot("start"));
+	CHECK(hooked.empty());
+
+	world.ecs.DestroyEntity(b);
+	CHECK(world.ecs.RestoreSnapshot("start"));
+
+	// XibvVbgɂComponentƂ1񂸂A߂lɑ΂ČĂ΂
+	std::sort(hooked.begin(), hooked.end());
+	CHECK((hooked == std::vector<Entity>{ a, b, c }));
+	for (auto e : { a, b, c }) {
+		CHECK(world.ecs.GetComponent<Transform>(e)->dirty);
+	}
+
+	// XibvVbgɉxł߂
+	hooked.clear();
+	CHECK(world.ecs.RestoreSnapshot("start"));
+	CHECK(hooked.size() == 3);
+
+	const auto infos = world.ecs.GetSnapshotInfos();
+	CHECK(infos.size() == 1);
+	CHECK(!infos.empty() && infos.front().entityCount == 3);
+	CHECK(!infos.empty() && infos.front().componentCount == 3 + 2 + 3);
+	world.ecs.DeleteSnapshot("start");
+	CHECK(!world.ecs.HasSnapshot("start"));
+}
+
+BENCH_CASE(WorldSnapshot, CaptureRestore)
+{
+	// 1k / 10k / 100k Entity(<Rigidbody>t)̕ۑƕ
+	const int repeat = 10;
+	for (int count : { 1000, 10000, 100000 }) {
+		TestWorld world;
+		for (int i = 0; i < count; ++i) {
+			world.Spawn(static_cast<float>(i), (i & 1) == 0);
+		}
+
+		const double captureMs = test::MeasureMs(repeat, [&]() {
+			world.ecs.CaptureSnapshot("bench");
+		});
+		const double restoreMs = test::MeasureMs(repeat, [&]() {
+			world.ecs.RestoreSnapshot("bench");
+		});
+		test::DoNotOptimize(world.SystemEntities().size());
+
+		const auto infos = world.ecs.GetSnapshotInfos();
+		std::printf("    %6d entities: capture %8.3f ms / restore %8.3f ms / %zu KB\n",
+			count, captureMs, restoreMs, infos.empty() ? size_t{ 0 } : infos.front().byteSize / 1024);
+	}
+}
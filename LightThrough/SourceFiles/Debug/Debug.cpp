@@ -9,12 +9,12 @@
 #include <iostream>
 #include <chrono>
 #include <ctime>
-#include <sstream>
-#include <iomanip>
 #include <mutex>
 #include <fstream>
 #include <string>
 #include <filesystem>
+#include <algorithm>
+#include <memory>
 
 #include <Debug/Debug.h>
 
@@ -23,9 +23,29 @@ namespace debug {
 	// ÓIoϐ̒`
 	std::ofstream Debug::out_file_;
 	bool Debug::console_allocated_ = false;
+#ifdef _WIN32
 	HANDLE Debug::console_handle_ = nullptr;
 	WORD Debug::default_console_attr_ = 0;
+#endif
 	std::mutex Debug::mutex_;
+	std::mutex Debug::rings_mutex_;
+	std::vector<std::unique_ptr<Debug::LogRing>> Debug::rings_;
+	std::thread Debug::writer_thread_;
+	std::mutex Debug::writer_mutex_;
+	std::condition_variable Debug::writer_cv_;
+	bool Debug::writer_wake_ = false;
+	uint64_t Debug::reported_dropped_ = 0;
+	std::vector<Debug::PendingLine> Debug::pending_;
+
+	/**
+	 * @brief XbhƂ̃O
+	 *	ςނ͎̂̃XbhÂmutex_Xbh
+	 */
+	struct Debug::LogRing {
+		std::unique_ptr<LogRecord[]> records = std::make_unique<LogRecord[]>(RING_SIZE);
+		std::atomic<uint64_t> head{ 0 };	// ς񂾐(݌v)
+		std::atomic<uint64_t> tail{ 0 };	// (݌v)
+	};
 
 
 	/**
@@ -35,7 +55,8 @@ namespace debug {
 	void Debug::Init(bool _showConsole) {
 #if defined(DEBUG) || defined(_DEBUG)
 
-		// fobOR\[\
+		// fobOR\[\(WindowsȊO͕Wo͂̂܂܎g)
+#ifdef _WIN32
 		if (_showConsole && !console_allocated_)
 		{
 			AllocConsole();
@@ -54,6 +75,9 @@ namespace debug {
 				default_console_attr_ = info.wAttributes;
 			}
 		}
+#else
+		console_allocated_ = _showConsole;
+#endif
 
 		// OfBNg쐬
 		try {
@@ -67,7 +91,16 @@ namespace debug {
 		out_file_.open("DebugLog/DebugLog.txt", std::ios::out | std::ios::trunc);
 		if (!out_file_.is_open()) {
 			std::cout << "Failed to open DebugLog/DebugLog.txt\n";
+#ifdef _WIN32
 			OutputDebugStringA("Failed to open DebugLog/DebugLog.txt\n");
+#endif
+		}
+
+		// oXbh̊Jn
+		if (!writer_running_.load(std::memory_order_acquire)) {
+			writer_stop_.store(false, std::memory_order_release);
+			writer_thread_ = std::thread(&Debug::WriterLoop);
+			writer_running_.store(true, std::memory_order_release);
 		}
 
 #endif	// DEBUG || _DEBUG
@@ -81,13 +114,27 @@ namespace debug {
 	void Debug::Shutdown(bool waitKey) {
 #if defined(DEBUG) || defined(_DEBUG)
 
+		// oXbh̒~(ȍ~͌Ă񂾃Xbhŏo)
+		if (writer_running_.exchange(false, std::memory_order_acq_rel)) {
+			{
+				std::lock_guard lock(writer_mutex_);
+				writer_stop_.store(true, std::memory_order_release);
+			}
+			writer_cv_.notify_one();
+			writer_thread_.join();
+		}
+		Drain();
+
 		if (console_allocated_) {
 			if (waitKey) {
 				std::cout << "Press Enter Key to Exit...";
 				std::cin.get();	// L[͑҂
 			}
+#ifdef _WIN32
 			// KvɉăR\[
 			FreeConsole();
+#endif
+			console_allocated_ = false;
 		}
 
 		if (out_file_.is_open()) {
@@ -100,17 +147,29 @@ namespace debug {
 
 
 	/**
-	 * @brief ^CX^v擾
+	 * @brief ^CX^v𕶎
+	 *	o(mutex_̒)炾ĂԁBbς܂ł͑O̕g
+	 * @param _time 
 	 * @return 񉻂^CX^v
 	 */
-	std::string Debug::GetTimestamp() {
-		auto now = std::chrono::system_clock::now();	// ݎ擾
-		auto in_time_t = std::chrono::system_clock::to_time_t(now);	// Time_t^ɕϊ
-		std::tm timeInfo{};
-		localtime_s(&timeInfo, &in_time_t);	// XbhZ[tɂȂG[o
-		std::stringstream ss;
-		ss << std::put_time(&timeInfo, "%Y-%m-%d %X");	// ɕϊ
-		return ss.str();
+	std::string Debug::FormatTimestamp(std::chrono::system_clock::time_point _time) {
+		static std::time_t cachedTime = -1;
+		static std::string cached{};
+
+		const auto in_time_t = std::chrono::system_clock::to_time_t(_time);	// Time_t^ɕϊ
+		if (in_time_t != cachedTime) {
+			std::tm timeInfo{};
+#ifdef _WIN32
+			localtime_s(&timeInfo, &in_time_t);	// XbhZ[tɂȂG[o
+#else
+			localtime_r(&in_time_t, &timeInfo);
+#endif
+			char buf[64]{};
+			std::strftime(buf, sizeof(buf), "%Y-%m-%d %X", &timeInfo);	// ɕϊ
+			cached = buf;
+			cachedTime = in_time_t;
+		}
+		return cached;
 	}
 
 	/**
@@ -133,6 +192,7 @@ namespace debug {
 	 * @param _level Ox
 	 */
 	void Debug::SetConsoleColor(LogLevel _level) {
+#ifdef _WIN32
 		if (!console_handle_) {
 			return;
 		}
@@ -153,15 +213,20 @@ namespace debug {
 			}
 			break;
 		}
+#else
+		(void)_level;
+#endif
 	}
 
 	/**
 	 * @brief ̐Fɖ߂
 	 */
 	void Debug::ResetConsoleColor() {
+#ifdef _WIN32
 		if (console_handle_ && default_console_attr_) {
 			SetConsoleTextAttribute(console_handle_, default_console_attr_);
 		}
+#endif
 	}
 
 	/**
@@ -177,6 +242,11 @@ namespace debug {
 #endif
 	}
 
+	/**
+	 * @brief `ς݂̕ς
+	 * @param level Ox
+	 * @param message o͂镶
+	 */
 	void Debug::Write(LogLevel level, std::string_view message) {
 #if defined(DEBUG) || defined(_DEBUG)
 		// tB^
@@ -184,32 +254,186 @@ namespace debug {
 			return;
 		}
 
-		const std::string logMessage =
-			GetTimestamp() + " [" + std::string(LogLevelToString(level)) + "] " +
-			std::string(message);
+		LogRecord* record = AcquireRecord(level);
+		if (!record) { return; }
+		record->format = "{}";
+		new (record->args) std::string(message);
+		record->formatFunc = [](void* _args, const char*, std::string& _out) {
+			auto* str = static_cast<std::string*>(_args);
+			_out += *str;
+			std::destroy_at(str);
+			};
+		CommitRecord();
+#else
+		(void)level; (void)message;
+#endif
+	}
 
-		std::scoped_lock lk(mutex_);
+	/**
+	 * @brief ̃Xbh̃O
+	 *	߂ĎgXbhȂ烊Oēo^
+	 */
+	Debug::LogRing& Debug::GetThreadRing() {
+		thread_local LogRing* ring = nullptr;
+		if (ring) { return *ring; }
 
-		// R\[ɏo
-		if (console_allocated_) {
-			SetConsoleColor(level);
-			std::cout << logMessage << std::endl;
-			ResetConsoleColor();
+		auto newRing = std::make_unique<LogRing>();
+		ring = newRing.get();
+		std::lock_guard lock(rings_mutex_);
+		rings_.push_back(std::move(newRing));
+		return *ring;
+	}
+
+	/**
+	 * @brief ̃Xbh̃O1m
+	 *	ςȂAINFO / WARNINĜ͎ĂnullptrAERROR͋󂭂܂ő҂
+	 * @param _level Ox
+	 * @return 1(̂Ă鎞nullptr)
+	 */
+	Debug::LogRecord* Debug::AcquireRecord(LogLevel _level) {
+		LogRing& ring = GetThreadRing();
+		const uint64_t head = ring.head.load(std::memory_order_relaxed);
+		while (head - ring.tail.load(std::memory_order_acquire) >= RING_SIZE) {
+			if (_level != LogLevel::LOG_ERROR) {
+				dropped_.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			if (writer_running_.load(std::memory_order_acquire)) {
+				{
+					std::lock_guard lock(writer_mutex_);
+					writer_wake_ = true;
+				}
+				writer_cv_.notify_one();
+				std::this_thread::yield();
+			}
+			else {
+				Drain();
+			}
 		}
 
-		// Visual Studio ̏o̓EBhEɂo
+		LogRecord& record = ring.records[head & (RING_SIZE - 1)];
+		record.sequence = sequence_.fetch_add(1, std::memory_order_relaxed);
+		record.time = std::chrono::system_clock::now();
+		record.level = _level;
+		return &record;
+	}
+
+	/**
+	 * @brief mۂ1ς
+	 *	ERROR / O𒴂͏oXbhN
+	 */
+	void Debug::CommitRecord() {
+		LogRing& ring = GetThreadRing();
+		const uint64_t head = ring.head.load(std::memory_order_relaxed);
+		const LogLevel level = ring.records[head & (RING_SIZE - 1)].level;
+		ring.head.store(head + 1, std::memory_order_release);
+
+		if (!writer_running_.load(std::memory_order_acquire)) {
+			Drain();
+			return;
+		}
+		if (level == LogLevel::LOG_ERROR || head + 1 - ring.tail.load(std::memory_order_relaxed) >= RING_SIZE / 2) {
+			{
+				std::lock_guard lock(writer_mutex_);
+				writer_wake_ = true;
+			}
+			writer_cv_.notify_one();
+		}
+	}
+
+	/**
+	 * @brief ς܂Ă郍Oo܂ő҂
+	 */
+	void Debug::Flush() {
+		Drain();
+	}
+
+	/**
+	 * @brief oXbh
+	 *	N邩莞ԂƂɉďo
+	 */
+	void Debug::WriterLoop() {
+		while (true) {
+			{
+				std::unique_lock lock(writer_mutex_);
+				writer_cv_.wait_for(lock, std::chrono::milliseconds(10), [] { return writer_wake_ || writer_stop_.load(std::memory_order_acquire); });
+				writer_wake_ = false;
+			}
+			Drain();
+			if (writer_stop_.load(std::memory_order_acquire)) { break; }
+		}
+	}
+
+	/**
+	 * @brief SOďo
+	 *	Xbh܂Őς񂾏ɕגAxԂ͂܂Ƃ߂ăR\[ցA
+	 *	t@C / o̓EBhEւ1ł܂Ƃ߂ď
+	 */
+	void Debug::Drain() {
+		std::scoped_lock lk(mutex_);
+
+		// (`ōs)
 		{
-			std::string dbg = logMessage + "\n";
-			OutputDebugStringA(dbg.c_str());
+			std::lock_guard ringsLock(rings_mutex_);
+			for (auto& ring : rings_) {
+				const uint64_t head = ring->head.load(std::memory_order_acquire);
+				uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+				for (; tail < head; ++tail) {
+					LogRecord& record = ring->records[tail & (RING_SIZE - 1)];
+					PendingLine line{ record.sequence, record.level, record.time, {} };
+					record.formatFunc(record.args, record.format, line.text);
+					pending_.push_back(std::move(line));
+				}
+				ring->tail.store(tail, std::memory_order_release);
+			}
+		}
+
+		std::sort(pending_.begin(), pending_.end(), [](const PendingLine& _a, const PendingLine& _b) {
+			return _a.sequence < _b.sequence;
+			});
+
+		// ̂Ă̕
+		const uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+		if (dropped != reported_dropped_) {
+			pending_.push_back(PendingLine{ 0, LogLevel::LOG_WARNING, std::chrono::system_clock::now(),
+				std::format("[Debug] Oӂꂽ̂ {} ̂Ă܂", dropped - reported_dropped_) });
+			reported_dropped_ = dropped;
 		}
+		if (pending_.empty()) { return; }
+
+		// o
+		std::string batch;
+		std::string run;	// xԂ̂܂Ƃ܂(R\[p)
+		for (size_t i = 0; i < pending_.size(); ++i) {
+			const auto& line = pending_[i];
+			std::string logMessage = FormatTimestamp(line.time) + " [" + std::string(LogLevelToString(line.level)) + "] " + line.text + "\n";
+			batch += logMessage;
+			run += logMessage;
+
+			// R\[ɏo
+			const bool runEnd = (i + 1 == pending_.size()) || (pending_[i + 1].level != line.level);
+			if (runEnd) {
+				if (console_allocated_) {
+					SetConsoleColor(line.level);
+					std::cout << run;
+					std::cout.flush();
+					ResetConsoleColor();
+				}
+				run.clear();
+			}
+		}
+		pending_.clear();
+
+#ifdef _WIN32
+		// Visual Studio ̏o̓EBhEɂo
+		OutputDebugStringA(batch.c_str());
+#endif
 
 		// t@Cɏo
 		if (out_file_.is_open()) {
-			out_file_ << logMessage << std::endl;
+			out_file_ << batch;
 			out_file_.flush();
 		}
-#else
-		(void)level; (void)message;
-#endif
 	}
 }
\ No newline at end of file
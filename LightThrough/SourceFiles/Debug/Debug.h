@@ -10,13 +10,43 @@
 #include <fstream>
 #include <string>
 #include <string_view>
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <mutex>
 #include <atomic>
 #include <format>
+#include <tuple>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <condition_variable>
+
+/**
+ * @brief RpCɏOx
+ *	0: INFOȏc, 1: WARNINGȏ, 2: ERROR̂, 3: S(]Ȃ)
+ */
+#ifndef DEBUG_LOG_MIN_LEVEL
+#if defined(DEBUG) || defined(_DEBUG)
+#define DEBUG_LOG_MIN_LEVEL 0
+#else
+#define DEBUG_LOG_MIN_LEVEL 3
+#endif
+#endif
 
 namespace debug {
 
+	/**
+	 * @brief fobOO
+	 *
+	 * Ă񂾃Xbh͈Rs[ăXbhƂ̃OɐςނŁA
+	 * ` / ^CX^v / R\[Et@Cւ̏o͂͏oXbh܂Ƃ߂čsB
+	 * Oς̎INFO / WARNINĜ͎ĂĐAERROR͋󂭂܂ő҂B
+	 * oXbhĂȂ(InitO / Shutdown)͌Ă񂾃Xbhł̂܂܏oB
+	 */
 	class Debug {
 	public:
 		enum class LogLevel {
@@ -25,37 +55,109 @@ namespace debug {
 			LOG_ERROR
 		};
 
+		static constexpr uint32_t RING_SIZE = 1024;		// XbhƂ̃Ȏ傫(2ׂ̂)
+		static constexpr std::size_t ARG_STORAGE = 192;	// 1̈̒u(𒴂͂̏Ő`)
+
 		static void Init(bool _showConsole);
 		static void Shutdown(bool waitKey = false);
 
-		// VOl`ێ
+		// VOl`ێ(񃊃eƂ͌Ȃ̂ŁȀŐ`)
 		template<typename... Args>
 		static void Log(LogLevel _level, const std::string& _format, Args&&... _args);
 
+		/**
+		 * @brief `oXbhɔC
+		 *	DebugLogXxx}NĂ
+		 * @param _format (񃊃eBo܂ŎQƂ)
+		 * @param _args (std::stringɁAȊO͒lŃRs[)
+		 */
+		template<typename... Args>
+		static void LogDeferred(LogLevel _level, const char* _format, Args&&... _args);
+
 		// bZ[Ŵ܂܏oꍇ
 		static void Log(LogLevel _level, std::string_view message);
 
 		// Ox̂lݒ
 		static void SetLevel(LogLevel level) noexcept { level_threshold_ = level; }
 
+		static void Flush();	// ς܂Ă郍Oo܂ő҂
+		static uint64_t GetDroppedCount() { return dropped_.load(std::memory_order_relaxed); }	// ӂĎ̂Ă(݌v)
+
 	private:
-		static std::string GetTimestamp();							// ^CX^v擾
+		/**
+		 * @brief O1
+		 */
+		struct LogRecord {
+			using FormatFunc = void(*)(void* _args, const char* _format, std::string& _out);	// `Ĉj
+
+			uint64_t sequence = 0;	// ς񂾏(Xbh܂ŕגp)
+			std::chrono::system_clock::time_point time{};
+			LogLevel level = LogLevel::LOG_INFO;
+			const char* format = nullptr;
+			FormatFunc formatFunc = nullptr;
+			alignas(std::max_align_t) std::byte args[ARG_STORAGE]{};
+		};
+
+		/**
+		 * @brief XbhƂ̃O(`Debug.cpp)
+		 */
+		struct LogRing;
+
+		/**
+		 * @brief o҂1(`ς)
+		 */
+		struct PendingLine {
+			uint64_t sequence = 0;
+			LogLevel level = LogLevel::LOG_INFO;
+			std::chrono::system_clock::time_point time{};
+			std::string text{};
+		};
+
+		// ̎(͂Ԃ牺Ȃ悤std::stringփRs[)
+		template<typename T>
+		using StoredArg = std::conditional_t<
+			!std::is_arithmetic_v<std::decay_t<T>> && std::is_convertible_v<const std::decay_t<T>&, std::string_view>,
+			std::string, std::decay_t<T>>;
+
+		static LogRecord* AcquireRecord(LogLevel _level);	// ̃Xbh̃O1m(̂Ă鎞nullptr)
+		static void CommitRecord();							// mۂ1ς
+		static LogRing& GetThreadRing();					// ̃Xbh̃O
+		static void WriterLoop();							// oXbh
+		static void Drain();								// SOďo
+
+		static std::string FormatTimestamp(std::chrono::system_clock::time_point _time);	// ^CX^v𕶎
 		static std::string_view LogLevelToString(LogLevel _level);	// Ox𕶎ɕϊ
 		static void SetConsoleColor(LogLevel _level);				// R\[̕Fݒ
 		static void ResetConsoleColor();							// ̐Fɖ߂
-		static void Write(LogLevel level, std::string_view message);// óiXbhSj
+		static void Write(LogLevel level, std::string_view message);// `ς݂̕ς
 
 		static std::ofstream out_file_;			// o͐t@C
 		static bool console_allocated_;			// R\[mۂǂ
+#ifdef _WIN32
 		static HANDLE console_handle_;			// R\[nh
 		static WORD default_console_attr_;		// ÑR\[葮
-		static std::mutex mutex_;				// o͕ی
+#endif
+		static std::mutex mutex_;				// o͕ی( / o͓Ɉ)
 		static inline std::atomic<LogLevel> level_threshold_ = LogLevel::LOG_INFO; // l
+
+		static std::mutex rings_mutex_;							// rings_̒ǉ̕ی
+		static std::vector<std::unique_ptr<LogRing>> rings_;	// SXbh̃O
+		static std::thread writer_thread_;						// oXbh
+		static std::mutex writer_mutex_;
+		static std::condition_variable writer_cv_;
+		static bool writer_wake_;								// writer_mutex_ŕی
+		static inline std::atomic<bool> writer_running_ = false;
+		static inline std::atomic<bool> writer_stop_ = false;
+		static inline std::atomic<uint64_t> sequence_ = 0;
+		static inline std::atomic<uint64_t> dropped_ = 0;
+		static uint64_t reported_dropped_;						// oς݂̎̂Ă(mutex_ŕی)
+		static std::vector<PendingLine> pending_;				// (mutex_ŕی, g)
 	};
 
 	template<typename... Args>
 	void Debug::Log(LogLevel _level, const std::string& _format, Args&&... _args) {
 #if defined(DEBUG) || defined(_DEBUG)
+		if (_level < level_threshold_.load(std::memory_order_relaxed)) { return; }
 		try {
 			std::string message = std::vformat(_format, std::make_format_args(_args...));
 			Write(_level, message);
@@ -65,13 +167,49 @@ namespace debug {
 		}
 #else
 		(void)_level; (void)_format; (void)sizeof...(_args);
+#endif
+	}
+
+	template<typename... Args>
+	void Debug::LogDeferred(LogLevel _level, const char* _format, Args&&... _args) {
+#if defined(DEBUG) || defined(_DEBUG)
+		if (_level < level_threshold_.load(std::memory_order_relaxed)) { return; }
+
+		using Pack = std::tuple<StoredArg<Args>...>;
+		if constexpr (sizeof(Pack) <= ARG_STORAGE && alignof(Pack) <= alignof(std::max_align_t)) {
+			LogRecord* record = AcquireRecord(_level);
+			if (!record) { return; }	// ӂꂽ̂Ŏ̂Ă
+
+			record->format = _format;
+			new (record->args) Pack(std::forward<Args>(_args)...);
+			record->formatFunc = [](void* _pack, const char* _fmt, std::string& _out) {
+				auto* pack = static_cast<Pack*>(_pack);
+				try {
+					std::apply([&](auto&... _a) {
+						std::vformat_to(std::back_inserter(_out), _fmt, std::make_format_args(_a...));
+						}, *pack);
+				}
+				catch (const std::format_error& e) {
+					_out += "[format_error] ";
+					_out += e.what();
+				}
+				pack->~Pack();
+				};
+			CommitRecord();
+		}
+		else {
+			Log(_level, std::string(_format), std::forward<Args>(_args)...);
+		}
+#else
+		(void)_level; (void)_format; (void)sizeof...(_args);
 #endif
 	}
 }
 
+// ͕񃊃eɌ("" fmt ŊmF)Bl艺̃x͈Ə
 #define DebugLogInfo(fmt, ...) \
-	debug::Debug::Log(debug::Debug::LogLevel::LOG_INFO, fmt, ##__VA_ARGS__)
+	do { if constexpr (DEBUG_LOG_MIN_LEVEL <= 0) { debug::Debug::LogDeferred(debug::Debug::LogLevel::LOG_INFO, "" fmt, ##__VA_ARGS__); } } while (0)
 #define DebugLogWarning(fmt, ...) \
-	debug::Debug::Log(debug::Debug::LogLevel::LOG_WARNING, fmt, ##__VA_ARGS__)
+	do { if constexpr (DEBUG_LOG_MIN_LEVEL <= 1) { debug::Debug::LogDeferred(debug::Debug::LogLevel::LOG_WARNING, "" fmt, ##__VA_ARGS__); } } while (0)
 #define DebugLogError(fmt, ...) \
-	debug::Debug::Log(debug::Debug::LogLevel::LOG_ERROR, fmt, ##__VA_ARGS__)
+	do { if constexpr (DEBUG_LOG_MIN_LEVEL <= 2) { debug::Debug::LogDeferred(debug::Debug::LogLevel::LOG_ERROR, "" fmt, ##__VA_ARGS__); } } while (0)
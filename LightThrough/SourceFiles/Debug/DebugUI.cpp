@@ -18,7 +18,7 @@ namespace debug {
 	 */
 	void DebugUI::Init(ID3D11Device* _device, ID3D11DeviceContext* _context, void* _hwnd)
 	{
-#if defined(DEBUG) || defined(_DEBUG)
+#if (defined(DEBUG) || defined(_DEBUG)) && defined(_WIN32)
 		// ImGuȉ
 		IMGUI_CHECKVERSION();
 		ImGui::CreateContext();
@@ -49,7 +49,7 @@ namespace debug {
 	 */
 	void DebugUI::Render()
 	{
-#if defined(DEBUG) || defined(_DEBUG)
+#if (defined(DEBUG) || defined(_DEBUG)) && defined(_WIN32)
 		ImGui_ImplDX11_CreateDeviceObjects();	// Ȃ𖾎IɌĂяoȂƃtHg
 
 		ImGui_ImplDX11_NewFrame();
@@ -77,7 +77,7 @@ namespace debug {
 	 */
 	void DebugUI::DisposeUI()
 	{
-#if defined(DEBUG) || defined(_DEBUG)
+#if (defined(DEBUG) || defined(_DEBUG)) && defined(_WIN32)
 		ImGui_ImplDX11_Shutdown();
 		ImGui_ImplWin32_Shutdown();
 		ImGui::DestroyContext();
@@ -7,14 +7,19 @@
  */
 
 // ---------- CN[h ---------- // 
-#include <d3d11.h>
 #include <vector>
 #include <functional>
-#include <DX3D/Game/Game.h>
 
 #include <imgui.h>
+#ifdef _WIN32
+#include <d3d11.h>
 #include <imgui_impl_dx11.h>
 #include <imgui_impl_win32.h>
+#else
+// wbhXsł̓obNGhȂ(InitĂ΂ȂBo^֐͕`Ȃ)
+struct ID3D11Device;
+struct ID3D11DeviceContext;
+#endif
 
 namespace debug {
 	class DebugUI {
@@ -7,6 +7,7 @@
  */
 
  // ---------- CN[h ---------- // 
+#include <cmath>
 #include <DirectXMath.h>
 #include <Game/Serialization/ComponentReflection.h>
 
@@ -43,6 +44,7 @@ namespace ecs {
 		mutable bool dirty = true;		// [JύXtO
 		mutable bool axesDirty = true;	// xNgXVtO
 		mutable bool worldDirty = true; // [hsXVtO
+		uint32_t worldVersion = 0;		// [hsvZxɐi(TransformSystemi߂BRC_[Ȃǂ̃LbVp)
 
 		// GfB^[p
 		// IC[pxLbV(x@)
@@ -233,7 +235,7 @@ namespace ecs {
 				return 0.0f;
 			}
 
-			return std::atan2f(fx, fz);
+			return std::atan2(fx, fz);
 		}
 
 
@@ -338,16 +340,16 @@ namespace ecs {
 			const float fz = XMVectorGetZ(f);
 
 			// Yaw: XZʂł̌
-			float yaw = std::atan2f(fx, fz);
+			float yaw = std::atan2(fx, fz);
 			// Pitch: OxNg̏㉺
-			float pitch = std::atan2f(-fy, std::sqrtf(fx * fx + fz * fz));
+			float pitch = std::atan2(-fy, std::sqrt(fx * fx + fz * fz));
 			// Roll: uprightőỎ]𐄒
 			float roll = 0.0f;
 			{
 				XMVECTOR worldUp = XMVectorSet(0, 1, 0, 0);
 				float uy = XMVectorGetY(u);
 				float ry = XMVectorGetY(r);
-				roll = std::atan2f(ry, uy);
+				roll = std::atan2(ry, uy);
 			}
 
 			eulerDegCache = {
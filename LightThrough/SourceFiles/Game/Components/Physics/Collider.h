@@ -7,7 +7,9 @@
  */
 
  // ---------- CN[h ---------- //
+#include <cstdint>
 #include <Game/Collisions/CollisionUtils.h>
+#include <Game/Collisions/BroadPhase.h>
 #include <Game/Serialization/ComponentReflection.h>
 
 namespace ecs {
@@ -28,6 +30,8 @@ namespace ecs {
 		collision::WorldSphere worldSphere{};
 		collision::WorldOBB worldOBB{};
 		float broadPhaseRadius = 0.0f; // u[htF[Yp̔a
+		collision::AABB worldAABB{};	// [h`͂AABB
+		uint32_t syncedWorldVersion = UINT32_MAX;	// `Transform::worldVersion(Ⴆ΍蒼)
 	};
 }
 
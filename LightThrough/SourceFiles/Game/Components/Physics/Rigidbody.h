@@ -22,6 +22,21 @@ namespace ecs {
 		bool useGravity = true;
 		bool isStatic = false;
 		bool isKinematic = false;
+
+		// ---------- X[v(s̏ԁAۑȂ) ---------- //
+		bool isSleeping = false;	// ĂԂ͐ϕ / `̓ / i[tF[Y΂
+		float sleepTimer = 0.0f;	// ~܂葱Ă鎞
+		// ̎p(TransformꂽN)
+		DirectX::XMFLOAT3 sleepPosition{};
+		DirectX::XMFLOAT4 sleepRotation{};
+		DirectX::XMFLOAT3 sleepScale{};
+
+		//! @brief N(~܂葱Ă鎞Ԃ)
+		void WakeUp()
+		{
+			isSleeping = false;
+			sleepTimer = 0.0f;
+		}
 	};
 }
 
@@ -72,11 +72,24 @@ namespace ecs {
 		DirectX::XMFLOAT4 spotAngles_shadowIndex{}; // x = innerCos, y = outerCos, z = shadowMapIndex ,w gp
 	};
 
+	//! @brief NX^Pʂ̃Cg蓖Ă̎QƏ(Lighting.hlslicluster*Ɠ)
+	struct CBClusterParams
+	{
+		uint32_t tilesX = 0, tilesY = 0, slicesZ = 0;
+		uint32_t enabled = 0;	// 0: SCg
+		DirectX::XMFLOAT2 screenSize{};
+		float sliceScale = 0.0f;
+		float sliceBias = 0.0f;
+		DirectX::XMFLOAT4 viewDepth{};	// r[Ԃz = dot(float4(worldPos, 1), viewDepth)
+		float nearSliceDepth = 0.0f; float _pad0[3]{};
+	};
+
 	struct CBLight
 	{
 		int lightCount; uint32_t _pad0[3];
 		LightCPU lights[MAX_LIGHTS];
 		DirectX::XMFLOAT4X4 lightViewProj[MAX_LIGHTS]; // eCg̃r[ˉes
+		CBClusterParams cluster;
 	};
 
 	struct CBLightMatrix
@@ -85,6 +98,7 @@ namespace ecs {
 	};
 
 	static_assert(sizeof(LightCPU) == 64, "LightCPŨTCYs(4 * 16 bytes)");
+	static_assert(sizeof(CBClusterParams) == 64, "CBClusterParams̃TCYs(4 * 16 bytes)");
 
 
 	/**
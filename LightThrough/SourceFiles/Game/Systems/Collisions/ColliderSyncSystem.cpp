@@ -7,20 +7,85 @@
 
 
  // ---------- CN[h ---------- // 
+#include <cmath>
+#include <algorithm>
+#include <span>
+#include <chrono>
 #include <DirectXMath.h>
 #include <Game/Systems/Collisions/ColliderSyncSystem.h>
 #include <Game/ECS/Coordinator.h>
+#include <DX3D/Core/JobSystem.h>
 
 #include <Game/Components/Core/Transform.h>
 #include <Game/Components/Physics/Collider.h>
+#include <Game/Components/Physics/Rigidbody.h>
+#include <Game/Collisions/DynamicAABBTree.h>
 
 #include <DX3D/Math/MathUtils.h>
 
+#include <Debug/DebugUI.h>
+
 
 
 namespace ecs {
+	namespace {
+		/**
+		 * @brief [h`󂩂AABB
+		 * @param _col `XVς݂Collider
+		 * @return AABB
+		 */
+		collision::AABB ComputeAABB(const Collider* _col)
+		{
+			collision::AABB aabb;
+			if (_col->type == collision::ShapeType::Sphere) {
+				const auto& s = _col->worldSphere;
+				const float c[3] = { s.center.x, s.center.y, s.center.z };
+				for (int i = 0; i < 3; ++i) {
+					aabb.min[i] = c[i] - s.radius;
+					aabb.max[i] = c[i] + s.radius;
+				}
+				return aabb;
+			}
+
+			// OBB͊e̔ˉeL
+			const auto& b = _col->worldOBB;
+			const float c[3] = { b.center.x, b.center.y, b.center.z };
+			const float h[3] = { b.half.x, b.half.y, b.half.z };
+			for (int i = 0; i < 3; ++i) {
+				float extent = 0.0f;
+				for (int k = 0; k < 3; ++k) {
+					const float axis[3] = { b.axis[k].x, b.axis[k].y, b.axis[k].z };
+					extent += std::fabs(axis[i]) * h[k];
+				}
+				aabb.min[i] = c[i] - extent;
+				aabb.max[i] = c[i] + extent;
+			}
+			return aabb;
+		}
+
+		//! @brief ̎p̂܂܂(͖Ă镨̂𓮂Ȃ̂ŁAႦΊO珑ꂽ)
+		bool IsSleepPose(const Transform* _tf, const Rigidbody* _rb)
+		{
+			const auto& p = _tf->position;
+			const auto& q = _tf->rotationQuat;
+			const auto& s = _tf->scale;
+			return p.x == _rb->sleepPosition.x && p.y == _rb->sleepPosition.y && p.z == _rb->sleepPosition.z
+				&& q.x == _rb->sleepRotation.x && q.y == _rb->sleepRotation.y && q.z == _rb->sleepRotation.z && q.w == _rb->sleepRotation.w
+				&& s.x == _rb->sleepScale.x && s.y == _rb->sleepScale.y && s.z == _rb->sleepScale.z;
+		}
+
+		//! @brief ÓIȕ(Collider / Rigidbodŷǂ炩 isStatic)
+		bool IsStaticCollider(Coordinator& _ecs, Entity _e, const Collider* _col)
+		{
+			if (_col->isStatic) { return true; }
+			return _ecs.HasComponent<Rigidbody>(_e) && _ecs.GetComponent<Rigidbody>(_e)->isStatic;
+		}
+	}
+
 	ColliderSyncSystem::ColliderSyncSystem(const SystemDesc& _desc)
 		: ISystem(_desc)
+		, job_system_(_desc.jobSystem)
+		, broad_phase_(std::make_unique<collision::DynamicAABBTree>())
 	{
 
 	}
@@ -32,41 +97,264 @@ namespace ecs {
 		signature.set(ecs_.GetComponentType<Transform>());
 		signature.set(ecs_.GetComponentType<Collider>());
 		ecs_.SetSystemSignature<ColliderSyncSystem>(signature);
+
+		// ɕ邽ߘAꗗŎ
+		query_ = &ecs_.GetQuery<Transform, Collider>();
+
+		// fobOUIo^
+#if defined(DEBUG) || defined(_DEBUG)
+		debug::DebugUI::ResistDebugFunction([this]() { DrawDebugUI(); });
+#endif
 	}
 
 
 	/**
 	 * @brief `̍\z
+	 *	EntityƂɓƗĂ̂ŋԂɕĕɏ
+	 *	ÓIȕ͍蒼KvȎBVHɂ܂Ƃ߁Ał͓IȕXV
 	 * @param _dt
 	 */
 	void ColliderSyncSystem::FixedUpdate(float _fixedDt)
 	{
-		for (auto e : entities_) {
-			auto tf = ecs_.GetComponent<Transform>(e);
-			auto col = ecs_.GetComponent<Collider>(e);
+		constexpr uint32_t GRAIN_SIZE = 128;
 
-			// TransformɕύXȂꍇ̂ݍXV
-			//if (!col->shapeDirty && !tf->dirty) { continue; }
+		if (query_->GetVersion() != partition_version_) {
+			PartitionEntities();
+		}
+		if (static_dirty_) {
+			RebuildStaticBVH();
+		}
 
-			// `̍XV
-			switch (col->type) {
-			case collision::ShapeType::Sphere:
-			{
-				BuildSphere(tf, col);
-				break;
+		const std::span<const Entity> entities = dynamic_entities_;
+		synced_.resize(entities.size());
+		awake_.resize(entities.size());
+		job_system_.ParallelFor(0, static_cast<uint32_t>(entities.size()), GRAIN_SIZE,
+			[this, entities](uint32_t _begin, uint32_t _end) {
+				for (uint32_t i = _begin; i < _end; ++i) {
+					const Entity e = entities[i];
+					synced_[i] = SyncEntity(e) ? 1 : 0;
+					awake_[i] = (ecs_.HasComponent<Rigidbody>(e) && ecs_.GetComponent<Rigidbody>(e)->isSleeping) ? 0 : 1;
+				}
+			});
+		force_sync_ = false;
+
+		// v
+		updated_count_ = static_cast<uint32_t>(std::count(synced_.begin(), synced_.end(), uint8_t{ 1 }));
+		skipped_count_ = static_cast<uint32_t>(synced_.size()) - updated_count_;
+
+		UpdateBroadPhase();
+		QueryStaticPairs();
+	}
+
+	//! @brief V[ǂݍݎ(ÓIȕĂ)
+	void ColliderSyncSystem::OnSceneLoaded()
+	{
+		// XibvVbg߂Ȃǂ́AoĂworldVersionĂɂȂȂ̂őS蒼
+		force_sync_ = true;
+		partition_version_ = UINT64_MAX;
+		static_dirty_ = true;
+		static_deferred_steps_ = 0;
+		static_pairs_.clear();
+	}
+
+	//! @brief u[htF[Y̍ւ
+	void ColliderSyncSystem::SetBroadPhase(std::unique_ptr<collision::IBroadPhase> _broadPhase)
+	{
+		broad_phase_ = std::move(_broadPhase);
+		proxies_.clear();
+		added_pairs_.clear();
+		removed_pairs_.clear();
+	}
+
+	/**
+	 * @brief vLV̍쐬 / ړ / 폜ƃyA̍XV
+	 *	dynamic_entities_proxies_Entity̏Ȃ̂ŁAׂē˂킹邾ő
+	 *	ÓIȕ̓vLVȂ(ÓIɂȂ̃vLV͂ŏ)
+	 */
+	void ColliderSyncSystem::UpdateBroadPhase()
+	{
+		const auto& entities = dynamic_entities_;
+		next_proxies_.clear();
+		next_proxies_.reserve(entities.size());
+
+		auto it = proxies_.begin();
+		for (size_t i = 0; i < entities.size(); ++i) {
+			const Entity e = entities[i];
+			// ȂEntitỹvLV
+			while (it != proxies_.end() && it->first < e) {
+				broad_phase_->DestroyProxy(it->second);
+				++it;
 			}
-			case collision::ShapeType::Box:
-			{
-				BuildOBB(tf, col);
-				break;
+
+			if (it != proxies_.end() && it->first == e) {
+				// `蒼ĂȂΓȂ
+				if (synced_[i]) {
+					broad_phase_->MoveProxy(it->second, ecs_.GetComponent<Collider>(e)->worldAABB);
+				}
+				next_proxies_.emplace_back(e, it->second);
+				++it;
+			}
+			else {
+				next_proxies_.emplace_back(e, broad_phase_->CreateProxy(ecs_.GetComponent<Collider>(e)->worldAABB, e.id_));
+			}
+		}
+		for (; it != proxies_.end(); ++it) {
+			broad_phase_->DestroyProxy(it->second);
+		}
+		proxies_.swap(next_proxies_);
+
+		broad_phase_->UpdatePairs(added_pairs_, removed_pairs_);
+	}
+
+	/**
+	 * @brief ÓI / Iɕ
+	 *	NG̈ꗗςs(isStatic̐؂ւRequestStaticRebuildŒm点Ă炤)
+	 *	ÓIȕ̊ԂꂪςĂBVH蒼
+	 */
+	void ColliderSyncSystem::PartitionEntities()
+	{
+		next_static_entities_.clear();
+		dynamic_entities_.clear();
+		for (const Entity e : query_->View()) {
+			if (IsStaticCollider(ecs_, e, ecs_.GetComponent<Collider>(e))) {
+				next_static_entities_.push_back(e);
+			}
+			else {
+				dynamic_entities_.push_back(e);
 			}
-			default:
+		}
+		if (next_static_entities_ != static_entities_) {
+			static_entities_.swap(next_static_entities_);
+			static_dirty_ = true;
+		}
+		partition_version_ = query_->GetVersion();
+	}
+
+	/**
+	 * @brief ÓIȕ̌`BVHɏĂ
+	 *	[hsTransformSystem(Update)̂ŁA
+	 *	܂fĂȂÓIȕΎ̃Xebv܂ő҂B
+	 *	t[ÓIȕƑ҂Ă܂̂ŁA
+	 *	MAX_STATIC_DEFER_STEPS ҂獡̃[hsōAf̂҂Ăx蒼
+	 */
+	void ColliderSyncSystem::RebuildStaticBVH()
+	{
+		// U蕪(isStatic؂ւꂽ̂)
+		PartitionEntities();
+
+		bool pending = false;
+		for (const Entity e : static_entities_) {
+			const auto tf = ecs_.GetComponent<Transform>(e);
+			if (tf->dirty || tf->worldDirty) {
+				pending = true;
 				break;
 			}
+		}
+		if (pending && static_deferred_steps_ < MAX_STATIC_DEFER_STEPS) {
+			++static_deferred_steps_;
+			return;
+		}
+		static_deferred_steps_ = 0;
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		static_items_.clear();
+		static_items_.reserve(static_entities_.size());
+		for (const Entity e : static_entities_) {
+			auto col = ecs_.GetComponent<Collider>(e);
+			UpdateWorldShape(ecs_.GetComponent<Transform>(e), col);
+			static_items_.push_back({ col->worldAABB, e.id_ });
+		}
+		static_bvh_.Build(static_items_);
+		static_build_ms_ = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		++static_build_count_;
+		static_dirty_ = pending;
+
+		// Ă镨̂̐ڐG͍蒼Ǒ`̂̂Ȃ̂ŁANĒג
+		for (const Entity e : dynamic_entities_) {
+			if (!ecs_.HasComponent<Rigidbody>(e)) { continue; }
+			auto rb = ecs_.GetComponent<Rigidbody>(e);
+			if (rb->isSleeping) { rb->WakeUp(); }
+		}
+	}
+
+	/**
+	 * @brief NĂ铮Iȕ̂BVH̃yAW߂
+	 *	`蒼ĂȂAoĂworldAABBŖXebvׂ(yA͖Xebv蒼)
+	 *	Ă镨ׂ̂͒Ȃ(̐ڐGCollisionResolveSystemĂ)
+	 */
+	void ColliderSyncSystem::QueryStaticPairs()
+	{
+		const auto start = std::chrono::high_resolution_clock::now();
+		static_pairs_.clear();
+		static_query_count_ = 0;
+		static_visited_nodes_ = 0;
+		if (static_bvh_.GetItemCount() > 0) {
+			for (size_t i = 0; i < dynamic_entities_.size(); ++i) {
+				if (!awake_[i]) { continue; }
+				const Entity e = dynamic_entities_[i];
+				++static_query_count_;
+				static_visited_nodes_ += static_bvh_.Query(ecs_.GetComponent<Collider>(e)->worldAABB, [&](const collision::StaticBVHItem& _item) {
+					// 蒼҂ĂԂɏ͔΂
+					const Entity other(static_cast<uint32_t>(_item.userData));
+					if (ecs_.IsValidEntity(other) && ecs_.HasComponent<Collider>(other)) {
+						static_pairs_.emplace_back(e, other);
+					}
+					return true;
+					});
+			}
+		}
+		static_query_ms_ = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	/**
+	 * @brief Entity̌`XV
+	 *	Transform̃[hs(worldVersion)`(shapeDirty)ςĂȂΔ΂
+	 *	Ă镨̂́A̎p̂܂܂ȂNȂ(ĂN)
+	 * @param _e ΏۂEntity
+	 * @return `XV
+	 */
+	bool ColliderSyncSystem::SyncEntity(Entity _e)
+	{
+		auto tf = ecs_.GetComponent<Transform>(_e);
+		auto col = ecs_.GetComponent<Collider>(_e);
+
+		if (ecs_.HasComponent<Rigidbody>(_e)) {
+			auto rb = ecs_.GetComponent<Rigidbody>(_e);
+			if (rb->isSleeping && (col->shapeDirty || !IsSleepPose(tf, rb))) {
+				rb->WakeUp();
+			}
+		}
 
-			// ύXtOZbg
-			col->shapeDirty = false;
+		if (!force_sync_ && !col->shapeDirty && col->syncedWorldVersion == tf->worldVersion) { return false; }
+		UpdateWorldShape(tf, col);
+		return true;
+	}
+
+	/**
+	 * @brief [h`AABB蒼
+	 *	Transform::worldVersionoĂA̔rɎg
+	 */
+	void ColliderSyncSystem::UpdateWorldShape(const Transform* _tf, Collider* _col)
+	{
+		switch (_col->type) {
+		case collision::ShapeType::Sphere:
+		{
+			BuildSphere(_tf, _col);
+			break;
+		}
+		case collision::ShapeType::Box:
+		{
+			BuildOBB(_tf, _col);
+			break;
 		}
+		default:
+			break;
+		}
+		_col->worldAABB = ComputeAABB(_col);
+		_col->syncedWorldVersion = _tf->worldVersion;
+
+		// ύXtOZbg
+		_col->shapeDirty = false;
 	}
 
 	void ColliderSyncSystem::BuildSphere(const Transform* _tf, Collider* _col)
@@ -108,4 +396,23 @@ namespace ecs {
 		const auto& h = _col->worldOBB.half;
 		_col->broadPhaseRadius = math::Length(h);
 	}
+
+	//! @brief fobOUI
+	void ColliderSyncSystem::DrawDebugUI()
+	{
+		if (ImGui::Begin("Broad Phase")) {
+			ImGui::Text("Dynamic: %u / Static: %u", static_cast<uint32_t>(dynamic_entities_.size()), static_bvh_.GetItemCount());
+			ImGui::Text("Shapes: %u updated / %u skipped", updated_count_, skipped_count_);
+			ImGui::Text("Dynamic Pairs: %u / Static Pairs: %u", static_cast<uint32_t>(broad_phase_->GetPairs().size()), static_cast<uint32_t>(static_pairs_.size()));
+
+			ImGui::Separator();
+			ImGui::Text("Static BVH Nodes: %u (Depth: %u, SAH Cost: %.2f)", static_bvh_.GetNodeCount(), static_bvh_.GetDepth(), static_bvh_.GetSAHCost());
+			ImGui::Text("Build: %.3f ms (Builds: %u, Deferred: %u)", static_build_ms_, static_build_count_, static_deferred_steps_);
+			ImGui::Text("Query: %.3f ms / %u queries (Visited Nodes: %u)", static_query_ms_, static_query_count_, static_visited_nodes_);
+			if (ImGui::Button("Rebuild Static BVH")) {
+				RequestStaticRebuild();
+			}
+		}
+		ImGui::End();
+	}
 }
\ No newline at end of file
@@ -9,15 +9,32 @@
 
 
  // ---------- CN[h ---------- // 
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <utility>
 #include <Game/ECS/ISystem.h>
+#include <Game/ECS/Entity.h>
+#include <Game/Collisions/BroadPhase.h>
+#include <Game/Collisions/StaticBVH.h>
+
+namespace dx3d {
+	class JobSystem;
+}
 
 namespace ecs {
 	struct Transform;
 	struct Collider;
+	class Query;
 
 	/**
 	 * @brief RC_[̓VXe
 	 * @details TransformR|[lg̕ύXmāAColliderR|[lǧ`XV
+	 *	TransformSystemi߂worldVersionƌ`̒lׁA[hs񂩌`󂪕ς蒼
+	 *	XV`Ńu[htF[ỸvLVAdȂĂyAXV
+	 *	ÓIȃRC_[(Collider / Rigidbodŷǂ炩 isStatic)͖Xebv͈킸A
+	 *	V[ǂݍݎ / Iɏꂽ` StaticBVH ɏĂށB
+	 *	BVH͋NĂ铮Iȕ̂炾ׂ̂ŁAÓIȕm̃yA͍Ȃ
 	 */
 	class ColliderSyncSystem : public ISystem {
 	public:
@@ -25,9 +42,78 @@ namespace ecs {
 
 		void Init() override;
 		void FixedUpdate(float _fixedDt) override;
+		void OnSceneLoaded() override;
+
+		/**
+		 * @brief u[htF[Y̍ւ(r / ؂蕪p)
+		 *	vLV͎FixedUpdateō蒼
+		 * @param _broadPhase Vu[htF[Y
+		 */
+		void SetBroadPhase(std::unique_ptr<dx3d::collision::IBroadPhase> _broadPhase);
+
+		//! @brief dȂĂyA(userA / userBEntityid)
+		const dx3d::collision::IBroadPhase& GetBroadPhase() const { return *broad_phase_; }
+		//! @brief ߂FixedUpdateőyA
+		const std::vector<dx3d::collision::BroadPhasePair>& GetAddedPairs() const { return added_pairs_; }
+		//! @brief ߂FixedUpdateŌyA
+		const std::vector<dx3d::collision::BroadPhasePair>& GetRemovedPairs() const { return removed_pairs_; }
+		//! @brief ߂FixedUpdateŌ`蒼 / ςĂȂĔ΂(Iȕ)
+		uint32_t GetUpdatedCount() const { return updated_count_; }
+		uint32_t GetSkippedCount() const { return skipped_count_; }
+		//! @brief ߂FixedUpdateŐÓIBVHƏdȂyA(I, ÓI)
+		const std::vector<std::pair<Entity, Entity>>& GetStaticPairs() const { return static_pairs_; }
+
+		/**
+		 * @brief ÓIBVH蒼(GfB^[ŐÓIȕȂ)
+		 *	FixedUpdateŁAÓIȕ̈ꗗ蒼
+		 */
+		void RequestStaticRebuild() { static_dirty_ = true; }
+		const dx3d::collision::StaticBVH& GetStaticBVH() const { return static_bvh_; }
+
+		static constexpr uint32_t MAX_STATIC_DEFER_STEPS = 4;	// ÓIBVH̍蒼҂ő̃Xebv
 
 	private:
 		void BuildSphere(const Transform* _tf, Collider* _col);
 		void BuildOBB(const Transform* _tf, Collider* _col);
+		bool SyncEntity(Entity _e);	// `XVtrue(ςĂȂĔ΂false)
+		void UpdateWorldShape(const Transform* _tf, Collider* _col);	// [h`AABB蒼
+		void UpdateBroadPhase();	// vLV̍쐬 / ړ / 폜ƃyA̍XV
+		void PartitionEntities();	// ÓI / Iɕ
+		void RebuildStaticBVH();	// ÓIȕ̌`BVHɏĂ
+		void QueryStaticPairs();	// NĂ铮Iȕ̂BVH̃yAW߂
+		void DrawDebugUI();
+
+	private:
+		dx3d::JobSystem& job_system_;
+		const Query* query_ = nullptr;	// Transform + Collider
+
+		std::unique_ptr<dx3d::collision::IBroadPhase> broad_phase_{};
+		std::vector<std::pair<Entity, dx3d::collision::ProxyId>> proxies_{};	// Entity̏ɕ񂾃vLV
+		std::vector<std::pair<Entity, dx3d::collision::ProxyId>> next_proxies_{};	// Ɨp
+		std::vector<uint8_t> synced_{};	// dynamic_entities_̏B`XV(Ɨp)
+		std::vector<uint8_t> awake_{};	// dynamic_entities_̏BĂȂ(ÓIBVH𒲂ׂ邩BƗp)
+		std::vector<dx3d::collision::BroadPhasePair> added_pairs_{};
+		std::vector<dx3d::collision::BroadPhasePair> removed_pairs_{};
+		bool force_sync_ = true;	// ̃XebvŕςĂȂ蒼
+		uint32_t updated_count_ = 0;	// ߂̃XebvŌ`蒼
+		uint32_t skipped_count_ = 0;	// ߂̃XebvŕςĂȂĔ΂
+
+		// ÓI / I̐U蕪
+		std::vector<Entity> static_entities_{};		// Entity̏
+		std::vector<Entity> dynamic_entities_{};	// Entity̏
+		std::vector<Entity> next_static_entities_{};	// Ɨp
+		uint64_t partition_version_ = UINT64_MAX;	// U蕪̃NG̃o[W
+
+		// ÓIBVH
+		dx3d::collision::StaticBVH static_bvh_{};
+		std::vector<dx3d::collision::StaticBVHItem> static_items_{};	// Ɨp
+		std::vector<std::pair<Entity, Entity>> static_pairs_{};	// (I, ÓI)
+		bool static_dirty_ = true;	// 蒼Kv
+		uint32_t static_deferred_steps_ = 0;	// [hs񂪔f̂҂Xebv
+		float static_build_ms_ = 0.0f;	// ߂̍蒼ɂ
+		float static_query_ms_ = 0.0f;	// ߂̃XebvBVH̖₢킹ɂ
+		uint32_t static_query_count_ = 0;	// ߂̃XebvŖ₢킹
+		uint32_t static_visited_nodes_ = 0;	// ߂̃XebvŒHm[h̐
+		uint32_t static_build_count_ = 0;	// 蒼
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
  // ---------- CN[h ----------
 #include <optional>
+#include <algorithm>
 #include <cmath>
 #include <variant>
 
@@ -12,6 +13,7 @@
 #include <Game/ECS/Coordinator.h>
 
 #include <Game/Systems/Gimmicks/ShadowTestSystem.h>
+#include <Game/Systems/Collisions/ColliderSyncSystem.h>
 
 #include <Game/Components/Core/Transform.h>
 #include <Game/Components/Physics/Collider.h>
@@ -20,6 +22,7 @@
 #include <DX3D/Math/MathUtils.h>
 
 #include <Debug/Debug.h>
+#include <Debug/DebugUI.h>
 
 namespace ecs {
 	using namespace DirectX;
@@ -31,8 +34,11 @@ namespace ecs {
 		struct Overloaded : Ts... { using Ts::operator()...; };
 		template <class... Ts>
 		Overloaded(Ts...) -> Overloaded< Ts...>;
-		// i[tF[Y̓蔻fBXpb`[
-		std::optional<collision::ContactResult> DispatchContact(const Collider* _a, const Collider* _b)
+		constexpr uint32_t SCALAR_PAIR = UINT32_MAX;	// ܂Ƃ߂ɂ̏Ŕ肵yA
+
+		// i[tF[ỸyAς(ԍԂ)
+		// mNarrowPhaseBatchɐς݁AރyA͐ςގԂ̂̕ł̏Ŕ肵_scalarɓ
+		uint32_t AddNarrowPhasePair(collision::NarrowPhaseBatch& _batch, const Collider* _a, const Collider* _b, std::optional<collision::ContactResult>& _scalar)
 		{
 			using collision::SphereShape;
 			using collision::BoxShape;
@@ -40,69 +46,52 @@ namespace ecs {
 			return std::visit(
 				Overloaded{
 					[&](const SphereShape&, const SphereShape&) {
-						return collision::IntersectSphere(_a->worldSphere, _b->worldSphere);
+						_scalar = collision::IntersectSphere(_a->worldSphere, _b->worldSphere);
+						return SCALAR_PAIR;
 					},
 					[&](const SphereShape&, const BoxShape&) {
-						return collision::IntersectSphereOBB(_a->worldSphere, _b->worldOBB);
+						_scalar = collision::IntersectSphereOBB(_a->worldSphere, _b->worldOBB);
+						return SCALAR_PAIR;
 					},
 					[&](const BoxShape&, const SphereShape&) {
-						return collision::IntersectSphereOBB(_b->worldSphere, _a->worldOBB);
+						_scalar = collision::IntersectSphereOBB(_b->worldSphere, _a->worldOBB);
+						return SCALAR_PAIR;
 					},
 					[&](const BoxShape&, const BoxShape&) {
-						return collision::IntersectOBB(_a->worldOBB, _b->worldOBB);
+						return _batch.AddBoxBox(collision::ToContactBox(_a->worldOBB), collision::ToContactBox(_b->worldOBB));
 					}
 				},
 				_a->shape, _b->shape
 			);
 		}
 
-		// Transform ύX Collider  world 𑦎XVwp[
-		void UpdateColliderWorldFromTransform(Entity _e, Transform* _tf, Collider* _col)
+		// ڐG_im̓NbsOŕ_AȊO͋ߎڐG_̈_j
+		uint32_t BuildContactPoints(const Collider* _a, const Collider* _b, const collision::ContactResult& _contact, collision::ContactPointInput* _out)
 		{
-			// Transform  world s񂪕KvȂ BuildWorld ĂԁiTransform  dirty ǗĂȂ炻Łj
-			// ł Transform  position/rotation/scale ̒l𒼐ڎg world 񂾂XVB
-			switch (_col->type) {
-			case collision::ShapeType::Sphere:
-			{
-				// XP[͍ő厲ňiƈvj
-				float maxScale = (std::max)({ _tf->scale.x, _tf->scale.y, _tf->scale.z });
-				_col->worldSphere.center = _tf->position;
-				_col->worldSphere.radius = _col->sphere.radius * maxScale;
-				_col->broadPhaseRadius = _col->worldSphere.radius;
-				break;
-			}
-			case collision::ShapeType::Box:
-			{
-				// rotationQuat 玲vZ worldOBB.axis XViColliderSync::BuildOBB Ɠꏈj
-				using namespace DirectX;
-				XMVECTOR q = XMQuaternionNormalize(XMLoadFloat4(&_tf->rotationQuat));
-
-				XMVECTOR axisX = XMVector3Rotate(XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f), q);
-				XMVECTOR axisY = XMVector3Rotate(XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), q);
-				XMVECTOR axisZ = XMVector3Rotate(XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), q);
-
-				XMStoreFloat3(&_col->worldOBB.axis[0], XMVector3Normalize(axisX));
-				XMStoreFloat3(&_col->worldOBB.axis[1], XMVector3Normalize(axisY));
-				XMStoreFloat3(&_col->worldOBB.axis[2], XMVector3Normalize(axisZ));
-
-				_col->worldOBB.center = _tf->position;
-				_col->worldOBB.half = {
-					_col->box.halfExtents.x * _tf->scale.x,
-					_col->box.halfExtents.y * _tf->scale.y,
-					_col->box.halfExtents.z * _tf->scale.z
-				};
-
-				const auto& h = _col->worldOBB.half;
-				_col->broadPhaseRadius = std::sqrt(h.x * h.x + h.y * h.y + h.z * h.z);
-				break;
-			}			default:
-				break;
+			if (_a->type == collision::ShapeType::Box && _b->type == collision::ShapeType::Box) {
+				const uint32_t count = collision::GenerateOBBContactPoints(_a->worldOBB, _b->worldOBB, _contact, _out);
+				if (count > 0) { return count; }
 			}
-			// Collider ɑfƂigĂȂZbgj
-			_col->shapeDirty = false;
+			_out[0].position[0] = _contact.contactPoint.x;
+			_out[0].position[1] = _contact.contactPoint.y;
+			_out[0].position[2] = _contact.contactPoint.z;
+			_out[0].penetration = _contact.penetration;
+			_out[0].featureId = _contact.feature << 8;
+			return 1;
 		}
 
-
+		// o[h`𓮂(sړȂ̂ō蒼Ȃ)
+		// syncedWorldVersion͂̂܂܂Ȃ̂ŁA[hs񂪌vZꂽColliderSyncSystem蒼
+		void TranslateWorldShape(Collider* _col, const XMFLOAT3& _disp)
+		{
+			_col->worldOBB.center = math::Add(_col->worldOBB.center, _disp);
+			_col->worldSphere.center = math::Add(_col->worldSphere.center, _disp);
+			const float d[3] = { _disp.x, _disp.y, _disp.z };
+			for (int i = 0; i < 3; ++i) {
+				_col->worldAABB.min[i] += d[i];
+				_col->worldAABB.max[i] += d[i];
+			}
+		}
 
 	} // namespace anonymous
 
@@ -120,6 +109,14 @@ namespace ecs {
 		ecs_.SetSystemSignature<CollisionResolveSystem>(sig);
 
 		shadow_test_system_ = ecs_.GetSystem<ShadowTestSystem>();
+		collider_sync_system_ = ecs_.GetSystem<ColliderSyncSystem>();
+
+		body_query_ = &ecs_.GetQuery<Collider, Rigidbody>();
+
+		// fobOUIo^
+#if defined(DEBUG) || defined(_DEBUG)
+		debug::DebugUI::ResistDebugFunction([this]() { DrawDebugUI(); });
+#endif
 	}
 
 	//! @brief ŒXV
@@ -132,34 +129,66 @@ namespace ecs {
 
 
 		auto shadow = shadow_test_system_.lock();
+		auto colliderSync = collider_sync_system_.lock();
+		if (!colliderSync) { return; }
 		contacts_.clear();
 		// SyAL
 		std::unordered_set<std::pair<Entity, Entity>, EntityPairHash> currentContacts;
 
 		// ---------- ڐGW ---------- //
-		std::vector<Entity> ents(entities_.begin(), entities_.end());
-		const size_t n = ents.size();
-
-		for (size_t i = 0; i < n; ++i) {
-			const Entity eA = ents[i];
+		// ColliderSyncSystem̃u[htF[YŏdȂyAƁAÓIBVHƏdȂyAׂ
+		// ̏ԂȑȎƑ邽߁AEntity̏ɕג
+		candidate_pairs_.clear();
+		for (const auto& pair : colliderSync->GetBroadPhase().GetPairs()) {
+			const Entity a(static_cast<uint32_t>(pair.userA));
+			const Entity b(static_cast<uint32_t>(pair.userB));
+			candidate_pairs_.push_back(std::minmax(a, b));
+		}
+		for (const auto& [dynamicEntity, staticEntity] : colliderSync->GetStaticPairs()) {
+			candidate_pairs_.push_back(std::minmax(dynamicEntity, staticEntity));
+		}
+		std::sort(candidate_pairs_.begin(), candidate_pairs_.end());
+		// ÓIBVH̍蒼҂̊Ԃ́AIɂȂɋ邱Ƃ
+		candidate_pairs_.erase(std::unique(candidate_pairs_.begin(), candidate_pairs_.end()), candidate_pairs_.end());
+
+		// m͐ςł܂Ƃ߂Ĕ肷(NarrowPhaseBatch)
+		narrow_phase_.Begin();
+		narrow_pairs_.clear();
+		for (const auto& [eA, eB] : candidate_pairs_) {
 			auto tfA = ecs_.GetComponent<Transform>(eA);
 			auto colA = ecs_.GetComponent<Collider>(eA);
-			if (colA->isTrigger) { continue; }
+			auto tfB = ecs_.GetComponent<Transform>(eB);
+			auto colB = ecs_.GetComponent<Collider>(eB);
+			if (colA->isTrigger || colB->isTrigger) { continue; }
+
+			const float r = colA->broadPhaseRadius + colB->broadPhaseRadius;
+			if (math::DistSq(tfA->position, tfB->position) > r * r) { continue; }
+			// ~܂Ă̓mׂ͒Ȃ(̐ڐGő)
+			if (IsAtRestPair(eA, colA, eB, colB)) { continue; }
+			auto& pair = narrow_pairs_.emplace_back(NarrowPhasePair{ eA, eB });
+			pair.index = AddNarrowPhasePair(narrow_phase_, colA, colB, pair.scalar);
+		}
+		narrow_phase_.Run();
 
-			for (size_t j = i + 1; j < n; ++j) {
-				const Entity eB = ents[j];
-				auto tfB = ecs_.GetComponent<Transform>(eB);
-				auto colB = ecs_.GetComponent<Collider>(eB);
-				if (colB->isTrigger) { continue; }
+		// ʂ͐ς񂾏(Entity̏)Ɏo
+		for (const auto& [eA, eB, index, scalar] : narrow_pairs_) {
+			const auto c = (index == SCALAR_PAIR) ? scalar : collision::ToContactResult(narrow_phase_.GetResult(index));
+			if (!c || c->penetration <= 1e-6f) { continue; }
 
-				const float r = colA->broadPhaseRadius + colB->broadPhaseRadius;
-				if (math::DistSq(tfA->position, tfB->position) > r * r) { continue; }
-				auto c = DispatchContact(colA, colB);
-				if (!c || c->penetration <= 1e-6f) { continue; }
+			auto colA = ecs_.GetComponent<Collider>(eA);
+			auto colB = ecs_.GetComponent<Collider>(eB);
+			auto& rec = contacts_.emplace_back(ContactRecord{ eA, eB, *c, {} });
+			rec.pointCount = BuildContactPoints(colA, colB, rec.contact, rec.points);
+			currentContacts.insert(std::minmax(eA, eB));
+		}
 
-				contacts_.push_back(ContactRecord{ eA, eB, *c, {} });
-				currentContacts.insert(std::minmax(eA, eB));
-			}
+		// Ă铇̐ڐǦ͖ʂg(rŋN̂̃yA̓i[tF[YŎ蒼Ă)
+		for (const auto& cached : sleeping_contacts_) {
+			if (!ecs_.IsValidEntity(cached.a) || !ecs_.IsValidEntity(cached.b)) { continue; }
+			if (!ecs_.HasComponent<Collider>(cached.a) || !ecs_.HasComponent<Collider>(cached.b)) { continue; }
+			if (!IsAtRestPair(cached.a, ecs_.GetComponent<Collider>(cached.a), cached.b, ecs_.GetComponent<Collider>(cached.b))) { continue; }
+			contacts_.push_back(cached);
+			currentContacts.insert(std::minmax(cached.a, cached.b));
 		}
 
 		// ---------- eXLbvXgXV ---------- //
@@ -200,7 +229,16 @@ namespace ecs {
 
 				// \_̎擾
 				XMFLOAT3 center = collision::GetRepresentativeContactPointOnOBB(baseCol->worldOBB, n);
-				collision::GenerateOverlapSamplePoints(baseCol->worldOBB, otherCol->worldOBB, rec.samplePoints);
+				if (baseCol->type == collision::ShapeType::Box && otherCol->type == collision::ShapeType::Box) {
+					// m̓NbsOڐG_giʓmłlj
+					for (uint32_t i = 0; i < rec.pointCount; ++i) {
+						const float* p = rec.points[i].position;
+						rec.samplePoints.push_back({ p[0], p[1], p[2] });
+					}
+				}
+				else {
+					collision::GenerateOverlapSamplePoints(baseCol->worldOBB, otherCol->worldOBB, rec.samplePoints);
+				}
 
 				constexpr float EPS = 0.00005f; // @ɃItZbgēo^
 				for (auto& p : rec.samplePoints) {
@@ -214,7 +252,11 @@ namespace ecs {
 		shadow->ExecuteShadowTests();
 
 		// ---------- tF[Y ---------- //
-		const float baumgarte = 0.2f;
+		manifold_cache_.BeginStep();
+		solver_bodies_.assign(1, collision::SolverBody{});	// 0: ÓIȕ
+		solver_entities_.assign(1, Entity{});
+		solver_rigidbodies_.assign(1, nullptr);
+		solver_body_index_.clear();
 
 		for (auto& rec : contacts_) {
 
@@ -232,106 +274,77 @@ namespace ecs {
 				}
 			}
 
+			// Ă铇̐ڐG͉Ȃ
+			if (rec.sleeping) { continue; }
+
 			// Ď擾irec.a/rec.b ͐K̏j
 			auto colA = ecs_.GetComponent<Collider>(rec.a);
 			auto colB = ecs_.GetComponent<Collider>(rec.b);
-			auto tfA = ecs_.GetComponent<Transform>(rec.a);
-			auto tfB = ecs_.GetComponent<Transform>(rec.b);
-
-			// ---------- oiʒu␳j ---------- //
-			auto [dispA, dispB] =
-				collision::ComputePushOut(rec.contact, colA->isStatic, colB->isStatic, solve_percent_, solve_slop_);
-
-			// Transform 𒼐ڍXViposition ςK Collider  world XVj
-			if (!colA->isStatic && !math::IsZeroVec(dispA)) {
-				tfA->AddPosition(dispA);
-				tfA->dirty = true; // Transform  dirty tOiTransform ɍ킹āj
-				UpdateColliderWorldFromTransform(rec.a, tfA, colA); // f
-			}
-			if (!colB->isStatic && !math::IsZeroVec(dispB)) {
-				tfB->AddPosition(dispB);
-				tfB->dirty = true;
-				UpdateColliderWorldFromTransform(rec.b, tfB, colB);
-			}
-
-			// ---------- CpX ---------- //
-			// ł "Static-Static" ̓XLbvA"Dynamic-Dynamic"  "Static-Dynamic" 
 			if (colA->isStatic && colB->isStatic) {
 				continue; //  static => Ȃ
 			}
 
-			// Rigidbody Kv`FbNidynamic  Rigidbody Αx͕svj
 			Rigidbody* rbA = ecs_.HasComponent<Rigidbody>(rec.a) ? ecs_.GetComponent<Rigidbody>(rec.a) : nullptr;
 			Rigidbody* rbB = ecs_.HasComponent<Rigidbody>(rec.b) ? ecs_.GetComponent<Rigidbody>(rec.b) : nullptr;
+			const bool dynamicA = rbA && !rbA->isStatic && !rbA->isKinematic && !colA->isStatic;
+			const bool dynamicB = rbB && !rbB->isStatic && !rbB->isKinematic && !colB->isStatic;
 
-			// Iꂩ݂Ȃꍇ̓XLbv
-			if ((!rbA || rbA->isStatic || rbA->isKinematic) && (!rbB || rbB->isStatic || rbB->isKinematic)) {
+			// ---------- oiʒu␳j ---------- //
+			// xȂyA͈ʒu
+			if (!dynamicA && !dynamicB) {
+				auto tfA = ecs_.GetComponent<Transform>(rec.a);
+				auto tfB = ecs_.GetComponent<Transform>(rec.b);
+				// RigidbodyŐÓIȕȂ(ColliderSyncSystem̐ÓIBVHɏĂ܂Ă)
+				const bool staticA = colA->isStatic || (rbA && rbA->isStatic);
+				const bool staticB = colB->isStatic || (rbB && rbB->isStatic);
+				auto [dispA, dispB] =
+					collision::ComputePushOut(rec.contact, staticA, staticB, solve_percent_, solve_slop_);
+
+				// Transform 𒼐ڍXVACollider  world (̔ / \oǑ`gȂ悤)
+				if (!staticA && !math::IsZeroVec(dispA)) {
+					tfA->AddPosition(dispA);
+					TranslateWorldShape(colA, dispA);
+				}
+				if (!staticB && !math::IsZeroVec(dispB)) {
+					tfB->AddPosition(dispB);
+					TranslateWorldShape(colB, dispB);
+				}
 				continue;
 			}
 
-			// penetration  bias ̎Zo
-			const float pen = (std::max)(rec.contact.penetration - solve_slop_, 0.0f);
-
-			// : o dynamic AȊOiБ staticj
-			const bool bothDynamic = !(colA->isStatic || colB->isStatic);
-
-			// bias ͊{I dynamic-dynamic ̂݌Astatic-dynamic ł 0 ɂĐÓIIuWFNguxɂāv鎖h
-			const float bias = (bothDynamic && pen > 0.0f && _fixedDt > 0.0f) ? (baumgarte * (pen / _fixedDt)) : 0.0f;
-
-			// xivB - vAj
-			XMFLOAT3 vA{ 0,0,0 }, vB{ 0,0,0 };
-			if (rbA) vA = rbA->linearVelocity;
-			if (rbB) vB = rbB->linearVelocity;
-			const XMFLOAT3 vRel = math::Sub(vB, vA);
-			const float vRelN = math::Dot(vRel, rec.contact.normal);
+			// ---------- }jtH[hXV ---------- //
+			// ђʂ̓\o[xƈꏏɉ̂ŁAł͈ʒu𓮂Ȃ
+			const float normal[3] = { rec.contact.normal.x, rec.contact.normal.y, rec.contact.normal.z };
+			auto& m = manifold_cache_.Update(rec.a.id_, rec.b.id_, normal, rec.points, rec.pointCount);
+			m.bodyA = colA->isStatic ? 0 : GetSolverBody(rec.a, rbA);
+			m.bodyB = colB->isStatic ? 0 : GetSolverBody(rec.b, rbB);
 
+			// W: 傫
 			float e = 0.0f;
 			if (rbA) e = (std::max)(e, std::clamp(rbA->restitution, 0.0f, 1.0f));
 			if (rbB) e = (std::max)(e, std::clamp(rbB->restitution, 0.0f, 1.0f));
+			m.restitution = e;
 
-			// ʌWiБ static ̏ꍇ͂̑ invMass = 0j
-			const float invA = (rbA && rbA->mass > 0.0f && !rbA->isStatic && !rbA->isKinematic) ? (1.0f / rbA->mass) : 0.0f;
-			const float invB = (rbB && rbB->mass > 0.0f && !rbB->isStatic && !rbB->isKinematic) ? (1.0f / rbB->mass) : 0.0f;
-
-			const float denom = invA + invB;
-			if (denom <= 1e-8f) { continue; }
-
-			float jn = -((vRelN < 0.0f ? (1.0f + e) * vRelN : vRelN) + bias) / denom;
-			if (jn < 0.0f) jn = 0.0f;
-
-			const XMFLOAT3 impulseN = math::Scale(rec.contact.normal, jn);
-
-			// Static-I ̏ꍇłAÓIɂ͑x^ȂiinvMass==0 ̂ߎۂ͉eȂmɂj
-			if (rbA && invA > 0.0f) {
-				rbA->linearVelocity = math::Sub(rbA->linearVelocity, math::Scale(impulseN, invA));
-			}
-			if (rbB && invB > 0.0f) {
-				rbB->linearVelocity = math::Add(rbB->linearVelocity, math::Scale(impulseN, invB));
-			}
-
-			// ---------- C ---------- //
-			XMFLOAT3 t = math::Sub(vRel, math::Scale(rec.contact.normal, vRelN));
-			const float tLen = math::Length(t);
-			if (tLen > 1e-6f) {
-				t = math::Scale(t, 1.0f / tLen);
-
-				// CW: oꍇ͕ρAȊO͎Ă̒lg
-				float muA = (rbA) ? std::clamp(rbA->friction, 0.0f, 1.0f) : 0.0f;
-				float muB = (rbB) ? std::clamp(rbB->friction, 0.0f, 1.0f) : 0.0f;
-				float mu = (rbA && rbB) ? ((muA + muB) * 0.5f) : (muA + muB);
-
-				float jt = -(math::Dot(vRel, t) / denom);
-				const float jtMax = mu * jn;
-				jt = std::clamp(jt, -jtMax, jtMax);
-
-				const XMFLOAT3 impulseT = math::Scale(t, jt);
-				if (rbA && invA > 0.0f) {
-					rbA->linearVelocity = math::Sub(rbA->linearVelocity, math::Scale(impulseT, invA));
-				}
-				if (rbB && invB > 0.0f) {
-					rbB->linearVelocity = math::Add(rbB->linearVelocity, math::Scale(impulseT, invB));
-				}
-			}
+			// CW: oꍇ͕ρAȊO͎Ă̒lg
+			const float muA = (rbA) ? std::clamp(rbA->friction, 0.0f, 1.0f) : 0.0f;
+			const float muB = (rbB) ? std::clamp(rbB->friction, 0.0f, 1.0f) : 0.0f;
+			m.friction = (rbA && rbB) ? ((muA + muB) * 0.5f) : (muA + muB);
+		}
+		manifold_cache_.EndStep();
+
+		// ---------- CpX ---------- //
+		solver_.Solve(solver_bodies_, manifold_cache_.GetManifolds(), _fixedDt, solver_settings_);
+		for (size_t i = 1; i < solver_bodies_.size(); ++i) {
+			const auto& body = solver_bodies_[i];
+			if (body.invMass <= 0.0f) { continue; }
+			solver_rigidbodies_[i]->linearVelocity = { body.velocity[0], body.velocity[1], body.velocity[2] };
+
+			// ђʂ̖߂(ƁAxƂ̍̈̕ړ)ʒuɔf
+			const XMFLOAT3 disp{ body.positionCorrection[0], body.positionCorrection[1], body.positionCorrection[2] };
+			if (math::IsZeroVec(disp)) { continue; }
+			const Entity e = solver_entities_[i];
+			ecs_.GetComponent<Transform>(e)->AddPosition(disp);
+			TranslateWorldShape(ecs_.GetComponent<Collider>(e), disp);
 		}
 
 		// ---------- eՓ˃XLbvyA̍XV ---------- //
@@ -345,6 +358,9 @@ namespace ecs {
 			}
 		}
 		shadow_skip_pairs_ = std::move(newShadowSkips);
+
+		// ---------- X[v ---------- //
+		UpdateSleep(_fixedDt);
 	}
 
 	//! @brief V[ǂݍݎ
@@ -352,7 +368,228 @@ namespace ecs {
 	{
 		contacts_.clear();
 		shadow_skip_pairs_.clear();
+		manifold_cache_.Clear();
+		sleeping_contacts_.clear();
 		time_ = 0.0f;
 	}
 
+	/**
+	 * @brief \o[̂̔̕ԍ擾(Ȃ΍)
+	 *	Rigidbody / ÓI / Ll}eBbNȂ̂ invMass = 0 őx
+	 * @param _e Entity
+	 * @param _rb Entity Rigidbody(nullptr)
+	 * @return solver_bodies_̔ԍ
+	 */
+	uint32_t CollisionResolveSystem::GetSolverBody(Entity _e, Rigidbody* _rb)
+	{
+		if (!_rb) { return 0; }
+		auto [it, inserted] = solver_body_index_.try_emplace(_e, static_cast<uint32_t>(solver_bodies_.size()));
+		if (!inserted) { return it->second; }
+
+		collision::SolverBody body{};
+		body.velocity[0] = _rb->linearVelocity.x;
+		body.velocity[1] = _rb->linearVelocity.y;
+		body.velocity[2] = _rb->linearVelocity.z;
+		body.invMass = (_rb->mass > 0.0f && !_rb->isStatic && !_rb->isKinematic) ? (1.0f / _rb->mass) : 0.0f;
+		solver_bodies_.push_back(body);
+		solver_entities_.push_back(_e);
+		solver_rigidbodies_.push_back(_rb);
+		return it->second;
+	}
+
+	//! @brief Ă邩
+	bool CollisionResolveSystem::IsSleeping(Entity _e)
+	{
+		return ecs_.HasComponent<Rigidbody>(_e) && ecs_.GetComponent<Rigidbody>(_e)->isSleeping;
+	}
+
+	/**
+	 * @brief i[tF[Y΂yA
+	 *	ǂ炩ĂāAĂ邩ÓIȂAڐG͕ςĂȂ
+	 */
+	bool CollisionResolveSystem::IsAtRestPair(Entity _a, const Collider* _colA, Entity _b, const Collider* _colB)
+	{
+		// ÓIRigidbodyȂ(ColliderSyncSystem̐ÓIBVHɓĂ)
+		auto isFixed = [&](Entity _e, const Collider* _col) {
+			return _col->isStatic || (ecs_.HasComponent<Rigidbody>(_e) && ecs_.GetComponent<Rigidbody>(_e)->isStatic);
+		};
+		const bool sleepA = IsSleeping(_a);
+		const bool sleepB = IsSleeping(_b);
+		return (sleepA || sleepB) && (sleepA || isFixed(_a, _colA)) && (sleepB || isFixed(_b, _colB));
+	}
+
+	/**
+	 * @brief Ė点 / N
+	 *	- Iȕ̂ڐGłȂœɂ(ÓIȕ̂͂ȂȂ)
+	 *	- ̑S sleep_time_ ̊Ԏ~܂葱ĂAƖ点
+	 *	- Ă镨̂NĂ镨̂ƐڐGAƋN(̂ȂŁÂNƋN)
+	 *	- Ll}eBbNȂǊO瓮镨ɐGĂ铇 / eł̂蔲ς͖点Ȃ(ĂN)
+	 *	Transform̏(ColliderSyncSystem)Ax / ͂^ꂽ(IntegrationSystem)͈̂NA
+	 *	̃XebvłœƋN
+	 * @param _fixedDt ŒXebv
+	 */
+	void CollisionResolveSystem::UpdateSleep(float _fixedDt)
+	{
+		constexpr uint32_t NONE = UINT32_MAX;
+
+		// ---------- Iȕ̂ɔԍUA~܂Ă鎞Ԃ𐔂 ---------- //
+		sleep_bodies_.clear();
+		const float linearSq = sleep_linear_threshold_ * sleep_linear_threshold_;
+		const float angularSq = sleep_angular_threshold_ * sleep_angular_threshold_;
+		for (const Entity e : body_query_->View()) {
+			auto col = ecs_.GetComponent<Collider>(e);
+			auto rb = ecs_.GetComponent<Rigidbody>(e);
+			if (rb->isStatic || rb->isKinematic || col->isStatic) { continue; }
+
+			if (e.Index() >= sleep_body_slot_.size()) { sleep_body_slot_.resize(e.Index() + 1, NONE); }
+			sleep_body_slot_[e.Index()] = static_cast<uint32_t>(sleep_bodies_.size());
+			sleep_bodies_.push_back({ e, rb });
+
+			if (rb->isSleeping) { continue; }
+			const bool still = math::LengthSq(rb->linearVelocity) <= linearSq && math::LengthSq(rb->angularVelocity) <= angularSq;
+			rb->sleepTimer = still ? rb->sleepTimer + _fixedDt : 0.0f;
+		}
+		auto slotOf = [&](Entity _e) {
+			if (_e.Index() >= sleep_body_slot_.size()) { return NONE; }
+			const uint32_t slot = sleep_body_slot_[_e.Index()];
+			return (slot < sleep_bodies_.size() && sleep_bodies_[slot].e == _e) ? slot : NONE;
+		};
+		// IłȂÎ~Ă邩(ÓIColliderAÓIRigidbody)
+		auto isFixed = [&](Entity _e) {
+			if (ecs_.GetComponent<Collider>(_e)->isStatic) { return true; }
+			return ecs_.HasComponent<Rigidbody>(_e) && ecs_.GetComponent<Rigidbody>(_e)->isStatic;
+		};
+
+		// ---------- ڐGłȂ ---------- //
+		const uint32_t bodyCount = static_cast<uint32_t>(sleep_bodies_.size());
+		island_builder_.Reset(bodyCount);
+		keep_awake_.assign(bodyCount, sleep_enabled_ ? 0 : 1);
+		for (const auto& rec : contacts_) {
+			const uint32_t a = slotOf(rec.a);
+			const uint32_t b = slotOf(rec.b);
+			if (a == NONE && b == NONE) { continue; }
+
+			// ĂԂɉeł̂蔲ςN
+			if (rec.sleeping && rec.shadowSkiped != rec.sleepShadowSkiped) {
+				if (a != NONE) { keep_awake_[a] = 1; }
+				if (b != NONE) { keep_awake_[b] = 1; }
+			}
+			// 蔲ĂyA͐GĂȂ̂ƂĈ
+			if (rec.shadowSkiped) { continue; }
+
+			if (a != NONE && b != NONE) {
+				island_builder_.Union(a, b);
+			}
+			else if (a != NONE && !isFixed(rec.b)) {
+				keep_awake_[a] = 1;
+			}
+			else if (b != NONE && !isFixed(rec.a)) {
+				keep_awake_[b] = 1;
+			}
+		}
+		// ÕXebvŖĂ̂ȂBN̂̐ڐG̓i[tF[YŎ蒼Ă邪A
+		// Ă(ђʂ)ƌȂ̂ŁAłȂœƋN
+		for (const auto& rec : sleeping_contacts_) {
+			if (rec.sleepShadowSkiped) { continue; }
+			const uint32_t a = slotOf(rec.a);
+			const uint32_t b = slotOf(rec.b);
+			if (a != NONE && b != NONE) { island_builder_.Union(a, b); }
+		}
+		island_builder_.Build();
+
+		// ---------- Ƃɖ点 / N ---------- //
+		active_body_count_ = 0;
+		sleeping_body_count_ = 0;
+		island_count_ = island_builder_.GetIslandCount();
+		for (uint32_t i = 0; i < island_count_; ++i) {
+			const auto island = island_builder_.GetIsland(i);
+			bool anyAwake = false;
+			bool anySleeping = false;
+			bool ready = true;		// S~܂葱Ă
+			bool keepAwake = false;
+			for (const uint32_t slot : island) {
+				const Rigidbody* rb = sleep_bodies_[slot].rb;
+				if (rb->isSleeping) { anySleeping = true; }
+				else {
+					anyAwake = true;
+					if (rb->sleepTimer < sleep_time_) { ready = false; }
+				}
+				if (keep_awake_[slot]) { keepAwake = true; }
+			}
+
+			// NĂ镨̂ƐGꂽ / 点Ȃ́ASN
+			if (anySleeping && (anyAwake || keepAwake)) {
+				for (const uint32_t slot : island) {
+					if (sleep_bodies_[slot].rb->isSleeping) { sleep_bodies_[slot].rb->WakeUp(); }
+				}
+				active_body_count_ += static_cast<uint32_t>(island.size());
+				continue;
+			}
+			// S~܂葱Ă疰点
+			if (!anySleeping && ready && !keepAwake) {
+				for (const uint32_t slot : island) {
+					const auto& body = sleep_bodies_[slot];
+					const auto tf = ecs_.GetComponent<Transform>(body.e);
+					body.rb->isSleeping = true;
+					body.rb->linearVelocity = { 0.0f, 0.0f, 0.0f };
+					body.rb->angularVelocity = { 0.0f, 0.0f, 0.0f };
+					body.rb->sleepPosition = tf->position;
+					body.rb->sleepRotation = tf->rotationQuat;
+					body.rb->sleepScale = tf->scale;
+				}
+				anySleeping = true;
+			}
+
+			if (anySleeping) { sleeping_body_count_ += static_cast<uint32_t>(island.size()); }
+			else { active_body_count_ += static_cast<uint32_t>(island.size()); }
+		}
+
+		// ---------- Ă铇̐ڐGĂ ---------- //
+		sleeping_contacts_.clear();
+		for (const auto& rec : contacts_) {
+			if (!IsAtRestPair(rec.a, ecs_.GetComponent<Collider>(rec.a), rec.b, ecs_.GetComponent<Collider>(rec.b))) { continue; }
+			auto& cached = sleeping_contacts_.emplace_back(rec);
+			cached.sleeping = true;
+			cached.sleepShadowSkiped = rec.shadowSkiped;
+			cached.shadowSkiped = false;
+			cached.samplePoints.clear();
+		}
+	}
+
+
+	//! @brief fobO\
+	void CollisionResolveSystem::DrawDebugUI()
+	{
+		if (ImGui::Begin("Contact Solver")) {
+			int iterations = static_cast<int>(solver_settings_.iterations);
+			if (ImGui::SliderInt("Iterations", &iterations, 1, 32)) {
+				solver_settings_.iterations = static_cast<uint32_t>(iterations);
+			}
+			int positionIterations = static_cast<int>(solver_settings_.positionIterations);
+			if (ImGui::SliderInt("Position Iterations", &positionIterations, 0, 16)) {
+				solver_settings_.positionIterations = static_cast<uint32_t>(positionIterations);
+			}
+			ImGui::Checkbox("Warm Start", &solver_settings_.warmStart);
+			ImGui::SliderFloat("Baumgarte", &solver_settings_.baumgarte, 0.0f, 1.0f);
+			ImGui::SliderFloat("Slop", &solver_settings_.slop, 0.0f, 0.05f);
+
+			const auto& stats = solver_.GetLastStats();
+			ImGui::Separator();
+			ImGui::Text("Manifolds: %u / Points: %u", stats.manifoldCount, stats.pointCount);
+			ImGui::Text("Warm Started Points: %u / %u", manifold_cache_.GetMatchedPointCount(), manifold_cache_.GetPointCount());
+			ImGui::Text("Last Impulse Delta: %.5f", stats.lastImpulseDelta);
+			ImGui::Text("Narrow Phase Pairs: %u batched box-box (Lanes: %u) / %u scalar", narrow_phase_.GetCount(), collision::NarrowPhaseBatch::GetLaneWidth(),
+				static_cast<uint32_t>(narrow_pairs_.size()) - narrow_phase_.GetCount());
+
+			ImGui::Separator();
+			ImGui::Checkbox("Sleep", &sleep_enabled_);
+			ImGui::SliderFloat("Sleep Linear Threshold", &sleep_linear_threshold_, 0.0f, 0.5f);
+			ImGui::SliderFloat("Sleep Angular Threshold", &sleep_angular_threshold_, 0.0f, 0.5f);
+			ImGui::SliderFloat("Time To Sleep", &sleep_time_, 0.0f, 2.0f);
+			ImGui::Text("Bodies: %u active / %u sleeping (Islands: %u)", active_body_count_, sleeping_body_count_, island_count_);
+			ImGui::Text("Sleeping Contacts: %u", static_cast<uint32_t>(sleeping_contacts_.size()));
+		}
+		ImGui::End();
+	}
+
 } // namespace ecs
@@ -7,23 +7,37 @@
 
  // ---------- CN[h ---------- // 
 #include <vector>
+#include <optional>
 #include <unordered_set>
+#include <unordered_map>
 #include <DirectXMath.h>
 #include <Game/ECS/ISystem.h>
 #include <DX3D/Core/Common.h>
 
 #include <Game/Collisions/CollisionUtils.h>
+#include <Game/Collisions/ContactManifold.h>
+#include <Game/Collisions/ContactSolver.h>
+#include <Game/Collisions/NarrowPhaseBatch.h>
+#include <Game/Collisions/IslandBuilder.h>
 
 
 namespace ecs {
 	struct Transform;
 	struct Collider;
+	struct Rigidbody;
 	class ShadowTestSystem;
+	class ColliderSyncSystem;
+	class Query;
 
 	/**
 	 * @brief Փˎ̉oVXe
 	 * @details
 	 * - Signature: Transform, Collider
+	 * - ׂyAColliderSyncSystem󂯎(Iȕm̃u[htF[Y + ÓIBVHBÓIȕm͗Ȃ)
+	 * - IRigidbodyރyÁAXebv܂ŕێ}jtH[hƔ\o[őx
+	 * - ȊÕyA͏]ʂʒủos
+	 * - ڐGłȂIȕ̂𓇂ɂ܂Ƃ߁AƎ~܂葱疰点B
+	 *   Ă镨̓m / ÓIȕ̂Ƃ̃yA̓i[tF[YA̐ڐGg
 	 */
 	class CollisionResolveSystem : public ISystem
 	{
@@ -35,6 +49,10 @@ namespace ecs {
 			collision::ContactResult contact;
 			std::vector<DirectX::XMFLOAT3> samplePoints;
 			bool shadowSkiped = false; // eŃXLbvꂽ
+			collision::ContactPointInput points[collision::MAX_MANIFOLD_POINTS]{};	// ڐG_(m̓NbsOōő4_)
+			uint32_t pointCount = 0;
+			bool sleeping = false;				// Ă铇̐ڐG(̌ʂg񂵂Ă)
+			bool sleepShadowSkiped = false;		// ̉ě(ςN)
 		};
 
 		explicit CollisionResolveSystem(const SystemDesc& _desc);
@@ -47,7 +65,23 @@ namespace ecs {
 
 		// Փ˃Xg擾
 		const std::vector<ContactRecord>& GetContacts() const { return contacts_; }
+
+		//! @brief ڐG\o[̐ݒ
+		collision::ContactSolverSettings& GetSolverSettings() { return solver_settings_; }
+		const collision::ContactManifoldCache& GetManifoldCache() const { return manifold_cache_; }
+		const collision::ContactSolverStats& GetSolverStats() const { return solver_.GetLastStats(); }
+
+		//! @brief 点邩ǂ(falseɂƎ̃XebvőSN)
+		void SetSleepEnabled(bool _enabled) { sleep_enabled_ = _enabled; }
+		uint32_t GetActiveBodyCount() const { return active_body_count_; }		// NĂ铮Iȕ̂̐
+		uint32_t GetSleepingBodyCount() const { return sleeping_body_count_; }	// Ă镨̂̐
 	private:
+		uint32_t GetSolverBody(Entity _e, Rigidbody* _rb);	// \o[̂̔̕ԍ(Ȃ΍)
+		bool IsSleeping(Entity _e);
+		bool IsAtRestPair(Entity _a, const Collider* _colA, Entity _b, const Collider* _colB);	// i[tF[Y΂yA
+		void UpdateSleep(float _fixedDt);	// Ė点 / N
+		void DrawDebugUI();
+
 		using EntityPair = std::pair<Entity, Entity>;
 		struct EntityPairHash {
 			std::size_t operator()(const EntityPair& _p) const {
@@ -56,9 +90,49 @@ namespace ecs {
 		};
 
 		std::weak_ptr<ShadowTestSystem> shadow_test_system_{};
+		std::weak_ptr<ColliderSyncSystem> collider_sync_system_{};	// u[htF[Y̎
+		std::vector<EntityPair> candidate_pairs_{};	// u[htF[YŏdȂyA(Ɨp)
+
+		// i[tF[Y
+		struct NarrowPhasePair {
+			Entity a;
+			Entity b;
+			uint32_t index = 0;	// narrow_phase_̌ʂ̔ԍ(ރyA͂̏Ŕ肷̂ŎgȂ)
+			std::optional<collision::ContactResult> scalar{};	// ̏Ŕ肵
+		};
+		collision::NarrowPhaseBatch narrow_phase_{};
+		std::vector<NarrowPhasePair> narrow_pairs_{};	// ς񂾏̃yA(Ɨp)
 		std::vector<ContactRecord> contacts_; // Փ˃Xg
 		std::unordered_set<std::pair<Entity, Entity>, EntityPairHash> shadow_skip_pairs_{}; // eŏՓˉXLbvyAW
 
+		// ڐG\o[
+		collision::ContactManifoldCache manifold_cache_{};
+		collision::ContactSolver solver_{};
+		collision::ContactSolverSettings solver_settings_{};
+		std::vector<collision::SolverBody> solver_bodies_{};	// 0Ԃ͐ÓIȕ(L)
+		std::vector<Entity> solver_entities_{};					// solver_bodies_Ɠ(߂)
+		std::vector<Rigidbody*> solver_rigidbodies_{};
+		std::unordered_map<Entity, uint32_t> solver_body_index_{};
+
+		// X[v
+		struct SleepBody {
+			Entity e;
+			Rigidbody* rb;
+		};
+		const Query* body_query_ = nullptr;	// Collider + Rigidbody
+		collision::IslandBuilder island_builder_{};
+		std::vector<SleepBody> sleep_bodies_{};		// island_builder_̔ԍ  (IȂ̂)
+		std::vector<uint32_t> sleep_body_slot_{};		// Entity̔ԍ  island_builder_̔ԍ(ÂlĉŁAgEntityׂ)
+		std::vector<uint8_t> keep_awake_{};			// island_builder_̔ԍBĂ镨ɐGĂ / e̔肪ς̂Ŗ点Ȃ
+		std::vector<ContactRecord> sleeping_contacts_{};	// Ă铇̐ڐG(̃XebvŎg)
+		bool sleep_enabled_ = true;
+		float sleep_linear_threshold_ = 0.05f;	// xΎ~܂ĂƂ݂Ȃ(m/s)
+		float sleep_angular_threshold_ = 0.05f;	// (rad/s)
+		float sleep_time_ = 0.5f;				// ~܂葱疰点܂ł̎(b)
+		uint32_t active_body_count_ = 0;
+		uint32_t sleeping_body_count_ = 0;
+		uint32_t island_count_ = 0;
+
 		float solve_percent_ = 2.0f; // 
 		float solve_slop_ = 0.01f;   // ђʂ𖳎臒l
 		bool shadow_collision_enabled_ = true;	// eł̏ՓˉLɂ邩
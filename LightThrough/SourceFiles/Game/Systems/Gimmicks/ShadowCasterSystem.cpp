@@ -0,0 +1,241 @@
+/**
+ * @file ShadowCasterSystem.cpp
+ * @brief CgƂɉe𗎂Ƃ`IԃVXe
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cmath>
+#include <algorithm>
+#include <unordered_map>
+#include <Game/Systems/Gimmicks/ShadowCasterSystem.h>
+
+#include <DX3D/Graphics/Meshes/MeshRegistry.h>
+#include <DX3D/Graphics/Meshes/Mesh.h>
+#include <Game/ECS/Coordinator.h>
+
+#include <Game/Components/Core/Transform.h>
+#include <Game/Components/Render/MeshRenderer.h>
+#include <Game/Components/Render/Light.h>
+
+#include <Debug/Debug.h>
+#include <Debug/DebugUI.h>
+
+
+namespace ecs
+{
+	/**
+	 * @brief RXgN^
+	 */
+	ShadowCasterSystem::ShadowCasterSystem(const SystemDesc& _desc)
+		: ISystem(_desc)
+		, mesh_registry_(_desc.meshRegistry)
+	{
+	}
+
+	void ShadowCasterSystem::Init()
+	{
+		// K{R|[lg
+		Signature signature;
+		signature.set(ecs_.GetComponentType<Transform>());
+		signature.set(ecs_.GetComponentType<MeshRenderer>());
+		// 2025-11-26 todo: shadowCasterComponentƂǉĂ悢B
+		ecs_.SetSystemSignature<ShadowCasterSystem>(signature);
+		light_query_ = &ecs_.GetQuery<LightCommon>();
+
+		// fobOUIo^
+#if defined(DEBUG) || defined(_DEBUG)
+		debug::DebugUI::ResistDebugFunction([this]()
+			{
+				if (ImGui::Begin("Shadow Caster Culling")) {
+					ImGui::Checkbox("Caster Culling", &caster_culling_);
+					ImGui::Text("Lights: %zu", shadow_lights_.size());
+					ImGui::Text("Drawn: %llu / Culled: %llu",
+						static_cast<unsigned long long>(GetDrawnCasterCount()), static_cast<unsigned long long>(GetCulledCasterCount()));
+				}
+				ImGui::End();
+			}
+		);
+#endif
+	}
+
+
+	//! @brief XV
+	void ShadowCasterSystem::Update(float _dt)
+	{
+		// ob`
+		shadow_batches_.clear();	// ob`NA
+		CollectBatches();			// ob`W
+
+		// CgsƔ͈͂̌vZ(SCg𑵂ĂACgƂɕ``I)
+		CollectLights();
+		CullCasters();
+	}
+
+	//! @brief GeBeBj̏
+	void ShadowCasterSystem::OnEntityDestroyed(Entity _e)
+	{
+		// ShadowLightEntry폜
+		auto it = std::remove_if(shadow_lights_.begin(), shadow_lights_.end(),
+			[_e](const ShadowLightEntry& entry) {
+				return entry.light == _e;
+			});
+
+		if (it != shadow_lights_.end()) {
+			shadow_lights_.erase(it, shadow_lights_.end());
+		}
+	}
+
+
+	/**
+	 * @brief ob`W
+	 *
+	 * Mesh܂Ƃ߂ăob`(Null̃obNGhł͒_obt@̂ŁAobt@ł͂ȂMeshŕ)
+	 * CX^Xf[^͊eEntityTransform烏[hs擾Ċi[
+	 */
+	void ShadowCasterSystem::CollectBatches()
+	{
+		std::unordered_map<const dx3d::Mesh*, size_t> map;
+
+		// Entityꗗ𑖍ăob`
+		for (auto& e : entities_) {
+			auto mesh = ecs_.GetComponent<MeshRenderer>(e);
+			auto tf = ecs_.GetComponent<Transform>(e);
+
+			auto meshData = mesh_registry_.Get(mesh->handle);
+
+			if (!meshData) continue;
+
+			size_t batchIndex{};
+			// ̃ob`
+			if (auto it = map.find(meshData); it != map.end()) {
+				batchIndex = it->second;
+			}
+			// Vob`
+			else {
+				batchIndex = shadow_batches_.size();
+				map.emplace(meshData, batchIndex);
+				shadow_batches_.push_back(InstanceBatchShadow{
+					.vb = meshData->vb,
+					.ib = meshData->ib,
+					.indexCount = meshData->indexCount,
+					.instances = {},
+					.mesh = meshData
+					});
+			}
+
+			// CX^Xf[^ǉ
+			dx3d::InstanceDataShadow ds{};
+			ds.world = tf->world;
+			shadow_batches_[batchIndex].instances.emplace_back(ds);
+		}
+	}
+
+	/**
+	 * @brief CgsƔ͈͂̌vZ
+	 *	s͐ˉe̔AX|bgCg͎Ɖ~(̊p̕)
+	 */
+	void ShadowCasterSystem::CollectLights()
+	{
+		// todo: V[[hɑSystemAshadow_lights_clearshadow_lights_ɃANZXăNbV肪
+		shadow_lights_.clear();
+		light_volumes_.clear();
+
+		int32_t shadowIndex = 0;
+		for (auto& e : *light_query_) {
+			if (shadowIndex >= static_cast<int32_t>(MAX_SHADOW_LIGHTS)) { break; }
+
+			auto common = ecs_.GetComponent<LightCommon>(e);
+			if (!common->enabled) { continue; }
+			auto tf = ecs_.GetComponent<Transform>(e);
+			SpotLight* spot = nullptr;
+			if (ecs_.HasComponent<SpotLight>(e)) {
+				spot = ecs_.GetComponent<SpotLight>(e);
+			}
+
+			LightViewProj vp = BuildLightViewProj(tf, spot);
+
+			// ̊i[
+			auto lightViewProj = vp.view * vp.proj;
+			XMFLOAT4X4 lightVPFloat;
+			XMStoreFloat4x4(&lightVPFloat, lightViewProj);
+			shadow_lights_.push_back({ e, lightVPFloat, shadowIndex });
+
+			LightVolume volume{ .frustum = dx3d::culling::ExtractFrustumPlanes(&lightVPFloat._11) };
+			if (spot && spot->outerCos > 0.0f) {
+				const XMFLOAT3 pos = tf->GetWorldPosition();
+				const XMFLOAT3 forward = tf->GetWorldForwardCached();
+				XMFLOAT3 dir{};
+				XMStoreFloat3(&dir, XMVector3Normalize(XMLoadFloat3(&forward)));
+				const float cosHalf = (std::min)(spot->outerCos, 1.0f);
+				volume.cone = {
+					.apex = { pos.x, pos.y, pos.z },
+					.direction = { dir.x, dir.y, dir.z },
+					.cosHalfAngle = cosHalf,
+					.sinHalfAngle = std::sqrt(1.0f - cosHalf * cosHalf),
+					.range = (std::max)(1.0f, spot->range),	// BuildLightViewProjfarƓ
+				};
+				volume.hasCone = true;
+			}
+			light_volumes_.push_back(volume);
+
+			++shadowIndex;
+		}
+	}
+
+	/**
+	 * @brief CgƂɉe𗎂Ƃ`I
+	 *
+	 * Sob`̃CX^Xx[h͈̔͂ɂĂACg͈̔( / ~)Ƃɔ肵A
+	 * ͈͂ɓ̂CgEob`light_instances_֋l߂B[xpX̓CgƂɂ͈̔͂`B
+	 */
+	void ShadowCasterSystem::CullCasters()
+	{
+		light_instances_.clear();
+		light_draws_.clear();
+		light_draw_begin_.assign(1, 0);
+		drawn_caster_count_ = 0;
+		culled_caster_count_ = 0;
+
+		size_t totalInstance = 0;
+		for (auto& b : shadow_batches_) {
+			totalInstance += b.instances.size();
+		}
+
+		// ob`ɃCX^Xς
+		caster_culler_.Begin(totalInstance);
+		for (auto& b : shadow_batches_) {
+			const bool bounded = caster_culling_ && b.mesh && b.mesh->bounds.valid;
+			for (auto& inst : b.instances) {
+				if (!bounded) {
+					caster_culler_.AddUnbounded();
+					continue;
+				}
+				const auto& bounds = b.mesh->bounds;
+				caster_culler_.Add(&bounds.center.x, &bounds.extents.x, bounds.radius, &inst.world._11);
+			}
+		}
+
+		for (auto& volume : light_volumes_) {
+			caster_culler_.Cull(volume.frustum, volume.hasCone ? &volume.cone : nullptr);
+			culled_caster_count_ += caster_culler_.GetCulledCount();
+
+			// ͈͂ɓCX^Xob`Ƃɋl߂
+			uint32_t cullIndex = 0;
+			for (uint32_t batchIndex = 0; batchIndex < shadow_batches_.size(); ++batchIndex) {
+				const auto& b = shadow_batches_[batchIndex];
+				const uint32_t first = static_cast<uint32_t>(light_instances_.size());
+				for (auto& inst : b.instances) {
+					if (caster_culler_.IsVisible(cullIndex++)) { light_instances_.push_back(inst); }
+				}
+				const uint32_t count = static_cast<uint32_t>(light_instances_.size()) - first;
+				if (count > 0) {
+					light_draws_.push_back({ .batchIndex = batchIndex, .firstInstance = first, .instanceCount = count });
+				}
+			}
+			light_draw_begin_.push_back(static_cast<uint32_t>(light_draws_.size()));
+		}
+		drawn_caster_count_ = light_instances_.size();
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+/**
+ * @file ShadowCasterSystem.h
+ * @brief CgƂɉe𗎂Ƃ`IԃVXe
+ * @author Arima Keita
+ * @date 2026-10-16
+ */
+
+ // ---------- CN[h ---------- //
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+#include <DX3D/Core/Core.h>
+#include <DX3D/Graphics/Buffers/InstanceData.h>
+#include <Game/Culling/FrustumCuller.h>
+#include <Game/ECS/ISystem.h>
+
+// ---------- O錾 ---------- //
+namespace dx3d {
+	class MeshRegistry;
+	struct Mesh;
+}
+
+namespace ecs {
+	class Query;
+
+	//! @brief CX^X`pob`\
+	// shadowPass
+	struct InstanceBatchShadow {
+		dx3d::VertexBufferPtr vb{};
+		dx3d::IndexBufferPtr ib{};
+		uint32_t indexCount{};
+		std::vector<dx3d::InstanceDataShadow> instances{};
+		const dx3d::Mesh* mesh{};	// CPǓ`(eCPUp)
+	};
+
+	//! @brief CgƂ̃VhEGg
+	struct ShadowLightEntry {
+		ecs::Entity light;
+		DirectX::XMFLOAT4X4 lightViewProj;
+		int32_t sliceIndex = -1;
+	};
+
+	//! @brief Cg̕`͈(ob`̂Cg͈̔͂ɓCX^X)
+	struct ShadowDrawRange {
+		uint32_t batchIndex = 0;		// shadow_batches_̔ԍ
+		uint32_t firstInstance = 0;		// light_instances_̐擪
+		uint32_t instanceCount = 0;
+	};
+
+	/**
+	 * @brief e𗎂Ƃ`ƃCgs܂Ƃ߂VXe
+	 *
+	 * GPUɐGȂ̂ŁA[xpX(LightDepthRenderSystem)wbhXsłB
+	 * [xpXƉe(ShadowTestSystem)͂ő̂gB
+	 *
+	 * @detail K{G<Transform>, <MeshRenderer>
+	 */
+	class ShadowCasterSystem : public ISystem {
+	public:
+		static constexpr uint32_t MAX_SHADOW_LIGHTS = 16;
+		static constexpr uint32_t SHADOW_MAP_WIDTH = 2048;
+		static constexpr uint32_t SHADOW_MAP_HEIGHT = 2048;
+
+		explicit ShadowCasterSystem(const SystemDesc& _desc);
+		//! @brief 
+		void Init() override;
+		//! @brief XV
+		void Update(float _dt) override;
+		/**
+		 * @brief GeBeBj
+		 * @param _e jꂽGeBeB
+		 */
+		void OnEntityDestroyed(Entity _e) override;
+
+		uint32_t GetShadowMapWidth() const { return SHADOW_MAP_WIDTH; }
+		uint32_t GetShadowMapHeight() const { return SHADOW_MAP_HEIGHT; }
+
+		//! @brief CgGeBeB̃VhE擾
+		std::vector<ShadowLightEntry> GetShadowLights() const { return shadow_lights_; }
+		//! @brief ߂̃t[ŏW߂ob`(e𗎂Ƃ`)
+		const std::vector<InstanceBatchShadow>& GetShadowBatches() const { return shadow_batches_; }
+		//! @brief Cgɋl߂CX^X
+		const std::vector<dx3d::InstanceDataShadow>& GetLightInstances() const { return light_instances_; }
+		//! @brief CgƂ̕`͈(CgiGetLightDraws()[begin[i]] ` [begin[i + 1]])
+		const std::vector<ShadowDrawRange>& GetLightDraws() const { return light_draws_; }
+		const std::vector<uint32_t>& GetLightDrawBegin() const { return light_draw_begin_; }
+
+		uint64_t GetDrawnCasterCount() const { return drawn_caster_count_; }	// ߂̃t[Ő[xpXɕ`CX^X̐(SCg̍v)
+		uint64_t GetCulledCasterCount() const { return culled_caster_count_; }	// ߂̃t[ŃCg͈̔͂̊OCX^X̐(SCg̍v)
+	private:
+		//! @brief ob`W
+		void CollectBatches();
+		//! @brief CgsƔ͈͂̌vZ
+		void CollectLights();
+		//! @brief CgƂɉe𗎂Ƃ`I
+		void CullCasters();
+
+	private:
+		dx3d::MeshRegistry& mesh_registry_;
+
+		std::vector<InstanceBatchShadow> shadow_batches_{}; // VhEpX̃ob`
+
+		//! @brief Cg͈̔(shadow_lights_Ɠ)
+		struct LightVolume {
+			dx3d::culling::FrustumPlanes frustum{};
+			dx3d::culling::ConeBounds cone{};
+			bool hasCone = false;	// X|bgCg~ł肷
+		};
+		std::vector<LightVolume> light_volumes_{};
+
+		// CgƂ̕`͈(Cgilight_draws_[light_draw_begin_[i]] ` [light_draw_begin_[i + 1]])
+		dx3d::culling::FrustumCuller caster_culler_{};
+		std::vector<dx3d::InstanceDataShadow> light_instances_{};	// Cgɋl߂CX^X
+		std::vector<ShadowDrawRange> light_draws_{};
+		std::vector<uint32_t> light_draw_begin_{};
+		bool caster_culling_ = true;	// false: SCgɑS`(rp)
+		uint64_t drawn_caster_count_ = 0;
+		uint64_t culled_caster_count_ = 0;
+
+		// CgƂ̃VhE
+		std::vector<ShadowLightEntry> shadow_lights_;
+		const Query* light_query_ = nullptr;	// LightCommoñNG
+	};
+}
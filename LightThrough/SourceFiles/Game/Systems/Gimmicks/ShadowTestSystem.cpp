@@ -5,14 +5,13 @@
 
  // ---------- CN[h ---------- // 
 #include <vector>
+#include <cstring>
 #include <Game/Systems/Gimmicks/ShadowTestSystem.h>
 
-#include <DX3D/Graphics/GraphicsEngine.h>
-#include <DX3D/Graphics/GraphicsDevice.h>
-#include <DX3D/Graphics/Buffers/ConstantBuffer.h>
+#include <DX3D/Graphics/Meshes/Mesh.h>
 
 #include <Game/ECS/Coordinator.h>
-#include <Game/Systems/Renderers/LightDepthRenderSystem.h>
+#include <Game/Systems/Gimmicks/ShadowCasterSystem.h>
 #include <Game/Components/Core/Transform.h>
 #include <Game/Components/Render/Light.h>
 #include <Game/Components/Physics/Collider.h>
@@ -21,7 +20,6 @@
 
 #include <Debug/Debug.h>
 #include <Debug/DebugUI.h>
-#include <Game/Systems/Renderers/DebugRenderSystem.h>
 
 
 namespace ecs {
@@ -29,6 +27,8 @@ namespace ecs {
 	//! @brief RXgN^
 	ShadowTestSystem::ShadowTestSystem(const SystemDesc& _desc)
 		:ISystem(_desc)
+		, job_system_(_desc.jobSystem)
+		, backend_(_desc.shadowTestBackend)
 	{
 	}
 
@@ -41,17 +41,30 @@ namespace ecs {
 		signature.set(ecs_.GetComponentType<LightCommon>());
 		ecs_.SetSystemSignature<ShadowTestSystem>(signature);
 
-		// Rs[gp\[X쐬
-		CreateComputeResources();
+		caster_system_ = ecs_.GetSystem<ShadowCasterSystem>();
 
-		light_depth_system_ = ecs_.GetSystem<LightDepthRenderSystem>();
-		debug_render_system_ = ecs_.GetSystem<DebugRenderSystem>();
+		// GPUł̔肪CPUŔ肷(wbhXsȂ)
+		if (backend_ == dx3d::ShadowTestBackend::Gpu && !gpu_test_) {
+			DebugLogWarning("[ShadowTestSystem] GPUł̉e肪o^ĂȂ̂CPUŔ肷");
+			backend_ = dx3d::ShadowTestBackend::Cpu;
+		}
+		if (backend_ == dx3d::ShadowTestBackend::Cpu) {
+			// [xpXƓ𑜓xŕ`
+			dx3d::shadow::ShadowRasterDesc rasterDesc{};
+			rasterDesc.width = ShadowCasterSystem::SHADOW_MAP_WIDTH;
+			rasterDesc.height = ShadowCasterSystem::SHADOW_MAP_HEIGHT;
+			software_tester_ = std::make_unique<dx3d::shadow::SoftwareShadowTester>(rasterDesc);
+		}
 
 		// fobOUIo^
 #if defined(DEBUG) || defined(_DEBUG)
 		debug::DebugUI::ResistDebugFunction([this]()
 			{
 				if (ImGui::Begin("Shadow Test Debug")) {
+					ImGui::Text("Backend: %s", backend_ == dx3d::ShadowTestBackend::Cpu ? "CPU" : "GPU");
+					if (software_tester_) {
+						ImGui::Text("Rasterized Texels: %llu", static_cast<unsigned long long>(software_tester_->GetLastRasterizedTexels()));
+					}
 					ImGui::Checkbox("Show Test Points", &show_debug_points_);
 					ImGui::Text("Test Points Count: %zu", debug_test_points_.size());
 
@@ -74,26 +87,7 @@ namespace ecs {
 	void ShadowTestSystem::Update(float _dt)
 	{
 #if defined(DEBUG) || defined(_DEBUG)
-
 		DebugCheckSliceIndex();
-
-		// fobO\
-		if (show_debug_points_) {
-			auto debugRenderSystem = debug_render_system_.lock();
-			if (debugRenderSystem) {
-				constexpr float POINT_SIZE = 0.05f;
-				constexpr DirectX::XMFLOAT4 LIGHT_COLOR = { 0.0f, 1.0f, 0.0f, 1.0f };  // ΁i̒j
-				constexpr DirectX::XMFLOAT4 SHADOW_COLOR = { 1.0f, 0.0f, 0.0f, 1.0f }; // ԁie̒j
-
-				for (const auto& point : debug_test_points_) {
-					debugRenderSystem->DrawPoint(
-						point.position,
-						point.isInShadow ? SHADOW_COLOR : LIGHT_COLOR,
-						POINT_SIZE
-					);
-				}
-			}
-		}
 #endif
 	}
 
@@ -152,24 +146,10 @@ namespace ecs {
 		return false;
 	}
 
-	//! @brief Rs[gp\[X쐬
-	void ShadowTestSystem::CreateComputeResources()
-	{
-		auto& device = engine_.GetGraphicsDevice();
-		// 萔obt@
-		cb_params_ = device.CreateConstantBuffer({ sizeof(CSParams), nullptr });
-		// ̓|Cgp
-		point_buffer_ = device.CreateStructuredBuffer({ sizeof(XMFLOAT3), MAX_TEST_POINTS, nullptr });
-		// o̓tOp
-		result_buffer_ = device.CreateRWStructuredBuffer({ sizeof(uint32_t), MAX_TEST_POINTS });
-		// ǂݖ߂p
-		staging_buffer_ = device.CreateStagingBuffer({ sizeof(uint32_t), MAX_TEST_POINTS });
-	}
-
 	//! @brief e̎s
 	void ShadowTestSystem::ExecuteShadowTests()
 	{
-		auto lightDepthSystem = light_depth_system_.lock();
+		auto casterSystem = caster_system_.lock();
 
 		// Փ˂Ȃꍇ͑Ot[̌ʂێ
 		if (pending_tests_.empty()) {
@@ -204,15 +184,8 @@ namespace ecs {
 			return;
 		}
 
-		auto& device = engine_.GetGraphicsDevice();
-		auto* immediateContext = engine_.GetImmediateContext();
-
-		// ComputeShader擾
-		auto& shaderCache = engine_.GetShaderCache();
-		auto& csEntry = shaderCache.GetCS(dx3d::ComputeShaderKind::ShadowTest);
-
 		// ڐG_eXg|CgƂĎgp
-		std::vector<DirectX::XMFLOAT3> testPoints = pending_contact_points_;
+		const std::vector<DirectX::XMFLOAT3>& testPoints = pending_contact_points_;
 
 		if (testPoints.empty()) {
 #if defined(DEBUG) || defined(_DEBUG)
@@ -223,147 +196,81 @@ namespace ecs {
 			return;
 		}
 
-		// |Cgobt@̍XV
-		point_buffer_->Update(testPoints.data(), sizeof(DirectX::XMFLOAT3) * testPoints.size());
 		// 
-		// memo: falseŏBCŠʂȂtrueŏ㏑B
-		std::vector<bool> isLitByAnyLight(testPoints.size(), false);
+		const auto& shadowLights = casterSystem->GetShadowLights();
+		BuildLightParams(shadowLights);
+		if (backend_ == dx3d::ShadowTestBackend::Cpu) {
+			ExecuteCpu(*casterSystem, testPoints);
+		}
+		else {
+			gpu_test_->ExecuteShadowTest(shadowLights, light_params_, testPoints, flags_);
+		}
 
-		const auto& shadowLights = lightDepthSystem->GetShadowLights();
+		// memo: falseŏBʂȂtrueŏ㏑B
+		std::vector<bool> isLitByAnyLight(testPoints.size(), false);
 		for (uint32_t i = 0; i < shadowLights.size(); ++i) {
-			const auto& entry = shadowLights[i];
-
-			// 萔obt@̍XV
-			CSParams params{};
-			params.lightViewProj = entry.lightViewProj;
-			params.numPoints = static_cast<uint32_t>(testPoints.size());
-			params.shadowWidth = lightDepthSystem->GetShadowMapWidth();
-			params.shadowHeight = lightDepthSystem->GetShadowMapHeight();
-			params.sliceIndex = entry.sliceIndex;
-			// Cg
-			auto lightTf = ecs_.GetComponent<Transform>(entry.light);
-			auto lightCommon = ecs_.GetComponent<LightCommon>(entry.light);
-			params.lightPos = lightTf->GetWorldPosition();
-			params.lightDir = lightTf->GetWorldForwardCached();
-			params.cosOuterAngle = -1.0f;
-			params.cosInnerAngle = -1.0f;
-			params.lightRange = 100000.0f;
-			// X|bgCgȂ
-			if (ecs_.HasComponent<SpotLight>(entry.light)) {
-				auto spot = ecs_.GetComponent<SpotLight>(entry.light);
-				params.cosOuterAngle = spot->outerCos;
-				params.cosInnerAngle = spot->innerCos;
-				params.lightRange = spot->range;
-			}
-			// CBXV
-			D3D11_MAPPED_SUBRESOURCE mapped{};
-			immediateContext->Map(
-				cb_params_->GetBuffer(),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mapped
-			);
-			memcpy(mapped.pData, &params, sizeof(CSParams));
-			immediateContext->Unmap(cb_params_->GetBuffer(), 0);
-
-			// \[XZbg
-			immediateContext->CSSetShader(csEntry.shader.Get(), nullptr, 0);
-			// CB
-			ID3D11Buffer* cb = cb_params_->GetBuffer();
-			immediateContext->CSSetConstantBuffers(0, 1, &cb);
-			// SRV
-			ID3D11ShaderResourceView* csSrvs[2];
-			csSrvs[0] = point_buffer_->GetSRV();
-			csSrvs[1] = lightDepthSystem->GetShadowMapSRVs();
-			immediateContext->CSSetShaderResources(0, 2, csSrvs);
-			// UAV
-			ID3D11UnorderedAccessView* uav = result_buffer_->GetUAV();
-			UINT initialCounts = 0;
-			immediateContext->CSSetUnorderedAccessViews(0, 1, &uav, &initialCounts);
-
-			// VhETv[Zbg
-			ID3D11SamplerState* samplers[] = { lightDepthSystem->GetShadowSampler() };
-			immediateContext->CSSetSamplers(0, 1, samplers);
-
-			// s
-			uint32_t groupCount = static_cast<uint32_t>(testPoints.size() + CS_THREAD_GROUP_SIZE - 1) / CS_THREAD_GROUP_SIZE;
-			immediateContext->Dispatch(groupCount, 1, 1);
-
-			// GPU҂Ă猋ʂ擾
-			immediateContext->CopyResource(staging_buffer_->GetBuffer(), result_buffer_->GetBuffer());
-			void* mappedData = staging_buffer_->Map();
-			if (mappedData) {
-
 #if defined(DEBUG) || defined(_DEBUG)
-				// fobOpJE^
-				uint32_t countLit = 0;
-				uint32_t countShadow = 0;
-				uint32_t countOutUV = 0;
-				uint32_t countOutZ = 0;
-				uint32_t countZeroW = 0;
-				uint32_t countOutRange = 0;
-				uint32_t countOutSideCone = 0;
+			// fobOpJE^
+			uint32_t countLit = 0;
+			uint32_t countShadow = 0;
+			uint32_t countOutUV = 0;
+			uint32_t countOutZ = 0;
+			uint32_t countZeroW = 0;
+			uint32_t countOutRange = 0;
+			uint32_t countOutSideCone = 0;
 #endif // DEBUG
-				// outFlags: 0 = lit, 1 = shadow, 2 = outUV, 3 = outZ, 4 = wZero, 5 = outRange, 6 = outSideCone
-				auto* flags = static_cast<const uint32_t*>(mappedData);
-				for (size_t j = 0; j < testPoints.size(); ++j)
+			using dx3d::shadow::ShadowTestFlag;
+			const ShadowTestFlag* flags = flags_.data() + static_cast<size_t>(i) * testPoints.size();
+			for (size_t j = 0; j < testPoints.size(); ++j)
+			{
+				switch (flags[j])
 				{
-					switch (flags[j])
-					{
-					case 0: // lit
+				case ShadowTestFlag::Lit:
 #if defined(DEBUG) || defined(_DEBUG)
-						++countLit;
+					++countLit;
 #endif // DEBUG
-						isLitByAnyLight[j] = true;
-						break;
+					isLitByAnyLight[j] = true;
+					break;
 #if defined(DEBUG) || defined(_DEBUG)
-					case 1: // shadow
-						++countShadow;
-						break;
-					case 2: // outUV
-						++countOutUV;
-						break;
-					case 3: // outZ
-						++countOutZ;
-						break;
-					case 4: // wZero
-						++countZeroW;
-						break;
-					case 5: // outRange
-						++countOutRange;
-						break;
-					case 6: // outSideCone
-						++countOutSideCone;
-						break;
+				case ShadowTestFlag::Shadow:
+					++countShadow;
+					break;
+				case ShadowTestFlag::OutUV:
+					++countOutUV;
+					break;
+				case ShadowTestFlag::OutZ:
+					++countOutZ;
+					break;
+				case ShadowTestFlag::ZeroW:
+					++countZeroW;
+					break;
+				case ShadowTestFlag::OutRange:
+					++countOutRange;
+					break;
+				case ShadowTestFlag::OutSideCone:
+					++countOutSideCone;
+					break;
 #endif // DEBUG
-					default:
-						break;
-					}
+				default:
+					break;
 				}
-				staging_buffer_->Unmap();
+			}
 
 #if defined(DEBUG) || defined(_DEBUG)
 
-				//DebugLogInfo("[ShadowTestSystem] Light Entity {}: lit={}, shadow={}, outUV={}, outZ={}, zeroW={}, outRange={}, outSideCone={}",
-				//	entry.light.id_,
-				//	countLit,
-				//	countShadow,
-				//	countOutUV,
-				//	countOutZ,
-				//	countZeroW,
-				//	countOutRange,
-				//	countOutSideCone
-				//);
+			//DebugLogInfo("[ShadowTestSystem] Light Entity {}: lit={}, shadow={}, outUV={}, outZ={}, zeroW={}, outRange={}, outSideCone={}",
+			//	shadowLights[i].light.id_,
+			//	countLit,
+			//	countShadow,
+			//	countOutUV,
+			//	countOutZ,
+			//	countZeroW,
+			//	countOutRange,
+			//	countOutSideCone
+			//);
 
 #endif // DEBUG
-			}
 		}
-		// NA
-		ID3D11ShaderResourceView* nullSrvs[2] = { nullptr, nullptr };
-		immediateContext->CSSetShaderResources(0, 2, nullSrvs);
-		ID3D11UnorderedAccessView* nullUav = nullptr;
-		immediateContext->CSSetUnorderedAccessViews(0, 1, &nullUav, nullptr);
 
 #if defined(DEBUG) || defined(_DEBUG)
 		// fobO\p̏XV
@@ -406,6 +313,56 @@ namespace ecs {
 		pending_contact_points_.clear();
 	}
 
+	//! @brief CgƂ̔̍쐬
+	void ShadowTestSystem::BuildLightParams(const std::vector<ShadowLightEntry>& _shadowLights)
+	{
+		light_params_.resize(_shadowLights.size());
+		for (size_t i = 0; i < _shadowLights.size(); ++i) {
+			const auto& entry = _shadowLights[i];
+			auto& params = light_params_[i];
+			params = {};
+			memcpy(params.lightViewProj, &entry.lightViewProj.m[0][0], sizeof(params.lightViewProj));
+			// Cg
+			auto lightTf = ecs_.GetComponent<Transform>(entry.light);
+			const DirectX::XMFLOAT3 lightPos = lightTf->GetWorldPosition();
+			const DirectX::XMFLOAT3 lightDir = lightTf->GetWorldForwardCached();
+			params.lightPos[0] = lightPos.x; params.lightPos[1] = lightPos.y; params.lightPos[2] = lightPos.z;
+			params.lightDir[0] = lightDir.x; params.lightDir[1] = lightDir.y; params.lightDir[2] = lightDir.z;
+			// X|bgCgȂ
+			if (ecs_.HasComponent<SpotLight>(entry.light)) {
+				auto spot = ecs_.GetComponent<SpotLight>(entry.light);
+				params.cosOuterAngle = spot->outerCos;
+				params.cosInnerAngle = spot->innerCos;
+				params.lightRange = spot->range;
+			}
+		}
+	}
+
+	/**
+	 * @brief CPUŔ
+	 *	ShadowCasterSystem߂ɏW߂ob`([xpXɕ`)̂܂܉e𗎂Ƃ`ƂĎg
+	 */
+	void ShadowTestSystem::ExecuteCpu(const ShadowCasterSystem& _casterSystem, const std::vector<DirectX::XMFLOAT3>& _testPoints)
+	{
+		casters_.clear();
+		for (const auto& batch : _casterSystem.GetShadowBatches()) {
+			const dx3d::Mesh* mesh = batch.mesh;
+			if (!mesh || mesh->positions.empty() || mesh->indices.empty()) { continue; }
+			for (const auto& inst : batch.instances) {
+				casters_.push_back({
+					&inst.world.m[0][0],
+					&mesh->positions[0].x,
+					static_cast<uint32_t>(mesh->positions.size()),
+					mesh->indices.data(),
+					static_cast<uint32_t>(mesh->indices.size())
+					});
+			}
+		}
+
+		software_tester_->Execute(light_params_, casters_,
+			&_testPoints[0].x, static_cast<uint32_t>(_testPoints.size()), &job_system_, flags_);
+	}
+
 	//! @brief eXg|Cg̎W
 	void ShadowTestSystem::CollectTestPoints(Entity _entity, std::vector<DirectX::XMFLOAT3>& _outPoints)
 	{
@@ -450,10 +407,10 @@ namespace ecs {
 	void ShadowTestSystem::DebugCheckSliceIndex()
 	{
 #if defined(DEBUG) || defined(_DEBUG)
-		auto lightDepthSystem = light_depth_system_.lock();
-		if (!lightDepthSystem) return;
+		auto casterSystem = caster_system_.lock();
+		if (!casterSystem) return;
 
-		const auto& lights = lightDepthSystem->GetShadowLights();
+		const auto& lights = casterSystem->GetShadowLights();
 		for (uint32_t i = 0; i < lights.size(); ++i) {
 			const auto& entry = lights[i];
 			if (entry.sliceIndex != i) {
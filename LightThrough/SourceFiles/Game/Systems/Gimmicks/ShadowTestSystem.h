@@ -6,18 +6,20 @@
 
  // ---------- CN[h ---------- //
 #include <unordered_map>
-#include <wrl/client.h>
+#include <vector>
+#include <DirectXMath.h>
 
 #include <Game/ECS/ISystem.h>
+#include <Game/Shadows/SoftwareShadowTester.h>
 
 // ---------- O錾 ---------- //
 namespace dx3d {
-	class GraphicsEngine;
+	class JobSystem;
 }
 
 namespace ecs {
-	class LightDepthRenderSystem;
-	class DebugRenderSystem;
+	class ShadowCasterSystem;
+	struct ShadowLightEntry;
 	//! @brief e茋
 	struct ShadowTestResult {
 		bool aInShadow = false; // Entity Ae̒ɂ邩
@@ -26,8 +28,30 @@ namespace ecs {
 	};
 
 
+	/**
+	 * @brief GPUł̉e(CS_ShadowTest)
+	 *	VhE}bv[xpX(LightDepthRenderSystem)ēo^B
+	 *	o^(wbhXsȂ)ShadowTestSystemCPUŔ肷
+	 */
+	class IGpuShadowTest {
+	public:
+		virtual ~IGpuShadowTest() = default;
+		/**
+		 * @brief CgƂɃeXg|Cg𔻒肷
+		 * @param _shadowLights Cg(sliceIndexŃVhE}bṽXCXI)
+		 * @param _lightParams _shadowLightsƓт̃Cg̔
+		 * @param _testPoints eXg|Cg(ShadowTestSystem::MAX_TEST_POINTS܂)
+		 * @param _outFlags  [light * pointCount + point]
+		 */
+		virtual void ExecuteShadowTest(const std::vector<ShadowLightEntry>& _shadowLights,
+			const std::vector<dx3d::shadow::ShadowLightParams>& _lightParams,
+			const std::vector<DirectX::XMFLOAT3>& _testPoints,
+			std::vector<dx3d::shadow::ShadowTestFlag>& _outFlags) = 0;
+	};
+
 	class ShadowTestSystem : public ISystem {
 	public:
+		static constexpr uint32_t MAX_TEST_POINTS = 4096;
 
 		explicit ShadowTestSystem(const SystemDesc& _desc);
 		//! @brief 
@@ -60,34 +84,32 @@ namespace ecs {
 
 		//! @brief e̎s
 		void ExecuteShadowTests();
+		//! @brief e̎s@(GPU̔肪o^ĂȂInitCPUɂȂ)
+		dx3d::ShadowTestBackend GetBackend() const { return backend_; }
+		/**
+		 * @brief GPUł̉e̓o^(InitOɌĂ)
+		 * @param _gpuTest 肷[xpX(j܂œo^܂܂ɂ)
+		 */
+		void SetGpuShadowTest(IGpuShadowTest* _gpuTest) { gpu_test_ = _gpuTest; }
+
+		//! @brief fobOpeXg|Cg
+		struct DebugTestPoint {
+			DirectX::XMFLOAT3 position;
+			bool isInShadow;
+		};
+		//! @brief ߂ɔ肵eXg|Cg(DebugRenderSystem`)
+		const std::vector<DebugTestPoint>& GetDebugTestPoints() const { return debug_test_points_; }
+		//! @brief eXg|Cg\邩
+		bool IsShowingDebugPoints() const { return show_debug_points_; }
 	private:
-		//! @brief Rs[gp\[X̍쐬
-		void CreateComputeResources();
+		//! @brief CgƂ̔̍쐬
+		void BuildLightParams(const std::vector<ShadowLightEntry>& _shadowLights);
+		//! @brief CPUŔ(flags_Ɋi[)
+		void ExecuteCpu(const ShadowCasterSystem& _casterSystem, const std::vector<DirectX::XMFLOAT3>& _testPoints);
 		//! @brief eXgp̃|CgW
 		void CollectTestPoints(Entity _entity, std::vector<DirectX::XMFLOAT3>& _outPoints);
 
 	private:
-		//! @brief CSp萔obt@
-		struct alignas(16) CSParams {
-			DirectX::XMFLOAT4X4 lightViewProj;
-
-			uint32_t numPoints;
-			uint32_t shadowWidth;
-			uint32_t shadowHeight;
-			int32_t sliceIndex;
-
-			DirectX::XMFLOAT3 lightPos;
-			float _pad0;
-
-			DirectX::XMFLOAT3 lightDir;
-			float _pad1;
-
-			float cosOuterAngle;
-			float cosInnerAngle;
-			float lightRange;
-			float _pad2;
-		};
-		// v 144 bytes
 		//! @brief Փ˃yAL[
 		struct PairKey {
 			Entity a;
@@ -113,32 +135,28 @@ namespace ecs {
 		};
 
 	private:
-		std::weak_ptr<LightDepthRenderSystem> light_depth_system_{};
-		std::weak_ptr<DebugRenderSystem> debug_render_system_{};
+		std::weak_ptr<ShadowCasterSystem> caster_system_{};
+		IGpuShadowTest* gpu_test_ = nullptr;	// GPUł̔(o^ĂȂnullptr)
+		dx3d::JobSystem& job_system_;
+		dx3d::ShadowTestBackend backend_ = dx3d::ShadowTestBackend::Gpu;
+
+		// 茋 [light * pointCount + point]
+		std::vector<dx3d::shadow::ShadowLightParams> light_params_{};
+		std::vector<dx3d::shadow::ShadowTestFlag> flags_{};
 
-		// Rs[gVF[_[֘A
-		dx3d::ConstantBufferPtr cb_params_{};			// CSp萔obt@
-		dx3d::StructuredBufferPtr point_buffer_{};		// eXg|Cgobt@
-		dx3d::RWStructuredBufferPtr result_buffer_{};	// ʃobt@
-		dx3d::StagingBufferPtr staging_buffer_{};		// ǂݖ߂pXe[WOobt@
+		// CPU
+		std::unique_ptr<dx3d::shadow::SoftwareShadowTester> software_tester_{};
+		std::vector<dx3d::shadow::ShadowCaster> casters_{};	// Ɨp
 
 		// Ώ
 		std::vector<PendingTest> pending_tests_{};
 		std::unordered_map<PairKey, ShadowTestResult, PairKeyHash> shadow_results_{};
 		std::vector<DirectX::XMFLOAT3> pending_contact_points_;
 
-		static constexpr uint32_t MAX_TEST_POINTS = 4096;
 		static constexpr uint32_t POINTS_PER_AABB = 8;
-		static constexpr uint32_t CS_THREAD_GROUP_SIZE = 64;
 
 
 		// fobO֘A
-		// fobOpeXg|Cg
-		struct DebugTestPoint {
-			DirectX::XMFLOAT3 position;
-			bool isInShadow;
-		};
-
 		// fobOpeXg|CgXg
 		std::vector<DebugTestPoint> debug_test_points_;
 		bool show_debug_points_ = false;  // fobO\ON/OFF
@@ -25,11 +25,11 @@ namespace ecs {
 	{
 		//if (!active_) { return; }
 
+		const auto& namedEntities = ecs_.GetQuery<Name>();
 		for (auto const& e : entities_) {
 			auto pc = ecs_.GetComponent<PlayerController>(e);
 			// targetNametarget
-			auto entitiesWithName = ecs_.GetEntitiesWithComponent<Name>();
-			for (auto const& targetEntity : entitiesWithName) {
+			for (auto const& targetEntity : namedEntities) {
 				auto nameComp = ecs_.GetComponent<ecs::Name>(targetEntity);
 				if (nameComp->value == pc->handLightName) {
 					pc->handLight = targetEntity;
@@ -42,13 +42,13 @@ namespace ecs {
 		std::unordered_map<std::string, Entity> rootMap;
 
 		// [gIuWFNg̃}bv쐬
-		for (auto e : ecs_.GetEntitiesWithComponent<ObjectRoot>()) {
+		for (auto e : ecs_.GetQuery<ObjectRoot>()) {
 			const auto& r = ecs_.GetComponent<ObjectRoot>(e);
 			rootMap.emplace(r->name, e);
 		}
 
 		// ꉞOtIuWFNgo^
-		for (auto e : ecs_.GetEntitiesWithComponent<Name>()) {
+		for (auto e : ecs_.GetQuery<Name>()) {
 			if (rootMap.find(ecs_.GetComponent<Name>(e)->value) == rootMap.end()) {
 				rootMap.emplace(ecs_.GetComponent<Name>(e)->value, e);
 			}
@@ -18,7 +18,7 @@ namespace ecs {
 		//! @brief RXgN^
 		explicit TextureHandleResolveSystem(const SystemDesc& _desc)
 			: ISystem(_desc)
-			, texture_registry_(_desc.textureRegistry)
+			, texture_registry_(*_desc.textureRegistry)
 		{
 		}
 		//! @brief 
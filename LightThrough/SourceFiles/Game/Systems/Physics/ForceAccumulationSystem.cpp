@@ -34,6 +34,8 @@ namespace ecs {
 			auto rb = ecs_.GetComponent<Rigidbody>(e);
 
 			if (rb->isStatic || rb->isKinematic) { continue; }
+			// ĂԂ͏d͂߂Ȃ(O͂𑫂ꂽIntegrationSystemŋN)
+			if (rb->isSleeping) { continue; }
 
 
 			// d
@@ -9,6 +9,7 @@
 #include <Game/ECS/Coordinator.h>
 #include <Game/Components/Core/Transform.h>
 #include <Game/Components/Physics/Rigidbody.h>
+#include <DX3D/Math/MathUtils.h>
 
 namespace ecs {
 	void IntegrationSystem::Init()
@@ -30,6 +31,12 @@ namespace ecs {
 
 			if (rb->isStatic || rb->isKinematic) { continue; }
 
+			// Ă镨̂́Ax͂O^ꂽN(ȊO͉Ȃ)
+			if (rb->isSleeping) {
+				if (math::IsZeroVec(rb->linearVelocity) && math::IsZeroVec(rb->angularVelocity) && math::IsZeroVec(rb->force)) { continue; }
+				rb->WakeUp();
+			}
+
 			// ʂ̋t todo: ɃLbVƂĂȂB
 			const float invMass = (rb->mass > 0.0f) ? (1.0f / rb->mass) : 0.0f;
 
@@ -4,6 +4,7 @@
  */
 
  // ---------- CN[h ---------- // 
+#include <cmath>
 #include <Game/Systems/PlayerControllerSystem.h>
 #include <Game/ECS/Coordinator.h>
 #include <Game/InputSystem/InputSystem.h>
@@ -44,7 +45,7 @@ namespace ecs {
 		if (input.IsKeyDown('D')) { move_right_ = true; }
 
 		// Wv͎擾
-		if (input.IsKeyTrigger(VK_SPACE)) { request_jump_ = true; }
+		if (input.IsKeyTrigger(input::Key::Space)) { request_jump_ = true; }
 
 		// CgNGXg擾
 		if (input.IsMouseTrigger(input::MouseButton::Left)) { request_spawn_light_ = true; }
@@ -75,8 +76,8 @@ namespace ecs {
 				yaw = tf->GetYaw();
 			}
 
-			const XMFLOAT3& forward = { std::sinf(yaw), 0.0f, std::cosf(yaw) };
-			const XMFLOAT3& right = { std::cosf(yaw), 0.0f, -std::sinf(yaw) };
+			const XMFLOAT3& forward = { std::sin(yaw), 0.0f, std::cos(yaw) };
+			const XMFLOAT3& right = { std::cos(yaw), 0.0f, -std::sin(yaw) };
 
 
 			// ---------- ړ ---------- //
@@ -20,6 +20,7 @@
 #include <Game/Components/Physics/Collider.h>
 
 #include <Game/Collisions/CollisionUtils.h>
+#include <Game/Systems/Gimmicks/ShadowTestSystem.h>
 #include <Debug/DebugUI.h>
 
 namespace {
@@ -41,7 +42,7 @@ namespace ecs {
 
 	//! @brief RXgN^
 	DebugRenderSystem::DebugRenderSystem(const SystemDesc& _desc)
-		: ISystem(_desc)
+		: IRenderSystem(_desc)
 	{
 
 	}
@@ -50,6 +51,10 @@ namespace ecs {
 	void DebugRenderSystem::Init()
 	{
 #if defined(DEBUG) || defined(_DEBUG)
+		collider_query_ = &ecs_.GetQuery<Collider>();
+		camera_query_ = &ecs_.GetQuery<Camera>();
+
+
 		auto& device = engine_.GetGraphicsDevice();
 
 		cb_per_frame_ = device.CreateConstantBuffer({
@@ -238,9 +243,7 @@ namespace ecs {
 	{
 #if defined(DEBUG) || defined(_DEBUG)
 		// Collider S Entity 擾
-		auto entities = ecs_.GetEntitiesWithComponent<Collider>();
-
-		for (auto& e : entities) {
+		for (auto& e : *collider_query_) {
 			auto col = ecs_.GetComponent<Collider>(e);
 			DirectX::XMFLOAT4 color = { 0.0f, 1.0f, 1.0f, _alpha };  // VA
 
@@ -273,6 +276,21 @@ namespace ecs {
 	}
 
 
+	//! @brief ẽeXg|Cg`(ShadowTestSystemŕ\ONɂƂ)
+	void DebugRenderSystem::DrawShadowTestPoints()
+	{
+		auto shadowTestSystem = ecs_.GetSystem<ShadowTestSystem>();
+		if (!shadowTestSystem->IsShowingDebugPoints()) { return; }
+
+		constexpr float POINT_SIZE = 0.05f;
+		constexpr DirectX::XMFLOAT4 LIGHT_COLOR = { 0.0f, 1.0f, 0.0f, 1.0f };  // ΁i̒j
+		constexpr DirectX::XMFLOAT4 SHADOW_COLOR = { 1.0f, 0.0f, 0.0f, 1.0f }; // ԁie̒j
+		for (const auto& point : shadowTestSystem->GetDebugTestPoints()) {
+			DrawPoint(point.position, point.isInShadow ? SHADOW_COLOR : LIGHT_COLOR, POINT_SIZE);
+		}
+	}
+
+
 	//! @brief XV
 	void DebugRenderSystem::Update(float _dt)
 	{
@@ -280,6 +298,7 @@ namespace ecs {
 		if (show_all_colliders_) {
 			DrawAllColliders(0.5f);
 		}
+		DrawShadowTestPoints();
 
 
 		// R}hȂ΃XLbv
@@ -291,13 +310,12 @@ namespace ecs {
 
 		// J擾
 		Entity cameraEnt;
-		auto camEntities = ecs_.GetEntitiesWithComponent<Camera>();
-		if (camEntities.empty()) {
+		if (camera_query_->empty()) {
 			GameLogWarning("CameraComponentEntity݂Ȃ߁A`XLbv");
 			return;
 		}
 		// CJT
-		for (auto& e : camEntities) {
+		for (auto& e : *camera_query_) {
 			auto cameraComp = ecs_.GetComponent<Camera>(e);
 			if (cameraComp->isActive && cameraComp->isMain) {
 				cameraEnt = e;
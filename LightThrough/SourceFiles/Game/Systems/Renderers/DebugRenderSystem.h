@@ -9,7 +9,7 @@
  /*---------- CN[h ----------*/
 #include <vector>
 #include <DirectXMath.h>
-#include <Game/ECS/ISystem.h>
+#include <Game/ECS/IRenderSystem.h>
 #include <Game/Components/Render/MeshRenderer.h>
 #include <DX3D/Graphics/Buffers/ConstantBuffer.h>
 
@@ -24,6 +24,7 @@ namespace dx3d {
 namespace ecs {
 	// ---------- O ---------- // 
 	struct Transform;
+	class Query;
 
 	/**
 	 * @brief fobO`VXe
@@ -31,7 +32,7 @@ namespace ecs {
 	 * 蔻Ȃǂ̕`Ɏg
 	 * DrawHOGE()ŌĂ΂ꂽ̂CommandƂĕێĕ`掞ɏo
 	 */
-	class DebugRenderSystem : public ISystem {
+	class DebugRenderSystem : public IRenderSystem {
 	public:
 		DebugRenderSystem(const SystemDesc& _desc);
 		void Init() override;
@@ -64,6 +65,8 @@ namespace ecs {
 		void DrawAllColliders(float _alpha = 0.5f);
 
 		void DrawShadowMap(ID3D11ShaderResourceView* _srv);
+		//! @brief ẽeXg|Cg`
+		void DrawShadowTestPoints();
 
 		/**
 		 * @brief XV
@@ -93,6 +96,10 @@ namespace ecs {
 
 		bool show_all_colliders_ = false;
 
+		// NG
+		const Query* collider_query_ = nullptr;
+		const Query* camera_query_ = nullptr;
+
 		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> shadow_srv_{};
 		Microsoft::WRL::ComPtr<ID3D11SamplerState> shadow_sampler_{};
 		int texture_layer_ = 0;
@@ -6,26 +6,25 @@
  */
 
  // ---------- CN[h ---------- //
+#include <cstring>
 #include <DirectXMath.h>
 #include <Game/Systems/Renderers/LightDepthRenderSystem.h>
 
 #include <DX3D/Graphics/Buffers/ConstantBuffer.h>
+#include <DX3D/Graphics/Buffers/StructuredBuffers.h>
+#include <DX3D/Graphics/Buffers/VertexBuffer.h>
+#include <DX3D/Graphics/Buffers/IndexBuffer.h>
 #include <DX3D/Graphics/GraphicsEngine.h>
 #include <DX3D/Graphics/DeviceContext.h>
 #include <DX3D/Graphics/GraphicsDevice.h>
-#include <DX3D/Graphics/Meshes/MeshRegistry.h>
-#include <DX3D/Graphics/Meshes/Mesh.h>
 #include <DX3D/Graphics/GraphicslogUtils.h>
 #include <DX3D/Graphics/PipelineKey.h>
 #include <Game/ECS/Coordinator.h>
 
-#include <Game/Components/Camera/Camera.h>
 #include <Game/Components/Core/Transform.h>
 #include <Game/Components/Render/MeshRenderer.h>
 #include <Game/Components/Render/Light.h>
 
-#include <Game/Systems/Renderers/DebugRenderSystem.h>
-
 #include <Debug/Debug.h>
 
 
@@ -60,19 +59,24 @@ namespace ecs
 	 * @brief RXgN^
 	 */
 	LightDepthRenderSystem::LightDepthRenderSystem(const SystemDesc& _desc)
-		: ISystem(_desc)
+		: IRenderSystem(_desc)
 	{
 		//light_view_proj_matrices_.resize(MAX_SHADOW_LIGHTS);
 	}
 
 	void LightDepthRenderSystem::Init()
 	{
-		// K{R|[lg
+		// K{R|[lg(`̂ShadowCasterSystemI)
 		Signature signature;
 		signature.set(ecs_.GetComponentType<Transform>());
 		signature.set(ecs_.GetComponentType<MeshRenderer>());
-		// 2025-11-26 todo: shadowCasterComponentƂǉĂ悢B
 		ecs_.SetSystemSignature<LightDepthRenderSystem>(signature);
+		caster_system_ = ecs_.GetSystem<ShadowCasterSystem>();
+
+		// [xpX͑ReLXgŕ`
+		instance_ring_ = std::make_unique<dx3d::InstanceBufferRing>(engine_.GetBackend(), dx3d::GraphicsQueue::Immediate,
+			static_cast<uint32_t>(sizeof(dx3d::InstanceDataShadow)), "LightDepthRenderSystem");
+
 
 		auto& device = engine_.GetGraphicsDevice();
 		// ConstantBuffer쐬
@@ -94,169 +98,45 @@ namespace ecs
 			engine_.GetGraphicsDevice().GetD3DDevice()->CreateSamplerState(&sd, &shadow_sampler_);
 		}
 
-		CreateShadowResources(SHADOW_MAP_HEIGHT, SHADOW_MAP_WIDTH, MAX_SHADOW_LIGHTS);
+		CreateShadowResources(ShadowCasterSystem::SHADOW_MAP_HEIGHT, ShadowCasterSystem::SHADOW_MAP_WIDTH, ShadowCasterSystem::MAX_SHADOW_LIGHTS);
 
-		debug_render_system_ = ecs_.GetSystem<DebugRenderSystem>();
+		// GPUŉe肷ȂVhE}bvgo^(ShadowTestSystemInitɌĂ΂)
+		auto shadowTestSystem = ecs_.GetSystem<ShadowTestSystem>();
+		if (shadowTestSystem->GetBackend() == dx3d::ShadowTestBackend::Gpu) {
+			CreateComputeResources();
+			shadowTestSystem->SetGpuShadowTest(this);
+		}
 	}
 
 
 	//! @brief XV
 	void LightDepthRenderSystem::Update(float _dt)
 	{
-		// ob`
-		shadow_batches_.clear();	// ob`NA
-		CollectBatches();			// ob`W
-		UpdateBatches();			// ob`XV
+		auto casterSystem = caster_system_.lock();
+		UpdateBatches(*casterSystem);	// ob`XV
 
-		// todo: V[[hɑSystemAshadow_lights_clearshadow_lights_ɃANZXăNbV肪
-		shadow_lights_.clear();
 		// [xpXs
-		int32_t shadowIndex = 0;
-		for (auto& e : ecs_.GetEntitiesWithComponents<LightCommon>()) {
-			if (shadowIndex >= MAX_SHADOW_LIGHTS) { break; }
-
-			auto common = ecs_.GetComponent<LightCommon>(e);
-			if (!common->enabled) { continue; }
-			auto tf = ecs_.GetComponent<Transform>(e);
-			SpotLight* spot = nullptr;
-			if (ecs_.HasComponent<SpotLight>(e)) {
-				spot = ecs_.GetComponent<SpotLight>(e);
-			}
-
-			LightViewProj vp = BuildLightViewProj(tf, spot);
-
-			// ̊i[
-			auto lightViewProj = vp.view * vp.proj;
-			XMFLOAT4X4 lightVPFloat;
-			XMStoreFloat4x4(&lightVPFloat, lightViewProj);
-			shadow_lights_.push_back({ e, lightVPFloat, shadowIndex });
-			//DebugLogInfo("[LightDepthRenderSystem] Dispatching ShadowTest CS for light {} sliceIndex={}", e.id_, shadowIndex);
-
-			// `
-			RenderShadowPass(shadow_lights_.back(), shadow_dsvs_[shadowIndex].Get());
-
-			++shadowIndex;
-		}
-	}
-
-	//! @brief GeBeBj̏
-	void LightDepthRenderSystem::OnEntityDestroyed(Entity _e)
-	{
-		// ShadowLightEntry폜
-		auto it = std::remove_if(shadow_lights_.begin(), shadow_lights_.end(),
-			[_e](const ShadowLightEntry& entry) {
-				return entry.light == _e;
-			});
-
-		if (it != shadow_lights_.end()) {
-			shadow_lights_.erase(it, shadow_lights_.end());
+		const auto& shadowLights = casterSystem->GetShadowLights();
+		for (size_t i = 0; i < shadowLights.size(); ++i) {
+			RenderShadowPass(*casterSystem, shadowLights[i], i, shadow_dsvs_[shadowLights[i].sliceIndex].Get());
 		}
-
 	}
 
-
 	/**
-	 * @brief ob`W
-	 *
-	 * Mesh̒_obt@ƃCfbNXobt@̂܂Ƃ߂ăob`
-	 * CX^Xf[^͊eEntityTransform烏[hs擾Ċi[
+	 * @brief ob`XV
+	 *	CgƂɋl߂CX^Xg񂵂̃CX^Xobt@ɂ܂Ƃ߂ď([xpX͑ReLXgŕ`)
 	 */
-	void LightDepthRenderSystem::CollectBatches()
-	{
-		struct Key {
-			dx3d::VertexBuffer* vb{};
-			dx3d::IndexBuffer* ib{};
-			bool operator==(const Key& o) const noexcept { return vb == o.vb && ib == o.ib; }
-		};
-
-		struct KeyHash {
-			size_t operator()(const Key& k) const noexcept {
-				return std::hash<void*>()(k.vb) ^ (std::hash<void*>()(k.ib) << 1);
-			}
-		};
-		std::unordered_map<Key, size_t, KeyHash> map;
-
-		// Entityꗗ𑖍ăob`
-		for (auto& e : entities_) {
-			auto mesh = ecs_.GetComponent<MeshRenderer>(e);
-			auto tf = ecs_.GetComponent<Transform>(e);
-
-			auto& mr = engine_.GetMeshRegistry();
-			auto meshData = mr.Get(mesh->handle);
-
-			if (!meshData) continue;
-
-			Key key{ meshData->vb.get(), meshData->ib.get() };
-			size_t batchIndex{};
-			// ̃ob`
-			if (auto it = map.find(key); it != map.end()) {
-				batchIndex = it->second;
-			}
-			// Vob`
-			else {
-				batchIndex = shadow_batches_.size();
-				map.emplace(key, batchIndex);
-				shadow_batches_.push_back(InstanceBatchShadow{
-					.vb = meshData->vb,
-					.ib = meshData->ib,
-					.indexCount = meshData->indexCount,
-					.instances = {},
-					.instanceOffset = 0
-					});
-			}
-
-			// CX^Xf[^ǉ
-			dx3d::InstanceDataShadow ds{};
-			ds.world = tf->world;
-			shadow_batches_[batchIndex].instances.emplace_back(ds);
-		}
-	}
-
-	void LightDepthRenderSystem::UpdateBatches()
+	void LightDepthRenderSystem::UpdateBatches(const ShadowCasterSystem& _casterSystem)
 	{
-		// CX^X
-		size_t totalInstance = 0;
-		for (auto& b : shadow_batches_) {
-			totalInstance += b.instances.size();
-		}
-		if (totalInstance == 0) { return; } // `悷̂Ȃ
-
-		// CX^Xobt@̍쐬܂̓TCY
-		CreateOrResizeInstanceBufferShadow(totalInstance);
-
-		std::vector<dx3d::InstanceDataShadow> instances;
-		instances.reserve(totalInstance);
-
-		size_t cursor = 0;
-
-		// CX^Xf[^CX^Xobt@pɕϊĊi[
-		for (auto& b : shadow_batches_) {
-			b.instanceOffset = cursor;
-			for (auto& inst : b.instances) {
-				instances.emplace_back(inst);
-			}
-			cursor += b.instances.size();
+		instance_base_ = dx3d::InstanceBufferRing::INVALID_INSTANCE;
+		const auto& lightInstances = _casterSystem.GetLightInstances();
+		if (lightInstances.empty()) { return; } // `悷̂Ȃ
+
+		const uint32_t totalInstance = static_cast<uint32_t>(lightInstances.size());
+		if (instance_ring_->Begin(totalInstance)) {
+			instance_base_ = instance_ring_->Write(lightInstances.data(), totalInstance);
+			instance_ring_->End();
 		}
-
-		// CX^Xobt@̍쐬
-		{
-			dx3d::VertexBufferDesc desc{
-				.vertexList = instances.data(),
-				.vertexListSize = static_cast<uint32_t>(instances.size() * sizeof(dx3d::InstanceDataShadow)),
-				.vertexSize = static_cast<uint32_t>(sizeof(dx3d::InstanceDataShadow))
-			};
-			instance_buffer_shadow_ = engine_.GetGraphicsDevice().CreateVertexBuffer(desc);
-		}
-	}
-
-	/**
-	 * @brief CX^Xobt@̍쐬܂̓TCY
-	 * @param _requiredInstanceCapacity KvȃCX^X
-	 */
-	void LightDepthRenderSystem::CreateOrResizeInstanceBufferShadow(size_t _requiredInstanceCapacity)
-	{
-		if (_requiredInstanceCapacity <= instance_buffer_capacity_) { return; }
-		instance_buffer_capacity_ = (std::max)(_requiredInstanceCapacity, instance_buffer_capacity_ * 2 + 1);
 	}
 
 
@@ -311,11 +191,10 @@ namespace ecs
 	/**
 	 * @brief Brief VhE}bv`pX
 	 */
-	void LightDepthRenderSystem::RenderShadowPass(ShadowLightEntry _entry, ID3D11DepthStencilView* _dsv)
+	void LightDepthRenderSystem::RenderShadowPass(const ShadowCasterSystem& _casterSystem, const ShadowLightEntry& _entry, size_t _lightIndex, ID3D11DepthStencilView* _dsv)
 	{
 		// todo: ReLXg𒼒@APIɒu
 
-		auto debugRenderSystem = debug_render_system_.lock();
 		auto immediateContext = engine_.GetImmediateContext();
 
 		// jRTV/DSVޔ
@@ -331,7 +210,7 @@ namespace ecs
 		immediateContext->OMSetRenderTargets(0, nullptr, _dsv);
 		immediateContext->ClearDepthStencilView(_dsv, D3D11_CLEAR_DEPTH, 1.0f, 0);
 
-		auto vp = BuildViewport(static_cast<float>(SHADOW_MAP_WIDTH), static_cast<float>(SHADOW_MAP_HEIGHT));
+		auto vp = BuildViewport(static_cast<float>(ShadowCasterSystem::SHADOW_MAP_WIDTH), static_cast<float>(ShadowCasterSystem::SHADOW_MAP_HEIGHT));
 		immediateContext->RSSetViewports(1, &vp);
 
 		// ConstantBuffer
@@ -354,11 +233,16 @@ namespace ecs
 		);
 
 
-		// `
-		for (auto& b : shadow_batches_) {
-			const uint32_t instanceCount = static_cast<uint32_t>(b.instances.size());
-			if (instanceCount == 0) { continue; }
-			engine_.RenderInstancedOnImmediate(*b.vb, *b.ib, *instance_buffer_shadow_, instanceCount, (uint32_t)b.instanceOffset, psoKey);
+		// `(̃Cg͈̔͂ɓ̂)
+		if (instance_base_ != dx3d::InstanceBufferRing::INVALID_INSTANCE) {
+			const auto& draws = _casterSystem.GetLightDraws();
+			const auto& drawBegin = _casterSystem.GetLightDrawBegin();
+			const auto& batches = _casterSystem.GetShadowBatches();
+			for (uint32_t i = drawBegin[_lightIndex]; i < drawBegin[_lightIndex + 1]; ++i) {
+				const auto& d = draws[i];
+				const auto& b = batches[d.batchIndex];
+				engine_.RenderInstancedOnImmediate(*b.vb, *b.ib, *instance_ring_->GetBuffer(), d.instanceCount, instance_base_ + d.firstInstance, psoKey);
+			}
 		}
 
 		// ޔĂRTVADSV𕜌
@@ -367,4 +251,102 @@ namespace ecs
 		if (prevDSV) { prevDSV->Release(); }
 		immediateContext->RSSetViewports(prevVPCount, prevVPs);
 	}
-}
\ No newline at end of file
+
+	//! @brief Rs[gp\[X쐬
+	void LightDepthRenderSystem::CreateComputeResources()
+	{
+		auto& device = engine_.GetGraphicsDevice();
+		// 萔obt@
+		cb_params_ = device.CreateConstantBuffer({ sizeof(CSParams), nullptr });
+		// ̓|Cgp
+		point_buffer_ = device.CreateStructuredBuffer({ sizeof(XMFLOAT3), ShadowTestSystem::MAX_TEST_POINTS, nullptr });
+		// o̓tOp
+		result_buffer_ = device.CreateRWStructuredBuffer({ sizeof(uint32_t), ShadowTestSystem::MAX_TEST_POINTS });
+		// ǂݖ߂p
+		staging_buffer_ = device.CreateStagingBuffer({ sizeof(uint32_t), ShadowTestSystem::MAX_TEST_POINTS });
+	}
+
+	//! @brief CS_ShadowTestŔ
+	void LightDepthRenderSystem::ExecuteShadowTest(const std::vector<ShadowLightEntry>& _shadowLights,
+		const std::vector<dx3d::shadow::ShadowLightParams>& _lightParams,
+		const std::vector<DirectX::XMFLOAT3>& _testPoints,
+		std::vector<dx3d::shadow::ShadowTestFlag>& _outFlags)
+	{
+		auto* immediateContext = engine_.GetImmediateContext();
+
+		// ComputeShader擾
+		auto& shaderCache = engine_.GetShaderCache();
+		auto& csEntry = shaderCache.GetCS(dx3d::ComputeShaderKind::ShadowTest);
+
+		// |Cgobt@̍XV
+		point_buffer_->Update(_testPoints.data(), sizeof(DirectX::XMFLOAT3) * _testPoints.size());
+		// ǂݖ߂Ȃ͌̒ɂȂ
+		_outFlags.assign(_shadowLights.size() * _testPoints.size(), dx3d::shadow::ShadowTestFlag::Shadow);
+
+		for (uint32_t i = 0; i < _shadowLights.size(); ++i) {
+			const auto& entry = _shadowLights[i];
+			const auto& light = _lightParams[i];
+
+			// 萔obt@̍XV
+			CSParams params{};
+			memcpy(&params.lightViewProj, light.lightViewProj, sizeof(params.lightViewProj));
+			params.numPoints = static_cast<uint32_t>(_testPoints.size());
+			params.shadowWidth = ShadowCasterSystem::SHADOW_MAP_WIDTH;
+			params.shadowHeight = ShadowCasterSystem::SHADOW_MAP_HEIGHT;
+			params.sliceIndex = entry.sliceIndex;
+			params.lightPos = { light.lightPos[0], light.lightPos[1], light.lightPos[2] };
+			params.lightDir = { light.lightDir[0], light.lightDir[1], light.lightDir[2] };
+			params.cosOuterAngle = light.cosOuterAngle;
+			params.cosInnerAngle = light.cosInnerAngle;
+			params.lightRange = light.lightRange;
+			// CBXV
+			D3D11_MAPPED_SUBRESOURCE mapped{};
+			immediateContext->Map(
+				cb_params_->GetBuffer(),
+				0,
+				D3D11_MAP_WRITE_DISCARD,
+				0,
+				&mapped
+			);
+			memcpy(mapped.pData, &params, sizeof(CSParams));
+			immediateContext->Unmap(cb_params_->GetBuffer(), 0);
+
+			// \[XZbg
+			immediateContext->CSSetShader(csEntry.shader.Get(), nullptr, 0);
+			// CB
+			ID3D11Buffer* cb = cb_params_->GetBuffer();
+			immediateContext->CSSetConstantBuffers(0, 1, &cb);
+			// SRV
+			ID3D11ShaderResourceView* csSrvs[2];
+			csSrvs[0] = point_buffer_->GetSRV();
+			csSrvs[1] = shadow_srvs_.Get();
+			immediateContext->CSSetShaderResources(0, 2, csSrvs);
+			// UAV
+			ID3D11UnorderedAccessView* uav = result_buffer_->GetUAV();
+			UINT initialCounts = 0;
+			immediateContext->CSSetUnorderedAccessViews(0, 1, &uav, &initialCounts);
+
+			// VhETv[Zbg
+			ID3D11SamplerState* samplers[] = { shadow_sampler_.Get() };
+			immediateContext->CSSetSamplers(0, 1, samplers);
+
+			// s
+			uint32_t groupCount = static_cast<uint32_t>(_testPoints.size() + CS_THREAD_GROUP_SIZE - 1) / CS_THREAD_GROUP_SIZE;
+			immediateContext->Dispatch(groupCount, 1, 1);
+
+			// GPU҂Ă猋ʂ擾
+			// outFlags: 0 = lit, 1 = shadow, 2 = outUV, 3 = outZ, 4 = wZero, 5 = outRange, 6 = outSideCone
+			immediateContext->CopyResource(staging_buffer_->GetBuffer(), result_buffer_->GetBuffer());
+			void* mappedData = staging_buffer_->Map();
+			if (mappedData) {
+				memcpy(_outFlags.data() + static_cast<size_t>(i) * _testPoints.size(), mappedData, sizeof(uint32_t) * _testPoints.size());
+				staging_buffer_->Unmap();
+			}
+		}
+		// NA
+		ID3D11ShaderResourceView* nullSrvs[2] = { nullptr, nullptr };
+		immediateContext->CSSetShaderResources(0, 2, nullSrvs);
+		ID3D11UnorderedAccessView* nullUav = nullptr;
+		immediateContext->CSSetUnorderedAccessViews(0, 1, &nullUav, nullptr);
+	}
+}
@@ -6,12 +6,14 @@
  * @date 2025-09-01
  */
 
- // ---------- CN[h ---------- // 
+ // ---------- CN[h ---------- //
 #include <wrl/client.h>
-#include <unordered_map>
 #include <DX3D/Core/Core.h>
 #include <DX3D/Graphics/Buffers/InstanceData.h>
-#include <Game/ECS/ISystem.h>
+#include <DX3D/Graphics/Buffers/InstanceBufferRing.h>
+#include <Game/ECS/IRenderSystem.h>
+#include <Game/Systems/Gimmicks/ShadowCasterSystem.h>
+#include <Game/Systems/Gimmicks/ShadowTestSystem.h>
 
 // ---------- O錾 ---------- //
 namespace dx3d {
@@ -19,40 +21,21 @@ namespace dx3d {
 }
 
 namespace ecs {
-	//! @brief CX^X`pob`\
-	// shadowPass
-	struct InstanceBatchShadow {
-		dx3d::VertexBufferPtr vb{};
-		dx3d::IndexBufferPtr ib{};
-		uint32_t indexCount{};
-		std::vector<dx3d::InstanceDataShadow> instances{};
-		size_t instanceOffset = 0;
-	};
-
-	//! @brief CgƂ̃VhEGg
-	struct ShadowLightEntry {
-		ecs::Entity light;
-		DirectX::XMFLOAT4X4 lightViewProj;
-		int32_t sliceIndex = -1;
-	};
-
 	/**
 	 * @brief `VXe
 	 *
-	 * @detail K{G<Transform>, <Mesh>
+	 * ShadowCasterSystemI񂾌`CgƂ̃VhE}bvɕ`B
+	 * VhE}bv̂ŁAGPUł̉e(IGpuShadowTest)ōsB
+	 *
+	 * @detail K{G<Transform>, <MeshRenderer>
 	 */
-	class LightDepthRenderSystem : public ISystem {
+	class LightDepthRenderSystem : public IRenderSystem, public IGpuShadowTest {
 	public:
 		explicit LightDepthRenderSystem(const SystemDesc& _desc);
 		//! @brief 
 		void Init() override;
 		//! @brief XV
 		void Update(float _dt) override;
-		/**
-		 * @brief GeBeBj
-		 * @param _e jꂽGeBeB
-		 */
-		void OnEntityDestroyed(Entity _e) override;
 
 		/**
 		 * @brief VhE}bvSRV擾
@@ -66,35 +49,54 @@ namespace ecs {
 		 */
 		ID3D11SamplerState* GetShadowSampler() const { return shadow_sampler_.Get(); }
 
-		uint32_t GetShadowMapWidth() const { return SHADOW_MAP_WIDTH; }
-		uint32_t GetShadowMapHeight() const { return SHADOW_MAP_HEIGHT; }
-
-		//! @brief CgGeBeB̃VhE擾
-		std::vector<ShadowLightEntry> GetShadowLights() const { return shadow_lights_; }
+		//! @brief CS_ShadowTestŔ
+		void ExecuteShadowTest(const std::vector<ShadowLightEntry>& _shadowLights,
+			const std::vector<dx3d::shadow::ShadowLightParams>& _lightParams,
+			const std::vector<DirectX::XMFLOAT3>& _testPoints,
+			std::vector<dx3d::shadow::ShadowTestFlag>& _outFlags) override;
 	private:
-		//! @brief ob`W
-		void CollectBatches();
-		//! @brief ob`XV
-		void UpdateBatches();
-		//! @brief VhE}bv`pX
-		void RenderShadowPass(ShadowLightEntry _entry, ID3D11DepthStencilView* _dsv);
-		//! @brief CX^Xobt@̍쐬܂̓TCY
-		void CreateOrResizeInstanceBufferShadow(size_t _requiredInstanceCapacity);
+		//! @brief CgƂ̃CX^Xobt@ɏ
+		void UpdateBatches(const ShadowCasterSystem& _casterSystem);
+		/**
+		 * @brief VhE}bv`pX
+		 * @param _lightIndex ShadowCasterSystem̃Cg̔ԍ(`͈͂I)
+		 */
+		void RenderShadowPass(const ShadowCasterSystem& _casterSystem, const ShadowLightEntry& _entry, size_t _lightIndex, ID3D11DepthStencilView* _dsv);
 		// VhE}bvp\[X̍쐬
 		void CreateShadowResources(uint32_t _texHeight, uint32_t _texWidth, uint32_t _arraySize);
+		//! @brief Rs[gp\[X̍쐬
+		void CreateComputeResources();
 
 
 	private:
-		std::weak_ptr<class DebugRenderSystem> debug_render_system_{};
+		//! @brief CSp萔obt@
+		struct alignas(16) CSParams {
+			DirectX::XMFLOAT4X4 lightViewProj;
+
+			uint32_t numPoints;
+			uint32_t shadowWidth;
+			uint32_t shadowHeight;
+			int32_t sliceIndex;
+
+			DirectX::XMFLOAT3 lightPos;
+			float _pad0;
 
+			DirectX::XMFLOAT3 lightDir;
+			float _pad1;
 
-		static const uint32_t MAX_SHADOW_LIGHTS = 16;
-		const uint32_t SHADOW_MAP_WIDTH = 2048;
-		const uint32_t SHADOW_MAP_HEIGHT = 2048;
+			float cosOuterAngle;
+			float cosInnerAngle;
+			float lightRange;
+			float _pad2;
+		};
+		// v 144 bytes
 
-		std::vector<InstanceBatchShadow> shadow_batches_{}; // VhEpX̃ob`
-		std::shared_ptr<dx3d::VertexBuffer> instance_buffer_shadow_{};
-		size_t instance_buffer_capacity_{};
+		static constexpr uint32_t CS_THREAD_GROUP_SIZE = 64;
+
+		std::weak_ptr<ShadowCasterSystem> caster_system_{};
+
+		uint32_t instance_base_ = dx3d::InstanceBufferRing::INVALID_INSTANCE;	// Cg̃CX^X̃obt@̐擪
+		std::unique_ptr<dx3d::InstanceBufferRing> instance_ring_{};	// CX^Xobt@(t[ƂɎg)
 		dx3d::ConstantBufferPtr cb_light_matrix_{};	// 萔obt@
 
 		// VhE}bvp\[X
@@ -104,9 +106,11 @@ namespace ecs {
 		//std::vector<Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>> shadow_srvs_{};
 		Microsoft::WRL::ComPtr<ID3D11SamplerState> shadow_sampler_{};
 
-		// CgƂ̃VhE
-		std::vector<ShadowLightEntry> shadow_lights_;
-
+		// Rs[gVF[_[֘A(e)
+		dx3d::ConstantBufferPtr cb_params_{};			// CSp萔obt@
+		dx3d::StructuredBufferPtr point_buffer_{};		// eXg|Cgobt@
+		dx3d::RWStructuredBufferPtr result_buffer_{};	// ʃobt@
+		dx3d::StagingBufferPtr staging_buffer_{};		// ǂݖ߂pXe[WOobt@
 	};
 
-}
\ No newline at end of file
+}
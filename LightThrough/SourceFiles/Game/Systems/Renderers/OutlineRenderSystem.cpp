@@ -8,7 +8,7 @@
 namespace ecs
 {
 	OutlineRenderSystem::OutlineRenderSystem(const SystemDesc& _desc)
-		: ISystem(_desc)
+		: IRenderSystem(_desc)
 	{
 	}
 
@@ -4,12 +4,12 @@
  */
 
  // ---------- CN[h ---------- //
-#include <Game/ECS/ISystem.h>
+#include <Game/ECS/IRenderSystem.h>
 #include <DX3D/Graphics/GraphicsEngine.h>
 
 namespace ecs
 {
-	class OutlineRenderSystem : public ISystem
+	class OutlineRenderSystem : public IRenderSystem
 	{
 	public:
 		explicit OutlineRenderSystem(const SystemDesc& _desc);
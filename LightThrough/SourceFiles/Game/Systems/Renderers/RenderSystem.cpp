@@ -6,12 +6,16 @@
  */
 
  // ---------- CN[h ---------- //
+#include <cmath>
+#include <cstring>
 #include <DirectXMath.h>
 #include <Game/Systems/Renderers/RenderSystem.h>
 #include <Game/Systems/Renderers/LightDepthRenderSystem.h>
+#include <Game/Systems/Gimmicks/ShadowCasterSystem.h>
 #include <Game/Systems/Renderers/DebugRenderSystem.h>
 
 #include <DX3D/Graphics/Buffers/ConstantBuffer.h>
+#include <DX3D/Graphics/Buffers/StructuredBuffers.h>
 #include <DX3D/Graphics/GraphicsEngine.h>
 #include <DX3D/Graphics/DeviceContext.h>
 #include <DX3D/Graphics/GraphicsDevice.h>
@@ -25,6 +29,8 @@
 #include <Game/Components/Render/MeshRenderer.h>
 #include <Game/Components/Render/Light.h>
 
+#include <Debug/DebugUI.h>
+
 namespace {
 	struct CBPerFrame {
 		DirectX::XMFLOAT4X4 view;	// r[s
@@ -42,7 +48,8 @@ namespace ecs {
 	 * @brief RXgN^
 	 */
 	RenderSystem::RenderSystem(const SystemDesc& _desc)
-		: ISystem(_desc)
+		: IRenderSystem(_desc)
+		, job_system_(_desc.jobSystem)
 	{
 	}
 
@@ -53,6 +60,8 @@ namespace ecs {
 		signature.set(ecs_.GetComponentType<Transform>());
 		signature.set(ecs_.GetComponentType<MeshRenderer>());
 		ecs_.SetSystemSignature<RenderSystem>(signature);
+		camera_query_ = &ecs_.GetQuery<Camera>();
+
 
 		auto& device = engine_.GetGraphicsDevice();
 		// ConstantBuffer쐬
@@ -71,6 +80,32 @@ namespace ecs {
 			nullptr
 			});
 
+		instance_ring_ = std::make_unique<dx3d::InstanceBufferRing>(engine_.GetBackend(), dx3d::GraphicsQueue::Deferred,
+			static_cast<uint32_t>(sizeof(dx3d::InstanceDataMain)), "RenderSystem");
+
+		// NX^Ƃ̃Cg(psXbg1, 2)Bԍ͑̕ȂȂ蒼
+		const uint32_t clusterCount = light_clusters_.GetClusterCount();
+		cluster_range_buffer_ = device.CreateStructuredBuffer({ sizeof(uint32_t) * 2, clusterCount, nullptr });
+		cluster_index_capacity_ = clusterCount * 4;
+		cluster_index_buffer_ = device.CreateStructuredBuffer({ sizeof(uint32_t), cluster_index_capacity_, nullptr });
+
+		// fobOUIo^
+#if defined(DEBUG) || defined(_DEBUG)
+		debug::DebugUI::ResistDebugFunction([this]()
+			{
+				if (ImGui::Begin("Render Culling")) {
+					ImGui::Checkbox("Frustum Culling", &frustum_culling_);
+					ImGui::Text("Visible: %u / Culled: %u", GetVisibleCount(), GetCulledCount());
+					ImGui::Separator();
+					ImGui::Checkbox("Clustered Lighting", &clustered_lighting_);
+					const auto& desc = light_clusters_.GetDesc();
+					ImGui::Text("Clusters: %u x %u x %u", desc.tilesX, desc.tilesY, desc.slicesZ);
+					ImGui::Text("Light Indices: %zu / Max per Cluster: %u", light_clusters_.GetLightIndices().size(), light_clusters_.GetMaxLightsPerCluster());
+				}
+				ImGui::End();
+			}
+		);
+#endif
 	}
 
 	/**
@@ -78,17 +113,17 @@ namespace ecs {
 	 */
 	void RenderSystem::Update(float _dt)
 	{
+
 		auto& context = engine_.GetDeferredContext();
 		auto& device = engine_.GetGraphicsDevice();
 
 		// Camera擾 memo: J͈z
-		auto camEntities = ecs_.GetEntitiesWithComponent<Camera>();
-		if (camEntities.empty()) {
+		if (camera_query_->empty()) {
 			GameLogWarning("CameraComponentEntity݂Ȃ߁A`XLbv");
 			return;
 		}
 		// J
-		auto cam = ecs_.GetComponent<Camera>(camEntities[0]);
+		auto cam = ecs_.GetComponent<Camera>(camera_query_->Front());
 		CBPerFrame cbPerFrameData{};
 		cbPerFrameData.view = cam->view;
 		cbPerFrameData.proj = cam->proj;
@@ -99,7 +134,7 @@ namespace ecs {
 
 		// VXe烉Cg[x擾
 		auto depthSystem = ecs_.GetSystem<LightDepthRenderSystem>();
-		const auto& shadowLights = depthSystem->GetShadowLights();
+		const auto& shadowLights = ecs_.GetSystem<ShadowCasterSystem>()->GetShadowLights();
 
 		// ---------- Cg ---------- // 
 		// Cgʏ
@@ -131,20 +166,25 @@ namespace ecs {
 		}
 
 		lightData.lightCount = lightSum;
+		BuildLightClusters(lightData, *cam);
 
-		// SRVZbg
-		ID3D11ShaderResourceView* srv = depthSystem->GetShadowMapSRVs();
-		context.PSSetShaderResources(0, 1, &srv);
+		// SRVZbg(VhE}bv, NX^͈̔, NX^̃Cgԍ)
+		ID3D11ShaderResourceView* srvs[3] = {
+			depthSystem->GetShadowMapSRVs(),
+			cluster_range_buffer_->GetSRV(),
+			cluster_index_buffer_->GetSRV(),
+		};
+		context.PSSetShaderResources(0, 3, srvs);
 
 		// Tv[Zbg
 		auto shadowSampler = depthSystem->GetShadowSampler();
 		context.PSSetSamplers(0, 1, &shadowSampler);
 
 		// ob`
-		opaque_batches_.clear();	// ob`NA
-		transparent_batches_.clear();
-		auto camPos = ecs_.GetComponent<Transform>(camEntities[0])->GetWorldPosition();
-		CollectBatches(camPos);	// ob`W
+		auto camPos = ecs_.GetComponent<Transform>(camera_query_->Front())->GetWorldPosition();
+		DirectX::XMFLOAT4X4 viewProj{};
+		DirectX::XMStoreFloat4x4(&viewProj, DirectX::XMMatrixMultiply(DirectX::XMLoadFloat4x4(&cam->view), DirectX::XMLoadFloat4x4(&cam->proj)));
+		CollectBatches(camPos, viewProj, cam->farZ);	// ob`W
 		UpdateBatches();	// ob`XV
 
 		// CpX
@@ -154,36 +194,106 @@ namespace ecs {
 
 
 	/**
-	 * @brief ob`W
+	 * @brief NX^Ƃ̃Cg̊蓖
 	 *
-	 * Mesh̒_obt@ƃCfbNXobt@̂܂Ƃ߂ăob`
-	 * CX^Xf[^͊eEntityTransform烏[hs擾Ċi[
+	 * J̎^C x XCXɋ؂ANX^Ƃɓ͂Cg̔ԍCPUőgō\obt@ɑB
+	 * PS_Default̓sNZ̃NX^̔ԍ(s͑SNX^ɓ)B
 	 */
-	void RenderSystem::CollectBatches(const DirectX::XMFLOAT3& _camPos)
+	void RenderSystem::BuildLightClusters(CBLight& _lightData, const Camera& _camera)
 	{
-		struct Key {
-			dx3d::VertexBuffer* vb{};
-			dx3d::IndexBuffer* ib{};
-			dx3d::PipelineKey psoKey{};
-			bool operator==(const Key& o) const noexcept { return vb == o.vb && ib == o.ib; }
+		auto& params = _lightData.cluster;
+		params = {};
+		const auto& screen = engine_.GetScreenSize();
+		if (!clustered_lighting_ || screen.width <= 0 || screen.height <= 0) { return; }
+
+		// Cg(ԍCBLightlightsƓ)
+		cluster_lights_.resize(_lightData.lightCount);
+		for (int i = 0; i < _lightData.lightCount; ++i) {
+			const auto& src = _lightData.lights[i];
+			auto& dst = cluster_lights_[i];
+			dst = {
+				.position = { src.pos_type.x, src.pos_type.y, src.pos_type.z },
+				.direction = { src.dir_range.x, src.dir_range.y, src.dir_range.z },
+				.range = src.dir_range.w,
+				.cosOuter = src.spotAngles_shadowIndex.y,
+				.shape = (static_cast<uint32_t>(src.pos_type.w) == static_cast<uint32_t>(LightType::Spot))
+					? dx3d::culling::ClusterLightShape::Spot : dx3d::culling::ClusterLightShape::Global,
+			};
+			// ̓VF[_[ƓKĎg
+			const float len = std::sqrt(dst.direction[0] * dst.direction[0] + dst.direction[1] * dst.direction[1] + dst.direction[2] * dst.direction[2]);
+			if (len > 0.0f) { for (float& d : dst.direction) { d /= len; } }
+		}
+
+		dx3d::culling::ClusterCamera camera{
+			.projScaleX = _camera.proj._11,
+			.projScaleY = _camera.proj._22,
+			.nearZ = _camera.nearZ,
+			.farZ = _camera.farZ,
 		};
+		std::memcpy(camera.view, &_camera.view._11, sizeof(camera.view));
+		light_clusters_.Build(camera, cluster_lights_, &job_system_);
+
+		// 
+		const auto& indices = light_clusters_.GetLightIndices();
+		if (indices.size() > cluster_index_capacity_) {
+			while (cluster_index_capacity_ < indices.size()) { cluster_index_capacity_ *= 2; }
+			cluster_index_buffer_ = engine_.GetGraphicsDevice().CreateStructuredBuffer({ sizeof(uint32_t), cluster_index_capacity_, nullptr });
+		}
+		const auto& ranges = light_clusters_.GetClusterRanges();
+		cluster_range_buffer_->Update(ranges.data(), ranges.size() * sizeof(uint32_t));
+		cluster_index_buffer_->Update(indices.data(), indices.size() * sizeof(uint32_t));
+
+		const auto& desc = light_clusters_.GetDesc();
+		params.tilesX = desc.tilesX;
+		params.tilesY = desc.tilesY;
+		params.slicesZ = desc.slicesZ;
+		params.enabled = 1;
+		params.screenSize = { static_cast<float>(screen.width), static_cast<float>(screen.height) };
+		params.sliceScale = light_clusters_.GetSliceScale();
+		params.sliceBias = light_clusters_.GetSliceBias();
+		params.viewDepth = { _camera.view._13, _camera.view._23, _camera.view._33, _camera.view._43 };
+		params.nearSliceDepth = light_clusters_.GetNearSliceDepth();
+	}
+
+	/**
+	 * @brief ob`W
+	 *
+	 * EntityƂɃCX^Xf[^ς݁A`L[64bit̃L[(pCvC / bV / [x)Ɣԍς
+	 * ܂Ƃ߂鏈ׂ͕ɗׂ荇L[ōs(UpdateBatches)
+	 * ̊OɂEntity͐ς܂Ȃ(bṼ[JAABB / Oڋ[hɈڂĂ܂Ƃ߂Ĕ)
+	 */
+	void RenderSystem::CollectBatches(const DirectX::XMFLOAT3& _camPos, const DirectX::XMFLOAT4X4& _viewProj, float _farZ)
+	{
+		auto& mr = engine_.GetMeshRegistry();
+		render_queue_.Clear();
+		queue_instances_.clear();
 
-		struct KeyHash {
-			size_t operator()(const Key& _k) const noexcept {
-				size_t h1 = std::hash<void*>()(_k.vb);
-				size_t h2 = std::hash<void*>()(_k.ib);
-				size_t h3 = dx3d::PipelineKeyHash()(_k.psoKey);
-				return h1 ^ (h2 << 1) ^ (h3 << 2);
+		// JO
+		frustum_culler_.Begin(entities_.size());
+		for (auto& e : entities_) {
+			auto meshData = mr.Get(ecs_.GetComponent<MeshRenderer>(e)->handle);
+			if (!frustum_culling_ || !meshData || !meshData->bounds.valid) {
+				frustum_culler_.AddUnbounded();
+				continue;
 			}
-		};
-		std::unordered_map<Key, size_t, KeyHash> map;
+			const auto& bounds = meshData->bounds;
+			frustum_culler_.Add(&bounds.center.x, &bounds.extents.x, bounds.radius, &ecs_.GetComponent<ecs::Transform>(e)->world._11);
+		}
+		frustum_culler_.Cull(dx3d::culling::ExtractFrustumPlanes(&_viewProj._11));
 
-		// Entityꗗ𑖍ăob` // todo: t[SEntityɑ΂ď̂͂܂ɂʂȂ̂ŁAXVƂɂB
+		render_queue_.Reserve(frustum_culler_.GetVisibleCount());
+		queue_instances_.reserve(frustum_culler_.GetVisibleCount());
+		const DirectX::XMVECTOR camPos = DirectX::XMLoadFloat3(&_camPos);
+		const float invFar = (_farZ > 0.0f) ? 1.0f / _farZ : 0.0f;
+
+		// Entityꗗ𑖍ăL[ɐς // todo: t[SEntityɑ΂ď̂͂܂ɂʂȂ̂ŁAXVƂɂB
+		uint32_t cullIndex = 0;
 		for (auto& e : entities_) {
+			if (!frustum_culler_.IsVisible(cullIndex++)) { continue; }
+
 			auto mesh = ecs_.GetComponent<MeshRenderer>(e);
 			auto tf = ecs_.GetComponent<ecs::Transform>(e);
 
-			auto& mr = engine_.GetMeshRegistry();
 			auto meshData = mr.Get(mesh->handle);
 
 			// todo: }eApso擾ɂ
@@ -198,96 +308,50 @@ namespace ecs {
 			);
 
 			if (!meshData) continue;
-
-
-			std::vector<InstanceBatchMain>* targetBatches = nullptr;
-			if (psoKey.GetBlend() == dx3d::BlendMode::Opaque) {
-				targetBatches = &opaque_batches_;
-			}
-			else {
-				targetBatches = &transparent_batches_;
+			if (mesh->handle.id > dx3d::RenderQueue::MAX_MESH_ID) {
+				GameLogFWarning("bV̔ԍL[Ɏ܂Ȃߕ`XLbv: {}", mesh->handle.id);
+				continue;
 			}
 
-			struct Key key { meshData->vb.get(), meshData->ib.get(), psoKey };
-			size_t batchIndex{};
-			// ̃ob`
-			if (auto it = map.find(key); it != map.end()) {
-				batchIndex = it->second;
-			}
-			// Vob`
-			else {
-				batchIndex = targetBatches->size();
-				map.emplace(key, batchIndex);
-				targetBatches->push_back(InstanceBatchMain{
-					.vb = meshData->vb,
-					.ib = meshData->ib,
-					.indexCount = meshData->indexCount,
-					.instances = {},
-					.instanceOffset = 0,
-					.key = psoKey,
-					});
-			}
+			// [x(s: O, : )
+			const float distance = DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(tf->GetWorldPositionV(), camPos)));
+			const bool transparent = psoKey.GetBlend() != dx3d::BlendMode::Opaque;
 
 			// CX^Xf[^ǉ
-            dx3d::InstanceDataMain dm{};
+			dx3d::InstanceDataMain dm{};
 			dm.world = tf->world;
 			dm.color = { 1, 1, 1, 1 };	// todo: FAQƂ悤
-            (*targetBatches)[batchIndex].instances.emplace_back(dm);
-
-			// Ȃ
-			if (psoKey.GetBlend() == dx3d::BlendMode::Alpha) {
-				DirectX::XMVECTOR pos = tf->GetWorldPositionV();
-				DirectX::XMVECTOR camPos = DirectX::XMLoadFloat3(&_camPos);
-				float distance = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(DirectX::XMVectorSubtract(pos, camPos)));
-				(*targetBatches)[batchIndex].sortKey = distance;
-			}
-
+			render_queue_.Add(dx3d::RenderQueue::MakeKey(0, psoKey, mesh->handle.id, transparent, distance * invFar),
+				static_cast<uint32_t>(queue_instances_.size()));
+			queue_instances_.emplace_back(dm);
 		}
 	}
 
+	/**
+	 * @brief ob`XV
+	 *	L[ŕׁAׂɃCX^Xf[^l߂Ďg񂵂̃CX^Xobt@Ɉxŏ
+	 */
 	void RenderSystem::UpdateBatches()
 	{
-		// CX^X
-		size_t totalInstance = 0;
-		for (auto& b : opaque_batches_) {
-			totalInstance += b.instances.size();
-		}
-		for (auto& b : transparent_batches_) {
-			totalInstance += b.instances.size();
+		instance_offset_ = dx3d::InstanceBufferRing::INVALID_INSTANCE;
+		render_queue_.Sort();
+		const auto& payloads = render_queue_.GetPayloads();
+		if (payloads.empty()) { return; } // `悷̂Ȃ
+
+		sorted_instances_.resize(payloads.size());
+		for (size_t i = 0; i < payloads.size(); ++i) {
+			sorted_instances_[i] = queue_instances_[payloads[i]];
 		}
-		if (totalInstance == 0) { return; } // `悷̂Ȃ
-
-		// CX^Xobt@̍쐬܂̓TCY
-		CreateOrResizeInstanceBufferMain(totalInstance);
 
-		std::vector<dx3d::InstanceDataMain> instances;
-		instances.reserve(totalInstance);
-
-		size_t cursor = 0;
-
-		// CX^Xf[^CX^Xobt@pɕϊĊi[
-		for (auto& b : opaque_batches_) {
-			b.instanceOffset = cursor;
-			instances.insert(instances.end(), b.instances.begin(), b.instances.end());
-			cursor += b.instances.size();
-		}
-		for (auto& b : transparent_batches_) {
-			b.instanceOffset = cursor;
-			instances.insert(instances.end(), b.instances.begin(), b.instances.end());
-			cursor += b.instances.size();
-		}
-
-		// CX^Xobt@̍쐬
-		{
-			dx3d::VertexBufferDesc desc{
-				.vertexList = instances.data(),
-				.vertexListSize = static_cast<uint32_t>(instances.size() * sizeof(dx3d::InstanceDataMain)),
-				.vertexSize = static_cast<uint32_t>(sizeof(dx3d::InstanceDataMain))
-			};
-			instance_buffer_main_ = engine_.GetGraphicsDevice().CreateVertexBuffer(desc);
-		}
+		if (!instance_ring_->Begin(static_cast<uint32_t>(sorted_instances_.size()))) { return; }
+		instance_offset_ = instance_ring_->Write(sorted_instances_.data(), static_cast<uint32_t>(sorted_instances_.size()));
+		instance_ring_->End();
 	}
 
+	/**
+	 * @brief `
+	 *	ׂ(s  ͉)ɂ܂Ƃ܂育ƂɃCX^X`悷
+	 */
 	void RenderSystem::RenderMainPass(CBLight& _lightData)
 	{
 		auto& context = engine_.GetDeferredContext();
@@ -296,40 +360,17 @@ namespace ecs {
 		cb_lighting_->Update(context, &_lightData, sizeof(_lightData));
 		context.PSSetConstantBuffer(0, *cb_lighting_); // Xbg0
 
-		// sIuWFNg̃\[g
-		std::sort(opaque_batches_.begin(), opaque_batches_.end(),
-			[](const auto& _a, const auto& _b) {
-				return _a.key < _b.key;
-			});
-		// `
-		for (auto& b : opaque_batches_) {
-			if (b.instances.empty()) { continue; }
+		if (instance_offset_ == dx3d::InstanceBufferRing::INVALID_INSTANCE) { return; }
 
-			// `
-			engine_.RenderInstanced(*b.vb, *b.ib, *instance_buffer_main_, b.instances.size(), b.instanceOffset, b.key);
-		}
+		auto& mr = engine_.GetMeshRegistry();
+		for (const auto& d : render_queue_.GetDraws()) {
+			auto meshData = mr.Get(dx3d::MeshHandle{ dx3d::RenderQueue::GetMeshId(d.key) });
+			if (!meshData || !meshData->vb || !meshData->ib) { continue; }
 
-		// IuWFNg̃\[giJ牓j
-		std::sort(transparent_batches_.begin(), transparent_batches_.end(),
-			[](const auto& _a, const auto& _b) {
-				return _a.sortKey > _b.sortKey; // ~\[g
-			});
-		for (auto& b : transparent_batches_) {
-			if (b.instances.empty()) { continue; }
 			// `
-			engine_.RenderInstanced(*b.vb, *b.ib, *instance_buffer_main_, b.instances.size(), b.instanceOffset, b.key);
+			engine_.RenderInstanced(*meshData->vb, *meshData->ib, *instance_ring_->GetBuffer(),
+				d.count, instance_offset_ + d.first, dx3d::RenderQueue::GetPipelineKey(d.key));
 		}
-
-
 	}
 
-	/**
-	 * @brief CX^Xobt@̍쐬܂̓TCY
-	 * @param _requiredInstanceCapacity KvȃCX^X
-	 */
-	void RenderSystem::CreateOrResizeInstanceBufferMain(size_t _requiredInstanceCapacity)
-	{
-		if (_requiredInstanceCapacity <= instance_buffer_capacity_) { return; }
-		instance_buffer_capacity_ = (std::max)(_requiredInstanceCapacity, instance_buffer_capacity_ * 2 + 1);
-	}
 }
\ No newline at end of file
@@ -10,23 +10,30 @@
 #include <wrl/client.h>
 #include <DX3D/Core/Core.h>
 #include <DX3D/Graphics/Buffers/InstanceData.h>
+#include <DX3D/Graphics/Buffers/InstanceBufferRing.h>
 #include <DX3D/Graphics/PipelineCache.h>
-#include <Game/ECS/ISystem.h>
+#include <DX3D/Graphics/RenderQueue.h>
+#include <Game/ECS/IRenderSystem.h>
+#include <Game/Culling/FrustumCuller.h>
+#include <Game/Culling/LightClusterBuilder.h>
 
 // ---------- O錾 ---------- //
 namespace dx3d {
 	class GraphicsEngine;
+	class JobSystem;
 }
 
 namespace ecs {
 	struct CBLight;
+	struct Camera;
+	class Query;
 
 	/**
 	 * @brief `VXe
 	 *
 	 * @detail K{G<Transform>, <Mesh>
 	 */
-	class RenderSystem : public ISystem {
+	class RenderSystem : public IRenderSystem {
 	public:
 		//! @brief RXgN^
 		explicit RenderSystem(const SystemDesc& _desc);
@@ -37,38 +44,52 @@ namespace ecs {
 
 		ID3D11ShaderResourceView* GetDepthSRV() const { return depth_srv_.Get(); }
 		ID3D11ShaderResourceView* GetSceneColorSRV() const { return scene_color_srv_.Get(); }
+
+		uint32_t GetVisibleCount() const { return frustum_culler_.GetVisibleCount(); }	// ߂̃t[ŕ`Entity̐
+		uint32_t GetCulledCount() const { return frustum_culler_.GetCulledCount(); }		// ߂̃t[Ŏ̊OEntity̐
+		const dx3d::culling::LightClusterBuilder& GetLightClusters() const { return light_clusters_; }	// ߂̃t[̃NX^Ƃ̃Cg
 	private:
-		//! @brief ob`W
-		void CollectBatches(const DirectX::XMFLOAT3& _camPos);
+		/**
+		 * @brief NX^Ƃ̃Cg̊蓖Ăƍ\obt@̍XV
+		 * @param _lightData t[̃Cg(clusterȊO͐ݒς)
+		 */
+		void BuildLightClusters(CBLight& _lightData, const Camera& _camera);
+		/**
+		 * @brief ob`W
+		 * @param _farZ [x0 ` 1ɂ鋗
+		 */
+		void CollectBatches(const DirectX::XMFLOAT3& _camPos, const DirectX::XMFLOAT4X4& _viewProj, float _farZ);
 		//! @brief ob`XV
 		void UpdateBatches();
 		//! @brief `
 		void RenderMainPass(struct CBLight& _lightData);
-		//! @brief CX^Xobt@̍쐬܂̓TCY
-		void CreateOrResizeInstanceBufferMain(size_t _requiredInstanceCapacity);
 
-		//! @brief CX^X`pob`\
-		struct InstanceBatchMain {
-			dx3d::VertexBufferPtr vb{};
-			dx3d::IndexBufferPtr ib{};
-			uint32_t indexCount{};
-			std::vector<dx3d::InstanceDataMain> instances{};
-			size_t instanceOffset = 0;
-			dx3d::PipelineKey key{};
-			float sortKey = 0.0f; // \[gpL[
-		};
 	private:
-		// ob`
-		std::vector<InstanceBatchMain> opaque_batches_{};
-		std::vector<InstanceBatchMain> transparent_batches_{};
-		// CX^Xobt@
-		std::shared_ptr<dx3d::VertexBuffer> instance_buffer_main_{};
-		size_t instance_buffer_capacity_{};
+		// `L[(L[ŕׂăCX^X`ɂ܂Ƃ߂)
+		dx3d::RenderQueue render_queue_{};
+		std::vector<dx3d::InstanceDataMain> queue_instances_{};		// ς񂾏(payload̔ԍ)
+		std::vector<dx3d::InstanceDataMain> sorted_instances_{};	// ׂ̏
+		uint32_t instance_offset_ = dx3d::InstanceBufferRing::INVALID_INSTANCE;	// sorted_instances_̐擪̃CX^Xobt@̈ʒu
+		// CX^Xobt@(t[ƂɎg)
+		std::unique_ptr<dx3d::InstanceBufferRing> instance_ring_{};
 		// 萔obt@
 		dx3d::ConstantBufferPtr cb_per_frame_{};
 		dx3d::ConstantBufferPtr cb_per_object_{};	// [ToDo] P̕`p/}eAƂHHH
 		dx3d::ConstantBufferPtr cb_light_matrix_{};
 		dx3d::ConstantBufferPtr cb_lighting_{};
+		// J̃NG
+		const Query* camera_query_ = nullptr;
+		// JO
+		dx3d::culling::FrustumCuller frustum_culler_{};
+		bool frustum_culling_ = true;	// false: S鈵(rp)
+		// NX^Pʂ̃Cg蓖
+		dx3d::JobSystem& job_system_;
+		dx3d::culling::LightClusterBuilder light_clusters_{};
+		std::vector<dx3d::culling::ClusterLight> cluster_lights_{};
+		dx3d::StructuredBufferPtr cluster_range_buffer_{};	// uint2 * NX^
+		dx3d::StructuredBufferPtr cluster_index_buffer_{};	// uint * cluster_index_capacity_
+		uint32_t cluster_index_capacity_ = 0;
+		bool clustered_lighting_ = true;	// false: SsNZőSCg(rp)
 		// [xobt@pSRV
 		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> depth_srv_;
 		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> scene_color_srv_;
@@ -87,7 +87,7 @@ namespace {
 namespace ecs {
 
 	SpriteRenderSystem::SpriteRenderSystem(const SystemDesc& _desc)
-		: ISystem(_desc)
+		: IRenderSystem(_desc)
 	{
 	}
 
@@ -99,6 +99,7 @@ namespace ecs {
 		signature.set(ecs_.GetComponentType<SpriteRenderer>());
 		ecs_.SetSystemSignature<SpriteRenderSystem>(signature);
 
+
 		auto& device = engine_.GetGraphicsDevice();
 
 		// vsXbg0
@@ -107,6 +108,9 @@ namespace ecs {
 			nullptr
 			});
 
+		instance_ring_ = std::make_unique<dx3d::InstanceBufferRing>(engine_.GetBackend(), dx3d::GraphicsQueue::Deferred,
+			static_cast<uint32_t>(sizeof(dx3d::InstanceDataSprite)), "SpriteRenderSystem");
+
 		// UIpTviLinear + Clampj
 		ID3D11Device* d3d = device.GetD3DDevice().Get();
 		if (d3d) {
@@ -142,6 +146,7 @@ namespace ecs {
 
 	void SpriteRenderSystem::Update(float _dt)
 	{
+
 		auto& context = engine_.GetDeferredContext();
 
 		// XN[
@@ -263,24 +268,14 @@ namespace ecs {
 		}
 		if (totalInstance == 0) return;
 
-		CreateOrResizeInstanceBuffer(totalInstance);
-
-		std::vector<dx3d::InstanceDataSprite> instances;
-		instances.reserve(totalInstance);
-
-		size_t cursor = 0;
+		if (!instance_ring_->Begin(static_cast<uint32_t>(totalInstance))) {
+			for (auto& b : batches_) { b.instanceOffset = dx3d::InstanceBufferRing::INVALID_INSTANCE; }
+			return;
+		}
 		for (auto& b : batches_) {
-			b.instanceOffset = cursor;
-			instances.insert(instances.end(), b.instances.begin(), b.instances.end());
-			cursor += b.instances.size();
+			b.instanceOffset = instance_ring_->Write(b.instances.data(), static_cast<uint32_t>(b.instances.size()));
 		}
-
-		dx3d::VertexBufferDesc desc{
-			.vertexList = instances.data(),
-			.vertexListSize = static_cast<uint32_t>(instances.size() * sizeof(dx3d::InstanceDataSprite)),
-			.vertexSize = static_cast<uint32_t>(sizeof(dx3d::InstanceDataSprite))
-		};
-		instance_buffer_ = engine_.GetGraphicsDevice().CreateVertexBuffer(desc);
+		instance_ring_->End();
 	}
 
 	void SpriteRenderSystem::RenderSpritePass()
@@ -296,7 +291,7 @@ namespace ecs {
 		auto& texReg = engine_.GetTextureRegistry();
 
 		for (auto& b : batches_) {
-			if (b.instances.empty()) continue;
+			if (b.instances.empty() || b.instanceOffset == dx3d::InstanceBufferRing::INVALID_INSTANCE) continue;
 
 			// eNX`擾
 			auto tex = texReg.Get(b.textureHandle);
@@ -305,7 +300,7 @@ namespace ecs {
 			ID3D11ShaderResourceView* srv = tex->srv_.Get();
 			context.PSSetShaderResources(0, 1, &srv);
 
-			engine_.RenderInstanced(*b.vb, *b.ib, *instance_buffer_, static_cast<uint32_t>(b.instances.size()), static_cast<uint32_t>(b.instanceOffset), b.pipelineKey);
+			engine_.RenderInstanced(*b.vb, *b.ib, *instance_ring_->GetBuffer(), static_cast<uint32_t>(b.instances.size()), static_cast<uint32_t>(b.instanceOffset), b.pipelineKey);
 
 			// SRVO
 			ID3D11ShaderResourceView* nullSrv = nullptr;
@@ -313,10 +308,4 @@ namespace ecs {
 		}
 	}
 
-	void SpriteRenderSystem::CreateOrResizeInstanceBuffer(size_t _requiredInstanceCapacity)
-	{
-		if (_requiredInstanceCapacity <= instance_buffer_capacity_) return;
-		instance_buffer_capacity_ = (std::max)(_requiredInstanceCapacity, instance_buffer_capacity_ * 2 + 1);
-	}
-
 }
\ No newline at end of file
@@ -9,10 +9,11 @@
  // ---------- CN[h ---------- //
 #include <wrl/client.h>
 #include <DX3D/Core/Core.h>
-#include <Game/ECS/ISystem.h>
+#include <Game/ECS/IRenderSystem.h>
 
 #include <DX3D/Graphics/PipelineCache.h>
 #include <DX3D/Graphics/Buffers/InstanceData.h>
+#include <DX3D/Graphics/Buffers/InstanceBufferRing.h>
 #include <DX3D/Graphics/Textures/TextureHandle.h>
 // ---------- O錾 ---------- //
 namespace dx3d {
@@ -30,7 +31,7 @@ namespace ecs {
 	 * - MeshRenderer.handle  Quad wziMeshRegistry𗬗pVB/IB擾j
 	 * - UIzȂ̂Őˉe(Ortho)ŕ`悷
 	 */
-	class SpriteRenderSystem : public ISystem {
+	class SpriteRenderSystem : public IRenderSystem {
 	public:
 		explicit SpriteRenderSystem(const SystemDesc& _desc);
 		void Init() override;
@@ -43,8 +44,6 @@ namespace ecs {
 		void UpdateBatches();
 		//! @brief `
 		void RenderSpritePass();
-		//! @brief CX^Xobt@̍쐬܂̓TCY
-		void CreateOrResizeInstanceBuffer(size_t _requiredInstanceCapacity);
 
 		struct InstanceBatchSprite {
 			dx3d::VertexBufferPtr vb{};
@@ -64,9 +63,8 @@ namespace ecs {
 		
 		// ob`
 		std::vector<InstanceBatchSprite> batches_{};
-		// CX^Xobt@
-		std::shared_ptr<dx3d::VertexBuffer> instance_buffer_{};
-		size_t instance_buffer_capacity_{};
+		// CX^Xobt@(t[ƂɎg)
+		std::unique_ptr<dx3d::InstanceBufferRing> instance_ring_{};
 
 		// 萔obt@
 		dx3d::ConstantBufferPtr cb_per_frame_{};
@@ -6,6 +6,7 @@
  */
 
  // ---------- CN[h ---------- // 
+#include <cmath>
 #include <Game/Systems/Scenes/TitleSceneSystem.h>
 #include <Game/ECS/Coordinator.h>
 #include <Game/Scene/SceneManager.h>
@@ -91,12 +92,12 @@ namespace ecs {
 			const float pitchAmp = XMConvertToRadians(pitchAmpDeg);
 			const float basePitch = XMConvertToRadians(basePitchDeg);
 			const float yaw = time_sec_ * yawSpeed + XMConvertToRadians(yawOffsetDeg) + phase;
-			const float pitch = basePitch + std::sinf(time_sec_ * pitchFreq + phase) * pitchAmp;
+			const float pitch = basePitch + std::sin(time_sec_ * pitchFreq + phase) * pitchAmp;
 
-			const float cy = std::cosf(yaw);
-			const float sy = std::sinf(yaw);
-			const float cp = std::cosf(pitch);
-			const float sp = std::sinf(pitch);
+			const float cy = std::cos(yaw);
+			const float sy = std::sin(yaw);
+			const float cp = std::cos(pitch);
+			const float sp = std::sin(pitch);
 
 			// ʍWxNgiY㉺j
 			DirectX::XMFLOAT3 dir{
@@ -7,6 +7,7 @@
  */
 
  // ---------- CN[h ---------- // 
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -106,6 +107,9 @@ namespace ecs
 		Signature signature;
 		signature.set(ecs_.GetComponentType<Transform>());
 		ecs_.SetSystemSignature<TransformSystem>(signature);
+
+		transform_query_ = &ecs_.GetQuery<Transform>();
+		link_query_ = &ecs_.GetQuery<Transform, ObjectChild>();
 	}
 
 	/**
@@ -114,87 +118,147 @@ namespace ecs
 	 */
 	void TransformSystem::Update(float _dt)
 	{
-		using namespace DirectX;
-
-		// K
-		std::unordered_set<Entity> visited;
-		std::unordered_set<Entity> visiting;
-
-		// [hsXVċA֐
-		std::function<void(Entity)> updateWorld = [&](Entity e)
-			{
-				if (visited.count(e)) return;
+		UpdateWorldMatrices();
+	}
 
-				if (visiting.count(e)) {
-					GameLogFError(
-						"[TransformSystem] eq֌WɃTCNoBEntity ID: {}",
-						e.id_
-					);
-					visited.insert(e);
-					return;
-				}
+	/**
+	 * @brief ŒXV
+	 *	ŒXebv̍ŌɌĂ΂̂ŁATransform̃Xebv܂łɃ[h֔f
+	 * @param _fixedDt ŒXebv
+	 */
+	void TransformSystem::FixedUpdate(float _fixedDt)
+	{
+		UpdateWorldMatrices();
+	}
 
-				visiting.insert(e);
+	/**
+	 * @brief ςm[h̃[hsvZ
+	 *	vZTransform worldVersion i߂
+	 */
+	void TransformSystem::UpdateWorldMatrices()
+	{
+		using namespace DirectX;
 
-				auto tf = ecs_.GetComponent<Transform>(e);
+		// eq֌WςĂΕג(גt[͑SvZ)
+		const bool rebuilt = IsHierarchyChanged();
+		if (rebuilt) {
+			RebuildHierarchy();
+		}
 
-				bool hasParent = false;
-				XMMATRIX parentWorld = XMMatrixIdentity();
+		const size_t count = nodes_.size();
+		transforms_.resize(count);
+		changed_.assign(count, 0);
+		uint32_t updated = 0;
+
+		// e͕KqOɂ̂ŁA擪xȂ߂ΐe̍s͌vZς
+		for (size_t i = 0; i < count; ++i) {
+			const Node& node = nodes_[i];
+			auto tf = ecs_.GetComponent<Transform>(node.e);
+			transforms_[i] = tf;
+
+			const bool hasParent = node.parent >= 0;
+			// eςĂȂΑǑʂ̂܂
+			if (!rebuilt && !tf->dirty && !tf->worldDirty && !(hasParent && changed_[node.parent])) { continue; }
+
+			XMMATRIX S = XMMatrixScaling(tf->scale.x, tf->scale.y, tf->scale.z);
+			XMMATRIX R = XMMatrixRotationQuaternion(XMLoadFloat4(&tf->rotationQuat));
+			XMMATRIX T = XMMatrixTranslation(tf->position.x, tf->position.y, tf->position.z);
+
+			XMMATRIX local = S * R * T;
+			XMMATRIX world = hasParent
+				? XMMatrixMultiply(local, XMLoadFloat4x4(&transforms_[node.parent]->world))
+				: local;
+
+			XMStoreFloat4x4(&tf->world, world);
+
+			// pLbVo
+			ExtractCacheFromMatrix(
+				tf->world,
+				tf->worldRight,
+				tf->worldUp,
+				tf->worldForward,
+				tf->worldScale
+			);
+			tf->worldRotationQuat = BasisToQuat(
+				tf->worldRight,
+				tf->worldUp,
+				tf->worldForward
+			);
 
-				// eȂɐeXV
-				if (ecs_.HasComponent<ObjectChild>(e)) {
-					const auto& child = ecs_.GetComponent<ObjectChild>(e);
-					if (child->root.IsInitialized() &&
-						ecs_.HasComponent<Transform>(child->root))
-					{
-						hasParent = true;
-						updateWorld(child->root);
+			tf->dirty = false;
+			tf->worldDirty = false;
+			++tf->worldVersion;
+			changed_[i] = 1;
+			++updated;
+		}
+		last_updated_count_ = updated;
+	}
 
-						const auto& parentTf =
-							ecs_.GetComponent<Transform>(child->root);
-						parentWorld = XMLoadFloat4x4(&parentTf->world);
-					}
-				}
+	/**
+	 * @brief גKv
+	 *	Entity̑̓NG̃o[WŁAe̕tւ(ObjectChild::root̏)͑O̒lƂ̔rŒׂ
+	 */
+	bool TransformSystem::IsHierarchyChanged() const
+	{
+		if (!hierarchy_built_) { return true; }
+		if (transform_query_->GetVersion() != transform_version_ || link_query_->GetVersion() != link_version_) { return true; }
 
-				if (tf->dirty || tf->worldDirty || hasParent) {
-					XMMATRIX S = XMMatrixScaling(tf->scale.x, tf->scale.y, tf->scale.z);
-					XMMATRIX R = XMMatrixRotationQuaternion(XMLoadFloat4(&tf->rotationQuat));
-					XMMATRIX T = XMMatrixTranslation(tf->position.x, tf->position.y, tf->position.z);
-
-					XMMATRIX local = S * R * T;
-					XMMATRIX world = hasParent
-						? XMMatrixMultiply(local, parentWorld)
-						: local;
-
-					XMStoreFloat4x4(&tf->world, world);
-
-					// pLbVo
-					ExtractCacheFromMatrix(
-						tf->world,
-						tf->worldRight,
-						tf->worldUp,
-						tf->worldForward,
-						tf->worldScale
-					);
-					tf->worldRotationQuat = BasisToQuat(
-						tf->worldRight,
-						tf->worldUp,
-						tf->worldForward
-					);
-
-					tf->dirty = false;
-					tf->worldDirty = false;
-				}
+		size_t i = 0;
+		for (auto e : *link_query_) {
+			if (ecs_.GetComponent<ObjectChild>(e)->root != links_[i].second) { return true; }
+			++i;
+		}
+		return false;
+	}
 
-				visited.insert(e);
-				visiting.erase(e);
+	/**
+	 * @brief [ɕג
+	 *	[̒łEntity̏BTCN͌Ő؂ă[gƂĈ
+	 */
+	void TransformSystem::RebuildHierarchy()
+	{
+		const auto entities = transform_query_->View();
+		const uint32_t count = static_cast<uint32_t>(entities.size());
+		auto indexOf = [&entities](Entity _e) -> int32_t {
+			auto it = std::lower_bound(entities.begin(), entities.end(), _e);
+			return (it != entities.end() && *it == _e) ? static_cast<int32_t>(it - entities.begin()) : -1;
 			};
 
+		// eIndex(Entity̏)
+		std::vector<int32_t> parentOf(count, -1);
+		links_.clear();
+		for (auto e : *link_query_) {
+			const Entity root = ecs_.GetComponent<ObjectChild>(e)->root;
+			links_.emplace_back(e, root);
+			// eTransformĂȂ΃[g
+			if (!root.IsInitialized()) { continue; }
+			const int32_t self = indexOf(e);
+			const int32_t parent = indexOf(root);
+			if (self >= 0 && parent >= 0) {
+				parentOf[self] = parent;
+			}
+		}
 
-		// SGeBeBXV
-		for (auto e : entities_) {
-			updateWorld(e);
+		// [ɕׂ(TCN͐؂ă[g)
+		order_.Build(parentOf);
+		for (uint32_t cut : order_.GetCutNodes()) {
+			GameLogFError(
+				"[TransformSystem] eq֌WɃTCNoBEntity ID: {}",
+				entities[cut].id_
+			);
 		}
+		const auto order = order_.GetOrder();
+		const auto parents = order_.GetParents();
+		nodes_.resize(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			nodes_[i].e = entities[order[i]];
+			nodes_[i].parent = parents[i];
+		}
+
+		transform_version_ = transform_query_->GetVersion();
+		link_version_ = link_query_->GetVersion();
+		hierarchy_built_ = true;
+		++rebuild_count_;
 	}
 
 
@@ -203,6 +267,7 @@ namespace ecs
 	{
 		// ImGuiEBhE쐬
 		ImGui::Begin("Transform Hierarchy");
+		ImGui::Text("Nodes: %zu / Updated: %u / Rebuilds: %u", nodes_.size(), last_updated_count_, rebuild_count_);
 
 		// e->q}bv\zƐetO
 		std::unordered_map<Entity, std::vector<Entity>> childrenMap;
@@ -8,21 +8,62 @@
 
 
  // ---------- CN[h ---------- //
+#include <vector>
 #include <Game/ECS/ISystem.h>
+#include <Game/ECS/Entity.h>
+#include <Game/Hierarchy/HierarchyOrder.h>
 
 namespace ecs {
+	struct Transform;
+	class Query;
+
 	/**
 	 * @brief TransformVXe
 	 * 
 	 * TransformR|[lg̃[hsvZ
+	 * eq֌W͐eKqOɗ悤([)ׂzŎA
+	 * ObjectChild̃NςגB
+	 * XV͔z擪xȂ߂邾ŁAύXm[hƂ̎qvZB
+	 * vZTransform worldVersion i߂̂ŁA[hLbV(RC_[̌`Ȃ)
+	 * oĂlƔׂ邾ō蒼v邩B
+	 * ̌ŒXebvɓn߁AŒXebv̍ŌɂXVsB
 	 */
 	class TransformSystem : public ISystem {
 	public:
 		TransformSystem(const SystemDesc& _desc);
 		void Init();
 		void Update(float _dt) override;
+		void FixedUpdate(float _fixedDt) override;
 
 	private:
+		/**
+		 * @brief Kw̃m[h([)
+		 */
+		struct Node {
+			Entity e{};
+			int32_t parent = -1;	// em[hIndex(-1: [g)
+		};
+
+		void UpdateWorldMatrices();			// ςm[h̃[hsvZ
+		bool IsHierarchyChanged() const;	// גKv
+		void RebuildHierarchy();			// [ɕג
 		void RenderTransformHierarchy();
+
+	private:
+		const Query* transform_query_ = nullptr;	// Transform
+		const Query* link_query_ = nullptr;			// Transform + ObjectChild
+		uint64_t transform_version_ = 0;
+		uint64_t link_version_ = 0;
+		bool hierarchy_built_ = false;
+
+		dx3d::HierarchyOrder order_{};					// [̕(mۂg)
+		std::vector<Node> nodes_{};						// [̃m[h
+		std::vector<std::pair<Entity, Entity>> links_{};	// ׂ(q, e)Blink_query_̏
+		std::vector<Transform*> transforms_{};			// Ɨp(m[hTransform)
+		std::vector<uint8_t> changed_{};				// Ɨp(̃t[Ń[hs񂪕ς)
+
+		// v
+		uint32_t last_updated_count_ = 0;
+		uint32_t rebuild_count_ = 0;
 	};
 }
\ No newline at end of file
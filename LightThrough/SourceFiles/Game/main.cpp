@@ -7,25 +7,55 @@
 
 
 /*----- CN[h -----*/
+#include <cstdlib>
+#include <cstring>
 #include <DX3D/All.h>
 #include <Debug/Debug.h>
 
 /**
  * Gg|Cg
+ *	--headless [t[]: EBhE /  / GPUȂTestScenewt[񂵂āASystemƂ̎ԂDebugLogɏo
+ *	WindowsȊO͏ɃwbhX
  */
-int main(void)
+int main(int argc, char** argv)
 {
 	DebugLogInfo("[main] Entry on main");
-#if defined(DEBUG) || defined(_DEBUG)
+#if (defined(DEBUG) || defined(_DEBUG)) && defined(_WIN32)
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif	// DEBUG || _DEBUG
 
+#ifdef _WIN32
+	bool headless = false;
+#else
+	bool headless = true;
+#endif
+	dx3d::HeadlessGameDesc headlessDesc{};
+	headlessDesc.logLevel = dx3d::Logger::LogLevel::Info;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+			if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+				headlessDesc.frames = static_cast<uint32_t>(std::atoi(argv[++i]));
+			}
+		}
+	}
+
 	try {
-		dx3d::Game game({
+		if (headless) {
+			dx3d::HeadlessGame game(headlessDesc);
+			if (game.Run() != headlessDesc.frames) { return EXIT_FAILURE; }
+		}
+#ifdef _WIN32
+		else {
+			dx3d::GameDesc desc{
 				{1920, 1080},					// EBhETCY
-				dx3d::Logger::LogLevel::Info	// O
-			});
-		game.Run();	// Q[s
+				dx3d::Logger::LogLevel::Info,	// O
+				dx3d::ShadowTestBackend::Gpu	// e
+			};
+			dx3d::Game game(desc);
+			game.Run();	// Q[s
+		}
+#endif
 	}
 	catch (const nlohmann::json::exception& _e) {
 		DebugLogError("[main] json exception: {}", _e.what());
@@ -42,4 +72,4 @@ int main(void)
 
 	DebugLogInfo("[main] normal exit\n");
 	return EXIT_SUCCESS;
-}
\ No newline at end of file
+}